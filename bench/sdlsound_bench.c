@@ -0,0 +1,560 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/**
+ * Decode throughput and seek latency benchmark.
+ *
+ * Give it audio files and/or directories full of them. Each file is opened,
+ *  decoded start to finish, and then seeked to a handful of (repeatable)
+ *  random spots, once as-is and once converted to a typical output format.
+ *  Results go to stdout as CSV: one "file" row per file and pass, and one
+ *  "decoder" row per decoder and pass with the totals, so runs against
+ *  different SDL_sound builds can be diffed or fed to a spreadsheet.
+ *
+ * Times are milliseconds, throughput is megabytes of decoded audio per
+ *  second, and "realtime" is how many times faster than playback the
+ *  decoding went. Peak memory is the most the process had allocated through
+ *  SDL while the file was open, over what it had going in.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "SDL.h"
+#include "SDL_sound.h"
+
+#define BENCH_MAX_DECODERS 64
+#define BENCH_DEFAULT_SEEKS 16
+#define BENCH_DEFAULT_BUFSIZE (16 * 1024)
+
+typedef enum
+{
+    PASS_NATIVE = 1 << 0,  /* decode in the file's own format. */
+    PASS_CONVERT = 1 << 1  /* decode to 48kHz stereo float. */
+} BenchPass;
+
+typedef struct
+{
+    double open_ms;
+    double decode_ms;
+    double seek_ms;       /* total of all seeks. */
+    double seek_max_ms;
+    Uint64 pcm_bytes;
+    double audio_secs;    /* playback time of what was decoded. */
+    Uint32 seeks;
+    Uint64 peak_bytes;
+    Sound_Stats stats;    /* only if the library has stats to give. */
+    Uint32 files;
+} BenchResult;
+
+typedef struct
+{
+    const Sound_DecoderInfo *info;
+    BenchResult result[2];  /* one for each BenchPass. */
+} BenchDecoder;
+
+static BenchDecoder bench_decoders[BENCH_MAX_DECODERS];
+static int bench_decoder_count = 0;
+static Uint32 bench_seeks = BENCH_DEFAULT_SEEKS;
+static Uint32 bench_bufsize = BENCH_DEFAULT_BUFSIZE;
+static int bench_passes = PASS_NATIVE | PASS_CONVERT;
+static int bench_failures = 0;
+
+
+/*
+ * Memory tracking. Every allocation SDL and SDL_sound make goes through
+ *  these, with its size tucked in front of it, so we know how much is live.
+ *  This needs SDL 2.0.7's SDL_SetMemoryFunctions(); without it, peak memory
+ *  is always reported as zero.
+ */
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+#define BENCH_MEMHDR 16  /* keeps the caller's pointer well-aligned. */
+
+static SDL_malloc_func real_malloc = NULL;
+static SDL_calloc_func real_calloc = NULL;
+static SDL_realloc_func real_realloc = NULL;
+static SDL_free_func real_free = NULL;
+static SDL_SpinLock mem_lock = 0;
+static Uint64 mem_current = 0;
+static Uint64 mem_peak = 0;
+
+static void mem_adjust(Sint64 delta)
+{
+    SDL_AtomicLock(&mem_lock);
+    mem_current += delta;
+    if (mem_current > mem_peak)
+        mem_peak = mem_current;
+    SDL_AtomicUnlock(&mem_lock);
+} /* mem_adjust */
+
+static void *tag_block(Uint8 *block, size_t size)
+{
+    if (block == NULL)
+        return NULL;
+    *((size_t *) block) = size;
+    mem_adjust((Sint64) size);
+    return block + BENCH_MEMHDR;
+} /* tag_block */
+
+static void * SDLCALL bench_malloc(size_t size)
+{
+    return tag_block((Uint8 *) real_malloc(size + BENCH_MEMHDR), size);
+} /* bench_malloc */
+
+static void * SDLCALL bench_calloc(size_t nmemb, size_t size)
+{
+    const size_t total = nmemb * size;
+    return tag_block((Uint8 *) real_calloc(1, total + BENCH_MEMHDR), total);
+} /* bench_calloc */
+
+static void * SDLCALL bench_realloc(void *mem, size_t size)
+{
+    Uint8 *block = (mem == NULL) ? NULL : (((Uint8 *) mem) - BENCH_MEMHDR);
+    const size_t oldsize = (block == NULL) ? 0 : *((size_t *) block);
+    Uint8 *ptr = (Uint8 *) real_realloc(block, size + BENCH_MEMHDR);
+    if (ptr == NULL)
+        return NULL;
+    mem_adjust(-((Sint64) oldsize));
+    return tag_block(ptr, size);
+} /* bench_realloc */
+
+static void SDLCALL bench_free(void *mem)
+{
+    if (mem != NULL)
+    {
+        Uint8 *block = ((Uint8 *) mem) - BENCH_MEMHDR;
+        mem_adjust(-((Sint64) *((size_t *) block)));
+        real_free(block);
+    } /* if */
+} /* bench_free */
+
+static void mem_init(void)
+{
+    SDL_GetMemoryFunctions(&real_malloc, &real_calloc, &real_realloc, &real_free);
+    SDL_SetMemoryFunctions(bench_malloc, bench_calloc, bench_realloc, bench_free);
+} /* mem_init */
+
+/* Start a new peak; returns what's allocated right now. */
+static Uint64 mem_reset_peak(void)
+{
+    Uint64 retval;
+    SDL_AtomicLock(&mem_lock);
+    retval = mem_peak = mem_current;
+    SDL_AtomicUnlock(&mem_lock);
+    return retval;
+} /* mem_reset_peak */
+
+static Uint64 mem_get_peak(void)
+{
+    Uint64 retval;
+    SDL_AtomicLock(&mem_lock);
+    retval = mem_peak;
+    SDL_AtomicUnlock(&mem_lock);
+    return retval;
+} /* mem_get_peak */
+#else
+#define mem_init()
+#define mem_reset_peak() (0)
+#define mem_get_peak() (0)
+#endif
+
+
+static double ms_since(Uint64 start)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    return ((double) (now - start) * 1000.0) / ((double) SDL_GetPerformanceFrequency());
+} /* ms_since */
+
+
+/* Tiny LCG, so every run seeks to the same spots. */
+static Uint32 bench_random(Uint32 *state)
+{
+    *state = (*state * 1103515245) + 12345;
+    return (*state >> 8);
+} /* bench_random */
+
+
+static BenchDecoder *find_decoder(const Sound_DecoderInfo *info)
+{
+    int i;
+
+    for (i = 0; i < bench_decoder_count; i++)
+    {
+        if (bench_decoders[i].info == info)
+            return &bench_decoders[i];
+    } /* for */
+
+    if (bench_decoder_count == BENCH_MAX_DECODERS)
+        return NULL;
+
+    i = bench_decoder_count++;
+    SDL_memset(&bench_decoders[i], '\0', sizeof (BenchDecoder));
+    bench_decoders[i].info = info;
+    return &bench_decoders[i];
+} /* find_decoder */
+
+
+static void add_result(BenchResult *dst, const BenchResult *src)
+{
+    dst->open_ms += src->open_ms;
+    dst->decode_ms += src->decode_ms;
+    dst->seek_ms += src->seek_ms;
+    if (src->seek_max_ms > dst->seek_max_ms)
+        dst->seek_max_ms = src->seek_max_ms;
+    dst->pcm_bytes += src->pcm_bytes;
+    dst->audio_secs += src->audio_secs;
+    dst->seeks += src->seeks;
+    if (src->peak_bytes > dst->peak_bytes)
+        dst->peak_bytes = src->peak_bytes;
+    dst->stats.encoded_bytes += src->stats.encoded_bytes;
+    dst->stats.decode_ns += src->stats.decode_ns;
+    dst->stats.convert_ns += src->stats.convert_ns;
+    dst->stats.io_ns += src->stats.io_ns;
+    dst->stats.rw_reads += src->stats.rw_reads;
+    dst->stats.rw_seeks += src->stats.rw_seeks;
+    dst->files += src->files;
+} /* add_result */
+
+
+static void print_header(void)
+{
+    printf("kind,name,pass,files,open_ms,decode_ms,decode_mbps,realtime,"
+           "seeks,seek_avg_ms,seek_max_ms,peak_bytes,pcm_bytes,"
+           "encoded_bytes,rw_reads,rw_seeks,decoder_ms,convert_ms,io_ms\n");
+} /* print_header */
+
+
+static void print_result(const char *kind, const char *name,
+                         BenchPass pass, const BenchResult *r)
+{
+    const double secs = r->decode_ms / 1000.0;
+    const double mbps = (secs > 0.0) ? ((r->pcm_bytes / (1024.0 * 1024.0)) / secs) : 0.0;
+    const double realtime = (secs > 0.0) ? (r->audio_secs / secs) : 0.0;
+    const double seek_avg = (r->seeks > 0) ? (r->seek_ms / r->seeks) : 0.0;
+    const char *p;
+
+    /* names are file paths; quote them in case of commas. */
+    printf("%s,\"", kind);
+    for (p = name; *p; p++)
+    {
+        if (*p == '"')
+            putchar('"');
+        putchar(*p);
+    } /* for */
+    printf("\",%s,%u,%.3f,%.3f,%.3f,%.2f,%u,%.4f,%.4f,%llu,%llu,%llu,%u,%u,%.3f,%.3f,%.3f\n",
+           (pass == PASS_NATIVE) ? "native" : "convert",
+           (unsigned int) r->files, r->open_ms, r->decode_ms, mbps, realtime,
+           (unsigned int) r->seeks, seek_avg, r->seek_max_ms,
+           (unsigned long long) r->peak_bytes,
+           (unsigned long long) r->pcm_bytes,
+           (unsigned long long) r->stats.encoded_bytes,
+           (unsigned int) r->stats.rw_reads, (unsigned int) r->stats.rw_seeks,
+           r->stats.decode_ns / 1000000.0, r->stats.convert_ns / 1000000.0,
+           r->stats.io_ns / 1000000.0);
+} /* print_result */
+
+
+static void bench_file(const char *fname, BenchPass pass)
+{
+    Sound_AudioInfo convert;
+    Sound_AudioInfo *desired = NULL;
+    BenchResult r;
+    BenchDecoder *decoder;
+    Sound_Sample *sample;
+    Uint64 base, start;
+    Uint32 framesize;
+    Uint32 seed = 0x5EEDu;
+    Sint32 duration;
+    Uint32 i;
+
+    if (pass == PASS_CONVERT)
+    {
+        convert.format = AUDIO_F32SYS;
+        convert.channels = 2;
+        convert.rate = 48000;
+        desired = &convert;
+    } /* if */
+
+    SDL_memset(&r, '\0', sizeof (r));
+    r.files = 1;
+    base = mem_reset_peak();
+
+    start = SDL_GetPerformanceCounter();
+    sample = Sound_NewSampleFromFile(fname, desired, bench_bufsize);
+    r.open_ms = ms_since(start);
+    if (sample == NULL)
+    {
+        fprintf(stderr, "sdlsound_bench: couldn't open '%s': %s\n",
+                fname, Sound_GetError());
+        bench_failures++;
+        return;
+    } /* if */
+
+    start = SDL_GetPerformanceCounter();
+    while ((sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR)) == 0)
+        r.pcm_bytes += Sound_Decode(sample);
+    r.decode_ms = ms_since(start);
+
+    if (sample->flags & SOUND_SAMPLEFLAG_ERROR)
+    {
+        fprintf(stderr, "sdlsound_bench: error decoding '%s': %s\n",
+                fname, Sound_GetError());
+        bench_failures++;
+    } /* if */
+
+    framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8) * sample->desired.channels;
+    if ((framesize > 0) && (sample->desired.rate > 0))
+        r.audio_secs = ((double) (r.pcm_bytes / framesize)) / sample->desired.rate;
+
+    duration = Sound_GetDuration(sample);
+    if ((sample->flags & SOUND_SAMPLEFLAG_CANSEEK) && (duration > 0))
+    {
+        for (i = 0; i < bench_seeks; i++)
+        {
+            const Uint32 ms = bench_random(&seed) % ((Uint32) duration);
+            double elapsed;
+            start = SDL_GetPerformanceCounter();
+            if (!Sound_Seek(sample, ms))
+                break;
+            elapsed = ms_since(start);
+            r.seek_ms += elapsed;
+            if (elapsed > r.seek_max_ms)
+                r.seek_max_ms = elapsed;
+            r.seeks++;
+        } /* for */
+    } /* if */
+
+    Sound_GetStats(sample, &r.stats);  /* just leaves zeros if it can't. */
+    r.peak_bytes = mem_get_peak() - base;
+
+    print_result("file", fname, pass, &r);
+
+    decoder = find_decoder(sample->decoder);
+    if (decoder != NULL)
+        add_result(&decoder->result[(pass == PASS_NATIVE) ? 0 : 1], &r);
+
+    Sound_FreeSample(sample);
+} /* bench_file */
+
+
+static void bench_path(const char *path);
+
+#if defined(_WIN32)
+static void bench_directory(const char *dname)
+{
+    WIN32_FIND_DATAA ent;
+    HANDLE dir;
+    char *spec = (char *) SDL_malloc(SDL_strlen(dname) + 3);
+
+    if (spec == NULL)
+        return;
+    SDL_snprintf(spec, SDL_strlen(dname) + 3, "%s\\*", dname);
+    dir = FindFirstFileA(spec, &ent);
+    SDL_free(spec);
+    if (dir == INVALID_HANDLE_VALUE)
+        return;
+
+    do
+    {
+        if ((SDL_strcmp(ent.cFileName, ".") != 0) && (SDL_strcmp(ent.cFileName, "..") != 0))
+        {
+            const size_t len = SDL_strlen(dname) + SDL_strlen(ent.cFileName) + 2;
+            char *full = (char *) SDL_malloc(len);
+            if (full != NULL)
+            {
+                SDL_snprintf(full, len, "%s\\%s", dname, ent.cFileName);
+                bench_path(full);
+                SDL_free(full);
+            } /* if */
+        } /* if */
+    } while (FindNextFileA(dir, &ent));
+
+    FindClose(dir);
+} /* bench_directory */
+
+static int is_directory(const char *path)
+{
+    const DWORD attr = GetFileAttributesA(path);
+    return ((attr != INVALID_FILE_ATTRIBUTES) && (attr & FILE_ATTRIBUTE_DIRECTORY));
+} /* is_directory */
+
+#else
+static int compare_names(const void *a, const void *b)
+{
+    return SDL_strcmp(*((char * const *) a), *((char * const *) b));
+} /* compare_names */
+
+static void bench_directory(const char *dname)
+{
+    DIR *dir = opendir(dname);
+    struct dirent *ent;
+    char **names = NULL;
+    size_t count = 0;
+    size_t i;
+
+    if (dir == NULL)
+        return;
+
+    /* sort them, so every run goes through the corpus in the same order. */
+    while ((ent = readdir(dir)) != NULL)
+    {
+        const size_t len = SDL_strlen(dname) + SDL_strlen(ent->d_name) + 2;
+        char **ptr;
+        char *full;
+
+        if ((SDL_strcmp(ent->d_name, ".") == 0) || (SDL_strcmp(ent->d_name, "..") == 0))
+            continue;
+
+        full = (char *) SDL_malloc(len);
+        ptr = (char **) SDL_realloc(names, (count + 1) * sizeof (char *));
+        if ((full == NULL) || (ptr == NULL))
+        {
+            SDL_free(full);
+            if (ptr != NULL)
+                names = ptr;
+            break;
+        } /* if */
+
+        names = ptr;
+        SDL_snprintf(full, len, "%s/%s", dname, ent->d_name);
+        names[count++] = full;
+    } /* while */
+
+    closedir(dir);
+
+    if (count > 0)
+        qsort(names, count, sizeof (char *), compare_names);
+
+    for (i = 0; i < count; i++)
+    {
+        bench_path(names[i]);
+        SDL_free(names[i]);
+    } /* for */
+    SDL_free(names);
+} /* bench_directory */
+
+static int is_directory(const char *path)
+{
+    struct stat statbuf;
+    return ((stat(path, &statbuf) == 0) && (S_ISDIR(statbuf.st_mode)));
+} /* is_directory */
+#endif
+
+
+static void bench_path(const char *path)
+{
+    if (is_directory(path))
+        bench_directory(path);
+    else
+    {
+        if (bench_passes & PASS_NATIVE)
+            bench_file(path, PASS_NATIVE);
+        if (bench_passes & PASS_CONVERT)
+            bench_file(path, PASS_CONVERT);
+    } /* else */
+} /* bench_path */
+
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+        "USAGE: %s [options] <file|directory> [more files or directories ...]\n"
+        "\n"
+        "     --native         Only decode in each file's own format.\n"
+        "     --convert        Only decode converted to 48kHz stereo float.\n"
+        "     --seeks n        Random seeks per file (default %d).\n"
+        "     --buffer n       Decode buffer size in bytes (default %d).\n"
+        "     --help           Show this.\n"
+        "\n"
+        "Results are written to stdout as CSV; errors go to stderr.\n"
+        "\n",
+        argv0, BENCH_DEFAULT_SEEKS, BENCH_DEFAULT_BUFSIZE);
+} /* usage */
+
+
+int main(int argc, char **argv)
+{
+    int paths = 0;
+    int i;
+
+    mem_init();  /* before anything allocates! */
+
+    for (i = 1; i < argc; i++)
+    {
+        if (SDL_strcmp(argv[i], "--native") == 0)
+            bench_passes = PASS_NATIVE;
+        else if (SDL_strcmp(argv[i], "--convert") == 0)
+            bench_passes = PASS_CONVERT;
+        else if ((SDL_strcmp(argv[i], "--seeks") == 0) && (i + 1 < argc))
+            bench_seeks = (Uint32) SDL_atoi(argv[++i]);
+        else if ((SDL_strcmp(argv[i], "--buffer") == 0) && (i + 1 < argc))
+            bench_bufsize = (Uint32) SDL_atoi(argv[++i]);
+        else if ((SDL_strcmp(argv[i], "--help") == 0) || (argv[i][0] == '-'))
+        {
+            usage(argv[0]);
+            return 1;
+        } /* else if */
+        else
+            paths++;
+    } /* for */
+
+    if ((paths == 0) || (bench_bufsize == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    } /* if */
+
+    if (SDL_Init(0) == -1)
+    {
+        fprintf(stderr, "sdlsound_bench: SDL_Init() failed: %s\n", SDL_GetError());
+        return 42;
+    } /* if */
+
+    if (!Sound_Init())
+    {
+        fprintf(stderr, "sdlsound_bench: Sound_Init() failed: %s\n", Sound_GetError());
+        SDL_Quit();
+        return 42;
+    } /* if */
+
+    Sound_EnableStats(1);
+    print_header();
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((SDL_strcmp(argv[i], "--seeks") == 0) || (SDL_strcmp(argv[i], "--buffer") == 0))
+            i++;  /* skip the option's argument. */
+        else if (argv[i][0] != '-')
+            bench_path(argv[i]);
+    } /* for */
+
+    for (i = 0; i < bench_decoder_count; i++)
+    {
+        const BenchDecoder *d = &bench_decoders[i];
+        const char *name = d->info->extensions[0];
+        if (d->result[0].files > 0)
+            print_result("decoder", name, PASS_NATIVE, &d->result[0]);
+        if (d->result[1].files > 0)
+            print_result("decoder", name, PASS_CONVERT, &d->result[1]);
+    } /* for */
+
+    Sound_Quit();
+    SDL_Quit();
+    return (bench_failures > 0) ? 2 : 0;
+} /* main */
+
+/* end of sdlsound_bench.c ... */
@@ -23,6 +23,10 @@
 
 #define DEFAULT_DECODEBUF 16384
 #define DEFAULT_AUDIOBUF  4096
+#define DEFAULT_PREFETCH  200
+
+/* SDL_QueueAudio() showed up in SDL 2.0.4. */
+#define HAVE_QUEUEAUDIO SDL_VERSION_ATLEAST(2, 0, 4)
 
 #define PLAYSOUND_VER_MAJOR  1
 #define PLAYSOUND_VER_MINOR  9
@@ -36,6 +40,8 @@ static const char *option_list[] =
     "--channels",  "n   Playback on n channels (1 or 2).",
     "--decodebuf", "n  Buffer n decoded bytes at a time (default 16384).",
     "--audiobuf",  "n   Buffer n samples to audio device (default 4096).",
+    "--queue",     "      Decode on its own thread and queue audio to device.",
+    "--prefetch",  "n   With --queue, keep n ms of audio queued (default 200).",
     "--volume",    "n     Playback volume multiplier (default 1.0).",
     "--stdin",     "[ext]  Read from stdin (treat data as format [ext])",
     "--version",   "     Display version information and exit.",
@@ -203,6 +209,10 @@ typedef struct
     Uint32 *seek_list;
     Uint32 seek_index;
     Sint32 bytes_before_next_seek;
+    int queue;                /* decode on a thread, SDL_QueueAudio() it. */
+    Uint64 period_ticks;      /* one device buffer's worth of time. */
+    Uint64 slowest_fill;      /* longest time fill_audio_buffer() took. */
+    Uint32 underruns;         /* times the device ran out of audio. */
 } playsound_global_state;
 
 static volatile playsound_global_state global_state;
@@ -459,22 +469,23 @@ static void memcpy_with_volume(Sound_Sample *sample,
 } /* memcpy_with_volume */
 
 
-static void audio_callback(void *userdata, Uint8 *stream, int len)
+/*
+ * Decode up to (len) bytes into (stream), and return how many we got. Less
+ *  than (len) means there isn't any more data to read. This also keeps
+ *  track of the slowest call, for the report at the end.
+ */
+static int fill_audio_buffer(Sound_Sample *sample, Uint8 *stream, int len)
 {
-    Sound_Sample *sample = (Sound_Sample *) userdata;
-    int bw = 0; /* bytes written to stream this time through the callback */
+    const Uint64 start = SDL_GetPerformanceCounter();
+    int bw = 0; /* bytes written to stream this time through. */
+    Uint64 elapsed;
 
     while (bw < len)
     {
         int cpysize;  /* bytes to copy on this iteration of the loop. */
 
         if (!read_more_data(sample)) /* read more data, if needed. */
-        {
-            /* ...there isn't any more data to read! */
-            SDL_memset(stream + bw, '\0', len - bw);
-            done_flag = 1;
-            return;
-        } /* if */
+            break;  /* ...there isn't any more data to read! */
 
         /* decoded_bytes and decoder_ptr are updated as necessary... */
 
@@ -495,9 +506,107 @@ static void audio_callback(void *userdata, Uint8 *stream, int len)
                 global_state.bytes_before_next_seek -= cpysize;
         } /* if */
     } /* while */
+
+    elapsed = SDL_GetPerformanceCounter() - start;
+    if (elapsed > global_state.slowest_fill)
+        global_state.slowest_fill = elapsed;
+
+    return(bw);
+} /* fill_audio_buffer */
+
+
+static void audio_callback(void *userdata, Uint8 *stream, int len)
+{
+    Sound_Sample *sample = (Sound_Sample *) userdata;
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const int bw = fill_audio_buffer(sample, stream, len);
+
+    /*
+     * Decoding right here in the audio thread, so if that took longer than
+     *  the buffer lasts, the device went hungry while we worked.
+     */
+    if (SDL_GetPerformanceCounter() - start > global_state.period_ticks)
+        global_state.underruns++;
+
+    if (bw < len)
+    {
+        SDL_memset(stream + bw, '\0', len - bw);
+        done_flag = 1;
+    } /* if */
 } /* audio_callback */
 
 
+#if HAVE_QUEUEAUDIO
+typedef struct
+{
+    Sound_Sample *sample;
+    Uint32 chunk_bytes;     /* decode this much at a time... */
+    Uint32 prefetch_bytes;  /* ...until the device has this much queued. */
+} decode_thread_args;
+
+/*
+ * The --queue mode: keep the device's queue topped up from here, so how
+ *  long a decode takes never holds up the audio thread. An empty queue
+ *  before we've run out of data is an underrun.
+ */
+static int SDLCALL decode_thread(void *data)
+{
+    const decode_thread_args *args = (const decode_thread_args *) data;
+    Uint8 *buf = (Uint8 *) SDL_malloc(args->chunk_bytes);
+    int started = 0;
+    int starved = 0;
+    int finished = 0;
+
+    if (buf == NULL)
+    {
+        fprintf(stderr, "Out of memory for decode thread!\n");
+        done_flag = 1;
+        return(0);
+    } /* if */
+
+    while (!done_flag)
+    {
+        const Uint32 queued = SDL_GetQueuedAudioSize(1);
+
+        if (queued == 0)
+        {
+            if (finished)
+                done_flag = 1;  /* played everything we had. */
+            else if ((started) && (!starved))
+                global_state.underruns++;
+            starved = 1;
+        } /* if */
+
+        if ((finished) || (queued >= args->prefetch_bytes))
+        {
+            SDL_Delay(1);
+            continue;
+        } /* if */
+
+        {
+            const int bw = fill_audio_buffer(args->sample, buf,
+                                             (int) args->chunk_bytes);
+            if ((bw > 0) && (SDL_QueueAudio(1, buf, (Uint32) bw) < 0))
+            {
+                fprintf(stderr, "SDL_QueueAudio() failed!\n"
+                                "  reason: [%s].\n", SDL_GetError());
+                done_flag = 1;
+            } /* if */
+
+            if (bw > 0)
+                started = 1;
+            starved = 0;
+            if (bw < (int) args->chunk_bytes)
+                finished = 1;
+        } /* block */
+    } /* while */
+
+    SDL_free(buf);
+    return(0);
+} /* decode_thread */
+#endif
+
+
 static int count_seek_list(const char *list)
 {
     const char *ptr;
@@ -690,6 +799,7 @@ int main(int argc, char **argv)
     SDL_AudioSpec sdl_desired;
     Uint32 audio_buffersize;
     Uint32 decode_buffersize;
+    Uint32 prefetch_ms;
     Sound_Sample *sample;
     int use_specific_audiofmt = 0;
     int i;
@@ -697,6 +807,11 @@ int main(int argc, char **argv)
     int new_sample = 1;
     Uint32 sdl_init_flags = SDL_INIT_AUDIO;
 
+    #if HAVE_QUEUEAUDIO
+    decode_thread_args thread_args;
+    SDL_Thread *decoder = NULL;
+    #endif
+
     #if ENABLE_EVENTS
     SDL_Surface *screen = NULL;
     SDL_Event event;
@@ -792,6 +907,7 @@ int main(int argc, char **argv)
             global_state.bytes_before_next_seek = -1;
             audio_buffersize = DEFAULT_AUDIOBUF;
             decode_buffersize = DEFAULT_DECODEBUF;
+            prefetch_ms = DEFAULT_PREFETCH;
             new_sample = 0;
         } /* if */
 
@@ -841,6 +957,20 @@ int main(int argc, char **argv)
             decode_buffersize = SDL_atoi(argv[++i]);
         } /* else if */
 
+        else if (SDL_strcmp(argv[i], "--queue") == 0)
+        {
+            #if HAVE_QUEUEAUDIO
+                global_state.queue = 1;
+            #else
+                fprintf(stderr, "--queue needs SDL 2.0.4 or later; ignoring it.\n");
+            #endif
+        } /* else if */
+
+        else if (SDL_strcmp(argv[i], "--prefetch") == 0 && argc > i + 1)
+        {
+            prefetch_ms = SDL_atoi(argv[++i]);
+        } /* else if */
+
         else if (SDL_strcmp(argv[i], "--volume") == 0 && argc > i + 1)
         {
             global_state.volume = SDL_atof(argv[++i]);
@@ -931,7 +1061,7 @@ int main(int argc, char **argv)
         } /* else */
 
         sdl_desired.samples = audio_buffersize;
-        sdl_desired.callback = audio_callback;
+        sdl_desired.callback = global_state.queue ? NULL : audio_callback;
         sdl_desired.userdata = sample;
 
         /* grr, SDL_CloseAudio() calls SDL_QuitSubSystem internally. */
@@ -978,9 +1108,41 @@ int main(int argc, char **argv)
             } /* else */
         } /* if */
 
+        global_state.period_ticks = (SDL_GetPerformanceFrequency() *
+                                     sdl_desired.samples) / sdl_desired.freq;
+
+        #if HAVE_QUEUEAUDIO
+        if (global_state.queue)
+        {
+            const Uint32 framesize = (SDL_AUDIO_BITSIZE(sdl_desired.format) / 8) *
+                                     sdl_desired.channels;
+            thread_args.sample = sample;
+            thread_args.chunk_bytes = sdl_desired.samples * framesize;
+            thread_args.prefetch_bytes = (Uint32) ((((Uint64) prefetch_ms) *
+                                          sdl_desired.freq) / 1000) * framesize;
+            if (thread_args.prefetch_bytes < thread_args.chunk_bytes)
+                thread_args.prefetch_bytes = thread_args.chunk_bytes;
+        } /* if */
+        #endif
+
+        done_flag = 0;  /* the audio callback or decode thread flips this. */
+
+        #if HAVE_QUEUEAUDIO
+        if (global_state.queue)
+        {
+            decoder = SDL_CreateThread(decode_thread, "playsound decoder",
+                                       &thread_args);
+            if (decoder == NULL)
+            {
+                fprintf(stderr, "Couldn't start decode thread!\n"
+                                "  reason: [%s].\n", SDL_GetError());
+                done_flag = 1;
+            } /* if */
+        } /* if */
+        #endif
+
         SDL_PauseAudio(0);
 
-        done_flag = 0;  /* the audio callback will flip this flag. */
         while (!done_flag)
         {
             #if ENABLE_EVENTS
@@ -992,6 +1154,14 @@ int main(int argc, char **argv)
             SDL_Delay(10);
         } /* while */
 
+        #if HAVE_QUEUEAUDIO
+        if (decoder != NULL)
+        {
+            SDL_WaitThread(decoder, NULL);
+            decoder = NULL;
+        } /* if */
+        #endif
+
         SDL_PauseAudio(1);
 
             /*
@@ -1002,6 +1172,15 @@ int main(int argc, char **argv)
         delay = 2 * 1000 * sdl_desired.samples / sdl_desired.freq;
         SDL_Delay(delay);
 
+        fprintf(stdout, "  %s: %u underrun%s, slowest decode %.2fms"
+                        " (device buffer is %.2fms).\n",
+                global_state.queue ? "queued" : "callback",
+                (unsigned int) global_state.underruns,
+                (global_state.underruns == 1) ? "" : "s",
+                (double) global_state.slowest_fill * 1000.0 /
+                    (double) SDL_GetPerformanceFrequency(),
+                1000.0 * sdl_desired.samples / sdl_desired.freq);
+
         SDL_CloseAudio();  /* reopen with next sample's format if possible */
         Sound_FreeSample(sample);
 
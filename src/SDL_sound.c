@@ -32,49 +32,60 @@ extern const Sound_DecoderFunctions __Sound_DecoderFunctions_FLAC;
 extern const Sound_DecoderFunctions __Sound_DecoderFunctions_QuickTime;
 extern const Sound_DecoderFunctions __Sound_DecoderFunctions_CoreAudio;
 
+/*
+ * Decoders are initialized the first time something needs them, not in
+ *  Sound_Init(), so a program that only ever plays WAVs doesn't pay for
+ *  ModPlug's or CoreAudio's setup. (state) is one of the DECODER_* values;
+ *  it only moves away from DECODER_UNINITIALIZED with decoder_mutex held.
+ */
+#define DECODER_UNINITIALIZED 0
+#define DECODER_AVAILABLE 1
+#define DECODER_FAILED 2
+
 typedef struct
 {
-    int available;
+    SDL_atomic_t state;
     const Sound_DecoderFunctions *funcs;
+    Sound_Stats totals;  /* freed samples; guarded by stats_mutex. */
 } decoder_element;
 
 static decoder_element decoders[] =
 {
 #if SOUND_SUPPORTS_MODPLUG
-    { 0, &__Sound_DecoderFunctions_MODPLUG },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_MODPLUG, { 0 } },
 #endif
 #if SOUND_SUPPORTS_MP3
-    { 0, &__Sound_DecoderFunctions_MP3 },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_MP3, { 0 } },
 #endif
 #if SOUND_SUPPORTS_WAV
-    { 0, &__Sound_DecoderFunctions_WAV },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_WAV, { 0 } },
 #endif
 #if SOUND_SUPPORTS_AIFF
-    { 0, &__Sound_DecoderFunctions_AIFF },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_AIFF, { 0 } },
 #endif
 #if SOUND_SUPPORTS_AU
-    { 0, &__Sound_DecoderFunctions_AU },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_AU, { 0 } },
 #endif
 #if SOUND_SUPPORTS_VORBIS
-    { 0, &__Sound_DecoderFunctions_VORBIS },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_VORBIS, { 0 } },
 #endif
 #if SOUND_SUPPORTS_VOC
-    { 0, &__Sound_DecoderFunctions_VOC },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_VOC, { 0 } },
 #endif
 #if SOUND_SUPPORTS_RAW
-    { 0, &__Sound_DecoderFunctions_RAW },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_RAW, { 0 } },
 #endif
 #if SOUND_SUPPORTS_SHN
-    { 0, &__Sound_DecoderFunctions_SHN },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_SHN, { 0 } },
 #endif
 #if SOUND_SUPPORTS_FLAC
-    { 0, &__Sound_DecoderFunctions_FLAC },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_FLAC, { 0 } },
 #endif
 #if SOUND_SUPPORTS_COREAUDIO
-    { 0, &__Sound_DecoderFunctions_CoreAudio },
+    { { DECODER_UNINITIALIZED }, &__Sound_DecoderFunctions_CoreAudio, { 0 } },
 #endif
 
-    { 0, NULL }
+    { { DECODER_UNINITIALIZED }, NULL, { 0 } }
 };
 
 
@@ -83,20 +94,92 @@ static decoder_element decoders[] =
 
 typedef struct __SOUND_ERRMSGTYPE__
 {
-    Uint32 tid;
     int error_available;
     char error_string[128];
-    struct __SOUND_ERRMSGTYPE__ *next;
 } ErrMsg;
 
-static ErrMsg *error_msgs = NULL;
-static SDL_mutex *errorlist_mutex = NULL;
+/*
+ * Each thread gets its own ErrMsg in thread-local storage, so setting an
+ *  error never takes a lock, and SDL frees it when the thread goes away.
+ */
+static SDL_TLSID error_tls = 0;
+
+/*
+ * Every open Sound_Sample is on one of these linked lists, so Sound_Quit()
+ *  can free the ones the app didn't. Each list has its own lock, and a new
+ *  sample goes on the list its creating thread hashes to, so loader threads
+ *  making and freeing samples in parallel don't all wait on one mutex. The
+ *  padding keeps each list on its own cache line.
+ */
+#define SAMPLELIST_SHARDS 16
+
+typedef struct
+{
+    SDL_mutex *mutex;
+    Sound_Sample *head;
+    Uint8 pad[64 - sizeof (SDL_mutex *) - sizeof (Sound_Sample *)];
+} SampleListShard;
 
-static Sound_Sample *sample_list = NULL;  /* this is a linked list. */
-static SDL_mutex *samplelist_mutex = NULL;
+static SampleListShard sample_lists[SAMPLELIST_SHARDS];
+static SDL_mutex *stats_mutex = NULL;  /* guards decoder_element totals. */
+static SDL_mutex *decoder_mutex = NULL;
+static SDL_mutex *batch_mutex = NULL;
+static void batch_stop_workers(void);
 
 static const Sound_DecoderInfo **available_decoders = NULL;
 static int initialized = 0;
+static Uint32 readahead_size = 4096;  /* 0 == don't buffer app's RWops. */
+static Sound_ResampleQuality resample_quality = SOUND_RESAMPLE_SDL;
+static int streaming_conversion = 0;
+static int stats_enabled = 0;
+static int tracing = 0;  /* non-zero if (trace_hooks) should be called. */
+static Sound_TraceHooks trace_hooks;  /* guarded by trace_lock. */
+static SDL_SpinLock trace_lock = 0;
+static int module_mix_threads = 0;
+static Sound_DecodeQuality decode_quality = SOUND_DECODE_QUALITY_BEST;
+
+/* Sound_SetAllocator()'s functions; all NULL means use SDL's. */
+static Sound_MallocFunc alloc_malloc = NULL;
+static Sound_ReallocFunc alloc_realloc = NULL;
+static Sound_FreeFunc alloc_free = NULL;
+static void *alloc_userdata = NULL;
+
+
+/*
+ * Sample pool. Sound_FreeSample() hands its memory back here instead of to
+ *  the heap, so apps that churn through lots of short-lived samples don't
+ *  hammer the allocator. The Sound_Sample and its Sound_SampleInternal live
+ *  in one allocation; decode buffers are kept in power-of-two size classes.
+ *  Like the sample lists, the pool is split into shards with a lock each,
+ *  picked by the calling thread; a thread that finds its own shard empty
+ *  takes from the others before going to the heap.
+ */
+#define SAMPLEPOOL_MIN_CLASS 10  /* 1 kilobyte... */
+#define SAMPLEPOOL_MAX_CLASS 20  /* ...to 1 megabyte. */
+#define SAMPLEPOOL_CLASSES (SAMPLEPOOL_MAX_CLASS - SAMPLEPOOL_MIN_CLASS + 1)
+#define SAMPLEPOOL_SHARDS SAMPLELIST_SHARDS  /* same hash picks both. */
+
+typedef struct
+{
+    Sound_Sample sample;
+    Sound_SampleInternal internal;
+} PooledSample;
+
+typedef struct __SOUND_POOLBUFFER__
+{
+    struct __SOUND_POOLBUFFER__ *next;
+} PooledBuffer;
+
+typedef struct
+{
+    SDL_mutex *mutex;
+    PooledSample *samples;  /* linked via internal.next */
+    PooledBuffer *buffers[SAMPLEPOOL_CLASSES];
+    Uint8 pad[128 - sizeof (SDL_mutex *) - sizeof (PooledSample *)
+                  - (SAMPLEPOOL_CLASSES * sizeof (PooledBuffer *))];
+} SamplePoolShard;
+
+static SamplePoolShard sample_pools[SAMPLEPOOL_SHARDS];
 
 
 /* functions ... */
@@ -112,6 +195,23 @@ void Sound_GetLinkedVersion(Sound_Version *ver)
 } /* Sound_GetLinkedVersion */
 
 
+int Sound_SetAllocator(Sound_MallocFunc mallocfn, Sound_ReallocFunc reallocfn,
+                       Sound_FreeFunc freefn, void *userdata)
+{
+    const int count = (mallocfn != NULL) + (reallocfn != NULL) + (freefn != NULL);
+
+    /* memory still out there would get freed with the wrong allocator. */
+    BAIL_IF_MACRO(initialized, ERR_IS_INITIALIZED, 0);
+    BAIL_IF_MACRO((count != 0) && (count != 3), ERR_INVALID_ARGUMENT, 0);
+
+    alloc_malloc = mallocfn;
+    alloc_realloc = reallocfn;
+    alloc_free = freefn;
+    alloc_userdata = (count != 0) ? userdata : NULL;
+    return 1;
+} /* Sound_SetAllocator */
+
+
 int Sound_Init(void)
 {
     size_t i;
@@ -119,26 +219,33 @@ int Sound_Init(void)
     size_t total = sizeof (decoders) / sizeof (decoders[0]);
     BAIL_IF_MACRO(initialized, ERR_IS_INITIALIZED, 0);
 
-    sample_list = NULL;
-    error_msgs = NULL;
+    SDL_memset(sample_lists, '\0', sizeof (sample_lists));
+    SDL_memset(sample_pools, '\0', sizeof (sample_pools));
 
     available_decoders = (const Sound_DecoderInfo **)
-                            SDL_calloc(total, sizeof (Sound_DecoderInfo *));
+                            __Sound_Calloc(total, sizeof (Sound_DecoderInfo *));
     BAIL_IF_MACRO(available_decoders == NULL, ERR_OUT_OF_MEMORY, 0);
 
     SDL_InitSubSystem(SDL_INIT_AUDIO);
 
-    errorlist_mutex = SDL_CreateMutex();
-    samplelist_mutex = SDL_CreateMutex();
-
+    if (error_tls == 0)  /* TLS slots can't be freed, so reuse it. */
+        error_tls = SDL_TLSCreate();
+    for (i = 0; i < SAMPLELIST_SHARDS; i++)
+        sample_lists[i].mutex = SDL_CreateMutex();
+    for (i = 0; i < SAMPLEPOOL_SHARDS; i++)
+        sample_pools[i].mutex = SDL_CreateMutex();
+    stats_mutex = SDL_CreateMutex();
+    decoder_mutex = SDL_CreateMutex();
+    batch_mutex = SDL_CreateMutex();
+    __Sound_InitCache();  /* if this fails, there's just no caching. */
+
+    /* decoders get init()'d by decoder_available(), when first needed. */
     for (i = 0; decoders[i].funcs != NULL; i++)
     {
-        decoders[i].available = decoders[i].funcs->init();
-        if (decoders[i].available)
-        {
-            available_decoders[pos] = &(decoders[i].funcs->info);
-            pos++;
-        } /* if */
+        SDL_memset(&decoders[i].totals, '\0', sizeof (Sound_Stats));
+        SDL_AtomicSet(&decoders[i].state, DECODER_UNINITIALIZED);
+        available_decoders[pos] = &(decoders[i].funcs->info);
+        pos++;
     } /* for */
 
     initialized = 1;
@@ -148,46 +255,57 @@ int Sound_Init(void)
 
 int Sound_Quit(void)
 {
-    ErrMsg *err;
-    ErrMsg *nexterr = NULL;
     size_t i;
 
     BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
 
-    while (((volatile Sound_Sample *) sample_list) != NULL)
-        Sound_FreeSample(sample_list);
+    Sound_MixQuit();
+
+    batch_stop_workers();
+    SDL_DestroyMutex(batch_mutex);
+    batch_mutex = NULL;
+
+    for (i = 0; i < SAMPLELIST_SHARDS; i++)
+    {
+        while (((volatile Sound_Sample *) sample_lists[i].head) != NULL)
+            Sound_FreeSample(sample_lists[i].head);
+    } /* for */
+
+    __Sound_QuitCache();
 
+    Sound_ClearError();  /* other threads' errors die with their threads. */
     initialized = 0;
 
-    SDL_DestroyMutex(samplelist_mutex);
-    samplelist_mutex = NULL;
-    sample_list = NULL;
+    for (i = 0; i < SAMPLELIST_SHARDS; i++)
+    {
+        SDL_DestroyMutex(sample_lists[i].mutex);
+        sample_lists[i].mutex = NULL;
+        sample_lists[i].head = NULL;
+    } /* for */
+    SDL_DestroyMutex(stats_mutex);
+    stats_mutex = NULL;
+
+    Sound_TrimSamplePool();
+    for (i = 0; i < SAMPLEPOOL_SHARDS; i++)
+    {
+        SDL_DestroyMutex(sample_pools[i].mutex);
+        sample_pools[i].mutex = NULL;
+    } /* for */
 
     for (i = 0; decoders[i].funcs != NULL; i++)
     {
-        if (decoders[i].available)
-        {
+        if (SDL_AtomicGet(&decoders[i].state) == DECODER_AVAILABLE)
             decoders[i].funcs->quit();
-            decoders[i].available = 0;
-        } /* if */
+        SDL_AtomicSet(&decoders[i].state, DECODER_UNINITIALIZED);
     } /* for */
 
+    SDL_DestroyMutex(decoder_mutex);
+    decoder_mutex = NULL;
+
     if (available_decoders != NULL)
-        SDL_free((void *) available_decoders);
+        __Sound_Free((void *) available_decoders);
     available_decoders = NULL;
 
-    /* clean up error state for each thread... */
-    SDL_LockMutex(errorlist_mutex);
-    for (err = error_msgs; err != NULL; err = nexterr)
-    {
-        nexterr = err->next;
-        SDL_free(err);
-    } /* for */
-    error_msgs = NULL;
-    SDL_UnlockMutex(errorlist_mutex);
-    SDL_DestroyMutex(errorlist_mutex);
-    errorlist_mutex = NULL;
-
     return 1;
 } /* Sound_Quit */
 
@@ -198,28 +316,73 @@ const Sound_DecoderInfo **Sound_AvailableDecoders(void)
 } /* Sound_AvailableDecoders */
 
 
-static ErrMsg *findErrorForCurrentThread(void)
+/*
+ * Returns nonzero if (decoder) is usable, calling its init() first if
+ *  nobody has yet. Once a decoder is initialized (or has failed to), this
+ *  is just an atomic read.
+ */
+static int decoder_available(decoder_element *decoder)
+{
+    int state = SDL_AtomicGet(&decoder->state);
+    if (state == DECODER_UNINITIALIZED)
+    {
+        SDL_LockMutex(decoder_mutex);
+        state = SDL_AtomicGet(&decoder->state);
+        if (state == DECODER_UNINITIALIZED)
+        {
+            if (decoder->funcs->init())
+                state = DECODER_AVAILABLE;
+            else
+            {
+                SNDDBG(("Decoder [%s] failed to initialize.\n",
+                        decoder->funcs->info.description));
+                state = DECODER_FAILED;
+            } /* else */
+            SDL_AtomicSet(&decoder->state, state);
+        } /* if */
+        SDL_UnlockMutex(decoder_mutex);
+    } /* if */
+
+    return (state == DECODER_AVAILABLE);
+} /* decoder_available */
+
+
+int Sound_InitDecoders(const char **extensions)
 {
-    ErrMsg *i;
-    Uint32 tid;
+    decoder_element *decoder;
+    int retval = 0;
 
-    if (error_msgs != NULL)
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+
+    for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
     {
-        tid = SDL_ThreadID();
+        int wanted = (extensions == NULL);
+        const char **ext;
 
-        SDL_LockMutex(errorlist_mutex);
-        for (i = error_msgs; i != NULL; i = i->next)
+        for (ext = extensions; (!wanted) && (*ext != NULL); ext++)
         {
-            if (i->tid == tid)
+            const char **decoderExt = decoder->funcs->info.extensions;
+            for (; *decoderExt != NULL; decoderExt++)
             {
-                SDL_UnlockMutex(errorlist_mutex);
-                return i;
-            } /* if */
+                if (SDL_strcasecmp(*decoderExt, *ext) == 0)
+                {
+                    wanted = 1;
+                    break;
+                } /* if */
+            } /* for */
         } /* for */
-        SDL_UnlockMutex(errorlist_mutex);
-    } /* if */
 
-    return NULL;   /* no error available. */
+        if ((wanted) && (decoder_available(decoder)))
+            retval++;
+    } /* for */
+
+    return retval;
+} /* Sound_InitDecoders */
+
+
+static ErrMsg *findErrorForCurrentThread(void)
+{
+    return (ErrMsg *) SDL_TLSGet(error_tls);
 } /* findErrorForCurrentThread */
 
 
@@ -255,6 +418,75 @@ void Sound_ClearError(void)
 } /* Sound_ClearError */
 
 
+/*
+ * This is declared in the internal header.
+ */
+void *__Sound_Malloc(size_t len)
+{
+    if (alloc_malloc != NULL)
+        return alloc_malloc(len, alloc_userdata);
+    return SDL_malloc(len);
+} /* __Sound_Malloc */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void *__Sound_Calloc(size_t nmemb, size_t len)
+{
+    void *retval;
+
+    if (alloc_malloc == NULL)
+        return SDL_calloc(nmemb, len);
+
+    if ((len != 0) && (nmemb > ((size_t) -1) / len))
+        return NULL;  /* would overflow. */
+
+    retval = alloc_malloc(nmemb * len, alloc_userdata);
+    if (retval != NULL)
+        SDL_memset(retval, '\0', nmemb * len);
+    return retval;
+} /* __Sound_Calloc */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void *__Sound_Realloc(void *ptr, size_t len)
+{
+    if (alloc_realloc != NULL)
+        return alloc_realloc(ptr, len, alloc_userdata);
+    return SDL_realloc(ptr, len);
+} /* __Sound_Realloc */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_Free(void *ptr)
+{
+    if (ptr == NULL)
+        return;
+    else if (alloc_free != NULL)
+        alloc_free(ptr, alloc_userdata);
+    else
+        SDL_free(ptr);
+} /* __Sound_Free */
+
+
+/*
+ * This is declared in the internal header.
+ */
+char *__Sound_StrDup(const char *str)
+{
+    const size_t len = SDL_strlen(str) + 1;
+    char *retval = (char *) __Sound_Malloc(len);
+    if (retval != NULL)
+        SDL_memcpy(retval, str, len);
+    return retval;
+} /* __Sound_StrDup */
+
+
 /*
  * This is declared in the internal header.
  */
@@ -274,16 +506,17 @@ void __Sound_SetError(const char *str)
     err = findErrorForCurrentThread();
     if (err == NULL)
     {
+        /* SDL frees this when the thread ends, maybe after Sound_Quit(),
+           so it comes from SDL's allocator, not Sound_SetAllocator()'s. */
         err = (ErrMsg *) SDL_calloc(1, sizeof (ErrMsg));
         if (err == NULL)
             return;   /* uhh...? */
 
-        err->tid = SDL_ThreadID();
-
-        SDL_LockMutex(errorlist_mutex);
-        err->next = error_msgs;
-        error_msgs = err;
-        SDL_UnlockMutex(errorlist_mutex);
+        if (SDL_TLSSet(error_tls, err, SDL_free) == -1)
+        {
+            SDL_free(err);
+            return;
+        } /* if */
     } /* if */
 
     err->error_available = 1;
@@ -291,457 +524,3136 @@ void __Sound_SetError(const char *str)
 } /* __Sound_SetError */
 
 
+Uint64 __Sound_convertMsToFrames(Uint32 rate, Uint32 ms)
+{
+    return (((Uint64) ms) * rate) / 1000;
+} /* __Sound_convertMsToFrames */
+
+
 Uint32 __Sound_convertMsToBytePos(Sound_AudioInfo *info, Uint32 ms)
 {
     /* "frames" == "sample frames" */
-    float frames_per_ms = ((float) info->rate) / 1000.0f;
-    Uint32 frame_offset = (Uint32) (frames_per_ms * ((float) ms));
+    Uint32 frame_offset = (Uint32) __Sound_convertMsToFrames(info->rate, ms);
     Uint32 frame_size = (Uint32) ((info->format & 0xFF) / 8) * info->channels;
     return frame_offset * frame_size;
 } /* __Sound_convertMsToBytePos */
 
 
-/*
- * Allocate a Sound_Sample, and fill in most of its fields. Those that need
- *  to be filled in later, by a decoder, will be initialized to zero.
- */
-static Sound_Sample *alloc_sample(SDL_RWops *rw, Sound_AudioInfo *desired,
-                                    Uint32 bufferSize)
+Uint64 __Sound_convertFramesToBytePos(const Sound_AudioInfo *info, Uint64 frame)
 {
-    /*
-     * !!! FIXME: We're going to need to pool samples, since the mixer
-     * !!! FIXME:  might be allocating tons of these on a regular basis.
-     */
-    Sound_Sample *retval = SDL_calloc(1, sizeof (Sound_Sample));
-    Sound_SampleInternal *internal = SDL_calloc(1, sizeof (Sound_SampleInternal));
-    if ((retval == NULL) || (internal == NULL))
-    {
-        __Sound_SetError(ERR_OUT_OF_MEMORY);
-        if (retval)
-            SDL_free(retval);
-        if (internal)
-            SDL_free(internal);
+    return frame * (((info->format & 0xFF) / 8) * info->channels);
+} /* __Sound_convertFramesToBytePos */
 
-        return NULL;
-    } /* if */
 
-    SDL_assert(bufferSize > 0);
-    retval->buffer = SDL_calloc(1, bufferSize);  /* pure ugly. */
-    if (!retval->buffer)
+/* Returns the pool size class for a given buffer size, rounding up. */
+static int buffer_size_class(Uint32 size)
+{
+    int i;
+    for (i = 0; i < SAMPLEPOOL_CLASSES; i++)
     {
-        __Sound_SetError(ERR_OUT_OF_MEMORY);
-        SDL_free(internal);
-        SDL_free(retval);
-        return NULL;
-    } /* if */
-    retval->buffer_size = bufferSize;
+        if (size <= (((Uint32) 1) << (i + SAMPLEPOOL_MIN_CLASS)))
+            return i;
+    } /* for */
 
-    if (desired != NULL)
-        SDL_memcpy(&retval->desired, desired, sizeof (Sound_AudioInfo));
+    return -1;  /* too big to pool. */
+} /* buffer_size_class */
 
-    internal->rw = rw;
-    retval->opaque = internal;
-    return retval;
-} /* alloc_sample */
 
+/*
+ * Pick a sample list (and pool shard) for the calling thread. Thread IDs
+ *  are often aligned pointers, so mix the bits up before taking the low ones.
+ */
+static Uint32 sample_list_shard(void)
+{
+    const Uint64 id = (Uint64) SDL_ThreadID();
+    const Uint32 mixed = (Uint32) ((id ^ (id >> 32)) * 0x9E3779B1u);
+    return mixed >> 28;  /* top 4 bits; SAMPLELIST_SHARDS is 16. */
+} /* sample_list_shard */
 
-#if (defined DEBUG_CHATTER)
-static SDL_INLINE const char *fmt_to_str(Uint16 fmt)
+
+/* The calling thread's pool shard. */
+static SDL_INLINE SamplePoolShard *sample_pool_shard(void)
 {
-    switch(fmt)
-    {
-        case AUDIO_U8:
-            return "U8";
-        case AUDIO_S8:
-            return "S8";
-        case AUDIO_U16LSB:
-            return "U16LSB";
-        case AUDIO_S16LSB:
-            return "S16LSB";
-        case AUDIO_S32LSB:
-            return "S32LSB";
-        case AUDIO_F32LSB:
-            return "F32LSB";
-        case AUDIO_U16MSB:
-            return "U16MSB";
-        case AUDIO_S16MSB:
-            return "S16MSB";
-        case AUDIO_S32MSB:
-            return "S32MSB";
-        case AUDIO_F32MSB:
-            return "F32MSB";
-    } /* switch */
+    return &sample_pools[sample_list_shard()];
+} /* sample_pool_shard */
 
-    return "Unknown";
-} /* fmt_to_str */
-#endif
+
+/*
+ * Take a class (cls) buffer from one shard, or NULL if it has none. The
+ *  unlocked peek can be stale, but only costs a lock or a heap allocation
+ *  when it is; it keeps a miss from locking every shard in turn.
+ */
+static PooledBuffer *pop_pooled_buffer(SamplePoolShard *pool, int cls)
+{
+    PooledBuffer *retval;
+
+    if (((PooledBuffer * volatile *) pool->buffers)[cls] == NULL)
+        return NULL;
+
+    SDL_LockMutex(pool->mutex);
+    retval = pool->buffers[cls];
+    if (retval != NULL)
+        pool->buffers[cls] = retval->next;
+    SDL_UnlockMutex(pool->mutex);
+
+    return retval;
+} /* pop_pooled_buffer */
 
 
 /*
- * The bulk of the Sound_NewSample() work is done here...
- *  Ask the specified decoder to handle the data in (rw), and if
- *  so, construct the Sound_Sample. Otherwise, try to wind (rw)'s stream
- *  back to where it was, and return false.
+ * Get a buffer of at least (size) bytes, from the pool if possible. The
+ *  number of bytes actually allocated is stored in (*capacity). Contents
+ *  of the buffer are undefined.
  */
-static int init_sample(const Sound_DecoderFunctions *funcs,
-                        Sound_Sample *sample, const char *ext,
-                        Sound_AudioInfo *_desired)
+static void *get_pooled_buffer(Uint32 size, Uint32 *capacity)
 {
-    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    Sound_AudioInfo desired;
-    int pos = SDL_RWtell(internal->rw);
+    const int cls = buffer_size_class(size);
+    const Uint32 shard = sample_list_shard();
+    void *retval = NULL;
+    Uint32 i;
 
-        /* fill in the funcs for this decoder... */
-    sample->decoder = &funcs->info;
-    internal->funcs = funcs;
-    if (!funcs->open(sample, ext))
+    if (cls < 0)
     {
-        SDL_RWseek(internal->rw, pos, SEEK_SET);  /* set for next try... */
-        return 0;
+        *capacity = size;
+        return __Sound_Malloc(size);
     } /* if */
 
-    /* success; we've got a decoder! */
+    for (i = 0; (retval == NULL) && (i < SAMPLEPOOL_SHARDS); i++)
+        retval = pop_pooled_buffer(&sample_pools[(shard + i) % SAMPLEPOOL_SHARDS], cls);
 
-    /* Now we need to set up the conversion buffer... */
+    *capacity = ((Uint32) 1) << (cls + SAMPLEPOOL_MIN_CLASS);
+    if (retval == NULL)
+        retval = __Sound_Malloc(*capacity);
 
-    if (_desired == NULL)
-        SDL_memcpy(&desired, &sample->actual, sizeof (Sound_AudioInfo));
-    else
-    {
-        desired.format = _desired->format ? _desired->format : sample->actual.format;
-        desired.channels = _desired->channels ? _desired->channels : sample->actual.channels;
-        desired.rate = _desired->rate ? _desired->rate : sample->actual.rate;
-    } /* else */
+    return retval;
+} /* get_pooled_buffer */
 
-    if (SDL_BuildAudioCVT(&internal->sdlcvt,
-                            sample->actual.format,
-                            sample->actual.channels,
-                            sample->actual.rate,
-                            desired.format,
-                            desired.channels,
-                            desired.rate) == -1)
-    {
-        __Sound_SetError(SDL_GetError());
-        funcs->close(sample);
-        SDL_RWseek(internal->rw, pos, SEEK_SET);  /* set for next try... */
-        return 0;
-    } /* if */
 
-    if (internal->sdlcvt.len_mult > 1)
+/*
+ * Hand a buffer back to (pool). It is filed under the largest class that
+ *  fits in (capacity), so buffers that were resized elsewhere are still
+ *  safe to reuse. Buffers too small or too large for the pool are freed.
+ */
+static void put_pooled_buffer_in(SamplePoolShard *pool, void *buf, Uint32 capacity)
+{
+    int cls;
+
+    if (buf == NULL)
+        return;
+
+    for (cls = SAMPLEPOOL_CLASSES - 1; cls >= 0; cls--)
     {
-        void *rc = SDL_realloc(sample->buffer, sample->buffer_size * internal->sdlcvt.len_mult);
-        if (rc == NULL)
-        {
-            funcs->close(sample);
-            SDL_RWseek(internal->rw, pos, SEEK_SET);  /* set for next try... */
-            return 0;
-        } /* if */
+        if (capacity >= (((Uint32) 1) << (cls + SAMPLEPOOL_MIN_CLASS)))
+            break;
+    } /* for */
 
-        sample->buffer = rc;
+    if ((cls < 0) || (capacity >= (((Uint32) 1) << (SAMPLEPOOL_MAX_CLASS + 1))))
+    {
+        __Sound_Free(buf);
+        return;
     } /* if */
 
-        /* these pointers are all one and the same. */
-    SDL_memcpy(&sample->desired, &desired, sizeof (Sound_AudioInfo));
-    internal->sdlcvt.buf = internal->buffer = sample->buffer;
-    internal->buffer_size = sample->buffer_size / internal->sdlcvt.len_mult;
-    internal->sdlcvt.len = internal->buffer_size;
+    SDL_LockMutex(pool->mutex);
+    ((PooledBuffer *) buf)->next = pool->buffers[cls];
+    pool->buffers[cls] = (PooledBuffer *) buf;
+    SDL_UnlockMutex(pool->mutex);
+} /* put_pooled_buffer_in */
 
-    /* Prepend our new Sound_Sample to the sample_list... */
-    SDL_LockMutex(samplelist_mutex);
-    internal->next = sample_list;
-    if (sample_list != NULL)
-        ((Sound_SampleInternal *) sample_list->opaque)->prev = sample;
-    sample_list = sample;
-    SDL_UnlockMutex(samplelist_mutex);
 
-    SNDDBG(("New sample DESIRED format: %s format, %d rate, %d channels.\n",
-            fmt_to_str(sample->desired.format),
-            sample->desired.rate,
-            sample->desired.channels));
+/* Hand a buffer back to the calling thread's shard of the pool. */
+static void put_pooled_buffer(void *buf, Uint32 capacity)
+{
+    put_pooled_buffer_in(sample_pool_shard(), buf, capacity);
+} /* put_pooled_buffer */
 
-    SNDDBG(("New sample ACTUAL format: %s format, %d rate, %d channels.\n",
-            fmt_to_str(sample->actual.format),
-            sample->actual.rate,
-            sample->actual.channels));
 
-    SNDDBG(("On-the-fly conversion: %s.\n",
-            internal->sdlcvt.needed ? "ENABLED" : "DISABLED"));
+/* Like pop_pooled_buffer(), for the sample structs. */
+static PooledSample *pop_pooled_sample(SamplePoolShard *pool)
+{
+    PooledSample *retval;
 
-    return 1;
-} /* init_sample */
+    if (*((PooledSample * volatile *) &pool->samples) == NULL)
+        return NULL;
 
+    SDL_LockMutex(pool->mutex);
+    retval = pool->samples;
+    if (retval != NULL)
+        pool->samples = (PooledSample *) retval->internal.next;
+    SDL_UnlockMutex(pool->mutex);
 
-Sound_Sample *Sound_NewSample(SDL_RWops *rw, const char *ext,
-                              Sound_AudioInfo *desired, Uint32 bSize)
+    return retval;
+} /* pop_pooled_sample */
+
+
+static void push_pooled_sample(SamplePoolShard *pool, PooledSample *ps)
 {
-    Sound_Sample *retval;
-    decoder_element *decoder;
+    SDL_LockMutex(pool->mutex);
+    ps->internal.next = (Sound_Sample *) pool->samples;
+    pool->samples = ps;
+    SDL_UnlockMutex(pool->mutex);
+} /* push_pooled_sample */
 
-    /* sanity checks. */
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
-    BAIL_IF_MACRO(rw == NULL, ERR_INVALID_ARGUMENT, NULL);
 
-    retval = alloc_sample(rw, desired, bSize);
-    if (!retval)
-        return NULL;  /* alloc_sample() sets error message... */
+static PooledSample *get_pooled_sample(void)
+{
+    const Uint32 shard = sample_list_shard();
+    PooledSample *retval = NULL;
+    Uint32 i;
 
-    if (ext != NULL)
+    for (i = 0; (retval == NULL) && (i < SAMPLEPOOL_SHARDS); i++)
+        retval = pop_pooled_sample(&sample_pools[(shard + i) % SAMPLEPOOL_SHARDS]);
+
+    if (retval == NULL)
+        return (PooledSample *) __Sound_Calloc(1, sizeof (PooledSample));
+
+    SDL_memset(retval, '\0', sizeof (PooledSample));
+    return retval;
+} /* get_pooled_sample */
+
+
+/*
+ * Streaming conversion. Instead of converting in place, which needs
+ *  sample->buffer to be sdlcvt.len_mult times bigger than what the decoder
+ *  fills, the decoder gets its own small buffer and everything goes through
+ *  an SDL_AudioStream, which hands back exactly as much as the app asked
+ *  for. Handy when there are lots of samples alive at once.
+ */
+#if SOUND_HAVE_AUDIOSTREAM
+#define USING_AUDIOSTREAM(internal) ((internal)->audiostream != NULL)
+
+/* Decoder buffer size that makes about (outsize) bytes of desired output. */
+static Uint32 audiostream_decode_size(const Sound_Sample *sample,
+                                      const Sound_AudioInfo *desired,
+                                      Uint32 outsize)
+{
+    const Uint32 inframe = (SDL_AUDIO_BITSIZE(sample->actual.format) / 8)
+                                * sample->actual.channels;
+    const Uint32 outframe = (SDL_AUDIO_BITSIZE(desired->format) / 8)
+                                * desired->channels;
+    Uint64 retval = ((Uint64) (outsize / outframe)) * sample->actual.rate;
+
+    retval = (retval / desired->rate) * inframe;
+    if (retval > outsize)  /* no point in being bigger than the output. */
+        retval = outsize - (outsize % inframe);
+    if (retval < inframe)
+        retval = inframe;
+    return (Uint32) retval;
+} /* audiostream_decode_size */
+
+
+static int setup_audiostream(Sound_Sample *sample, const Sound_AudioInfo *desired)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 len = audiostream_decode_size(sample, desired, sample->buffer_size);
+    SDL_AudioStream *stream;
+    void *buf;
+
+    if ((!streaming_conversion) || (!internal->sdlcvt.needed) ||
+        (internal->resampler != NULL))
+        return 1;  /* not wanted here. */
+
+    buf = __Sound_Malloc(len);
+    BAIL_IF_MACRO(buf == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    stream = SDL_NewAudioStream(sample->actual.format, sample->actual.channels,
+                                (int) sample->actual.rate, desired->format,
+                                desired->channels, (int) desired->rate);
+    if (stream == NULL)
     {
-        for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
+        __Sound_Free(buf);
+        BAIL_MACRO(SDL_GetError(), 0);
+    } /* if */
+
+    internal->audiostream = stream;
+    internal->audiostream_flushed = 0;
+    internal->buffer = buf;
+    internal->buffer_size = len;
+    return 1;
+} /* setup_audiostream */
+
+
+static void reset_audiostream(Sound_SampleInternal *internal)
+{
+    if (internal->audiostream != NULL)
+    {
+        SDL_AudioStreamClear(internal->audiostream);
+        internal->audiostream_flushed = 0;
+    } /* if */
+} /* reset_audiostream */
+
+
+static void free_audiostream(Sound_SampleInternal *internal)
+{
+    if (internal->audiostream != NULL)
+    {
+        SDL_FreeAudioStream(internal->audiostream);
+        internal->audiostream = NULL;
+    } /* if */
+} /* free_audiostream */
+
+
+/* Fill (buf) with up to (len) converted bytes, decoding as needed. */
+static Uint32 audiostream_decode(Sound_Sample *sample, Uint8 *buf, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    SDL_AudioStream *stream = internal->audiostream;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    int rc;
+
+    len -= len % framesize;
+    BAIL_IF_MACRO(len == 0, ERR_INVALID_ARGUMENT, 0);
+
+    while ( (!internal->audiostream_flushed) &&
+            (((Uint32) SDL_AudioStreamAvailable(stream)) < len) )
+    {
+        const Uint32 br = __Sound_DecoderRead(sample);
+        if ((br > 0) && (SDL_AudioStreamPut(stream, internal->buffer, (int) br) == -1))
+        {
+            __Sound_SetError(SDL_GetError());
+            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+            break;
+        } /* if */
+
+        if (sample->flags & SOUND_SAMPLEFLAG_EOF)
+        {
+            /* the app doesn't see EOF until the stream is empty, too. */
+            SDL_AudioStreamFlush(stream);
+            sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
+            internal->audiostream_flushed = 1;
+        } /* if */
+
+        else if ((br == 0) || (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EAGAIN)))
+            break;
+    } /* while */
+
+    rc = SDL_AudioStreamGet(stream, buf, (int) len);
+    if (rc < 0)
+    {
+        __Sound_SetError(SDL_GetError());
+        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+        return 0;
+    } /* if */
+
+    if ((internal->audiostream_flushed) && (SDL_AudioStreamAvailable(stream) == 0))
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+
+    return (Uint32) rc;
+} /* audiostream_decode */
+
+#else
+#define USING_AUDIOSTREAM(internal) (0)
+#define setup_audiostream(sample, desired) (1)
+#define reset_audiostream(internal)
+#define free_audiostream(internal)
+#define audiostream_decode(sample, buf, len) (0)
+#endif
+
+
+/*
+ * Return a Sound_Sample's memory to the pool. The decoder must already be
+ *  closed and the sample unlinked from its sample list.
+ */
+static void release_sample(Sound_Sample *sample)
+{
+    PooledSample *ps = (PooledSample *) sample;
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+
+    SDL_assert(internal == &ps->internal);
+
+    if ((internal->buffer != NULL) && (internal->buffer != sample->buffer))
+        __Sound_Free(internal->buffer);
+
+    if (internal->filename != NULL)
+        __Sound_Free(internal->filename);
+
+    if (internal->stats != NULL)
+        __Sound_Free(internal->stats);
+
+    if (internal->loop_head != NULL)
+        __Sound_Free(internal->loop_head);
+
+    __Sound_FreeResampler(sample);
+    free_audiostream(internal);
+
+    if (internal->shared_pcm != NULL)  /* (sample->buffer) isn't ours. */
+        __Sound_ReleaseSharedPCM(internal->shared_pcm);
+    else
+        put_pooled_buffer(sample->buffer, internal->buffer_capacity);
+
+    push_pooled_sample(sample_pool_shard(), ps);
+} /* release_sample */
+
+
+int Sound_PrewarmSamplePool(Uint32 count, Uint32 bufferSize)
+{
+    const int cls = (bufferSize > 0) ? buffer_size_class(bufferSize) : 0;
+    const Uint32 capacity = ((Uint32) 1) << (cls + SAMPLEPOOL_MIN_CLASS);
+    Uint32 i;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(cls < 0, ERR_INVALID_ARGUMENT, 0);
+
+    /* deal them out, so every thread finds some on its own shard. */
+    for (i = 0; i < count; i++)
+    {
+        SamplePoolShard *pool = &sample_pools[i % SAMPLEPOOL_SHARDS];
+        PooledSample *ps = (PooledSample *) __Sound_Calloc(1, sizeof (PooledSample));
+        BAIL_IF_MACRO(ps == NULL, ERR_OUT_OF_MEMORY, 0);
+        push_pooled_sample(pool, ps);
+
+        if (bufferSize > 0)
+            put_pooled_buffer_in(pool, __Sound_Malloc(capacity), capacity);
+    } /* for */
+
+    return 1;
+} /* Sound_PrewarmSamplePool */
+
+
+void Sound_TrimSamplePool(void)
+{
+    PooledSample *ps;
+    PooledBuffer *pb;
+    int shard, i;
+
+    for (shard = 0; shard < SAMPLEPOOL_SHARDS; shard++)
+    {
+        SamplePoolShard *pool = &sample_pools[shard];
+
+        SDL_LockMutex(pool->mutex);
+
+        while (pool->samples != NULL)
+        {
+            ps = pool->samples;
+            pool->samples = (PooledSample *) ps->internal.next;
+            __Sound_Free(ps);
+        } /* while */
+
+        for (i = 0; i < SAMPLEPOOL_CLASSES; i++)
         {
-            if (decoder->available)
+            while (pool->buffers[i] != NULL)
             {
-                const char **decoderExt = decoder->funcs->info.extensions;
-                while (*decoderExt)
-                {
-                    if (SDL_strcasecmp(*decoderExt, ext) == 0)
-                    {
-                        if (init_sample(decoder->funcs, retval, ext, desired))
-                            return retval;
-                        break;  /* done with this decoder either way. */
-                    } /* if */
-                    decoderExt++;
-                } /* while */
-            } /* if */
+                pb = pool->buffers[i];
+                pool->buffers[i] = pb->next;
+                __Sound_Free(pb);
+            } /* while */
         } /* for */
+
+        SDL_UnlockMutex(pool->mutex);
+    } /* for */
+} /* Sound_TrimSamplePool */
+
+
+/*
+ * This is declared in the internal header.
+ */
+const Uint8 *__Sound_RWMemoryView(SDL_RWops *rw, size_t *avail)
+{
+    if ((rw->type != SDL_RWOPS_MEMORY) && (rw->type != SDL_RWOPS_MEMORY_RO))
+        return NULL;
+
+    *avail = (size_t) (rw->hidden.mem.stop - rw->hidden.mem.here);
+    return rw->hidden.mem.here;
+} /* __Sound_RWMemoryView */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_ViewRW(Sound_Sample *sample, const Uint8 **data, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    size_t avail = 0;
+    const Uint8 *mem = __Sound_RWMemoryView(internal->rw, &avail);
+
+    *data = mem;
+    if (mem == NULL)
+        return 0;
+
+    if (avail < len)
+        len = (Uint32) avail;
+
+    internal->rw->hidden.mem.here += len;  /* same as a seek, but cheaper. */
+    return len;
+} /* __Sound_ViewRW */
+
+
+/*
+ * Allocate a Sound_Sample, and fill in most of its fields. Those that need
+ *  to be filled in later, by a decoder, will be initialized to zero.
+ */
+static Sound_Sample *alloc_sample(SDL_RWops *rw, Sound_AudioInfo *desired,
+                                    Uint32 bufferSize)
+{
+    PooledSample *ps = get_pooled_sample();
+    Sound_Sample *retval;
+    Sound_SampleInternal *internal;
+
+    BAIL_IF_MACRO(ps == NULL, ERR_OUT_OF_MEMORY, NULL);
+    retval = &ps->sample;
+    internal = &ps->internal;
+
+    /* instances don't have a buffer of their own. */
+    if (bufferSize > 0)
+        retval->buffer = get_pooled_buffer(bufferSize, &internal->buffer_capacity);
+    if ((bufferSize > 0) && (!retval->buffer))
+    {
+        __Sound_SetError(ERR_OUT_OF_MEMORY);
+        retval->opaque = internal;
+        release_sample(retval);
+        return NULL;
     } /* if */
 
-    /* no direct extension match? Try everything we've got... */
-    for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
+    /* pooled buffers hold whatever the last sample left in them. */
+    if (bufferSize > 0)
+        SDL_memset(retval->buffer, '\0', bufferSize);
+    retval->buffer_size = bufferSize;
+
+    if (desired != NULL)
+        SDL_memcpy(&retval->desired, desired, sizeof (Sound_AudioInfo));
+
+    if (stats_enabled)
     {
-        if (decoder->available)
+        internal->stats = (Sound_Stats *) __Sound_Calloc(1, sizeof (Sound_Stats));
+        if (internal->stats == NULL)
         {
-            int should_try = 1;
-            const char **decoderExt = decoder->funcs->info.extensions;
+            __Sound_SetError(ERR_OUT_OF_MEMORY);
+            retval->opaque = internal;
+            release_sample(retval);
+            return NULL;
+        } /* if */
+        internal->stats->samples = 1;
+    } /* if */
 
-                /* skip if we would have tried decoder above... */
-            while (*decoderExt)
+    internal->rw = rw;
+    internal->mix_gains[0] = internal->mix_gains[1] = 1.0f;
+    retval->opaque = internal;
+    return retval;
+} /* alloc_sample */
+
+
+#if (defined DEBUG_CHATTER)
+static SDL_INLINE const char *fmt_to_str(Uint16 fmt)
+{
+    switch(fmt)
+    {
+        case AUDIO_U8:
+            return "U8";
+        case AUDIO_S8:
+            return "S8";
+        case AUDIO_U16LSB:
+            return "U16LSB";
+        case AUDIO_S16LSB:
+            return "S16LSB";
+        case AUDIO_S32LSB:
+            return "S32LSB";
+        case AUDIO_F32LSB:
+            return "F32LSB";
+        case AUDIO_U16MSB:
+            return "U16MSB";
+        case AUDIO_S16MSB:
+            return "S16MSB";
+        case AUDIO_S32MSB:
+            return "S32MSB";
+        case AUDIO_F32MSB:
+            return "F32MSB";
+    } /* switch */
+
+    return "Unknown";
+} /* fmt_to_str */
+#endif
+
+
+static void restore_rw(Sound_SampleInternal *internal, int pos)
+{
+    if (internal->rw != NULL)  /* instances don't have one. */
+        SDL_RWseek(internal->rw, pos, SEEK_SET);
+} /* restore_rw */
+
+
+static void link_sample(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 shard = sample_list_shard();
+    SampleListShard *list = &sample_lists[shard];
+
+    internal->list_shard = shard;
+    internal->prev = NULL;
+    SDL_LockMutex(list->mutex);
+    internal->next = list->head;
+    if (list->head != NULL)
+        ((Sound_SampleInternal *) list->head->opaque)->prev = sample;
+    list->head = sample;
+    SDL_UnlockMutex(list->mutex);
+} /* link_sample */
+
+
+/* Call the app's trace hook for (event), begin or end, on (sample). */
+static void trace_event(int end, Sound_TraceEvent event,
+                        Sound_Sample *sample, Uint32 bytes)
+{
+    const char *decoder = NULL;
+    Sound_TraceFunc fn;
+    void *userdata;
+
+    /* a copy, so the app can swap hooks while another thread is in one. */
+    SDL_AtomicLock(&trace_lock);
+    fn = end ? trace_hooks.end : trace_hooks.begin;
+    userdata = trace_hooks.userdata;
+    SDL_AtomicUnlock(&trace_lock);
+
+    if (sample->decoder != NULL)
+        decoder = sample->decoder->description;
+    if (fn != NULL)
+        fn(userdata, event, sample, decoder, bytes);
+} /* trace_event */
+
+
+/* funcs->open(), funcs->seek(), funcs->seek_frames() and funcs->rewind(), traced. */
+static int decoder_open(const Sound_DecoderFunctions *funcs,
+                        Sound_Sample *sample, const char *ext)
+{
+    int retval;
+
+    if (!tracing)
+        return funcs->open(sample, ext);
+
+    trace_event(0, SOUND_TRACE_OPEN, sample, 0);
+    retval = funcs->open(sample, ext);
+    trace_event(1, SOUND_TRACE_OPEN, sample, (Uint32) retval);
+    return retval;
+} /* decoder_open */
+
+
+static int decoder_seek(Sound_Sample *sample, Uint32 ms)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    int retval;
+
+    if (!tracing)
+        return internal->funcs->seek(sample, ms);
+
+    trace_event(0, SOUND_TRACE_SEEK, sample, 0);
+    retval = internal->funcs->seek(sample, ms);
+    trace_event(1, SOUND_TRACE_SEEK, sample, (Uint32) retval);
+    return retval;
+} /* decoder_seek */
+
+
+static int decoder_seek_frames(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    int retval;
+
+    if (!tracing)
+        return internal->funcs->seek_frames(sample, frame);
+
+    trace_event(0, SOUND_TRACE_SEEK, sample, 0);
+    retval = internal->funcs->seek_frames(sample, frame);
+    trace_event(1, SOUND_TRACE_SEEK, sample, (Uint32) retval);
+    return retval;
+} /* decoder_seek_frames */
+
+
+static int decoder_rewind(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    int retval;
+
+    if (!tracing)
+        return internal->funcs->rewind(sample);
+
+    trace_event(0, SOUND_TRACE_REWIND, sample, 0);
+    retval = internal->funcs->rewind(sample);
+    trace_event(1, SOUND_TRACE_REWIND, sample, (Uint32) retval);
+    return retval;
+} /* decoder_rewind */
+
+
+/*
+ * The bulk of the Sound_NewSample() work is done here...
+ *  Ask the specified decoder to handle the data in (rw), and if
+ *  so, construct the Sound_Sample. Otherwise, try to wind (rw)'s stream
+ *  back to where it was, and return false. This doesn't put the sample on
+ *  a sample list; call link_sample() if it's going to the app.
+ */
+static int init_sample(const Sound_DecoderFunctions *funcs,
+                        Sound_Sample *sample, const char *ext,
+                        Sound_AudioInfo *_desired)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Sound_AudioInfo desired;
+    const int pos = (internal->rw != NULL) ? SDL_RWtell(internal->rw) : 0;
+    Uint32 len_mult;
+
+        /* fill in the funcs for this decoder... */
+    sample->decoder = &funcs->info;
+    internal->funcs = funcs;
+    internal->decode_quality = decode_quality;
+    if (!decoder_open(funcs, sample, ext))
+    {
+        restore_rw(internal, pos);  /* set for next try... */
+        return 0;
+    } /* if */
+
+    /* success; we've got a decoder! */
+    internal->open_pos = pos;  /* Sound_Resume() opens it here again... */
+    internal->open_ext = NULL;  /* ...with the same hint, if it was one of its. */
+    if (ext != NULL)
+    {
+        const char **decoderExt;
+        for (decoderExt = funcs->info.extensions; *decoderExt; decoderExt++)
+        {
+            if (SDL_strcasecmp(*decoderExt, ext) == 0)
             {
-                if (SDL_strcasecmp(*decoderExt, ext) == 0)
-                {
-                    should_try = 0;
-                    break;
-                } /* if */
-                decoderExt++;
-            } /* while */
+                internal->open_ext = *decoderExt;  /* the app's may not last. */
+                break;
+            } /* if */
+        } /* for */
+    } /* if */
+
+    /* Sound_ProbeInfo() only wanted to know that much. */
+    if (internal->probe_only)
+        return 1;
+
+    /* Now we need to set up the conversion buffer... */
+
+    if (_desired == NULL)
+        SDL_memcpy(&desired, &sample->actual, sizeof (Sound_AudioInfo));
+    else
+    {
+        desired.format = _desired->format ? _desired->format : sample->actual.format;
+        desired.channels = _desired->channels ? _desired->channels : sample->actual.channels;
+        desired.rate = _desired->rate ? _desired->rate : sample->actual.rate;
+    } /* else */
+
+    if (SDL_BuildAudioCVT(&internal->sdlcvt,
+                            sample->actual.format,
+                            sample->actual.channels,
+                            sample->actual.rate,
+                            desired.format,
+                            desired.channels,
+                            desired.rate) == -1)
+    {
+        __Sound_SetError(SDL_GetError());
+        funcs->close(sample);
+        restore_rw(internal, pos);  /* set for next try... */
+        return 0;
+    } /* if */
+
+    internal->resample_quality = resample_quality;
+    len_mult = __Sound_SetupResampler(sample, &desired, resample_quality);
+    if (len_mult == 0)
+    {
+        funcs->close(sample);
+        restore_rw(internal, pos);  /* set for next try... */
+        return 0;
+    } /* if */
+
+    if ((internal->resampler != NULL) && (len_mult > (Uint32) internal->sdlcvt.len_mult))
+        internal->sdlcvt.len_mult = (int) len_mult;
+
+    if (!setup_audiostream(sample, &desired))
+    {
+        funcs->close(sample);
+        restore_rw(internal, pos);  /* set for next try... */
+        return 0;
+    } /* if */
+
+    if ( (!USING_AUDIOSTREAM(internal)) &&
+         (sample->buffer_size * internal->sdlcvt.len_mult > internal->buffer_capacity) )
+    {
+        /* nothing's been decoded yet, so we can just swap buffers. */
+        Uint32 capacity;
+        void *rc = get_pooled_buffer(sample->buffer_size * internal->sdlcvt.len_mult, &capacity);
+        if (rc == NULL)
+        {
+            __Sound_FreeResampler(sample);
+            funcs->close(sample);
+            restore_rw(internal, pos);  /* set for next try... */
+            return 0;
+        } /* if */
+
+        put_pooled_buffer(sample->buffer, internal->buffer_capacity);
+        sample->buffer = rc;
+        internal->buffer_capacity = capacity;
+    } /* if */
+
+    internal->fastcvt = NULL;
+    if ( (internal->sdlcvt.needed) && (internal->resampler == NULL) &&
+         (!USING_AUDIOSTREAM(internal)) )
+        internal->fastcvt = __Sound_ChooseFastConvert(&sample->actual, &desired);
+
+    SDL_memcpy(&sample->desired, &desired, sizeof (Sound_AudioInfo));
+
+    if (!USING_AUDIOSTREAM(internal))
+    {
+            /* these pointers are all one and the same. */
+        internal->sdlcvt.buf = internal->buffer = sample->buffer;
+        internal->buffer_size = sample->buffer_size / internal->sdlcvt.len_mult;
+        internal->sdlcvt.len = internal->buffer_size;
+    } /* if */
+
+    SNDDBG(("New sample DESIRED format: %s format, %d rate, %d channels.\n",
+            fmt_to_str(sample->desired.format),
+            sample->desired.rate,
+            sample->desired.channels));
+
+    SNDDBG(("New sample ACTUAL format: %s format, %d rate, %d channels.\n",
+            fmt_to_str(sample->actual.format),
+            sample->actual.rate,
+            sample->actual.channels));
+
+    SNDDBG(("On-the-fly conversion: %s.\n",
+            internal->resampler ? "ENABLED (resampling)" :
+            USING_AUDIOSTREAM(internal) ? "ENABLED (streaming)" :
+            internal->fastcvt ? "ENABLED (fast path)" :
+            internal->sdlcvt.needed ? "ENABLED" : "DISABLED"));
+
+    return 1;
+} /* init_sample */
+
+
+/*
+ * Read the first few bytes of (rw) for the decoders' probe() methods, and
+ *  put the stream back where we found it. Returns the number of bytes read,
+ *  or zero if we can't peek at this stream, in which case no probing is done.
+ */
+static Uint32 read_probe_header(SDL_RWops *rw, Uint8 *buf, Uint32 len)
+{
+    const Sint64 pos = SDL_RWtell(rw);
+    size_t br;
+
+    if (pos < 0)
+        return 0;  /* not seekable, so we can't put the bytes back. */
+
+    br = SDL_RWread(rw, buf, 1, len);
+    if (SDL_RWseek(rw, pos, RW_SEEK_SET) != pos)
+        return 0;
+
+    return (Uint32) br;
+} /* read_probe_header */
+
+
+/*
+ * Find a decoder for the stream in (sample)'s internal->rw and init_sample()
+ *  with it: first the ones that claim (ext), then everything else that
+ *  might plausibly handle it. Returns non-zero once one has taken it.
+ */
+static int find_decoder(Sound_Sample *sample, const char *ext,
+                        Sound_AudioInfo *desired)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    decoder_element *decoder;
+    Uint8 header[SOUND_PROBE_BYTES];
+    Uint8 rejected[sizeof (decoders) / sizeof (decoders[0])];
+    Uint32 headerlen;
+
+    if (ext != NULL)
+    {
+        for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
+        {
+            const char **decoderExt = decoder->funcs->info.extensions;
+            while (*decoderExt)
+            {
+                if (SDL_strcasecmp(*decoderExt, ext) == 0)
+                {
+                    if ((decoder_available(decoder)) &&
+                        (init_sample(decoder->funcs, sample, ext, desired)))
+                        return 1;
+                    break;  /* done with this decoder either way. */
+                } /* if */
+                decoderExt++;
+            } /* while */
+        } /* for */
+    } /* if */
+
+    /*
+     * no direct extension match? Try everything we've got, but let each
+     *  decoder look at the start of the stream first, so we do a full
+     *  open() on the ones that could plausibly handle it before the rest.
+     *  Probes only see the first few bytes, and some formats (MP3) can have
+     *  any amount of junk before their first frame, so the decoders that
+     *  were ruled out still get a go afterwards.
+     */
+    headerlen = read_probe_header(internal->rw, header, sizeof (header));
+    SDL_memset(rejected, '\0', sizeof (rejected));
+    for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
+    {
+        int should_try = (SDL_AtomicGet(&decoder->state) != DECODER_FAILED);
+        const char **decoderExt = decoder->funcs->info.extensions;
+
+            /* skip if we would have tried decoder above... */
+        while ((should_try) && (ext != NULL) && (*decoderExt))
+        {
+            if (SDL_strcasecmp(*decoderExt, ext) == 0)
+            {
+                should_try = 0;
+                break;
+            } /* if */
+            decoderExt++;
+        } /* while */
+
+            /* put it off if the data doesn't look like this decoder's... */
+        if ((should_try) && (headerlen > 0) && (decoder->funcs->probe))
+        {
+            should_try = decoder->funcs->probe(header, headerlen, ext);
+            rejected[decoder - decoders] = !should_try;
+        } /* if */
+
+            /* only now is it worth getting the decoder ready... */
+        if ((should_try) && (decoder_available(decoder)))
+        {
+            if (init_sample(decoder->funcs, sample, ext, desired))
+                return 1;
+        } /* if */
+    } /* for */
+
+    /* nothing that liked the header took it; maybe a probe was wrong. */
+    for (decoder = &decoders[0]; decoder->funcs != NULL; decoder++)
+    {
+        if ((rejected[decoder - decoders]) && (decoder_available(decoder)))
+        {
+            if (init_sample(decoder->funcs, sample, ext, desired))
+                return 1;
+        } /* if */
+    } /* for */
+
+    /* nothing could handle the sound data... */
+    __Sound_SetError(ERR_UNSUPPORTED_FORMAT);
+    return 0;
+} /* find_decoder */
+
+
+Sound_Sample *Sound_NewSample(SDL_RWops *rw, const char *ext,
+                              Sound_AudioInfo *desired, Uint32 bSize)
+{
+    Sound_Sample *retval;
+
+    /* sanity checks. We own (rw) from here on, even if we fail. */
+    BAIL_IF_MACRO(rw == NULL, ERR_INVALID_ARGUMENT, NULL);
+    if (!initialized)
+    {
+        SDL_RWclose(rw);
+        BAIL_MACRO(ERR_NOT_INITIALIZED, NULL);
+    } /* if */
+
+    retval = alloc_sample(rw, desired, bSize);
+    if (!retval)
+    {
+        SDL_RWclose(rw);
+        return NULL;  /* alloc_sample() sets error message... */
+    } /* if */
+
+    /* memory streams are already as fast as they're going to get. */
+    if ((rw->type != SDL_RWOPS_MEMORY) && (rw->type != SDL_RWOPS_MEMORY_RO))
+    {
+        Sound_SampleInternal *internal = (Sound_SampleInternal *) retval->opaque;
+
+        /* count what really hits the app's RWops, under the read-ahead. */
+        if (internal->stats != NULL)
+        {
+            SDL_RWops *counted = __Sound_RWCounted(rw, internal->stats);
+            if (counted != NULL)  /* if this failed, just go without. */
+                rw = counted;
+        } /* if */
+
+        if (readahead_size > 0)
+        {
+            SDL_RWops *buffered = __Sound_RWBuffered(rw, readahead_size);
+            if (buffered != NULL)  /* if this failed, just go without. */
+                rw = buffered;
+        } /* if */
+
+        internal->rw = rw;
+    } /* if */
+
+    if (find_decoder(retval, ext, desired))
+    {
+        link_sample(retval);  /* put it on this thread's sample list. */
+        return retval;
+    } /* if */
+
+    release_sample(retval);
+    SDL_RWclose(rw);
+    return NULL;
+} /* Sound_NewSample */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Sound_Sample *__Sound_NewSampleWithDecoder(SDL_RWops *rw,
+                                           const Sound_DecoderFunctions *funcs,
+                                           void *decoder_private,
+                                           Sound_AudioInfo *desired,
+                                           Uint32 bufferSize)
+{
+    Sound_Sample *retval;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
+
+    retval = alloc_sample(rw, desired, bufferSize);
+    if (!retval)
+    {
+        SDL_RWclose(rw);
+        return NULL;  /* alloc_sample() sets error message... */
+    } /* if */
+
+    ((Sound_SampleInternal *) retval->opaque)->decoder_private = decoder_private;
+    if (!init_sample(funcs, retval, NULL, desired))
+    {
+        release_sample(retval);
+        SDL_RWclose(rw);
+        return NULL;
+    } /* if */
+
+    link_sample(retval);
+    return retval;
+} /* __Sound_NewSampleWithDecoder */
+
+
+Sound_Sample *Sound_NewSampleFromFile(const char *filename,
+                                      Sound_AudioInfo *desired,
+                                      Uint32 bufferSize)
+{
+    const char *ext;
+    SDL_RWops *rw;
+    Sound_Sample *retval;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
+    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    ext = SDL_strrchr(filename, '.');
+    if (ext != NULL)
+        ext++;
+
+    if (__Sound_CacheEnabled())
+        return __Sound_NewSampleFromFileCached(filename, ext, desired, bufferSize);
+
+    rw = SDL_RWFromFile(filename, "rb");
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+
+    retval = Sound_NewSample(rw, ext, desired, bufferSize);
+
+    /* remember this, so we can open the file again if we need to. */
+    if (retval != NULL)
+        ((Sound_SampleInternal *) retval->opaque)->filename = __Sound_StrDup(filename);
+
+    return retval;
+} /* Sound_NewSampleFromFile */
+
+
+Sound_Sample *Sound_NewSampleFromFileMapped(const char *filename,
+                                            Sound_AudioInfo *desired,
+                                            Uint32 bufferSize)
+{
+    const char *ext;
+    SDL_RWops *rw;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
+    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    if (__Sound_CacheEnabled())  /* the cache won't even open the file. */
+        return Sound_NewSampleFromFile(filename, desired, bufferSize);
+
+    rw = __Sound_RWFromMappedFile(filename);
+    if (rw == NULL)  /* can't map it? Do it the old-fashioned way. */
+        return Sound_NewSampleFromFile(filename, desired, bufferSize);
+
+    ext = SDL_strrchr(filename, '.');
+    if (ext != NULL)
+        ext++;
+
+    return Sound_NewSample(rw, ext, desired, bufferSize);
+} /* Sound_NewSampleFromFileMapped */
+
+
+Sound_Sample *Sound_NewSampleFromMem(const Uint8 *data,
+                                     Uint32 size,
+                                     const char *ext,
+                                     Sound_AudioInfo *desired,
+                                     Uint32 bufferSize)
+{
+    SDL_RWops *rw;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
+    BAIL_IF_MACRO(data == NULL, ERR_INVALID_ARGUMENT, NULL);
+    BAIL_IF_MACRO(size == 0, ERR_INVALID_ARGUMENT, NULL);
+
+    rw = SDL_RWFromConstMem(data, size);
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+
+    return Sound_NewSample(rw, ext, desired, bufferSize);
+} /* Sound_NewSampleFromMem */
+
+
+int Sound_ProbeInfo(SDL_RWops *rw, const char *ext,
+                    Sound_AudioInfo *info, Sint32 *duration)
+{
+    /* nothing outlives this call, so it doesn't need the sample pool. */
+    Sound_Sample sample;
+    Sound_SampleInternal internal;
+    int retval;
+
+    BAIL_IF_MACRO(rw == NULL, ERR_INVALID_ARGUMENT, 0);
+    if (!initialized)
+    {
+        SDL_RWclose(rw);
+        BAIL_MACRO(ERR_NOT_INITIALIZED, 0);
+    } /* if */
+
+    SDL_zero(sample);
+    SDL_zero(internal);
+    internal.rw = rw;
+    internal.probe_only = 1;
+    sample.opaque = &internal;
+
+    retval = find_decoder(&sample, ext, NULL);
+    if (retval)
+    {
+        if (info != NULL)
+            SDL_memcpy(info, &sample.actual, sizeof (Sound_AudioInfo));
+        if (duration != NULL)
+            *duration = internal.total_time;
+        internal.funcs->close(&sample);
+    } /* if */
+
+    SDL_RWclose(rw);
+    return retval;
+} /* Sound_ProbeInfo */
+
+
+int Sound_ProbeFileInfo(const char *filename,
+                        Sound_AudioInfo *info, Sint32 *duration)
+{
+    const char *ext;
+    SDL_RWops *rw;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    ext = SDL_strrchr(filename, '.');
+    if (ext != NULL)
+        ext++;
+
+    /* a mapping costs nothing until it's read, and lets ModPlug skip a copy. */
+    rw = __Sound_RWFromMappedFile(filename);
+    if (rw == NULL)
+        rw = SDL_RWFromFile(filename, "rb");
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), 0);
+
+    return Sound_ProbeInfo(rw, ext, info, duration);
+} /* Sound_ProbeFileInfo */
+
+
+void Sound_SetReadAheadSize(Uint32 size)
+{
+    readahead_size = size;
+} /* Sound_SetReadAheadSize */
+
+
+void Sound_SetDefaultResampleQuality(Sound_ResampleQuality quality)
+{
+    resample_quality = quality;
+} /* Sound_SetDefaultResampleQuality */
+
+
+void Sound_SetStreamingConversion(int enable)
+{
+    streaming_conversion = enable;
+} /* Sound_SetStreamingConversion */
+
+
+void Sound_SetModuleMixThreads(int threads)
+{
+    module_mix_threads = (threads < 0) ? 0 : threads;
+} /* Sound_SetModuleMixThreads */
+
+
+/* this is declared in the internal header. */
+int __Sound_ModuleMixThreads(void)
+{
+    return module_mix_threads;
+} /* __Sound_ModuleMixThreads */
+
+
+void Sound_FlushPatchCache(void)
+{
+    if (!initialized)
+    {
+        __Sound_SetError(ERR_NOT_INITIALIZED);
+        return;
+    } /* if */
+
+#if SOUND_SUPPORTS_MODPLUG
+    __Sound_FlushModulePatches();
+#endif
+} /* Sound_FlushPatchCache */
+
+
+void Sound_SetDefaultDecodeQuality(Sound_DecodeQuality quality)
+{
+    decode_quality = quality;
+} /* Sound_SetDefaultDecodeQuality */
+
+
+void Sound_EnableStats(int enable)
+{
+    stats_enabled = enable;
+} /* Sound_EnableStats */
+
+
+void Sound_SetTraceHooks(const Sound_TraceHooks *hooks)
+{
+    SDL_AtomicLock(&trace_lock);
+    if ((hooks == NULL) || ((hooks->begin == NULL) && (hooks->end == NULL)))
+    {
+        tracing = 0;
+        SDL_zero(trace_hooks);
+    } /* if */
+    else
+    {
+        SDL_memcpy(&trace_hooks, hooks, sizeof (Sound_TraceHooks));
+        tracing = 1;
+    } /* else */
+    SDL_AtomicUnlock(&trace_lock);
+} /* Sound_SetTraceHooks */
+
+
+/* (stats) holds performance counter ticks where nanoseconds should be. */
+static void stats_ticks_to_ns(Sound_Stats *stats)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 *t[3];
+    int i;
+
+    t[0] = &stats->decode_ns;
+    t[1] = &stats->convert_ns;
+    t[2] = &stats->io_ns;
+    for (i = 0; i < 3; i++)  /* split up so this doesn't overflow. */
+        *t[i] = ((*t[i] / freq) * 1000000000) + (((*t[i] % freq) * 1000000000) / freq);
+} /* stats_ticks_to_ns */
+
+
+static void stats_add(Sound_Stats *dst, const Sound_Stats *src)
+{
+    dst->encoded_bytes += src->encoded_bytes;
+    dst->pcm_bytes += src->pcm_bytes;
+    dst->decode_ns += src->decode_ns;
+    dst->convert_ns += src->convert_ns;
+    dst->io_ns += src->io_ns;
+    dst->decode_calls += src->decode_calls;
+    dst->rw_reads += src->rw_reads;
+    dst->rw_seeks += src->rw_seeks;
+    dst->samples += src->samples;
+} /* stats_add */
+
+
+int Sound_GetStats(Sound_Sample *sample, Sound_Stats *stats)
+{
+    Sound_SampleInternal *internal;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(stats == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+    BAIL_IF_MACRO(internal->stats == NULL, ERR_NOT_SUPPORTED, 0);
+
+    SDL_memcpy(stats, internal->stats, sizeof (Sound_Stats));
+    stats_ticks_to_ns(stats);
+    return 1;
+} /* Sound_GetStats */
+
+
+int Sound_GetDecoderStats(const Sound_DecoderInfo *decoder, Sound_Stats *stats)
+{
+    decoder_element *element;
+    Sound_Sample *i;
+    int shard;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(decoder == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(stats == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    for (element = &decoders[0]; element->funcs != NULL; element++)
+    {
+        if (&element->funcs->info == decoder)
+            break;
+    } /* for */
+    BAIL_IF_MACRO(element->funcs == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    /*
+     * Hold every list at once, so a sample being freed is counted exactly
+     *  once. Sound_FreeSample() only ever holds one list, and takes
+     *  stats_mutex after it, so locking in this order can't deadlock.
+     */
+    for (shard = 0; shard < SAMPLELIST_SHARDS; shard++)
+        SDL_LockMutex(sample_lists[shard].mutex);
+    SDL_LockMutex(stats_mutex);
+
+    SDL_memcpy(stats, &element->totals, sizeof (Sound_Stats));
+    for (shard = 0; shard < SAMPLELIST_SHARDS; shard++)
+    {
+        for (i = sample_lists[shard].head; i != NULL; )
+        {
+            Sound_SampleInternal *internal = (Sound_SampleInternal *) i->opaque;
+            if ((i->decoder == decoder) && (internal->stats != NULL))
+                stats_add(stats, internal->stats);
+            i = internal->next;
+        } /* for */
+    } /* for */
+
+    SDL_UnlockMutex(stats_mutex);
+    for (shard = SAMPLELIST_SHARDS; shard > 0; shard--)
+        SDL_UnlockMutex(sample_lists[shard - 1].mutex);
+
+    stats_ticks_to_ns(stats);
+    return 1;
+} /* Sound_GetDecoderStats */
+
+
+void Sound_FreeSample(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    SampleListShard *list;
+
+    if (!initialized)
+    {
+        __Sound_SetError(ERR_NOT_INITIALIZED);
+        return;
+    } /* if */
+
+    if (sample == NULL)
+    {
+        __Sound_SetError(ERR_INVALID_ARGUMENT);
+        return;
+    } /* if */
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    __Sound_MixRemoveSample(sample);
+    Sound_StopStreaming(sample);
+
+    list = &sample_lists[internal->list_shard];
+    SDL_LockMutex(list->mutex);
+
+    /* update the sample list... */
+    if (internal->prev != NULL)
+    {
+        Sound_SampleInternal *prevInternal;
+        prevInternal = (Sound_SampleInternal *) internal->prev->opaque;
+        prevInternal->next = internal->next;
+    } /* if */
+    else
+    {
+        SDL_assert(list->head == sample);
+        list->head = internal->next;
+    } /* else */
+
+    if (internal->next != NULL)
+    {
+        Sound_SampleInternal *nextInternal;
+        nextInternal = (Sound_SampleInternal *) internal->next->opaque;
+        nextInternal->prev = internal->prev;
+    } /* if */
+
+    /* keep the numbers for Sound_GetDecoderStats(). */
+    if ((internal->stats != NULL) && (sample->decoder != NULL))
+    {
+        decoder_element *element;
+        for (element = &decoders[0]; element->funcs != NULL; element++)
+        {
+            if (&element->funcs->info == sample->decoder)
+            {
+                SDL_LockMutex(stats_mutex);
+                stats_add(&element->totals, internal->stats);
+                SDL_UnlockMutex(stats_mutex);
+                break;
+            } /* if */
+        } /* for */
+    } /* if */
+
+    SDL_UnlockMutex(list->mutex);
+
+    /* nuke it... */
+    if (!internal->suspended)  /* Sound_Suspend() already closed it. */
+        internal->funcs->close(sample);
+
+    if (internal->rw != NULL)  /* this condition is a "just in case" thing. */
+        SDL_RWclose(internal->rw);
+
+    release_sample(sample);
+} /* Sound_FreeSample */
+
+
+/*
+ * Loop regions. The first buffer of the region is decoded once, into
+ *  internal->loop_head. Each time Sound_Decode() reaches the end of the
+ *  region, that buffer is copied out right behind the region's last frames,
+ *  and the decoder seeks to just past it at the start of the next call,
+ *  instead of in the middle of the call that has the loop point in it.
+ */
+static void free_loop_head(Sound_SampleInternal *internal)
+{
+    if (internal->loop_head != NULL)
+        __Sound_Free(internal->loop_head);
+    internal->loop_head = NULL;
+    internal->loop_head_len = internal->loop_head_pos = 0;
+    internal->loop_head_all = 0;
+    internal->loop_seek_pending = 0;
+} /* free_loop_head */
+
+
+/* The app moved the sample; forget the rest of the current wrap. */
+static SDL_INLINE void cancel_loop_wrap(Sound_SampleInternal *internal)
+{
+    internal->loop_head_pos = internal->loop_head_len;
+    internal->loop_seek_pending = 0;
+} /* cancel_loop_wrap */
+
+
+int Sound_SetLoop(Sound_Sample *sample, Uint64 start, Uint64 end, Sint32 count)
+{
+    Sound_SampleInternal *internal;
+    int reposition;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(count < -1, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO((end != 0) && (end <= start), ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    /* these call Sound_Decode() from another thread. */
+    BAIL_IF_MACRO(internal->mix_active, ERR_NOT_SUPPORTED, 0);
+    BAIL_IF_MACRO(internal->stream != NULL, ERR_NOT_SUPPORTED, 0);
+
+    if ((count != 0) && (start > 0) && (!(sample->flags & SOUND_SAMPLEFLAG_CANSEEK)))
+        BAIL_MACRO(ERR_CANNOT_SEEK, 0);
+
+    /* if we're partway through a wrap, the decoder isn't where we are. */
+    reposition = ( (internal->loop_seek_pending) ||
+                   (internal->loop_head_pos < internal->loop_head_len) );
+
+    free_loop_head(internal);  /* the old region's head is no good now. */
+    internal->loop_seek_pending = reposition;
+    internal->loop_count = count;
+    internal->loop_start = start;
+    internal->loop_end = end;
+    return 1;
+} /* Sound_SetLoop */
+
+
+/*
+ * Hibernation. A suspended sample keeps its Sound_Sample, its RWops, its
+ *  conversion setup and its place in the sample list, but its decoder is
+ *  closed and its buffers are freed. Waking it opens the decoder again from
+ *  where it opened the first time, and seeks back to internal->frame_pos.
+ */
+int Sound_Suspend(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    if (internal->suspended)
+        return 1;
+
+    /* these would lose data that's decoded but not handed out yet. */
+    BAIL_IF_MACRO(internal->mix_active, ERR_NOT_SUPPORTED, 0);
+    BAIL_IF_MACRO(internal->stream != NULL, ERR_NOT_SUPPORTED, 0);
+    BAIL_IF_MACRO(internal->decoded_all, ERR_NOT_SUPPORTED, 0);
+
+    /* instances and their parents share data; they're cheap already. */
+    BAIL_IF_MACRO(__Sound_IsInstance(sample), ERR_NOT_SUPPORTED, 0);
+    BAIL_IF_MACRO(internal->shared_pcm != NULL, ERR_NOT_SUPPORTED, 0);
+    BAIL_IF_MACRO(internal->rw == NULL, ERR_NOT_SUPPORTED, 0);
+
+    /* cached PCM is shared, too, and its decoder can't reopen on its own. */
+    BAIL_IF_MACRO(internal->funcs->info.extensions[0] == NULL, ERR_NOT_SUPPORTED, 0);
+
+    /* if we can't seek, we can only come back at the start (or the end). */
+    if ( (internal->frame_pos > 0) &&
+         (!(sample->flags & SOUND_SAMPLEFLAG_CANSEEK)) &&
+         (!(sample->flags & SOUND_SAMPLEFLAG_EOF)) )
+    {
+        BAIL_MACRO(ERR_CANNOT_SEEK, 0);
+    } /* if */
+
+    internal->funcs->close(sample);
+    internal->decoder_private = NULL;
+
+    /* the pool can hand it to whoever's awake; Sound_TrimSamplePool() frees it. */
+    if ((internal->buffer != NULL) && (internal->buffer != sample->buffer))
+        __Sound_Free(internal->buffer);
+    put_pooled_buffer(sample->buffer, internal->buffer_capacity);
+    internal->sdlcvt.buf = internal->buffer = sample->buffer = NULL;
+    reset_audiostream(internal);
+    free_loop_head(internal);  /* waking up seeks to frame_pos anyhow. */
+
+    internal->suspended = 1;
+    return 1;
+} /* Sound_Suspend */
+
+
+/*
+ * Open a suspended sample's decoder again, and give it back its buffers.
+ *  It's left at the start of the stream, with internal->frame_pos at zero.
+ */
+static int reopen_sample(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Sound_DecoderFunctions *funcs = internal->funcs;
+    Sound_AudioInfo actual;
+    Uint32 capacity;
+
+    SDL_memcpy(&actual, &sample->actual, sizeof (Sound_AudioInfo));
+
+    BAIL_IF_MACRO(SDL_RWseek(internal->rw, internal->open_pos, RW_SEEK_SET) != internal->open_pos, ERR_IO_ERROR, 0);
+    if (!decoder_open(funcs, sample, internal->open_ext))
+    {
+        internal->decoder_private = NULL;
+        return 0;
+    } /* if */
+
+    /* the conversion was built for the old format; it had better match. */
+    if ( (sample->actual.format != actual.format) ||
+         (sample->actual.channels != actual.channels) ||
+         (sample->actual.rate != actual.rate) )
+    {
+        funcs->close(sample);
+        internal->decoder_private = NULL;
+        SDL_memcpy(&sample->actual, &actual, sizeof (Sound_AudioInfo));
+        BAIL_MACRO(ERR_UNSUPPORTED_FORMAT, 0);
+    } /* if */
+
+    sample->buffer = get_pooled_buffer(internal->buffer_capacity, &capacity);
+    if ((sample->buffer != NULL) && (USING_AUDIOSTREAM(internal)))
+    {
+        internal->buffer = __Sound_Malloc(internal->buffer_size);
+        if (internal->buffer == NULL)
+        {
+            put_pooled_buffer(sample->buffer, capacity);
+            sample->buffer = NULL;
+        } /* if */
+    } /* if */
+
+    if (sample->buffer == NULL)
+    {
+        funcs->close(sample);
+        internal->decoder_private = NULL;
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
+    } /* if */
+
+    internal->buffer_capacity = capacity;
+    if (!USING_AUDIOSTREAM(internal))
+        internal->sdlcvt.buf = internal->buffer = sample->buffer;
+
+    __Sound_ResetResampler(sample);
+    reset_audiostream(internal);
+    internal->frame_pos = 0;
+    internal->suspended = 0;
+    return 1;
+} /* reopen_sample */
+
+
+int Sound_Resume(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    Sound_SampleFlags flags;
+    Uint64 frame;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    if (!internal->suspended)
+        return 1;
+
+    flags = sample->flags;
+    frame = internal->frame_pos;
+    if (!reopen_sample(sample))
+        return 0;  /* still suspended; the app can try again. */
+
+    if (flags & SOUND_SAMPLEFLAG_EOF)  /* nothing left to go back to. */
+    {
+        internal->frame_pos = frame;
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+    } /* if */
+    else if ((frame > 0) && (!Sound_SeekFrames(sample, frame)))
+    {
+        /* don't let it quietly start over from the top. */
+        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+        return 0;
+    } /* else if */
+
+    sample->flags |= (flags & SOUND_SAMPLEFLAG_ERROR);
+    return 1;
+} /* Sound_Resume */
+
+
+/* Sound_Resume(), without the checks, for the decode and seek paths. */
+static SDL_INLINE int wake_sample(Sound_Sample *sample)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    return internal->suspended ? Sound_Resume(sample) : 1;
+} /* wake_sample */
+
+
+int Sound_IsSuspended(Sound_Sample *sample)
+{
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    return ((Sound_SampleInternal *) sample->opaque)->suspended;
+} /* Sound_IsSuspended */
+
+
+Uint32 Sound_GetMemoryUsage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    Uint32 retval = sizeof (PooledSample);
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    /* instances point into shared data; that belongs to the parent. */
+    if ((sample->buffer != NULL) && (internal->shared_pcm == NULL) &&
+        (!__Sound_IsInstance(sample)))
+    {
+        retval += internal->buffer_capacity;
+    } /* if */
+
+    if ((internal->buffer != NULL) && (internal->buffer != sample->buffer))
+        retval += internal->buffer_size;
+
+    if (internal->stats != NULL)
+        retval += sizeof (Sound_Stats);
+
+    if (internal->loop_head != NULL)
+        retval += internal->loop_head_len;
+
+    retval += __Sound_ResamplerMemory(sample);
+
+    if ((!internal->suspended) && (internal->funcs->memory_usage != NULL))
+        retval += internal->funcs->memory_usage(sample);
+
+    return retval;
+} /* Sound_GetMemoryUsage */
+
+
+/*
+ * If Sound_NewInstance() is sharing this sample's buffer, get a new one for
+ *  this sample, so the instances' data doesn't change under them. (size) is
+ *  the sample->buffer_size this new buffer will be used for.
+ */
+static int unshare_buffer(Sound_Sample *sample, Uint32 size)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint32 capacity;
+    void *buf;
+
+    if (internal->shared_pcm == NULL)
+        return 1;
+
+    if (!USING_AUDIOSTREAM(internal))
+        size *= internal->sdlcvt.len_mult;
+    buf = get_pooled_buffer(size, &capacity);
+    BAIL_IF_MACRO(buf == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    if (internal->buffer == sample->buffer)
+        internal->sdlcvt.buf = internal->buffer = buf;
+    sample->buffer = buf;
+    internal->buffer_capacity = capacity;
+
+    __Sound_ReleaseSharedPCM(internal->shared_pcm);
+    internal->shared_pcm = NULL;
+    return 1;
+} /* unshare_buffer */
+
+
+int Sound_SetBufferSize(Sound_Sample *sample, Uint32 newSize)
+{
+    void *newBuf = NULL;
+    Sound_SampleInternal *internal = NULL;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = ((Sound_SampleInternal *) sample->opaque);
+
+    if (__Sound_IsInstance(sample))  /* just changes how much we hand out. */
+    {
+        sample->buffer_size = newSize;
+        return 1;
+    } /* if */
+
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+    BAIL_IF_MACRO(!unshare_buffer(sample, newSize), NULL, 0);
+    internal->decoded_all = 0;
+
+#if SOUND_HAVE_AUDIOSTREAM
+    if (USING_AUDIOSTREAM(internal))
+    {
+        const Uint32 len = audiostream_decode_size(sample, &sample->desired, newSize);
+        newBuf = __Sound_Realloc(sample->buffer, newSize);
+        BAIL_IF_MACRO(newBuf == NULL, ERR_OUT_OF_MEMORY, 0);
+        sample->buffer = newBuf;
+        internal->buffer_capacity = newSize;
+        sample->buffer_size = newSize;
+
+        /* if this fails, the old decode buffer still works fine. */
+        newBuf = __Sound_Realloc(internal->buffer, len);
+        if (newBuf != NULL)
+        {
+            internal->buffer = newBuf;
+            internal->buffer_size = len;
+        } /* if */
+        return 1;
+    } /* if */
+#endif
+
+    newBuf = __Sound_Realloc(sample->buffer, newSize * internal->sdlcvt.len_mult);
+    BAIL_IF_MACRO(newBuf == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    internal->sdlcvt.buf = internal->buffer = sample->buffer = newBuf;
+    internal->buffer_capacity = newSize * internal->sdlcvt.len_mult;
+    sample->buffer_size = newSize;
+    internal->buffer_size = newSize / internal->sdlcvt.len_mult;
+    internal->sdlcvt.len = internal->buffer_size;
+
+    return 1;
+} /* Sound_SetBufferSize */
+
+
+/*
+ * Automatic buffer sizing. Sound_Decode() times itself over a window of
+ *  AUTOBUFFER_WINDOW calls; a consumer that keeps up with playback gets
+ *  about AUTOBUFFER_LATENCY_MS worth of audio per call, one that pulls
+ *  faster than that, or spends most of its time waiting on the decoder,
+ *  gets the buffer doubled each window until autobuf_max. Sizes are
+ *  rounded to whole decoder blocks so no read() leaves a partial block
+ *  behind to be carried over.
+ */
+#define AUTOBUFFER_WINDOW 16
+#define AUTOBUFFER_LATENCY_MS 50
+
+/* Round (size) up to whole decoder blocks, within [one block, autobuf_max]. */
+static Uint32 autobuffer_align(const Sound_Sample *sample, Uint64 size)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    const Uint32 maxsize = internal->autobuf_max - (internal->autobuf_max % framesize);
+    Uint64 unit = framesize;
+
+    if ((internal->block_frames > 0) && (sample->actual.rate > 0))
+    {
+        /* a block of decoder output, in frames after rate conversion. */
+        const Uint64 frames = (((Uint64) internal->block_frames * sample->desired.rate)
+                                + sample->actual.rate - 1) / sample->actual.rate;
+        unit = frames * framesize;
+    } /* if */
+
+    if (unit > maxsize)
+        unit = framesize;  /* blocks are bigger than we're allowed; just frames. */
+
+    size = ((size + unit - 1) / unit) * unit;
+    if (size < unit)
+        size = unit;
+    else if (size > maxsize)
+        size = maxsize - (maxsize % unit);
+
+    return (Uint32) size;
+} /* autobuffer_align */
+
+
+static void autobuffer_reset(Sound_SampleInternal *internal, Uint64 now)
+{
+    internal->autobuf_calls = 0;
+    internal->autobuf_bytes = 0;
+    internal->autobuf_ticks = 0;
+    internal->autobuf_start = now;
+} /* autobuffer_reset */
+
+
+int Sound_SetAutoBufferSize(Sound_Sample *sample, Uint32 maxSize)
+{
+    Sound_SampleInternal *internal = NULL;
+    Uint32 framesize;
+    Uint64 size;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = ((Sound_SampleInternal *) sample->opaque);
+
+    if (maxSize == 0)
+    {
+        internal->autobuf_max = 0;
+        return 1;  /* leave the buffer the size it is now. */
+    } /* if */
+
+    framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                    * sample->desired.channels;
+    BAIL_IF_MACRO(maxSize < framesize, ERR_INVALID_ARGUMENT, 0);
+
+    /* start out assuming a realtime consumer; the first window corrects it. */
+    internal->autobuf_max = maxSize;
+    size = ((Uint64) sample->desired.rate * framesize * AUTOBUFFER_LATENCY_MS) / 1000;
+    size = autobuffer_align(sample, size);
+    autobuffer_reset(internal, SDL_GetPerformanceCounter());
+
+    if ((Uint32) size == sample->buffer_size)
+        return 1;
+
+    if (!Sound_SetBufferSize(sample, (Uint32) size))
+    {
+        internal->autobuf_max = 0;
+        return 0;  /* Sound_SetBufferSize() set the error. */
+    } /* if */
+
+    return 1;
+} /* Sound_SetAutoBufferSize */
+
+
+int Sound_SetResampleQuality(Sound_Sample *sample, Sound_ResampleQuality quality)
+{
+    Sound_SampleInternal *internal = NULL;
+    struct __SOUND_RESAMPLER__ *oldresampler;
+    SDL_AudioCVT cvt;
+    Uint32 len_mult;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = ((Sound_SampleInternal *) sample->opaque);
+    BAIL_IF_MACRO(USING_AUDIOSTREAM(internal), ERR_NOT_SUPPORTED, 0);
+
+    if (__Sound_IsInstance(sample))
+        return 1;  /* never converts anything. */
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+    BAIL_IF_MACRO(!unshare_buffer(sample, sample->buffer_size), NULL, 0);
+
+    if (SDL_BuildAudioCVT(&cvt, sample->actual.format, sample->actual.channels,
+                          sample->actual.rate, sample->desired.format,
+                          sample->desired.channels, sample->desired.rate) == -1)
+        BAIL_MACRO(SDL_GetError(), 0);
+
+    /* keep the old resampler around until we know the new one works. */
+    oldresampler = internal->resampler;
+    internal->resampler = NULL;
+    len_mult = __Sound_SetupResampler(sample, &sample->desired, quality);
+    if ((internal->resampler != NULL) && (len_mult > (Uint32) cvt.len_mult))
+        cvt.len_mult = (int) len_mult;
+
+    if ((len_mult != 0) && (sample->buffer_size * cvt.len_mult > internal->buffer_capacity))
+    {
+        void *newBuf = __Sound_Realloc(sample->buffer, sample->buffer_size * cvt.len_mult);
+        if (newBuf == NULL)
+        {
+            __Sound_SetError(ERR_OUT_OF_MEMORY);
+            len_mult = 0;
+        } /* if */
+        else
+        {
+            internal->buffer = sample->buffer = newBuf;
+            internal->buffer_capacity = sample->buffer_size * cvt.len_mult;
+        } /* else */
+    } /* if */
+
+    if (len_mult == 0)
+    {
+        __Sound_FreeResampler(sample);
+        internal->resampler = oldresampler;
+        return 0;
+    } /* if */
+
+    if (oldresampler != NULL)
+    {
+        struct __SOUND_RESAMPLER__ *newresampler = internal->resampler;
+        internal->resampler = oldresampler;
+        __Sound_FreeResampler(sample);
+        internal->resampler = newresampler;
+    } /* if */
+
+    SDL_memcpy(&internal->sdlcvt, &cvt, sizeof (SDL_AudioCVT));
+    internal->fastcvt = NULL;
+    if ((internal->sdlcvt.needed) && (internal->resampler == NULL))
+        internal->fastcvt = __Sound_ChooseFastConvert(&sample->actual, &sample->desired);
+
+    internal->resample_quality = quality;
+    internal->sdlcvt.buf = internal->buffer;
+    internal->buffer_size = sample->buffer_size / internal->sdlcvt.len_mult;
+    internal->sdlcvt.len = internal->buffer_size;
+
+    return 1;
+} /* Sound_SetResampleQuality */
+
+
+/* Convert (len) decoded bytes at internal->sdlcvt.buf; returns new length. */
+static Uint32 run_conversion(Sound_SampleInternal *internal, Uint32 len)
+{
+    if (internal->fastcvt != NULL)
+        return internal->fastcvt((Uint8 *) internal->sdlcvt.buf, len);
+
+    internal->sdlcvt.len = len;
+    SDL_ConvertAudio(&internal->sdlcvt);
+    return internal->sdlcvt.len_cvt;
+} /* run_conversion */
+
+
+/* run_conversion(), traced. */
+static Uint32 convert_decoded(Sound_Sample *sample, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint32 retval;
+
+    if (!tracing)
+        return run_conversion(internal, len);
+
+    trace_event(0, SOUND_TRACE_CONVERT, sample, len);
+    retval = run_conversion(internal, len);
+    trace_event(1, SOUND_TRACE_CONVERT, sample, retval);
+    return retval;
+} /* convert_decoded */
+
+
+/*
+ * Run the decoder's read() method into (buf), which has room for (bufsize)
+ *  bytes of converted audio, and convert it to the desired format in place.
+ *  The decoder gets told the buffer is (bufsize / len_mult) bytes, so the
+ *  conversion can't overflow it.
+ */
+static Uint32 decode_into_buffer(Sound_Sample *sample, Uint8 *buf, Uint32 bufsize)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 samplesize = (SDL_AUDIO_BITSIZE(sample->actual.format) / 8)
+                                * sample->actual.channels;
+    void *saved_buffer = internal->buffer;
+    const Uint32 saved_buffer_size = internal->buffer_size;
+    Uint32 chunk = bufsize / internal->sdlcvt.len_mult;
+    Uint32 retval = 0;
+
+    if (internal->resampler != NULL)
+    {
+        const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                    * sample->desired.channels;
+        sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+        return __Sound_Resample(sample, buf, bufsize, bufsize / framesize);
+    } /* if */
+
+    if (USING_AUDIOSTREAM(internal))
+    {
+        sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+        return audiostream_decode(sample, buf, bufsize);
+    } /* if */
+
+    if (samplesize > 0)
+        chunk -= chunk % samplesize;  /* don't hand the decoder a partial frame. */
+    BAIL_IF_MACRO(chunk == 0, ERR_INVALID_ARGUMENT, 0);
+
+    internal->buffer = buf;
+    internal->buffer_size = chunk;
+
+        /* reset EAGAIN. Decoder can flip it back on if it needs to. */
+    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+    retval = __Sound_DecoderRead(sample);
+
+    internal->buffer = saved_buffer;
+    internal->buffer_size = saved_buffer_size;
+
+    if (retval > 0 && internal->sdlcvt.needed)
+    {
+        internal->sdlcvt.buf = buf;
+        retval = convert_decoded(sample, retval);
+        internal->sdlcvt.buf = saved_buffer;
+        internal->sdlcvt.len = saved_buffer_size;
+    } /* if */
+
+    return retval;
+} /* decode_into_buffer */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_DecoderRead(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint64 start = 0;
+    Uint32 retval;
+
+    if ((internal->stats == NULL) && (!tracing))
+        return internal->funcs->read(sample);
+
+    if (tracing)
+        trace_event(0, SOUND_TRACE_READ, sample, internal->buffer_size);
+    if (internal->stats != NULL)
+        start = SDL_GetPerformanceCounter();
+
+    retval = internal->funcs->read(sample);
+
+    if (internal->stats != NULL)
+        internal->stats->decode_ns += SDL_GetPerformanceCounter() - start;
+    if (tracing)
+        trace_event(1, SOUND_TRACE_READ, sample, retval);
+    return retval;
+} /* __Sound_DecoderRead */
+
+
+/* Move Sound_TellFrames() along by (len) bytes of decoded, converted audio. */
+static void advance_frame_pos(Sound_Sample *sample, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    if (framesize > 0)
+        internal->frame_pos += len / framesize;
+} /* advance_frame_pos */
+
+
+/*
+ * Add a call that produced (len) bytes to a sample's stats. It started at
+ *  performance counter (start), when the decoder time was (decode_before);
+ *  whatever time wasn't spent in the decoder went to conversion.
+ */
+static void count_decode(Sound_SampleInternal *internal, Uint32 len,
+                         Uint64 start, Uint64 decode_before)
+{
+    Sound_Stats *stats = internal->stats;
+    const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    const Uint64 decoding = stats->decode_ns - decode_before;
+    stats->convert_ns += (elapsed > decoding) ? (elapsed - decoding) : 0;
+    stats->pcm_bytes += len;
+    stats->decode_calls++;
+} /* count_decode */
+
+
+static Uint32 decode_to_buffer(Sound_Sample *sample, Uint8 *buf, Uint32 bufsize)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint64 start, decode_before;
+    Uint32 retval;
+
+    if (internal->stats == NULL)
+        retval = decode_into_buffer(sample, buf, bufsize);
+    else
+    {
+        start = SDL_GetPerformanceCounter();
+        decode_before = internal->stats->decode_ns;
+        retval = decode_into_buffer(sample, buf, bufsize);
+        count_decode(internal, retval, start, decode_before);
+    } /* else */
+
+    advance_frame_pos(sample, retval);
+    return retval;
+} /* decode_to_buffer */
+
+
+/*
+ * Sound_Decode(), after the sanity checks. Decodes at most (len) bytes into
+ *  sample->buffer; (len) is normally sample->buffer_size.
+ */
+static Uint32 decode_sample(Sound_Sample *sample, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint32 retval = 0;
+
+        /* reset EAGAIN. Decoder can flip it back on if it needs to. */
+    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+
+    if (__Sound_IsInstance(sample))
+        return __Sound_InstanceDecode(sample, len);
+
+    BAIL_IF_MACRO(!unshare_buffer(sample, sample->buffer_size), NULL, 0);
+    internal->decoded_all = 0;
+
+    SDL_assert(sample->buffer != NULL);
+    SDL_assert(sample->buffer_size > 0);
+    SDL_assert(internal->buffer != NULL);
+    SDL_assert(internal->buffer_size > 0);
+
+    if (len < sample->buffer_size)  /* less than usual; ask for less. */
+        return decode_into_buffer(sample, (Uint8 *) sample->buffer, len);
+
+    if (internal->resampler != NULL)
+    {
+        const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                    * sample->desired.channels;
+        return __Sound_Resample(sample, (Uint8 *) sample->buffer,
+                                internal->buffer_capacity,
+                                sample->buffer_size / framesize);
+    } /* if */
+
+    if (USING_AUDIOSTREAM(internal))
+        return audiostream_decode(sample, (Uint8 *) sample->buffer, sample->buffer_size);
+
+    retval = __Sound_DecoderRead(sample);
+
+    if (retval > 0 && internal->sdlcvt.needed)
+        retval = convert_decoded(sample, retval);
+
+    return retval;
+} /* decode_sample */
+
+
+/* decode_sample(), counting it in the stats if they're on. */
+static Uint32 decode_sample_counted(Sound_Sample *sample, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint64 start, decode_before;
+    Uint32 retval;
+
+    if (internal->stats == NULL)
+        retval = decode_sample(sample, len);
+    else
+    {
+        start = SDL_GetPerformanceCounter();
+        decode_before = internal->stats->decode_ns;
+        retval = decode_sample(sample, len);
+        count_decode(internal, retval, start, decode_before);
+    } /* else */
+
+    advance_frame_pos(sample, retval);
+    return retval;
+} /* decode_sample_counted */
+
+
+/*
+ * Playback hit the end of the loop region (or EOF): go back to its start,
+ *  and put as much of the loop head in (buf) as (len) allows. Returns the
+ *  bytes put there, which can be zero if we had to decode from the start.
+ */
+static Uint32 loop_wrap(Sound_Sample *sample, Uint8 *buf, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    Uint32 cpy;
+
+    if (internal->loop_count > 0)
+        internal->loop_count--;
+    sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
+
+    if (!(sample->flags & SOUND_SAMPLEFLAG_CANSEEK))
+    {
+        /* Sound_SetLoop() made sure the region starts at zero. */
+        Sound_Rewind(sample);  /* sets the error flag if it fails. */
+        return 0;
+    } /* if */
+
+    if (internal->loop_head == NULL)  /* first time around; fetch it. */
+    {
+        Uint32 headsize = sample->buffer_size;
+        Uint64 region;
+
+        if (!Sound_SeekFrames(sample, internal->loop_start))
+        {
+            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+            return 0;
+        } /* if */
+
+        if (internal->loop_end != 0)
+        {
+            region = (internal->loop_end - internal->loop_start) * framesize;
+            if (region < headsize)
+                headsize = (Uint32) region;
+        } /* if */
+
+        internal->loop_head = (Uint8 *) __Sound_Malloc(headsize);
+        if (internal->loop_head == NULL)
+            return 0;  /* no head this time; just decode the start again. */
+
+        internal->loop_head_len = decode_to_buffer(sample, internal->loop_head, headsize);
+        internal->loop_seek_pending = 0;  /* decoder is right after the head. */
+        if ((internal->loop_head_len == 0) || (sample->flags & SOUND_SAMPLEFLAG_ERROR))
+        {
+            /* nothing in the region, and spinning on it won't help. */
+            free_loop_head(internal);
+            internal->loop_count = 0;
+            if (!(sample->flags & SOUND_SAMPLEFLAG_ERROR))
+                sample->flags |= SOUND_SAMPLEFLAG_EOF;
+            return 0;
+        } /* if */
+
+        /* if the whole region fits in the head, wraps never touch the decoder. */
+        if (sample->flags & SOUND_SAMPLEFLAG_EOF)
+        {
+            internal->loop_end = internal->loop_start + (internal->loop_head_len / framesize);
+            internal->loop_head_all = 2;
+            sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
+        } /* if */
+        else if (internal->loop_head_len == headsize)
+        {
+            if ((internal->loop_end != 0) &&
+                (internal->loop_start + (headsize / framesize) == internal->loop_end))
+                internal->loop_head_all = 1;
+        } /* else if */
+    } /* if */
+    else
+    {
+        /* it's still at the end, unless the head is all there is. */
+        internal->loop_seek_pending = !internal->loop_head_all;
+    } /* else */
+
+    cpy = SDL_min(len, internal->loop_head_len);
+    SDL_memcpy(buf, internal->loop_head, cpy);
+    internal->loop_head_pos = cpy;
+    internal->frame_pos = internal->loop_start + (cpy / framesize);
+    return cpy;
+} /* loop_wrap */
+
+
+/* Is Sound_Decode() in a loop region, or still finishing one? */
+static SDL_INLINE int loop_active(const Sound_SampleInternal *internal)
+{
+    return ( (internal->loop_count != 0) || (internal->loop_seek_pending) ||
+             (internal->loop_head_pos < internal->loop_head_len) );
+} /* loop_active */
+
+
+/* decode_sample_counted() for Sound_Decode(), with a loop region. */
+static Uint32 loop_decode(Sound_Sample *sample, Uint32 size)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    Uint8 *buf;
+    Uint32 retval = 0;
+
+    BAIL_IF_MACRO(!unshare_buffer(sample, sample->buffer_size), NULL, 0);
+    internal->decoded_all = 0;
+    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+    buf = (Uint8 *) sample->buffer;
+
+    while (retval < size)
+    {
+        Uint32 want = size - retval;
+        Uint32 br;
+
+        if (internal->loop_head_pos < internal->loop_head_len)
+        {
+            /* the rest of the head from the last wrap. */
+            br = SDL_min(want, internal->loop_head_len - internal->loop_head_pos);
+            SDL_memcpy(buf + retval, internal->loop_head + internal->loop_head_pos, br);
+            internal->loop_head_pos += br;
+            internal->frame_pos += br / framesize;
+            retval += br;
+            continue;
+        } /* if */
+
+        if ( (internal->loop_count != 0) && (internal->loop_end != 0) &&
+             (internal->frame_pos >= internal->loop_end) )
+        {
+            retval += loop_wrap(sample, buf + retval, want);
+            if (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EOF))
+                break;
+            continue;
+        } /* if */
+
+        if (internal->loop_seek_pending)
+        {
+            if (retval > 0)
+                break;  /* hand out the loop point now; seek next time. */
+            if (!Sound_SeekFrames(sample, internal->frame_pos))
+            {
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+                break;
+            } /* if */
+            continue;
+        } /* if */
+
+        if ( (internal->loop_head_all == 2) &&
+             (internal->frame_pos >= internal->loop_end) )
+        {
+            sample->flags |= SOUND_SAMPLEFLAG_EOF;  /* decoder got there already. */
+            break;
+        } /* if */
+
+        if ((internal->loop_count != 0) && (internal->loop_end != 0))
+        {
+            const Uint64 left = (internal->loop_end - internal->frame_pos) * framesize;
+            if (left < want)
+                want = (Uint32) left;
+        } /* if */
+
+        if (retval == 0)
+            br = decode_sample_counted(sample, want);
+        else
+            br = decode_to_buffer(sample, buf + retval, want);
+        retval += br;
+
+        if (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EAGAIN))
+            break;
+        else if ((sample->flags & SOUND_SAMPLEFLAG_EOF) && (internal->loop_count == 0))
+            break;  /* done looping; this is the real end. */
+        else if ((sample->flags & SOUND_SAMPLEFLAG_EOF) ||
+                 ((br == 0) && (internal->loop_count != 0) && (internal->loop_end != 0)))
+        {
+            /* EOF before the loop end, or a tail too small to decode. */
+            retval += loop_wrap(sample, buf + retval, size - retval);
+            if (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EOF))
+                break;
+        } /* else if */
+        else if (br == 0)
+            break;  /* no progress and no reason; don't spin. */
+    } /* while */
+
+    return retval;
+} /* loop_decode */
+
+
+/*
+ * Sound_Decode(), after the checks, but before any automatic sizing. This
+ *  puts no more than (len) bytes in sample->buffer; zero means all of it.
+ *  Everything that decodes into sample->buffer comes through here, so loop
+ *  regions work the same no matter which call the app used.
+ */
+static Uint32 decode_next(Sound_Sample *sample, Uint32 len)
+{
+    if ((len == 0) || (len > sample->buffer_size))
+        len = sample->buffer_size;
+    if (loop_active((Sound_SampleInternal *) sample->opaque))
+        return loop_decode(sample, len);
+    return decode_sample_counted(sample, len);
+} /* decode_next */
+
+
+/*
+ * Pick a new buffer size from the window that just ended at (now). This
+ *  runs before the next decode, so the app is done with the old buffer.
+ */
+static void autobuffer_adjust(Sound_Sample *sample, Uint64 now)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    const Uint64 playback = (Uint64) sample->desired.rate * framesize;  /* bytes/sec */
+    const Uint64 elapsed = now - internal->autobuf_start;
+    const Uint32 cursize = sample->buffer_size;
+    Uint64 target;
+
+    if (elapsed == 0)
+        return;
+
+    /* busy half the time, or pulling twice as fast as it plays: batch. */
+    if ((internal->autobuf_ticks * 2 >= elapsed) ||
+        (internal->autobuf_bytes * SDL_GetPerformanceFrequency()
+            >= playback * 2 * elapsed))
+        target = (Uint64) cursize * 2;
+    else
+        target = (playback * AUTOBUFFER_LATENCY_MS) / 1000;
+
+    target = autobuffer_align(sample, target);
+
+    /* ignore small changes, so we don't realloc every window. */
+    if ((target > (Uint64) cursize + cursize / 4) ||
+        (target < (Uint64) cursize - cursize / 4))
+    {
+        if (!Sound_SetBufferSize(sample, (Uint32) target))
+            internal->autobuf_max = 0;  /* keep the buffer we have; give up. */
+    } /* if */
+} /* autobuffer_adjust */
+
+
+/* decode_next() for Sound_Decode(), with automatic sizing. */
+static Uint32 autobuffer_decode(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint32 retval;
+
+    if (internal->autobuf_calls >= AUTOBUFFER_WINDOW)
+    {
+        autobuffer_adjust(sample, now);
+        autobuffer_reset(internal, now);
+    } /* if */
+    else if (internal->autobuf_calls == 0)
+        internal->autobuf_start = now;
+
+    retval = decode_next(sample, 0);
+
+    internal->autobuf_calls++;
+    internal->autobuf_bytes += retval;
+    internal->autobuf_ticks += SDL_GetPerformanceCounter() - now;
+    return retval;
+} /* autobuffer_decode */
+
+
+Uint32 Sound_Decode(Sound_Sample *sample)
+{
+        /* a boatload of sanity checks... */
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+
+    /* only here; the other calls would size it by the wrong measure. */
+    if (((Sound_SampleInternal *) sample->opaque)->autobuf_max != 0)
+        return autobuffer_decode(sample);
+
+    return decode_next(sample, 0);
+} /* Sound_Decode */
+
+
+Uint32 Sound_DecodeInto(Sound_Sample *sample, void *buffer, Uint32 len)
+{
+        /* a boatload of sanity checks... */
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(buffer == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+
+    return decode_to_buffer(sample, (Uint8 *) buffer, len);
+} /* Sound_DecodeInto */
+
+
+/*
+ * Let the decoder hand out its data in place, if nothing would change it
+ *  on the way to the app. Leaves (*data) NULL if that's not possible.
+ */
+static Uint32 view_sample(Sound_Sample *sample, const void **data)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint8 *ptr = NULL;
+    Uint64 start = 0;
+    Uint32 retval;
+
+    *data = NULL;
+
+    if ( (internal->funcs->view == NULL) ||
+         (__Sound_IsInstance(sample)) ||
+         (internal->shared_pcm != NULL) ||
+         (internal->resampler != NULL) ||
+         (USING_AUDIOSTREAM(internal)) ||
+         (internal->fastcvt != NULL) ||
+         (internal->sdlcvt.needed) )
+    {
+        return 0;
+    } /* if */
+
+    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+
+    if (internal->stats != NULL)
+        start = SDL_GetPerformanceCounter();
+
+    retval = internal->funcs->view(sample, &ptr, internal->buffer_size);
+
+    if (internal->stats != NULL)
+        internal->stats->decode_ns += SDL_GetPerformanceCounter() - start;
+
+    if (ptr != NULL)
+    {
+        internal->decoded_all = 0;
+        *data = ptr;
+    } /* if */
+
+    return retval;
+} /* view_sample */
+
+
+Uint32 Sound_DecodeView(Sound_Sample *sample, const void **data)
+{
+    Sound_SampleInternal *internal = NULL;
+    Uint64 start = 0, decode_before = 0;
+    Uint32 retval;
+
+        /* a boatload of sanity checks... */
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(data == NULL, ERR_INVALID_ARGUMENT, 0);
+    *data = NULL;
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+    if (!loop_active(internal))  /* a view can't wrap around a loop. */
+    {
+        if (internal->stats != NULL)
+        {
+            start = SDL_GetPerformanceCounter();
+            decode_before = internal->stats->decode_ns;
+        } /* if */
+
+        retval = view_sample(sample, data);
+        if (*data != NULL)
+        {
+            if (internal->stats != NULL)
+                count_decode(internal, retval, start, decode_before);
+            advance_frame_pos(sample, retval);
+            return retval;
+        } /* if */
+    } /* if */
+
+    /* no luck; decode it the usual way. */
+    retval = decode_next(sample, 0);
+    *data = sample->buffer;
+    return retval;
+} /* Sound_DecodeView */
+
+
+/*
+ * Batch decoding. Requests are handed out in order of decoder, so each
+ *  thread tends to stay in one decoder's code for a while, and the worker
+ *  threads stick around between calls, since an app calling this on every
+ *  audio tick can't be paying for SDL_CreateThread() each time. The pool
+ *  only does one batch at a time; batch_mutex is held while it's busy.
+ */
+#define BATCH_MAX_THREADS 16
+#define BATCH_STACK_REQUESTS 256  /* sort this many without a malloc. */
+
+typedef struct
+{
+    const void *funcs;            /* the decoder, to group by. */
+    const Sound_Sample *sample;   /* so repeats end up side by side. */
+    int index;                    /* into the app's array of requests. */
+} BatchOrder;
+
+typedef struct
+{
+    SDL_Thread *thread;
+    SDL_sem *go;
+} BatchWorker;
+
+static BatchWorker batch_workers[BATCH_MAX_THREADS - 1];
+static int batch_worker_count = 0;
+static int batch_quit = 0;
+static SDL_sem *batch_done = NULL;
+static Sound_DecodeRequest *batch_requests = NULL;
+static const BatchOrder *batch_order = NULL;
+static int batch_total = 0;
+static SDL_atomic_t batch_next;
+
+
+static void decode_request(Sound_DecodeRequest *req)
+{
+    Sound_Sample *sample = req->sample;
+
+    req->decoded = 0;
+    if ( (sample == NULL) ||
+         (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EOF)) )
+        return;  /* dead ones just sit this out, like Sound_Decode() would. */
+    if (!wake_sample(sample))
+        return;
+
+    if (req->buffer != NULL)
+        req->decoded = decode_to_buffer(sample, (Uint8 *) req->buffer, req->len);
+    else
+        req->decoded = decode_next(sample, req->len);
+} /* decode_request */
+
+
+/* Take requests off the current batch until there aren't any left. */
+static void batch_share(void)
+{
+    int i;
+    while ((i = SDL_AtomicAdd(&batch_next, 1)) < batch_total)
+        decode_request(&batch_requests[batch_order[i].index]);
+} /* batch_share */
+
+
+static int SDLCALL batch_worker(void *data)
+{
+    BatchWorker *worker = (BatchWorker *) data;
+    for (;;)
+    {
+        SDL_SemWait(worker->go);
+        if (batch_quit)
+            break;
+        batch_share();
+        SDL_SemPost(batch_done);
+    } /* for */
+    return 0;
+} /* batch_worker */
+
+
+/* Make sure there are at least (count) workers. Returns how many there are. */
+static int batch_start_workers(int count)
+{
+    if ((batch_done == NULL) && ((batch_done = SDL_CreateSemaphore(0)) == NULL))
+        return 0;
+
+    while (batch_worker_count < count)
+    {
+        BatchWorker *worker = &batch_workers[batch_worker_count];
+        worker->go = SDL_CreateSemaphore(0);
+        if (worker->go == NULL)
+            break;
+        worker->thread = SDL_CreateThread(batch_worker, "SDL_sound batch", worker);
+        if (worker->thread == NULL)
+        {
+            SDL_DestroySemaphore(worker->go);
+            break;
+        } /* if */
+        batch_worker_count++;
+    } /* while */
+
+    return batch_worker_count;
+} /* batch_start_workers */
+
+
+/* This is called from Sound_Quit(). */
+static void batch_stop_workers(void)
+{
+    int i;
+
+    batch_quit = 1;
+    for (i = 0; i < batch_worker_count; i++)
+        SDL_SemPost(batch_workers[i].go);
+    for (i = 0; i < batch_worker_count; i++)
+    {
+        SDL_WaitThread(batch_workers[i].thread, NULL);
+        SDL_DestroySemaphore(batch_workers[i].go);
+    } /* for */
+
+    if (batch_done != NULL)
+        SDL_DestroySemaphore(batch_done);
+
+    batch_done = NULL;
+    batch_worker_count = 0;
+    batch_quit = 0;
+} /* batch_stop_workers */
+
+
+static int SDLCALL batch_order_cmp(const void *_a, const void *_b)
+{
+    const BatchOrder *a = (const BatchOrder *) _a;
+    const BatchOrder *b = (const BatchOrder *) _b;
+    if (a->funcs != b->funcs)
+        return (a->funcs < b->funcs) ? -1 : 1;
+    if (a->sample != b->sample)
+        return (a->sample < b->sample) ? -1 : 1;
+    return a->index - b->index;  /* keep the app's order otherwise. */
+} /* batch_order_cmp */
+
+
+int Sound_DecodeMany(Sound_DecodeRequest *requests, int count, int threads)
+{
+    BatchOrder stack_order[BATCH_STACK_REQUESTS];
+    BatchOrder *order = stack_order;
+    int workers = 0;
+    int retval = 0;
+    int i;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, -1);
+    BAIL_IF_MACRO(count < 0, ERR_INVALID_ARGUMENT, -1);
+    BAIL_IF_MACRO((requests == NULL) && (count > 0), ERR_INVALID_ARGUMENT, -1);
+
+    if (count > BATCH_STACK_REQUESTS)
+    {
+        order = (BatchOrder *) __Sound_Malloc(count * sizeof (BatchOrder));
+        BAIL_IF_MACRO(order == NULL, ERR_OUT_OF_MEMORY, -1);
+    } /* if */
+
+    for (i = 0; i < count; i++)
+    {
+        const Sound_Sample *sample = requests[i].sample;
+        const Sound_SampleInternal *internal = (sample != NULL) ?
+                            (const Sound_SampleInternal *) sample->opaque : NULL;
+        order[i].funcs = (internal != NULL) ? internal->funcs : NULL;
+        order[i].sample = sample;
+        order[i].index = i;
+    } /* for */
+    SDL_qsort(order, count, sizeof (BatchOrder), batch_order_cmp);
+
+    /* two threads on one sample would wreck it; refuse before decoding. */
+    for (i = 1; i < count; i++)
+    {
+        if ((order[i].sample != NULL) && (order[i].sample == order[i-1].sample))
+        {
+            if (order != stack_order)
+                __Sound_Free(order);
+            BAIL_MACRO(ERR_INVALID_ARGUMENT, -1);
+        } /* if */
+    } /* for */
+
+    if (threads <= 0)
+        threads = SDL_GetCPUCount();
+    if (threads > BATCH_MAX_THREADS)
+        threads = BATCH_MAX_THREADS;
+    if (threads > count)
+        threads = count;
+
+    if (threads >= 2)
+    {
+        SDL_LockMutex(batch_mutex);
+        workers = batch_start_workers(threads - 1);
+        if (workers > threads - 1)
+            workers = threads - 1;
+        if (workers == 0)
+            SDL_UnlockMutex(batch_mutex);
+    } /* if */
+
+    if (workers == 0)  /* just us, then. */
+    {
+        for (i = 0; i < count; i++)
+            decode_request(&requests[order[i].index]);
+    } /* if */
+
+    else
+    {
+        batch_requests = requests;
+        batch_order = order;
+        batch_total = count;
+        SDL_AtomicSet(&batch_next, 0);
+        for (i = 0; i < workers; i++)
+            SDL_SemPost(batch_workers[i].go);
+        batch_share();
+        for (i = 0; i < workers; i++)
+            SDL_SemWait(batch_done);
+        batch_requests = NULL;
+        batch_order = NULL;
+        batch_total = 0;
+        SDL_UnlockMutex(batch_mutex);
+    } /* else */
+
+    if (order != stack_order)
+        __Sound_Free(order);
+
+    for (i = 0; i < count; i++)
+    {
+        if (requests[i].decoded > 0)
+            retval++;
+    } /* for */
+
+    return retval;
+} /* Sound_DecodeMany */
+
+
+/*
+ * Make (buf) the sample's buffer, after decoding everything into it. In
+ *  streaming conversion mode the decoder keeps its own buffer.
+ */
+static void replace_sample_buffer(Sound_Sample *sample, Uint8 *buf,
+                                  Uint32 capacity, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+
+    if ((!USING_AUDIOSTREAM(internal)) && (internal->buffer != sample->buffer))
+        __Sound_Free(internal->buffer);
+
+    if (internal->shared_pcm != NULL)  /* instances keep the old one. */
+    {
+        __Sound_ReleaseSharedPCM(internal->shared_pcm);
+        internal->shared_pcm = NULL;
+    } /* if */
+    else
+    {
+        put_pooled_buffer(sample->buffer, internal->buffer_capacity);
+    } /* else */
+
+    sample->buffer = buf;
+    internal->decoded_all = 1;
+    internal->buffer_capacity = capacity;
+    sample->buffer_size = len;
+
+    if (!USING_AUDIOSTREAM(internal))
+    {
+        internal->sdlcvt.buf = internal->buffer = buf;
+        internal->buffer_size = len / internal->sdlcvt.len_mult;
+        internal->sdlcvt.len = internal->buffer_size;
+    } /* if */
+} /* replace_sample_buffer */
+
+
+/*
+ * Guess how many bytes Sound_DecodeAll() will need, from the decoder's idea
+ *  of the total play time. Returns zero if we can't tell.
+ */
+static Uint32 estimate_decoded_size(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint64 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    Uint64 retval;
+
+    if (internal->total_time <= 0)
+        return 0;
+
+    retval = (((Uint64) internal->total_time) * sample->desired.rate) / 1000;
+    retval *= framesize;
+    retval += sample->buffer_size;  /* room for the read that hits EOF. */
+    return (retval > 0xFFFFFFFF) ? 0 : (Uint32) retval;
+} /* estimate_decoded_size */
+
+
+Uint32 Sound_DecodeAll(Sound_Sample *sample)
+{
+    Uint8 *buf = NULL;
+    Uint32 newBufSize = 0;
+    Uint32 bufCapacity = 0;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+
+    if (__Sound_IsInstance(sample))  /* just point at the rest of it. */
+    {
+        newBufSize = __Sound_InstanceDecode(sample, 0xFFFFFFFF);
+        if (newBufSize > 0)
+            sample->buffer_size = newBufSize;
+        return newBufSize;
+    } /* if */
+
+    bufCapacity = estimate_decoded_size(sample);
+    if (bufCapacity == 0)
+        bufCapacity = sample->buffer_size * 4;
+    buf = (Uint8 *) __Sound_Malloc(bufCapacity);
+    BAIL_IF_MACRO(buf == NULL, ERR_OUT_OF_MEMORY, sample->buffer_size);
+
+    while ( ((sample->flags & SOUND_SAMPLEFLAG_EOF) == 0) &&
+            ((sample->flags & SOUND_SAMPLEFLAG_ERROR) == 0) )
+    {
+        /* make sure there's always room for a full chunk. */
+        if ((bufCapacity - newBufSize) < sample->buffer_size)
+        {
+            Uint8 *ptr = NULL;
+            Uint64 newCapacity = ((Uint64) bufCapacity) * 2;
+            if (newCapacity < ((Uint64) newBufSize) + sample->buffer_size)
+                newCapacity = ((Uint64) newBufSize) + sample->buffer_size;
+
+            if (newCapacity <= 0xFFFFFFFF)
+                ptr = (Uint8 *) __Sound_Realloc(buf, (size_t) newCapacity);
 
-            if (should_try)
+            if (ptr == NULL)
             {
-                if (init_sample(decoder->funcs, retval, ext, desired))
-                    return retval;
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+                __Sound_SetError(ERR_OUT_OF_MEMORY);
+                break;
             } /* if */
-        } /* if */
-    } /* for */
-
-    /* nothing could handle the sound data... */
-    SDL_free(retval->opaque);
-    if (retval->buffer != NULL)
-        SDL_free(retval->buffer);
-    SDL_free(retval);
-    SDL_RWclose(rw);
-    __Sound_SetError(ERR_UNSUPPORTED_FORMAT);
-    return NULL;
-} /* Sound_NewSample */
 
+            buf = ptr;
+            bufCapacity = (Uint32) newCapacity;
+        } /* if */
 
-Sound_Sample *Sound_NewSampleFromFile(const char *filename,
-                                      Sound_AudioInfo *desired,
-                                      Uint32 bufferSize)
-{
-    const char *ext;
-    SDL_RWops *rw;
+        /* decode straight into the output instead of copying chunks over. */
+        newBufSize += decode_to_buffer(sample, buf + newBufSize,
+                                       bufCapacity - newBufSize);
 
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
-    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, NULL);
+        if (sample->flags & SOUND_SAMPLEFLAG_EAGAIN)
+            break;  /* source is behind; don't spin, hand over what we have. */
+    } /* while */
 
-    ext = SDL_strrchr(filename, '.');
-    rw = SDL_RWFromFile(filename, "rb");
-    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+    /* give back the slack, now that we know the real size. */
+    if ((newBufSize > 0) && (newBufSize < bufCapacity))
+    {
+        Uint8 *ptr = (Uint8 *) __Sound_Realloc(buf, newBufSize);
+        if (ptr != NULL)
+        {
+            buf = ptr;
+            bufCapacity = newBufSize;
+        } /* if */
+    } /* if */
 
-    if (ext != NULL)
-        ext++;
+    replace_sample_buffer(sample, buf, bufCapacity, newBufSize);
+    return newBufSize;
+} /* Sound_DecodeAll */
 
-    return Sound_NewSample(rw, ext, desired, bufferSize);
-} /* Sound_NewSampleFromFile */
 
+/*
+ * Parallel decode-all. Each worker opens its own decoder instance on its own
+ *  RWops, seeks to the start of its slice of the sample, and decodes just
+ *  that slice. Slice boundaries are chosen so they fall on a whole
+ *  millisecond AND a whole sample frame, so a frame-exact seek() puts every
+ *  worker exactly where the previous one stops.
+ */
+#define PARALLEL_MAX_THREADS 16
+#define PARALLEL_MIN_SLICE_MS 2000
 
-Sound_Sample *Sound_NewSampleFromMem(const Uint8 *data,
-                                     Uint32 size,
-                                     const char *ext,
-                                     Sound_AudioInfo *desired,
-                                     Uint32 bufferSize)
+typedef struct
 {
+    Sound_Sample *parent;
     SDL_RWops *rw;
+    Uint32 start_ms;
+    Uint8 *dst;        /* NULL for the last slice, which decodes to EOF. */
+    Uint32 dst_len;
+    Uint8 *tail;       /* last slice's output, since its length is a guess. */
+    Uint32 tail_len;
+    int ok;
+    SDL_Thread *thread;
+    Sound_Stats stats;  /* the worker's numbers, for the parent's stats. */
+} ParallelSlice;
+
+
+/* Open a new, independent RWops on the same data as (sample)'s. */
+static SDL_RWops *clone_rwops(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    SDL_RWops *rw = internal->rw;
+    SDL_RWops *retval = NULL;
 
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, NULL);
-    BAIL_IF_MACRO(data == NULL, ERR_INVALID_ARGUMENT, NULL);
-    BAIL_IF_MACRO(size == 0, ERR_INVALID_ARGUMENT, NULL);
+    if ((rw->type == SDL_RWOPS_MEMORY) || (rw->type == SDL_RWOPS_MEMORY_RO))
+    {
+        const Sint64 len = (Sint64) (rw->hidden.mem.stop - rw->hidden.mem.base);
+        return SDL_RWFromConstMem(rw->hidden.mem.base, (int) len);
+    } /* if */
 
-    rw = SDL_RWFromConstMem(data, size);
-    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+    if (internal->filename == NULL)
+        return NULL;
 
-    return Sound_NewSample(rw, ext, desired, bufferSize);
-} /* Sound_NewSampleFromMem */
+    retval = SDL_RWFromFile(internal->filename, "rb");
+    if ((retval != NULL) && (readahead_size > 0))
+    {
+        SDL_RWops *buffered = __Sound_RWBuffered(retval, readahead_size);
+        if (buffered != NULL)
+            retval = buffered;
+    } /* if */
+
+    return retval;
+} /* clone_rwops */
 
 
-void Sound_FreeSample(Sound_Sample *sample)
+/*
+ * Workers are never put on a sample list (init_sample() doesn't, and we
+ *  don't call link_sample()), so the app and Sound_Quit() never see them,
+ *  and their numbers don't count toward Sound_GetDecoderStats(); close them
+ *  here instead of with Sound_FreeSample().
+ */
+static void close_worker(Sound_Sample *sample)
 {
-    Sound_SampleInternal *internal;
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    internal->funcs->close(sample);
+    SDL_RWclose(internal->rw);
+    release_sample(sample);
+} /* close_worker */
 
-    if (!initialized)
-    {
-        __Sound_SetError(ERR_NOT_INITIALIZED);
-        return;
-    } /* if */
 
+static int SDLCALL parallel_decode_slice(void *data)
+{
+    ParallelSlice *slice = (ParallelSlice *) data;
+    Sound_Sample *parent = slice->parent;
+    Sound_SampleInternal *pinternal = (Sound_SampleInternal *) parent->opaque;
+    const char *ext = pinternal->open_ext;
+    Sound_SampleInternal *internal;
+    Sound_Sample *sample;
+    Uint32 pos = 0;
+    Uint32 cap = 0;
+
+    sample = alloc_sample(slice->rw, &parent->desired, parent->buffer_size);
     if (sample == NULL)
     {
-        __Sound_SetError(ERR_INVALID_ARGUMENT);
-        return;
+        SDL_RWclose(slice->rw);
+        return 0;
     } /* if */
 
-    internal = (Sound_SampleInternal *) sample->opaque;
-
-    SDL_LockMutex(samplelist_mutex);
-
-    /* update the sample_list... */
-    if (internal->prev != NULL)
+    if (!init_sample(pinternal->funcs, sample, ext, &parent->desired))
     {
-        Sound_SampleInternal *prevInternal;
-        prevInternal = (Sound_SampleInternal *) internal->prev->opaque;
-        prevInternal->next = internal->next;
+        SDL_RWclose(slice->rw);
+        release_sample(sample);
+        return 0;
     } /* if */
-    else
-    {
-        SDL_assert(sample_list == sample);
-        sample_list = internal->next;
-    } /* else */
 
-    if (internal->next != NULL)
+    if ((slice->start_ms > 0) &&
+        (!decoder_seek(sample, slice->start_ms)))
     {
-        Sound_SampleInternal *nextInternal;
-        nextInternal = (Sound_SampleInternal *) internal->next->opaque;
-        nextInternal->prev = internal->prev;
+        close_worker(sample);
+        return 0;
     } /* if */
 
-    SDL_UnlockMutex(samplelist_mutex);
-
-    /* nuke it... */
-    internal->funcs->close(sample);
-
-    if (internal->rw != NULL)  /* this condition is a "just in case" thing. */
-        SDL_RWclose(internal->rw);
-
-    if ((internal->buffer != NULL) && (internal->buffer != sample->buffer))
-        SDL_free(internal->buffer);
-
-    SDL_free(internal);
+    while ( ((slice->dst == NULL) || (pos < slice->dst_len)) &&
+            ((sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR)) == 0) )
+    {
+        Uint32 br = Sound_Decode(sample);
 
-    if (sample->buffer != NULL)
-        SDL_free(sample->buffer);
+        if (slice->dst != NULL)  /* fixed slice; stop exactly at the end. */
+        {
+            if (br > slice->dst_len - pos)
+                br = slice->dst_len - pos;
+            SDL_memcpy(slice->dst + pos, sample->buffer, br);
+        } /* if */
 
-    SDL_free(sample);
-} /* Sound_FreeSample */
+        else  /* last slice; grow as needed. */
+        {
+            if (pos + br > cap)
+            {
+                Uint8 *ptr;
+                cap = (cap == 0) ? (sample->buffer_size * 16) : (cap * 2);
+                if (cap < pos + br)
+                    cap = pos + br;
+                ptr = (Uint8 *) __Sound_Realloc(slice->tail, cap);
+                if (ptr == NULL)
+                {
+                    __Sound_SetError(ERR_OUT_OF_MEMORY);
+                    break;
+                } /* if */
+                slice->tail = ptr;
+            } /* if */
+            SDL_memcpy(slice->tail + pos, sample->buffer, br);
+        } /* else */
 
+        pos += br;
+    } /* while */
 
-int Sound_SetBufferSize(Sound_Sample *sample, Uint32 newSize)
-{
-    void *newBuf = NULL;
-    Sound_SampleInternal *internal = NULL;
+    if (slice->dst != NULL)
+        slice->ok = (pos == slice->dst_len);
+    else
+    {
+        slice->tail_len = pos;
+        slice->ok = ((sample->flags & SOUND_SAMPLEFLAG_EOF) != 0);
+    } /* else */
 
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
-    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
-    internal = ((Sound_SampleInternal *) sample->opaque);
-    newBuf = SDL_realloc(sample->buffer, newSize * internal->sdlcvt.len_mult);
-    BAIL_IF_MACRO(newBuf == NULL, ERR_OUT_OF_MEMORY, 0);
+    if (!slice->ok)
+    {
+        SNDDBG(("Parallel decode: slice at %u ms failed.\n", slice->start_ms));
+    } /* if */
 
-    internal->sdlcvt.buf = internal->buffer = sample->buffer = newBuf;
-    sample->buffer_size = newSize;
-    internal->buffer_size = newSize / internal->sdlcvt.len_mult;
-    internal->sdlcvt.len = internal->buffer_size;
+    internal = (Sound_SampleInternal *) sample->opaque;
+    if (internal->stats != NULL)  /* the parent gets these, not the decoder. */
+    {
+        SDL_memcpy(&slice->stats, internal->stats, sizeof (Sound_Stats));
+        slice->stats.samples = 0;
+    } /* if */
 
-    return 1;
-} /* Sound_SetBufferSize */
+    close_worker(sample);
+    return 0;
+} /* parallel_decode_slice */
 
 
-Uint32 Sound_Decode(Sound_Sample *sample)
+/* Returns zero if the parallel path couldn't be used; nothing's changed. */
+static Uint32 parallel_decode_all(Sound_Sample *sample, int threads)
 {
-    Sound_SampleInternal *internal = NULL;
-    Uint32 retval = 0;
-
-        /* a boatload of sanity checks... */
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
-    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
-    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
-    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 rate = sample->desired.rate;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    ParallelSlice slices[PARALLEL_MAX_THREADS];
+    Uint32 step, steps, prefix, i;
+    Uint64 total;
+    Uint8 *buf;
+    int ok = 1;
+
+    if ( (!(sample->flags & SOUND_SAMPLEFLAG_CANSEEK)) || (internal->rw == NULL) ||
+         (!internal->accurate_seek) || (internal->total_time <= 0) ||
+         (sample->actual.rate != rate) )  /* resampling smears boundaries. */
+        return 0;
 
-    internal = (Sound_SampleInternal *) sample->opaque;
+    if (threads <= 0)
+        threads = SDL_GetCPUCount();
+    if (threads > PARALLEL_MAX_THREADS)
+        threads = PARALLEL_MAX_THREADS;
+    if (threads > internal->total_time / PARALLEL_MIN_SLICE_MS)
+        threads = internal->total_time / PARALLEL_MIN_SLICE_MS;
+    if (threads < 2)
+        return 0;
 
-    SDL_assert(sample->buffer != NULL);
-    SDL_assert(sample->buffer_size > 0);
-    SDL_assert(internal->buffer != NULL);
-    SDL_assert(internal->buffer_size > 0);
+    /* smallest number of ms that is also a whole number of frames. */
+    step = 1000;
+    for (i = rate, prefix = 1000; prefix != 0; )
+    {
+        const Uint32 t = i % prefix;
+        i = prefix;
+        prefix = t;
+    } /* for */
+    step /= i;  /* 1000 / gcd(rate, 1000) */
+    steps = ((Uint32) internal->total_time) / step;
 
-        /* reset EAGAIN. Decoder can flip it back on if it needs to. */
-    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
-    retval = internal->funcs->read(sample);
+    SDL_memset(slices, '\0', sizeof (slices));
+    for (i = 0; i < (Uint32) threads; i++)
+    {
+        slices[i].parent = sample;
+        slices[i].start_ms = (Uint32) ((((Uint64) steps) * i) / threads) * step;
+        slices[i].rw = clone_rwops(sample);
+        if (slices[i].rw == NULL)
+            ok = 0;
+    } /* for */
 
-    if (retval > 0 && internal->sdlcvt.needed)
+    total = __Sound_convertMsToFrames(rate, slices[threads - 1].start_ms) * framesize;
+    buf = (ok && total <= 0xFFFFFFFF) ? (Uint8 *) __Sound_Malloc((size_t) total) : NULL;
+    if (buf == NULL)
     {
-        internal->sdlcvt.len = retval;
-        SDL_ConvertAudio(&internal->sdlcvt);
-        retval = internal->sdlcvt.len_cvt;
+        for (i = 0; i < (Uint32) threads; i++)
+        {
+            if (slices[i].rw != NULL)
+                SDL_RWclose(slices[i].rw);
+        } /* for */
+        return 0;
     } /* if */
 
-    return retval;
-} /* Sound_Decode */
-
-
-Uint32 Sound_DecodeAll(Sound_Sample *sample)
-{
-    Sound_SampleInternal *internal = NULL;
-    void *buf = NULL;
-    Uint32 newBufSize = 0;
+    prefix = (Uint32) total;
+    for (i = 0; i < (Uint32) threads; i++)
+    {
+        ParallelSlice *slice = &slices[i];
+        const Uint32 start = (Uint32) (__Sound_convertMsToFrames(rate, slice->start_ms) * framesize);
+        if (i < (Uint32) (threads - 1))
+        {
+            const Uint32 end = (Uint32) (__Sound_convertMsToFrames(rate, slices[i + 1].start_ms) * framesize);
+            slice->dst = buf + start;
+            slice->dst_len = end - start;
+        } /* if */
 
-    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
-    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_EOF, ERR_PREV_EOF, 0);
-    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_PREV_ERROR, 0);
+        slice->thread = SDL_CreateThread(parallel_decode_slice, "SDL_sound decode", slice);
+        if (slice->thread == NULL)
+            parallel_decode_slice(slice);  /* just do it here, then. */
+    } /* for */
 
-    internal = (Sound_SampleInternal *) sample->opaque;
+    for (i = 0; i < (Uint32) threads; i++)
+    {
+        if (slices[i].thread != NULL)
+            SDL_WaitThread(slices[i].thread, NULL);
+        ok = ok && slices[i].ok;
+        if (internal->stats != NULL)
+            stats_add(internal->stats, &slices[i].stats);
+    } /* for */
 
-    while ( ((sample->flags & SOUND_SAMPLEFLAG_EOF) == 0) &&
-            ((sample->flags & SOUND_SAMPLEFLAG_ERROR) == 0) )
+    if (ok)  /* stitch the last slice on. */
     {
-        Uint32 br = Sound_Decode(sample);
-        void *ptr = SDL_realloc(buf, newBufSize + br);
+        ParallelSlice *last = &slices[threads - 1];
+        Uint8 *ptr = (prefix + (Uint64) last->tail_len <= 0xFFFFFFFF) ?
+                        (Uint8 *) __Sound_Realloc(buf, prefix + last->tail_len) : NULL;
         if (ptr == NULL)
-        {
-            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-            __Sound_SetError(ERR_OUT_OF_MEMORY);
-        } /* if */
+            ok = 0;
         else
         {
             buf = ptr;
-            SDL_memcpy( ((char *) buf) + newBufSize, sample->buffer, br );
-            newBufSize += br;
+            SDL_memcpy(buf + prefix, last->tail, last->tail_len);
+            prefix += last->tail_len;
         } /* else */
-    } /* while */
+    } /* if */
 
-    if (buf == NULL)  /* ...in case first call to SDL_realloc() fails... */
-        return sample->buffer_size;
+    __Sound_Free(slices[threads - 1].tail);
 
-    if (internal->buffer != sample->buffer)
-        SDL_free(internal->buffer);
+    if (!ok)
+    {
+        __Sound_Free(buf);
+        return 0;
+    } /* if */
 
-    SDL_free(sample->buffer);
+    replace_sample_buffer(sample, buf, prefix, prefix);
+    internal->frame_pos = prefix / framesize;
+    sample->flags &= ~(SOUND_SAMPLEFLAG_EAGAIN | SOUND_SAMPLEFLAG_ERROR);
+    sample->flags |= SOUND_SAMPLEFLAG_EOF;
 
-    internal->sdlcvt.buf = internal->buffer = sample->buffer = buf;
-    sample->buffer_size = newBufSize;
-    internal->buffer_size = newBufSize / internal->sdlcvt.len_mult;
-    internal->sdlcvt.len = internal->buffer_size;
+    return (prefix > 0) ? prefix : 1;
+} /* parallel_decode_all */
 
-    return newBufSize;
-} /* Sound_DecodeAll */
+
+Uint32 Sound_DecodeAllParallel(Sound_Sample *sample, int threads)
+{
+    Uint32 retval;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(!wake_sample(sample), NULL, 0);
+
+    retval = parallel_decode_all(sample, threads);
+    if (retval > 0)
+        return sample->buffer_size;
+
+    /*
+     * can't split this one up; do it the slow way. The parallel path always
+     *  decodes from the start, so this does too: wherever the app had got
+     *  to is thrown away either way, as documented.
+     */
+    BAIL_IF_MACRO(!Sound_Rewind(sample), NULL, 0);
+    return Sound_DecodeAll(sample);
+} /* Sound_DecodeAllParallel */
 
 
 int Sound_Rewind(Sound_Sample *sample)
@@ -750,12 +3662,23 @@ int Sound_Rewind(Sound_Sample *sample)
     BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
 
     internal = (Sound_SampleInternal *) sample->opaque;
-    if (!internal->funcs->rewind(sample))
+    cancel_loop_wrap(internal);
+    if (internal->suspended)  /* reopening puts it at the start anyhow. */
+    {
+        internal->frame_pos = 0;
+        sample->flags &= ~(SOUND_SAMPLEFLAG_EAGAIN | SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EOF);
+        return reopen_sample(sample);
+    } /* if */
+
+    if (!decoder_rewind(sample))
     {
         sample->flags |= SOUND_SAMPLEFLAG_ERROR;
         return 0;
     } /* if */
 
+    __Sound_ResetResampler(sample);
+    reset_audiostream(internal);
+    internal->frame_pos = 0;
     sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
     sample->flags &= ~SOUND_SAMPLEFLAG_ERROR;
     sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
@@ -773,14 +3696,105 @@ int Sound_Seek(Sound_Sample *sample, Uint32 ms)
         BAIL_MACRO(ERR_CANNOT_SEEK, 0);
 
     internal = (Sound_SampleInternal *) sample->opaque;
-    BAIL_IF_MACRO(!internal->funcs->seek(sample, ms), NULL, 0);
+    cancel_loop_wrap(internal);
+    if (internal->suspended)  /* no point in seeking back to frame_pos first. */
+        BAIL_IF_MACRO(!reopen_sample(sample), NULL, 0);
+    BAIL_IF_MACRO(!decoder_seek(sample, ms), NULL, 0);
+    __Sound_ResetResampler(sample);
+    reset_audiostream(internal);
+    internal->frame_pos = __Sound_convertMsToFrames(sample->desired.rate, ms);
 
     sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
     sample->flags &= ~SOUND_SAMPLEFLAG_ERROR;
     sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
 
     return 1;
-} /* Sound_Rewind */
+} /* Sound_Seek */
+
+
+/*
+ * Read and throw away (frames) sample frames straight from the decoder, in
+ *  the sample's actual format, for decoders that can only seek to a
+ *  millisecond. There are never more than a millisecond's worth of them.
+ */
+static int skip_decoded_frames(Sound_Sample *sample, Uint64 frames)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = ((sample->actual.format & 0xFF) / 8) * sample->actual.channels;
+    const Uint32 saved_buffer_size = internal->buffer_size;
+    const Uint32 most = saved_buffer_size - (saved_buffer_size % framesize);
+
+    while ((frames > 0) && (most > 0))
+    {
+        Uint32 br;
+        internal->buffer_size = (frames * framesize < most) ? (Uint32) (frames * framesize) : most;
+        sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+        br = __Sound_DecoderRead(sample);
+        frames -= br / framesize;
+        if ((br == 0) || (sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EAGAIN)))
+            break;  /* close as we'll get. */
+    } /* while */
+
+    internal->buffer_size = saved_buffer_size;
+    return ((sample->flags & SOUND_SAMPLEFLAG_ERROR) == 0);
+} /* skip_decoded_frames */
+
+
+int Sound_SeekFrames(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal;
+    Uint64 target = frame;
+
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    if (!(sample->flags & SOUND_SAMPLEFLAG_CANSEEK))
+        BAIL_MACRO(ERR_CANNOT_SEEK, 0);
+
+    /* (frame) is in the app's rate; the decoder wants its own. */
+    if ((sample->desired.rate != sample->actual.rate) && (sample->desired.rate != 0))
+        target = (frame * sample->actual.rate) / sample->desired.rate;
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+    cancel_loop_wrap(internal);
+    if (internal->suspended)  /* no point in seeking back to frame_pos first. */
+        BAIL_IF_MACRO(!reopen_sample(sample), NULL, 0);
+    if (internal->funcs->seek_frames != NULL)
+    {
+        BAIL_IF_MACRO(!decoder_seek_frames(sample, target), NULL, 0);
+    } /* if */
+    else
+    {
+        const Uint64 ms = (target * 1000) / sample->actual.rate;
+        BAIL_IF_MACRO(ms > 0xFFFFFFFF, ERR_PAST_EOF, 0);
+        BAIL_IF_MACRO(!decoder_seek(sample, (Uint32) ms), NULL, 0);
+        if (internal->accurate_seek)
+        {
+            const Uint64 landed = __Sound_convertMsToFrames(sample->actual.rate, (Uint32) ms);
+            if (!skip_decoded_frames(sample, target - landed))
+                return 0;
+        } /* if */
+    } /* else */
+
+    __Sound_ResetResampler(sample);
+    reset_audiostream(internal);
+    internal->frame_pos = frame;
+
+    sample->flags &= ~SOUND_SAMPLEFLAG_EAGAIN;
+    sample->flags &= ~SOUND_SAMPLEFLAG_ERROR;
+    sample->flags &= ~SOUND_SAMPLEFLAG_EOF;
+
+    return 1;
+} /* Sound_SeekFrames */
+
+
+Sint64 Sound_TellFrames(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    BAIL_IF_MACRO(!initialized, ERR_NOT_INITIALIZED, -1);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, -1);
+    internal = (Sound_SampleInternal *) sample->opaque;
+    return (Sint64) internal->frame_pos;
+} /* Sound_TellFrames */
 
 
 Sint32 Sound_GetDuration(Sound_Sample *sample)
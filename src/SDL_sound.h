@@ -196,6 +196,74 @@ typedef struct
 } Sound_Version;
 
 
+/**
+ * \struct Sound_CacheStats
+ * \brief How the decoded PCM cache is doing.
+ *
+ * \sa Sound_SetCacheBudget
+ * \sa Sound_GetCacheStats
+ */
+typedef struct
+{
+    Uint32 hits;      /**< opens served from the cache. */
+    Uint32 misses;    /**< opens that had to decode. */
+    Uint32 evictions; /**< entries dropped to stay under budget. */
+    Uint32 entries;   /**< entries in the cache right now. */
+    Uint32 bytes;     /**< bytes of PCM in the cache right now. */
+    Uint32 budget;    /**< most bytes the cache will hold. */
+} Sound_CacheStats;
+
+
+/**
+ * \struct Sound_Stats
+ * \brief Where a sample's decoding time and bytes went.
+ *
+ * Times are in nanoseconds. (decode_ns) is the time spent in decoders, and
+ *  includes (io_ns); (convert_ns) is everything else Sound_Decode() and
+ *  friends did: format conversion, resampling, copying.
+ *
+ * Only reads and seeks that go through an SDL_RWops are counted, so memory
+ *  streams that a decoder reads in place will show less I/O than they did.
+ *
+ * \sa Sound_EnableStats
+ * \sa Sound_GetStats
+ * \sa Sound_GetDecoderStats
+ */
+typedef struct
+{
+    Uint64 encoded_bytes; /**< bytes read from the SDL_RWops. */
+    Uint64 pcm_bytes;     /**< bytes of decoded audio handed to the app. */
+    Uint64 decode_ns;     /**< time inside the decoder, I/O included. */
+    Uint64 convert_ns;    /**< time converting decoded audio. */
+    Uint64 io_ns;         /**< time inside the SDL_RWops. */
+    Uint32 decode_calls;  /**< times the sample was asked for more audio. */
+    Uint32 rw_reads;      /**< SDL_RWread() calls. */
+    Uint32 rw_seeks;      /**< SDL_RWseek() calls. */
+    Uint32 samples;       /**< samples these numbers came from. */
+} Sound_Stats;
+
+
+/**
+ * \struct Sound_DecodeRequest
+ * \brief One sample's share of a Sound_DecodeMany() call.
+ *
+ * Fill in (sample), (buffer) and (len); Sound_DecodeMany() fills in
+ *  (decoded). With (buffer) set, this works like Sound_DecodeInto(), and
+ *  (len) is the size of (buffer). Otherwise it works like Sound_Decode(),
+ *  and (len) caps how many bytes go into sample->buffer this time; zero
+ *  means a whole sample->buffer_size, as usual.
+ *
+ * \sa Sound_DecodeMany
+ */
+typedef struct
+{
+    Sound_Sample *sample;  /**< Sample to decode. NULL to skip this one. */
+    void *buffer;          /**< Where to decode to, or NULL for sample->buffer. */
+    Uint32 len;            /**< Most bytes to decode. */
+    Uint32 decoded;        /**< on return, bytes that were decoded. */
+} Sound_DecodeRequest;
+
+
 /* functions and macros... */
 
 /**
@@ -254,6 +322,52 @@ typedef struct
 SNDDECLSPEC void SDLCALL Sound_GetLinkedVersion(Sound_Version *ver);
 
 
+/**
+ * \brief Allocator callbacks for Sound_SetAllocator().
+ *
+ * These work like malloc(), realloc() and free(), plus the (userdata)
+ *  pointer that was passed to Sound_SetAllocator(). Sound_ReallocFunc may
+ *  be called with a NULL (ptr), and must then behave like Sound_MallocFunc.
+ *  Sound_FreeFunc is never called with NULL.
+ *
+ * \sa Sound_SetAllocator
+ */
+typedef void *(SDLCALL *Sound_MallocFunc)(size_t size, void *userdata);
+typedef void *(SDLCALL *Sound_ReallocFunc)(void *ptr, size_t size, void *userdata);
+typedef void (SDLCALL *Sound_FreeFunc)(void *ptr, void *userdata);
+
+
+/**
+ * \fn int Sound_SetAllocator(Sound_MallocFunc mallocfn, Sound_ReallocFunc reallocfn, Sound_FreeFunc freefn, void *userdata)
+ * \brief Route SDL_sound's memory allocations through your own functions.
+ *
+ * Everything SDL_sound allocates goes through these: samples and their
+ *  buffers, the decoders' state, and the libraries bundled with them
+ *  (dr_mp3, dr_flac, stb_vorbis, ModPlug). That makes it easy to keep audio
+ *  memory in its own arena, or just to count it. SDL itself, and external
+ *  libraries a decoder might use (CoreAudio, say), still use their own
+ *  allocators, as do the error strings from Sound_GetError().
+ *
+ * This can only be called while SDL_sound is not initialized, so nothing
+ *  gets freed by a different allocator than the one it came from. The
+ *  functions stay in effect across Sound_Quit() and Sound_Init() until
+ *  this is called again.
+ *
+ *    \param mallocfn Allocates memory, or NULL to go back to SDL_malloc().
+ *    \param reallocfn Resizes memory, or NULL to go back to SDL_realloc().
+ *    \param freefn Frees memory, or NULL to go back to SDL_free().
+ *    \param userdata Passed to all three functions.
+ *   \return nonzero on success, zero if SDL_sound is initialized, or if only
+ *           some of the functions are NULL.
+ *
+ * \sa Sound_Init
+ */
+SNDDECLSPEC int SDLCALL Sound_SetAllocator(Sound_MallocFunc mallocfn,
+                                           Sound_ReallocFunc reallocfn,
+                                           Sound_FreeFunc freefn,
+                                           void *userdata);
+
+
 /**
  * \fn Sound_Init(void)
  * \brief Initialize SDL_sound.
@@ -325,13 +439,49 @@ SNDDECLSPEC int SDLCALL Sound_Quit(void);
  * The return values are pointers to static internal memory, and should
  *  be considered READ ONLY, and never freed.
  *
+ * This lists every decoder compiled in. Decoders aren't initialized until
+ *  they are needed (see Sound_InitDecoders()), so one that turns out not to
+ *  work in this process stays in the list, but never gets picked.
+ *
  * \return READ ONLY Null-terminated array of READ ONLY structures.
  *
  * \sa Sound_DecoderInfo
+ * \sa Sound_InitDecoders
  */
 SNDDECLSPEC const Sound_DecoderInfo ** SDLCALL Sound_AvailableDecoders(void);
 
 
+/**
+ * \fn int Sound_InitDecoders(const char **extensions)
+ * \brief Get decoders ready ahead of time.
+ *
+ * Sound_Init() doesn't set up any decoders; each one is initialized the
+ *  first time a Sound_NewSample*() call might need it, which can make that
+ *  first call slower than the rest. Apps that would rather pay this cost
+ *  up front (say, at a loading screen) can do it here.
+ *
+ * Decoders are picked by file extension, like Sound_NewSample() does, from
+ *  a NULL-terminated list:
+ *
+ * \code
+ * const char *wanted[] = { "OGG", "MOD", NULL };
+ * Sound_InitDecoders(wanted);
+ * \endcode
+ *
+ * This function is safe to call from any thread, and calling it again for
+ *  decoders that are already set up costs almost nothing.
+ *
+ *    \param extensions NULL-terminated list of extensions whose decoders
+ *                      should be initialized, or NULL for all of them.
+ *   \return the number of matching decoders that are ready to use. A
+ *           decoder that fails to initialize is skipped from then on,
+ *           like it isn't compiled in.
+ *
+ * \sa Sound_AvailableDecoders
+ */
+SNDDECLSPEC int SDLCALL Sound_InitDecoders(const char **extensions);
+
+
 /**
  * \fn const char *Sound_GetError(void)
  * \brief Get the last SDL_sound error message as a null-terminated string.
@@ -379,6 +529,14 @@ SNDDECLSPEC void SDLCALL Sound_ClearError(void);
  * If no decoders can handle the data, a NULL value is returned, and a human
  *  readable error message can be fetched from Sound_GetError().
  *
+ * If (rw) is non-blocking (a socket, a pipe...), have it return however
+ *  many bytes it has instead of waiting, and decoding sets
+ *  SOUND_SAMPLEFLAG_EAGAIN when it runs short, so you can come back to this
+ *  sample later. Not every decoder can do this; WAV, AIFF, AU, RAW, MP3 and
+ *  FLAC can. MP3 and FLAC will also take a read of zero bytes to mean "not
+ *  yet" instead of end of stream, if SDL_RWsize() says there's more to come.
+ *  Opening and seeking a sample still wait for the data they need.
+ *
  * Optionally, a desired audio format can be specified. If the incoming data
  *  is in a different format, SDL_sound will convert it to the desired format
  *  on the fly. Note that this can be an expensive operation, so it may be
@@ -508,6 +666,380 @@ SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleFromFile(const char *fname,
                                                       Sound_AudioInfo *desired,
                                                       Uint32 bufferSize);
 
+/**
+ * \fn Sound_Sample *Sound_NewSampleFromFileMapped(const char *filename, Sound_AudioInfo *desired, Uint32 bufferSize)
+ * \brief Start decoding a new sound sample from a memory-mapped file.
+ *
+ * This is like Sound_NewSampleFromFile(), but instead of reading the file
+ *  through stdio, the file is mapped into memory and decoded from there, as
+ *  if you had passed it to Sound_NewSampleFromMem(). Decoders read straight
+ *  out of the OS's file cache, with no extra copies, and only the parts of
+ *  the file that actually get touched are paged in. This is a good fit for
+ *  large files, or formats whose decoders need the whole file at once.
+ *
+ * The mapping is released when the sample is freed. Please don't change or
+ *  truncate the file while the sample exists.
+ *
+ * If the file can't be mapped (it's not a regular file, it's larger than
+ *  2 gigabytes, or this platform doesn't support memory-mapped files), this
+ *  quietly falls back to Sound_NewSampleFromFile().
+ *
+ *    \param filename file containing sound data.
+ *    \param desired Format to convert sound data into. Can usually be NULL,
+ *                   if you don't need conversion.
+ *    \param bufferSize size, in bytes, of initial read buffer.
+ *   \return Sound_Sample pointer, which is used as a handle to several other
+ *           SDL_sound APIs. NULL on error. If error, use
+ *           Sound_GetError() to see what went wrong.
+ *
+ * \sa Sound_NewSampleFromFile
+ * \sa Sound_NewSampleFromMem
+ * \sa Sound_FreeSample
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleFromFileMapped(const char *filename,
+                                                      Sound_AudioInfo *desired,
+                                                      Uint32 bufferSize);
+
+
+/**
+ * \fn Sound_Sample *Sound_NewSampleResident(SDL_RWops *rw, const char *ext, Sound_AudioInfo *desired, Uint32 bufferSize)
+ * \brief Start decoding a new sound sample from a copy of it in memory.
+ *
+ * This reads everything left in (rw) into memory, closes (rw), and then
+ *  works like Sound_NewSample() on that copy. The sound stays compressed
+ *  in memory and is decoded as you go, so there's no more disk or
+ *  network i/o once this returns, and Sound_Rewind() and Sound_Seek()
+ *  never have to wait on a read. It's the middle ground between streaming
+ *  from (rw) and Sound_DecodeAll(): a Vorbis or MP3 sound costs about its
+ *  file size instead of about ten times that as PCM.
+ *
+ * Sound_NewInstance() works on a resident sample that isn't fully decoded.
+ *  Each instance gets a decoder of its own, but they all read the same
+ *  copy of the data, which is freed along with the last of them.
+ *
+ *    \param rw SDL_RWops with sound data. It's closed before this returns,
+ *              even on failure.
+ *    \param ext File extension normally associated with a data format.
+ *               Can usually be NULL.
+ *    \param desired Format to convert sound data into. Can usually be NULL,
+ *                   if you don't need conversion.
+ *    \param bufferSize size, in bytes, of initial read buffer.
+ *   \return Sound_Sample pointer, which is used as a handle to several other
+ *           SDL_sound APIs. NULL on error. If error, use
+ *           Sound_GetError() to see what went wrong.
+ *
+ * \sa Sound_NewSampleFromFileResident
+ * \sa Sound_NewInstance
+ * \sa Sound_FreeSample
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleResident(SDL_RWops *rw,
+                                                   const char *ext,
+                                                   Sound_AudioInfo *desired,
+                                                   Uint32 bufferSize);
+
+
+/**
+ * \fn Sound_Sample *Sound_NewSampleFromFileResident(const char *filename, Sound_AudioInfo *desired, Uint32 bufferSize)
+ * \brief Start decoding a new sound sample from a file read into memory.
+ *
+ * This is Sound_NewSampleResident() for a file on disk; the file extension
+ *  is taken from (filename). The file isn't touched again after this
+ *  returns.
+ *
+ *    \param filename file containing sound data.
+ *    \param desired Format to convert sound data into. Can usually be NULL,
+ *                   if you don't need conversion.
+ *    \param bufferSize size, in bytes, of initial read buffer.
+ *   \return Sound_Sample pointer, which is used as a handle to several other
+ *           SDL_sound APIs. NULL on error. If error, use
+ *           Sound_GetError() to see what went wrong.
+ *
+ * \sa Sound_NewSampleResident
+ * \sa Sound_FreeSample
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleFromFileResident(const char *filename,
+                                                      Sound_AudioInfo *desired,
+                                                      Uint32 bufferSize);
+
+
+/**
+ * \fn int Sound_ProbeInfo(SDL_RWops *rw, const char *ext, Sound_AudioInfo *info, Sint32 *duration)
+ * \brief Find out what's in a sound without opening it for decoding.
+ *
+ * This picks a decoder exactly like Sound_NewSample() does, and has it read
+ *  the stream's headers, but stops there: no Sound_Sample is created, no
+ *  decode buffer is allocated and no conversion is set up. It's meant for
+ *  scanning a lot of files, say to build an index of them, where only
+ *  the format and length are of interest.
+ *
+ * (info) gets the format the decoder would hand out with no conversion,
+ *  which is what a sample opened with a NULL (desired) would have in
+ *  sample->actual. (duration) gets what Sound_GetDuration() would say, in
+ *  milliseconds, or -1 if that's unknown without decoding the whole thing.
+ *
+ * Some formats still need more than their header for this. Modules are
+ *  loaded, since their length depends on what plays in them. MP3 files
+ *  without a VBR header are assumed to be constant bitrate, and their
+ *  length worked out from the file size; a variable bitrate file without
+ *  one may be reported a little off, until something seeks in it.
+ *
+ * The RWops is closed before this returns, whether it succeeds or not,
+ *  just like Sound_NewSample() takes ownership of it.
+ *
+ *    \param rw SDL_RWops with sound data.
+ *    \param ext File extension normally associated with a data format.
+ *               Can usually be NULL.
+ *    \param info Receives the sound's native format. Can be NULL.
+ *    \param duration Receives the sound's length in milliseconds, or -1.
+ *                    Can be NULL.
+ *   \return nonzero on success, zero if no decoder took the stream.
+ *           Specifics of the error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_ProbeFileInfo
+ * \sa Sound_NewSample
+ * \sa Sound_GetDuration
+ */
+SNDDECLSPEC int SDLCALL Sound_ProbeInfo(SDL_RWops *rw, const char *ext,
+                                        Sound_AudioInfo *info,
+                                        Sint32 *duration);
+
+
+/**
+ * \fn int Sound_ProbeFileInfo(const char *filename, Sound_AudioInfo *info, Sint32 *duration)
+ * \brief Find out what's in a sound file without opening it for decoding.
+ *
+ * This is Sound_ProbeInfo() for a file on disk. The file extension is
+ *  taken from (filename), and the file is memory-mapped where possible, so
+ *  only the parts the decoder looks at are read. The decoded PCM cache (see
+ *  Sound_SetCacheBudget()) is never consulted or filled.
+ *
+ *    \param filename file containing sound data.
+ *    \param info Receives the sound's native format. Can be NULL.
+ *    \param duration Receives the sound's length in milliseconds, or -1.
+ *                    Can be NULL.
+ *   \return nonzero on success, zero on error. Specifics of the error can
+ *           be gleaned from Sound_GetError().
+ *
+ * \sa Sound_ProbeInfo
+ */
+SNDDECLSPEC int SDLCALL Sound_ProbeFileInfo(const char *filename,
+                                            Sound_AudioInfo *info,
+                                            Sint32 *duration);
+
+
+/**
+ * \fn void Sound_SetCacheBudget(Uint32 bytes)
+ * \brief Turn on the decoded PCM cache, and choose how big it can get.
+ *
+ * With the cache on, the first time a file is opened with
+ *  Sound_NewSampleFromFile() (or anything is opened with
+ *  Sound_NewSampleCached()), it's decoded in full and the result is kept
+ *  around. Opening the same thing again, with the same desired format, skips
+ *  the file and the decoder completely, and plays from memory. This is meant
+ *  for sound effects that get opened over and over again.
+ *
+ * When the cache holds more than (bytes), the least-recently-used entries
+ *  are dropped. Samples that are still playing from a dropped entry keep
+ *  working; its memory is freed with the last of them. A single sound bigger
+ *  than the whole budget is never cached; if its duration says so up front
+ *  (or it doesn't know its duration), it isn't even decoded in full, and
+ *  you get a normal sample that decodes as it plays.
+ *
+ * Note that the cache doesn't notice if a file changes on disk; use
+ *  Sound_FlushCache() if you need it to forget what it has.
+ *
+ * The cache is off (a budget of zero) by default. Setting a smaller budget
+ *  drops entries right away, and zero turns the cache off again.
+ *
+ *    \param bytes Most bytes of decoded audio to keep. Zero disables caching.
+ *
+ * \sa Sound_NewSampleCached
+ * \sa Sound_FlushCache
+ * \sa Sound_GetCacheStats
+ */
+SNDDECLSPEC void SDLCALL Sound_SetCacheBudget(Uint32 bytes);
+
+
+/**
+ * \fn Sound_Sample *Sound_NewSampleCached(SDL_RWops *rw, const char *ext, const char *key, Sound_AudioInfo *desired, Uint32 bufferSize)
+ * \brief Start decoding a new sound sample, using the PCM cache.
+ *
+ * This is Sound_NewSample(), but if something with the same (key) and
+ *  (desired) format is in the cache, (rw) is closed unread and the new
+ *  sample plays from the cache. Otherwise, (rw) is decoded in full and added
+ *  to the cache. Either way, the sample works like any other.
+ *
+ * (key) can be anything that names the data uniquely: a path within an
+ *  archive, an asset ID, etc. If (key) is NULL or the cache is off, this is
+ *  exactly Sound_NewSample().
+ *
+ *    \param rw SDL_RWops with sound data.
+ *    \param ext File extension normally associated with a data format.
+ *    \param key Name for this data in the cache.
+ *    \param desired Format to convert sound data into. Can usually be NULL,
+ *                   if you don't need conversion.
+ *    \param bufferSize Size, in bytes, to allocate for the decoding buffer.
+ *   \return Sound_Sample pointer, which is used as a handle to several other
+ *           SDL_sound APIs. NULL on error. If error, use
+ *           Sound_GetError() to see what went wrong.
+ *
+ * \sa Sound_SetCacheBudget
+ * \sa Sound_NewSample
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleCached(SDL_RWops *rw,
+                                                         const char *ext,
+                                                         const char *key,
+                                                         Sound_AudioInfo *desired,
+                                                         Uint32 bufferSize);
+
+
+/**
+ * \fn void Sound_FlushCache(void)
+ * \brief Empty the decoded PCM cache.
+ *
+ * The budget doesn't change. Samples playing from the cache keep working.
+ *
+ * \sa Sound_SetCacheBudget
+ */
+SNDDECLSPEC void SDLCALL Sound_FlushCache(void);
+
+
+/**
+ * \fn void Sound_GetCacheStats(Sound_CacheStats *stats)
+ * \brief Find out how well the decoded PCM cache is working.
+ *
+ * The counters start at zero when SDL_sound is initialized.
+ *
+ *    \param stats Filled in with the current numbers.
+ *
+ * \sa Sound_SetCacheBudget
+ */
+SNDDECLSPEC void SDLCALL Sound_GetCacheStats(Sound_CacheStats *stats);
+
+
+/**
+ * \fn void Sound_SetReadAheadSize(Uint32 size)
+ * \brief Set how much SDL_sound reads ahead from your SDL_RWops.
+ *
+ * Many decoders parse their headers a few bytes at a time. If your SDL_RWops
+ *  is backed by something where each read is expensive (an archive, a
+ *  network stream, etc), that adds up. So by default, Sound_NewSample()
+ *  wraps the SDL_RWops you give it in one that reads ahead in 4 kilobyte
+ *  blocks and serves small reads from memory. Memory streams, like the ones
+ *  Sound_NewSampleFromMem() makes, are never wrapped.
+ *
+ * This only affects samples created after the call. Specify zero to turn
+ *  read-ahead off and have decoders talk to your SDL_RWops directly.
+ *
+ *    \param size Read-ahead block size, in bytes. Zero disables it.
+ *
+ * \sa Sound_NewSample
+ */
+SNDDECLSPEC void SDLCALL Sound_SetReadAheadSize(Uint32 size);
+
+
+/**
+ * \fn void Sound_SetStreamingConversion(int enable)
+ * \brief Convert through an SDL_AudioStream instead of in place.
+ *
+ * Normally, when a sample's desired format isn't its actual format, the
+ *  decoder fills part of sample->buffer and the result is converted in
+ *  place. That means the buffer has to be big enough to hold the output of
+ *  the worst-case conversion: turning 22kHz mono 8-bit audio into 48kHz
+ *  stereo float needs well over ten times the memory of what was decoded.
+ *
+ * With streaming conversion on, each sample gets a small decode buffer of
+ *  its own and converts through an SDL_AudioStream, so sample->buffer is
+ *  exactly as big as you asked for. If you have lots of samples around at
+ *  once, this can save a lot of memory. It does cost a copy, and it skips
+ *  the faster single-pass converters SDL_sound would otherwise use, and it
+ *  can't be combined with Sound_SetResampleQuality().
+ *
+ * This only affects samples created after the call, and needs SDL 2.0.7 or
+ *  later; with older versions, this setting is ignored. It's off by default.
+ *
+ *    \param enable non-zero to turn streaming conversion on, zero for off.
+ *
+ * \sa Sound_NewSample
+ * \sa Sound_SetBufferSize
+ */
+SNDDECLSPEC void SDLCALL Sound_SetStreamingConversion(int enable);
+
+
+/**
+ * \fn void Sound_SetModuleMixThreads(int threads)
+ * \brief Mix tracker modules' channels on more than one thread.
+ *
+ * Modules (MOD, S3M, XM, IT and friends) are played by mixing every one of
+ *  their channels together, which can get expensive for songs with lots of
+ *  channels. With this set to 2 or more, each module opened afterwards gets
+ *  a few threads of its own to share the channels between. The output is
+ *  exactly the same as mixing on one thread; it just gets done sooner on
+ *  a machine with cores to spare. Up to 8 threads are used, including the
+ *  one calling Sound_Decode(). Songs with only a few channels playing
+ *  don't bother with the extra threads.
+ *
+ * This only affects samples created after the call. It's 0 (don't use any
+ *  extra threads) by default.
+ *
+ *    \param threads Number of threads to mix each module with. 0 or 1 for
+ *                   none.
+ */
+SNDDECLSPEC void SDLCALL Sound_SetModuleMixThreads(int threads);
+
+
+/**
+ * \fn void Sound_FlushPatchCache(void)
+ * \brief Free the instrument patches MIDI songs were played with.
+ *
+ * MIDI and ABC files are played with GUS patches named in timidity.cfg.
+ *  Each patch is only loaded the first time a song needs it, then kept and
+ *  shared by every song after that. This frees the ones no open sample is
+ *  using right now, and makes the next song read timidity.cfg again, so
+ *  it'll notice if you've changed it. It's safe to call while other threads
+ *  are decoding; patches are freed when Sound_Quit() is called anyhow.
+ *
+ * This does nothing if SDL_sound was built without the ModPlug decoder.
+ */
+SNDDECLSPEC void SDLCALL Sound_FlushPatchCache(void);
+
+
+/**
+ * \enum Sound_DecodeQuality
+ * \brief How much CPU decoders may spend on making things sound nice.
+ *
+ * Most formats decode the same way no matter what, but some decoders have
+ *  extras that cost far more than the decoding itself. Tracker modules, for
+ *  example, are normally mixed with an 8-tap FIR interpolator plus bass
+ *  boost and surround effects; background music on a handheld might rather
+ *  have the CPU back.
+ *
+ * \sa Sound_SetDefaultDecodeQuality
+ */
+typedef enum
+{
+    SOUND_DECODE_QUALITY_BEST = 0,  /**< Everything the decoder offers (the default). */
+    SOUND_DECODE_QUALITY_BALANCED,  /**< Good interpolation, no extra effects. */
+    SOUND_DECODE_QUALITY_FAST       /**< Linear interpolation, no extra effects. */
+} Sound_DecodeQuality;
+
+
+/**
+ * \fn void Sound_SetDefaultDecodeQuality(Sound_DecodeQuality quality)
+ * \brief Choose how hard decoders work on samples created from now on.
+ *
+ * Each sample gets the quality that was set when it was created and keeps
+ *  it, so set this before each Sound_NewSample*() call if different samples
+ *  need different tiers. Right now only the module decoder pays attention;
+ *  other decoders sound the same at any setting.
+ *
+ *    \param quality One of the Sound_DecodeQuality values.
+ *
+ * \sa Sound_SetDefaultResampleQuality
+ */
+SNDDECLSPEC void SDLCALL Sound_SetDefaultDecodeQuality(Sound_DecodeQuality quality);
+
+
 /**
  * \fn void Sound_FreeSample(Sound_Sample *sample)
  * \brief Dispose of a Sound_Sample.
@@ -525,6 +1057,150 @@ SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewSampleFromFile(const char *fname,
 SNDDECLSPEC void SDLCALL Sound_FreeSample(Sound_Sample *sample);
 
 
+/**
+ * \fn int Sound_PrewarmSamplePool(Uint32 count, Uint32 bufferSize)
+ * \brief Preallocate memory for future Sound_Samples.
+ *
+ * SDL_sound keeps the memory of freed Sound_Samples around, and reuses it
+ *  the next time you create a sample, so apps that create and destroy lots
+ *  of short-lived samples don't pay for a trip to the allocator every time.
+ *  Decode buffers are pooled by size, rounded up to a power of two between
+ *  1 kilobyte and 1 megabyte; buffers outside that range are not pooled.
+ *  A new sample's buffer is zeroed whether it came from the pool or not.
+ *
+ * This function fills the pool ahead of time, so the first (count) calls to
+ *  Sound_NewSample*() with a buffer size of (bufferSize) or less don't
+ *  allocate either. Calling this a second time adds to the pool, it does not
+ *  replace it.
+ *
+ * This function is safe to call from any thread.
+ *
+ *    \param count Number of samples to preallocate.
+ *    \param bufferSize Decode buffer size to preallocate for each sample,
+ *                      in bytes. Specify zero to only preallocate the
+ *                      sample structures themselves. Sizes over a
+ *                      megabyte can't be pooled, and fail before anything
+ *                      is allocated.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError(). Anything allocated
+ *           before the error stays in the pool.
+ *
+ * \sa Sound_TrimSamplePool
+ * \sa Sound_NewSample
+ */
+SNDDECLSPEC int SDLCALL Sound_PrewarmSamplePool(Uint32 count,
+                                                Uint32 bufferSize);
+
+
+/**
+ * \fn void Sound_TrimSamplePool(void)
+ * \brief Release memory held by the sample pool.
+ *
+ * Frees everything that Sound_FreeSample() and Sound_PrewarmSamplePool()
+ *  have left in the pool. Samples that are still alive are not affected.
+ *  Sound_Quit() does this for you.
+ *
+ * This function is safe to call from any thread.
+ *
+ * \sa Sound_PrewarmSamplePool
+ */
+SNDDECLSPEC void SDLCALL Sound_TrimSamplePool(void);
+
+
+/**
+ * \fn int Sound_Suspend(Sound_Sample *sample)
+ * \brief Free most of a sample's memory until it's needed again.
+ *
+ * An app with hundreds of samples open, most of them idle, pays for every
+ *  one's decoder state and buffers the whole time. This closes the sample's
+ *  decoder and frees its buffers, but keeps the Sound_Sample, its SDL_RWops
+ *  and its play position, so it can pick up again exactly where it left off.
+ *  The decode buffer goes back to the sample pool, where other samples (or
+ *  this one, waking up) can reuse it; Sound_TrimSamplePool() hands it back
+ *  to the system.
+ *
+ * While suspended, sample->buffer is NULL; anything you haven't used from the
+ *  last Sound_Decode() is gone. Everything else about the sample, including
+ *  its flags, format and Sound_TellFrames(), stays the same.
+ *
+ * A suspended sample wakes up by itself when you decode, seek or rewind it,
+ *  change its buffer size or resample quality, or play it with
+ *  Sound_MixPlay() or Sound_StartStreaming(). Waking means opening the
+ *  decoder again and seeking, which can take a while for some formats, so
+ *  you might prefer to call Sound_Resume() yourself at a better time.
+ *
+ * You can't suspend a sample that's playing in the mixer or streaming, one
+ *  that Sound_DecodeAll() finished, or instances, cached samples and
+ *  samples with instances; they share their data with other samples. A
+ *  sample that can't seek can only be suspended at its start or its end.
+ *
+ *    \param sample The Sound_Sample to suspend.
+ *   \return nonzero on success, zero on error. Specifics of the error can be
+ *           gleaned from Sound_GetError(). Suspending a sample that's already
+ *           suspended succeeds and does nothing.
+ *
+ * \sa Sound_Resume
+ * \sa Sound_GetMemoryUsage
+ */
+SNDDECLSPEC int SDLCALL Sound_Suspend(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_Resume(Sound_Sample *sample)
+ * \brief Bring a suspended sample back.
+ *
+ * Opens the sample's decoder again, allocates its buffers, and seeks back to
+ *  where it was suspended. The position is as exact as the decoder's
+ *  seeking is; see Sound_SeekFrames().
+ *
+ * If the decoder won't open again (the file changed, or there's no memory),
+ *  this fails and the sample stays suspended, so you can try again or free
+ *  it. If it opens but can't seek back, this fails and the sample has
+ *  SOUND_SAMPLEFLAG_ERROR set, rather than quietly starting over.
+ *
+ *    \param sample The Sound_Sample to resume.
+ *   \return nonzero on success, zero on error. Specifics of the error can be
+ *           gleaned from Sound_GetError(). Resuming a sample that isn't
+ *           suspended succeeds and does nothing.
+ *
+ * \sa Sound_Suspend
+ */
+SNDDECLSPEC int SDLCALL Sound_Resume(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_IsSuspended(Sound_Sample *sample)
+ * \brief Check if Sound_Suspend() freed a sample's memory.
+ *
+ *    \param sample The Sound_Sample to check.
+ *   \return nonzero if (sample) is suspended, zero if it isn't.
+ *
+ * \sa Sound_Suspend
+ */
+SNDDECLSPEC int SDLCALL Sound_IsSuspended(Sound_Sample *sample);
+
+
+/**
+ * \fn Uint32 Sound_GetMemoryUsage(Sound_Sample *sample)
+ * \brief Find out roughly how much memory a sample is using.
+ *
+ * This counts the sample itself, its buffers, its resampler, and what its
+ *  decoder allocated, as far as the decoder can tell us; the WAV, AIFF, AU,
+ *  VOC and RAW decoders keep next to nothing, so they don't report it. Data
+ *  shared with other samples (cached PCM, instances, a resident sample's
+ *  encoded data) isn't counted, and neither is the SDL_RWops.
+ *
+ * This is an estimate, for deciding which samples to Sound_Suspend(), not an
+ *  exact accounting of the heap.
+ *
+ *    \param sample The Sound_Sample to check.
+ *   \return bytes in use, or zero on error.
+ *
+ * \sa Sound_Suspend
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_GetMemoryUsage(Sound_Sample *sample);
+
+
 /**
  * \fn Sint32 Sound_GetDuration(Sound_Sample *sample)
  * \brief Retrieve total play time of sample, in milliseconds.
@@ -574,11 +1250,107 @@ SNDDECLSPEC Sint32 SDLCALL Sound_GetDuration(Sound_Sample *sample);
  *
  * \sa Sound_Decode
  * \sa Sound_DecodeAll
+ * \sa Sound_SetAutoBufferSize
  */
 SNDDECLSPEC int SDLCALL Sound_SetBufferSize(Sound_Sample *sample,
                                             Uint32 new_size);
 
 
+/**
+ * \fn int Sound_SetAutoBufferSize(Sound_Sample *sample, Uint32 max_size)
+ * \brief Let Sound_Decode() pick the buffer size for a sample.
+ *
+ * Once this is on, Sound_Decode() keeps track of how fast you're pulling
+ *  audio out of (sample) and how long the decoder takes to make it, and
+ *  resizes the buffer every few calls to suit. If you're keeping pace with
+ *  playback, you get roughly 50 milliseconds of audio per call, so latency
+ *  stays low. If you're pulling much faster than realtime, or the decoder
+ *  is most of what you're waiting on, the buffer grows (up to (max_size))
+ *  so each call does more work per trip through the decoder. Sizes are
+ *  rounded to the decoder's natural block size where it has one.
+ *
+ * The resize happens at the start of a Sound_Decode() call, so the data
+ *  from your previous call is gone by then anyhow, but it means
+ *  sample->buffer and sample->buffer_size may change on any call; don't
+ *  hold onto them between calls. Sound_DecodeInto(), Sound_DecodeView(),
+ *  Sound_DecodeMany() and the mixer don't resize anything, and their
+ *  decoding doesn't count toward the measurement.
+ *
+ * Calling Sound_SetBufferSize() yourself doesn't turn this off; the next
+ *  adjustment just starts from the size you set. Pass a (max_size) of zero
+ *  to turn it off; the buffer keeps whatever size it has at that point.
+ *
+ *    \param sample The Sound_Sample to size automatically.
+ *    \param max_size The largest buffer, in bytes, to grow to. Zero to stop.
+ *   \return non-zero on success, zero on failure. On failure, the buffer
+ *           keeps its current size and automatic sizing is off.
+ *
+ * \sa Sound_SetBufferSize
+ * \sa Sound_Decode
+ */
+SNDDECLSPEC int SDLCALL Sound_SetAutoBufferSize(Sound_Sample *sample,
+                                                Uint32 max_size);
+
+
+/**
+ * \enum Sound_ResampleQuality
+ * \brief How to convert between sample rates.
+ *
+ * When a sample's desired rate isn't its actual rate, something has to
+ *  make up the difference. SDL_AudioCVT's converter is cheap and is the
+ *  default, but it's not pretty to listen to. The other choices trade CPU
+ *  for quality: linear is fine for short blips and UI noises, the sinc
+ *  filters are for music.
+ *
+ * \sa Sound_SetDefaultResampleQuality
+ * \sa Sound_SetResampleQuality
+ */
+typedef enum
+{
+    SOUND_RESAMPLE_SDL = 0,    /**< Let SDL_AudioCVT do it (the default). */
+    SOUND_RESAMPLE_LINEAR,     /**< Linear interpolation. Cheap. */
+    SOUND_RESAMPLE_SINC_FAST,  /**< 16-tap windowed sinc. */
+    SOUND_RESAMPLE_SINC_BEST   /**< 48-tap windowed sinc. Expensive. */
+} Sound_ResampleQuality;
+
+
+/**
+ * \fn void Sound_SetDefaultResampleQuality(Sound_ResampleQuality quality)
+ * \brief Choose how samples created from now on convert sample rates.
+ *
+ * This only affects samples created after the call; use
+ *  Sound_SetResampleQuality() to change an existing one. It also changes
+ *  nothing for samples whose desired rate matches their actual rate.
+ *
+ *    \param quality One of the Sound_ResampleQuality values.
+ *
+ * \sa Sound_SetResampleQuality
+ */
+SNDDECLSPEC void SDLCALL Sound_SetDefaultResampleQuality(Sound_ResampleQuality quality);
+
+
+/**
+ * \fn int Sound_SetResampleQuality(Sound_Sample *sample, Sound_ResampleQuality quality)
+ * \brief Choose how an existing sample converts sample rates.
+ *
+ * Any audio that's been decoded but not handed to you yet is thrown away,
+ *  so you'll probably want to do this right after creating the sample, or
+ *  right before a Sound_Seek() or Sound_Rewind(). The sample's buffer may be
+ *  reallocated, so reload sample->buffer afterwards. This fails for samples
+ *  that were created with Sound_SetStreamingConversion() turned on.
+ *
+ *    \param sample The Sound_Sample to change.
+ *    \param quality One of the Sound_ResampleQuality values.
+ *   \return non-zero on success, zero on failure, in which case the sample
+ *           will continue to convert the way it did before.
+ *
+ * \sa Sound_SetDefaultResampleQuality
+ * \sa Sound_SetBufferSize
+ */
+SNDDECLSPEC int SDLCALL Sound_SetResampleQuality(Sound_Sample *sample,
+                                                 Sound_ResampleQuality quality);
+
+
 /**
  * \fn Uint32 Sound_Decode(Sound_Sample *sample)
  * \brief Decode more of the sound data in a Sound_Sample.
@@ -601,6 +1373,112 @@ SNDDECLSPEC int SDLCALL Sound_SetBufferSize(Sound_Sample *sample,
 SNDDECLSPEC Uint32 SDLCALL Sound_Decode(Sound_Sample *sample);
 
 
+/**
+ * \fn Uint32 Sound_DecodeInto(Sound_Sample *sample, void *buffer, Uint32 len)
+ * \brief Decode more of the sound data straight into your own buffer.
+ *
+ * This works like Sound_Decode(), but the decoder writes into (buffer)
+ *  instead of sample->buffer, which saves you a copy if you were just going
+ *  to move the audio somewhere else anyhow. The data is already converted to
+ *  the sample's desired format when this returns. The contents of
+ *  sample->buffer are left alone.
+ *
+ * If format conversion needs scratch space (resampling to a higher rate, or
+ *  going from mono to stereo, etc), the decoder will be asked for less than
+ *  (len) bytes so the converted result still fits. So this may return less
+ *  than (len) even when more data is available; check sample->flags as you
+ *  would with Sound_Decode(). (len) must be large enough to hold at least one
+ *  sample frame after conversion scratch space is accounted for.
+ *
+ *    \param sample Do more decoding to this Sound_Sample.
+ *    \param buffer Where to put the decoded audio. Must be at least (len)
+ *                  bytes.
+ *    \param len Size of (buffer), in bytes.
+ *   \return number of bytes decoded into (buffer). If it is less than (len),
+ *           you should check sample->flags to see what the current state of
+ *           the sample is (EOF, error, read again).
+ *
+ * \sa Sound_Decode
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_DecodeInto(Sound_Sample *sample,
+                                            void *buffer, Uint32 len);
+
+
+/**
+ * \fn Uint32 Sound_DecodeView(Sound_Sample *sample, const void **data)
+ * \brief Decode more of the sound data, without copying it if possible.
+ *
+ * This works like Sound_Decode(), but instead of always filling
+ *  sample->buffer, it points (*data) at the decoded audio. If the sample
+ *  comes from memory (Sound_NewSampleFromMem(), a memory SDL_RWops, or
+ *  Sound_NewSampleFromFileMapped()), the data is uncompressed (RAW, or PCM
+ *  WAV files) and it's already in the desired format, (*data) will point
+ *  straight into the source memory and nothing gets decoded or copied at
+ *  all. Otherwise, this decodes into sample->buffer like Sound_Decode() and
+ *  points (*data) there, so it's always safe to use in place of
+ *  Sound_Decode(); loop regions behave the same way they would there.
+ *  Automatic buffer sizing doesn't resize the buffer here, though.
+ *
+ * Either way, no more than sample->buffer_size bytes are returned at a time.
+ *  Treat the data as read-only; it's valid until the next call that decodes,
+ *  seeks, rewinds or frees this sample, and if it points into your memory,
+ *  for as long as that memory is around. It isn't guaranteed to be aligned
+ *  any better than the source data was.
+ *
+ *    \param sample Do more decoding to this Sound_Sample.
+ *    \param data On return, points to the decoded audio, or NULL if nothing
+ *                 was decoded.
+ *   \return number of bytes available at (*data). If it is less than
+ *           sample->buffer_size, check sample->flags as you would with
+ *           Sound_Decode().
+ *
+ * \sa Sound_Decode
+ * \sa Sound_DecodeInto
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_DecodeView(Sound_Sample *sample,
+                                            const void **data);
+
+
+/**
+ * \fn int Sound_DecodeMany(Sound_DecodeRequest *requests, int count, int threads)
+ * \brief Decode more of lots of samples at once.
+ *
+ * If you're decoding a few hundred voices every audio callback, this does
+ *  the same thing as calling Sound_Decode() (or Sound_DecodeInto()) on every
+ *  one of them, without the per-call overhead, and optionally spread over
+ *  more than one thread. Samples that use the same decoder are done
+ *  together, which is kinder to the CPU's caches, so don't count on them
+ *  being decoded in the order you listed them.
+ *
+ * Samples that are already at EOF or in an error state are skipped, with
+ *  (decoded) set to zero. Check each sample's flags afterwards, as you would
+ *  after Sound_Decode(); on extra threads, Sound_GetError() won't know
+ *  what went wrong, but the sample's flags will. Each sample may only be in
+ *  (requests) once per call; if one shows up twice, nothing is decoded and
+ *  this fails. Requests without (buffer) go through the same loop region
+ *  logic Sound_Decode() does, but never resize sample->buffer, even with
+ *  automatic buffer sizing on.
+ *
+ * With (threads) at 2 or more, up to that many threads (counting the one
+ *  that calls this) share the requests. Those threads are kept around for
+ *  the next call, until Sound_Quit(). Zero or less picks one per CPU core;
+ *  1 does everything on the calling thread. Only one call at a time uses
+ *  the extra threads; another call made meanwhile waits for them.
+ *
+ *    \param requests Array of (count) requests.
+ *    \param count Number of requests.
+ *    \param threads Number of threads to decode with. See above.
+ *   \return number of requests that got any data, or -1 on an error that
+ *           kept anything from being decoded; check Sound_GetError().
+ *
+ * \sa Sound_Decode
+ * \sa Sound_DecodeInto
+ * \sa Sound_DecodeRequest
+ */
+SNDDECLSPEC int SDLCALL Sound_DecodeMany(Sound_DecodeRequest *requests,
+                                         int count, int threads);
+
+
 /**
  * \fn Uint32 Sound_DecodeAll(Sound_Sample *sample)
  * \brief Decode the remainder of the sound data in a Sound_Sample.
@@ -617,14 +1495,21 @@ SNDDECLSPEC Uint32 SDLCALL Sound_Decode(Sound_Sample *sample);
  *  memory before giving up...be sure to use this on finite sound sources
  *  only!
  *
- * When decoding the sample in its entirety, the work is done one buffer at a
- *  time. That is, sound is decoded in sample->buffer_size blocks, and
- *  appended to a continually-growing buffer until the decoding completes.
- *  That means that this function will need enough RAM to hold approximately
- *  sample->buffer_size bytes plus the complete decoded sample at most. The
- *  larger your buffer size, the less overhead this function needs, but beware
- *  the possibility of paging to disk. Best to make this user-configurable if
- *  the sample isn't specific and small.
+ * When decoding the sample in its entirety, sound is decoded directly into
+ *  a growing buffer until the decoding completes. If the decoder knows the
+ *  sample's duration, the buffer is sized for the whole thing up front;
+ *  otherwise it starts at a few times sample->buffer_size and doubles as
+ *  needed. The buffer is trimmed to the decoded size once at the end. That
+ *  means that this function will need enough RAM to hold up to about twice
+ *  the complete decoded sample while it works when the duration isn't known,
+ *  but beware the possibility of paging to disk either way. Best to make this
+ *  user-configurable if the sample isn't specific and small.
+ *
+ * If the source runs dry before the end (a stream that's behind sets
+ *  SOUND_SAMPLEFLAG_EAGAIN), this stops there instead of waiting for more,
+ *  and sample->buffer holds whatever was decoded so far. Decode the rest
+ *  with Sound_Decode() once the data arrives; calling this again would
+ *  replace the buffer with only what comes after.
  *
  *    \param sample Do all decoding for this Sound_Sample.
  *   \return number of bytes decoded into sample->buffer. You should check
@@ -637,6 +1522,226 @@ SNDDECLSPEC Uint32 SDLCALL Sound_Decode(Sound_Sample *sample);
 SNDDECLSPEC Uint32 SDLCALL Sound_DecodeAll(Sound_Sample *sample);
 
 
+/**
+ * \fn Uint32 Sound_DecodeAllParallel(Sound_Sample *sample, int threads)
+ * \brief Decode an entire Sound_Sample, using several threads if possible.
+ *
+ * This is like Sound_DecodeAll(), but it splits the sample into time ranges
+ *  and decodes each one on its own thread, with its own copy of the decoder
+ *  and its own stream, then stitches the pieces together in order. The
+ *  boundaries between ranges land on exact sample frames, so the result is
+ *  identical to what Sound_DecodeAll() would produce.
+ *
+ * Unlike Sound_DecodeAll(), this always decodes the WHOLE sample, from the
+ *  start, regardless of how much of it has been decoded already. Wherever
+ *  you had decoded or seeked to is lost, on either path below.
+ *
+ * This can only split up samples whose decoder can seek to an exact sample
+ *  frame and knows the sample's duration, that aren't being resampled, and
+ *  whose data can be opened more than once (samples from memory, or created
+ *  with Sound_NewSampleFromFile() or Sound_NewSampleFromFileMapped()). A
+ *  sample that doesn't qualify is rewound and handed to Sound_DecodeAll()
+ *  instead, so this is always safe to call.
+ *
+ *    \param sample Do all decoding for this Sound_Sample.
+ *    \param threads Number of threads to decode with. Zero or less uses one
+ *                   thread per CPU core.
+ *   \return number of bytes decoded into sample->buffer. You should check
+ *           sample->flags to see what the current state of the sample is
+ *           (EOF, error, read again).
+ *
+ * \sa Sound_DecodeAll
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_DecodeAllParallel(Sound_Sample *sample,
+                                                   int threads);
+
+
+/**
+ * \fn Sound_Sample *Sound_NewInstance(Sound_Sample *sample, Uint32 bufferSize)
+ * \brief Make another sample that plays the same decoded audio.
+ *
+ * Once a sample is fully decoded with Sound_DecodeAll() (or came out of the
+ *  PCM cache; see Sound_SetCacheBudget()), you can make any number of
+ *  instances of it. An instance is a Sound_Sample like any other, with its
+ *  own position, flags, Sound_Seek() and Sound_Rewind(), but it has no
+ *  decoder and no buffer of its own: the audio is shared by all of them,
+ *  and freed when the last one (original included) is freed. This is what
+ *  you want for the forty overlapping copies of one explosion.
+ *
+ * Sound_Decode() on an instance doesn't copy anything; it points
+ *  sample->buffer at the next (bufferSize) bytes of the shared audio. That
+ *  memory is shared, so treat it as read-only! Sound_DecodeInto() copies,
+ *  if you need something you can change.
+ *
+ * An instance's format is always the original's desired format. It starts
+ *  at the beginning of the audio, no matter where the original is. If the
+ *  original decodes anything more after this, it gets a new buffer of its
+ *  own, so its instances aren't affected.
+ *
+ * A sample from Sound_NewSampleResident() can have instances before it's
+ *  decoded, too. Those are regular samples with a decoder and buffer of
+ *  their own, sharing only the compressed data in memory, so
+ *  Sound_Decode() fills their buffer like it would anywhere else. Zero
+ *  for (bufferSize) means the original's buffer size for these.
+ *
+ *    \param sample A fully-decoded Sound_Sample, a resident one, or another
+ *                  instance.
+ *    \param bufferSize Bytes each Sound_Decode() should hand out. Zero means
+ *                      everything at once.
+ *   \return New Sound_Sample, or NULL on error; the sample not being fully
+ *           decoded (or resident) is an error. Free it with
+ *           Sound_FreeSample() as usual.
+ *
+ * \sa Sound_DecodeAll
+ * \sa Sound_NewSampleResident
+ * \sa Sound_FreeSample
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_NewInstance(Sound_Sample *sample,
+                                                     Uint32 bufferSize);
+
+
+/**
+ * \fn void Sound_EnableStats(int enable)
+ * \brief Turn per-sample decoding statistics on or off.
+ *
+ * With stats on, every sample keeps count of the bytes and time its
+ *  decoding takes, for Sound_GetStats() and Sound_GetDecoderStats(). This
+ *  costs a timer read or two per call into the decoder and the SDL_RWops.
+ *  With stats off, which is the default, there's no cost at all.
+ *
+ * This only affects samples created after the call.
+ *
+ *    \param enable non-zero to turn stats on, zero for off.
+ *
+ * \sa Sound_GetStats
+ */
+SNDDECLSPEC void SDLCALL Sound_EnableStats(int enable);
+
+
+/**
+ * \fn int Sound_GetStats(Sound_Sample *sample, Sound_Stats *stats)
+ * \brief Find out where a sample's decoding time went.
+ *
+ * The numbers start at zero when the sample is created. Decoding done by
+ *  Sound_DecodeAllParallel()'s worker threads is added in when it's done.
+ *
+ *    \param sample The Sound_Sample to query.
+ *    \param stats Filled in with the sample's numbers.
+ *   \return nonzero on success, zero if the sample was created with stats
+ *           off, or on error. Specifics of the error can be gleaned from
+ *           Sound_GetError().
+ *
+ * \sa Sound_EnableStats
+ * \sa Sound_GetDecoderStats
+ */
+SNDDECLSPEC int SDLCALL Sound_GetStats(Sound_Sample *sample,
+                                       Sound_Stats *stats);
+
+
+/**
+ * \fn int Sound_GetDecoderStats(const Sound_DecoderInfo *decoder, Sound_Stats *stats)
+ * \brief Find out where decoding time went for one decoder, overall.
+ *
+ * This adds up the stats of every sample that (decoder) has handled since
+ *  Sound_Init(), freed or not. Samples created with stats off aren't
+ *  counted. (decoder) is one of the entries from
+ *  Sound_AvailableDecoders(), or a sample's (decoder) field.
+ *
+ *    \param decoder The decoder to query.
+ *    \param stats Filled in with the decoder's numbers.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_EnableStats
+ * \sa Sound_GetStats
+ */
+SNDDECLSPEC int SDLCALL Sound_GetDecoderStats(const Sound_DecoderInfo *decoder,
+                                              Sound_Stats *stats);
+
+
+/**
+ * \enum Sound_TraceEvent
+ * \brief What a trace hook is being told about.
+ *
+ * \sa Sound_SetTraceHooks
+ */
+typedef enum
+{
+    SOUND_TRACE_OPEN = 0,  /**< A decoder trying to open a sample. */
+    SOUND_TRACE_READ,      /**< A decoder decoding into the sample's buffer. */
+    SOUND_TRACE_SEEK,      /**< A decoder seeking. */
+    SOUND_TRACE_REWIND,    /**< A decoder rewinding. */
+    SOUND_TRACE_CONVERT    /**< Converting decoded audio to the desired format. */
+} Sound_TraceEvent;
+
+
+/**
+ * \brief A trace hook for Sound_SetTraceHooks().
+ *
+ * (decoder) is the decoder's description, from its Sound_DecoderInfo
+ *  ("Microsoft WAVE audio format", ...). What (bytes) means depends on
+ *  the event and on which end of it this is:
+ *
+ * - SOUND_TRACE_READ: the room there is for decoded audio at the start,
+ *   and how many bytes the decoder produced at the end.
+ * - SOUND_TRACE_CONVERT: bytes going in at the start, bytes coming out at
+ *   the end.
+ * - SOUND_TRACE_OPEN, SOUND_TRACE_SEEK, SOUND_TRACE_REWIND: zero at the
+ *   start, and at the end, nonzero if it worked and zero if it didn't.
+ *   Probing for the right decoder tries several, so expect a few failed
+ *   opens before the one that works.
+ *
+ * \sa Sound_SetTraceHooks
+ */
+typedef void (SDLCALL *Sound_TraceFunc)(void *userdata, Sound_TraceEvent event,
+                                        Sound_Sample *sample,
+                                        const char *decoder, Uint32 bytes);
+
+
+/**
+ * \brief Begin and end hooks, for Sound_SetTraceHooks().
+ *
+ * Either function can be NULL.
+ *
+ * \sa Sound_SetTraceHooks
+ */
+typedef struct
+{
+    Sound_TraceFunc begin;  /**< Called just before the work starts. */
+    Sound_TraceFunc end;    /**< Called just after it's done. */
+    void *userdata;         /**< Passed to both, as is. */
+} Sound_TraceHooks;
+
+
+/**
+ * \fn void Sound_SetTraceHooks(const Sound_TraceHooks *hooks)
+ * \brief Get called around every decoder call, for a timeline profiler.
+ *
+ * Sound_GetStats() tells you how much time decoding took altogether; this
+ *  is for seeing when, and which calls were slow, next to everything else
+ *  in a frame profiler like Tracy or Perfetto. With hooks set, SDL_sound
+ *  calls (begin) just before, and (end) just after, each call into a
+ *  decoder's open, read, seek and rewind, and each conversion of decoded
+ *  audio to the desired format.
+ *
+ * Hooks are called on whatever thread is doing the work, which includes
+ *  Sound_DecodeAllParallel() workers, the streaming and playlist threads,
+ *  and the mixer's audio callback, so they need to be thread-safe and
+ *  quick. It's safe to change them while that's going on; each call picks
+ *  up one complete set of hooks, old or new, never half of each, but a
+ *  (begin) from the old set may be followed by an (end) from the new one.
+ *
+ * With no hooks, which is the default, each of those calls costs one
+ *  extra test of a global flag.
+ *
+ *    \param hooks The hooks to call. This is copied. NULL, or both
+ *                 functions NULL, turns tracing off.
+ *
+ * \sa Sound_TraceFunc
+ */
+SNDDECLSPEC void SDLCALL Sound_SetTraceHooks(const Sound_TraceHooks *hooks);
+
+
 /**
  * \fn int Sound_Rewind(Sound_Sample *sample)
  * \brief Rewind a sample to the start.
@@ -715,6 +1820,426 @@ SNDDECLSPEC int SDLCALL Sound_Rewind(Sound_Sample *sample);
  */
 SNDDECLSPEC int SDLCALL Sound_Seek(Sound_Sample *sample, Uint32 ms);
 
+
+/**
+ * \fn int Sound_SeekFrames(Sound_Sample *sample, Uint64 frame)
+ * \brief Seek to an exact sample frame.
+ *
+ * This is Sound_Seek() with a finer ruler: (frame) counts sample frames
+ *  (one sample for each channel) from the start of the sample, at the rate
+ *  you asked for in Sound_NewSample()'s (desired) parameter. A millisecond
+ *  at 44.1kHz covers 44.1 frames, so Sound_Seek() can't land on every one
+ *  of them; this can.
+ *
+ * Most decoders go straight to the frame. Those that can only seek by
+ *  milliseconds are sent to the millisecond at or before it, and if their
+ *  millisecond seeks are exact, the few frames left over are decoded and
+ *  thrown away. Otherwise you land as close as the decoder can get you.
+ *
+ * The same caveats as Sound_Seek() about SOUND_SAMPLEFLAG_CANSEEK and
+ *  failure apply here.
+ *
+ * On success, ERROR, EOF, and EAGAIN are cleared from sample->flags.
+ *
+ *    \param sample The Sound_Sample to seek.
+ *    \param frame The new position, in sample frames from start of sample.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_Seek
+ * \sa Sound_TellFrames
+ */
+SNDDECLSPEC int SDLCALL Sound_SeekFrames(Sound_Sample *sample, Uint64 frame);
+
+
+/**
+ * \fn Sint64 Sound_TellFrames(Sound_Sample *sample)
+ * \brief Report where in a sample the next decoded audio comes from.
+ *
+ * This is the position, in sample frames at the sample's desired rate,
+ *  of the first frame the next call to Sound_Decode() will give you. It
+ *  starts at zero, moves forward as you decode, and is set by
+ *  Sound_Rewind(), Sound_Seek() and Sound_SeekFrames().
+ *
+ * For a sample being streamed with Sound_StartStreaming(), this is where
+ *  the decoder is, which runs ahead of what you've been handed.
+ *
+ *    \param sample The Sound_Sample to query.
+ *   \return The current frame, or -1 on error. Specifics of the error
+ *           can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_SeekFrames
+ */
+SNDDECLSPEC Sint64 SDLCALL Sound_TellFrames(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_SetLoop(Sound_Sample *sample, Uint64 start, Uint64 end, Sint32 count)
+ * \brief Make Sound_Decode() play part of a sample over and over.
+ *
+ * When decoding reaches frame (end), or the end of the sample if (end) is
+ *  zero, Sound_Decode() goes back to frame (start) on its own and carries
+ *  on, (count) times, or forever if (count) is -1. After the last time
+ *  around, decoding runs on past (end) as usual, so you can have an intro,
+ *  a loop and an outro in one file. Frames are counted the same way as
+ *  Sound_SeekFrames() and Sound_TellFrames() count them.
+ *
+ * The loop point is seamless: the first buffer of the region is decoded
+ *  once and kept, and every time around it's copied in right behind the
+ *  last frames of the region, in the same Sound_Decode() call. The decoder
+ *  catches up at the start of the next call, so the call with the loop
+ *  point in it can come back with less than sample->buffer_size bytes. If
+ *  the whole region fits in one buffer, the decoder isn't touched at all.
+ *
+ * Since this all happens in Sound_Decode(), it works for samples playing
+ *  through Sound_MixPlay() or streaming with Sound_StartStreaming(), but you
+ *  have to set the loop up before you start those. Sound_DecodeAll() and
+ *  Sound_DecodeInto() ignore it. Seeking or rewinding yourself is fine;
+ *  the loop stays as it was, including how many times it has left to go.
+ *
+ * A region that doesn't start at zero needs a seekable sample.
+ *
+ *    \param sample The Sound_Sample to loop.
+ *    \param start First frame of the loop.
+ *    \param end Frame just past the last one in the loop, or zero for the
+ *               end of the sample.
+ *    \param count How many times to go back to (start); -1 for forever, or
+ *                 zero to turn looping off.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_Decode
+ * \sa Sound_SeekFrames
+ */
+SNDDECLSPEC int SDLCALL Sound_SetLoop(Sound_Sample *sample, Uint64 start,
+                                      Uint64 end, Sint32 count);
+
+
+/**
+ * \fn int Sound_StartStreaming(Sound_Sample *sample, Uint32 prefetch, Uint32 lowWater)
+ * \brief Start decoding a sample ahead of time on a background thread.
+ *
+ * Sound_Decode() runs the decoder on whatever thread calls it, which is a
+ *  bad idea in an audio callback: a slow frame or a disk stall turns into a
+ *  dropout. Streaming mode moves the decoding to a worker thread, which
+ *  keeps up to (prefetch) bytes of decoded audio waiting in a ring buffer.
+ *  You pull from it with Sound_ReadStream(), which only copies memory and
+ *  never waits on the worker.
+ *
+ * The worker decodes sample->buffer_size bytes at a time until the ring is
+ *  full, then sleeps until reading drains it below (lowWater) bytes.
+ *
+ * While streaming, the worker owns the sample: don't call Sound_Decode(),
+ *  Sound_Seek(), Sound_Rewind(), Sound_SetBufferSize() or friends on it, and
+ *  don't look at sample->buffer or sample->flags. Call
+ *  Sound_StopStreaming() first. Sound_FreeSample() stops streaming for you.
+ *
+ *    \param sample The Sound_Sample to stream.
+ *    \param prefetch How many bytes of decoded audio to keep ready. This is
+ *                    rounded up to a power of two, and to at least twice
+ *                    sample->buffer_size.
+ *    \param lowWater Wake the worker when fewer than this many bytes are
+ *                    buffered. Specify zero for half of (prefetch).
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_ReadStream
+ * \sa Sound_StopStreaming
+ */
+SNDDECLSPEC int SDLCALL Sound_StartStreaming(Sound_Sample *sample,
+                                             Uint32 prefetch,
+                                             Uint32 lowWater);
+
+
+/**
+ * \fn Uint32 Sound_ReadStream(Sound_Sample *sample, void *buffer, Uint32 len, Sound_SampleFlags *state)
+ * \brief Take decoded audio from a streaming sample.
+ *
+ * Copies up to (len) bytes of decoded audio, in the sample's desired format,
+ *  out of the streaming ring buffer. This never blocks and never runs the
+ *  decoder, so it's safe to call from an audio callback. This must only be
+ *  called from one thread at a time.
+ *
+ * If fewer than (len) bytes are ready, you get what there is, and (*state)
+ *  explains why: SOUND_SAMPLEFLAG_EAGAIN means the worker hasn't caught up
+ *  yet, and there will be more later. SOUND_SAMPLEFLAG_EOF or
+ *  SOUND_SAMPLEFLAG_ERROR mean the sample is done and everything the worker
+ *  decoded has been read. Otherwise (*state) is SOUND_SAMPLEFLAG_NONE.
+ *
+ *    \param sample The streaming Sound_Sample to read from.
+ *    \param buffer Where to put the decoded audio.
+ *    \param len Maximum number of bytes to read.
+ *    \param state Receives the stream state, as explained above. Can be
+ *                 NULL if you don't care.
+ *   \return number of bytes copied into (buffer).
+ *
+ * \sa Sound_StartStreaming
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_ReadStream(Sound_Sample *sample,
+                                            void *buffer, Uint32 len,
+                                            Sound_SampleFlags *state);
+
+
+/**
+ * \fn int Sound_StopStreaming(Sound_Sample *sample)
+ * \brief Stop a sample's background decoding thread.
+ *
+ * This waits for the worker to finish its current chunk and throws away
+ *  anything still in the ring buffer. Decoding picks up where the worker
+ *  left off, not where you stopped reading. Afterwards, the sample can be
+ *  used with Sound_Decode() and friends again. This is a no-op if the
+ *  sample isn't streaming.
+ *
+ *    \param sample The streaming Sound_Sample to stop.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_StartStreaming
+ */
+SNDDECLSPEC int SDLCALL Sound_StopStreaming(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_MixInit(Uint32 rate, Uint16 frames)
+ * \brief Open an audio device and start the mixer.
+ *
+ * SDL_sound can play any number of Sound_Samples at once for you. The mixer
+ *  opens an SDL audio device for stereo float output at (rate) Hz, and from
+ *  then on, SDL's audio callback decodes more of each playing sample as
+ *  needed and mixes it all together.
+ *
+ * Samples will only mix if they are decoded at the mixer's rate, so create
+ *  them with a desired rate of (rate). Their desired format has to be
+ *  AUDIO_U8, AUDIO_S8, AUDIO_S16SYS, AUDIO_S32SYS or AUDIO_F32SYS, and they
+ *  must be mono or stereo. Sound_NewSample() will convert to that for you.
+ *
+ * You must call Sound_Init() before this. Sound_Quit() shuts the mixer down
+ *  for you.
+ *
+ *    \param rate Output rate of the mixer, in Hz.
+ *    \param frames Size of the audio device's buffer, in sample frames.
+ *                  Specify zero for a reasonable default.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_MixQuit
+ * \sa Sound_MixPlay
+ */
+SNDDECLSPEC int SDLCALL Sound_MixInit(Uint32 rate, Uint16 frames);
+
+
+/**
+ * \fn void Sound_MixQuit(void)
+ * \brief Stop the mixer and close its audio device.
+ *
+ * Everything that was playing is stopped. The samples themselves are not
+ *  freed. This is a no-op if the mixer isn't running.
+ *
+ * \sa Sound_MixInit
+ */
+SNDDECLSPEC void SDLCALL Sound_MixQuit(void);
+
+
+/**
+ * \fn int Sound_MixPlay(Sound_Sample *sample)
+ * \brief Start mixing a sample.
+ *
+ * The sample plays from wherever it is currently decoded to, until it hits
+ *  EOF or a decoding error, at which point it is taken off the mixer (but
+ *  not freed). If the sample was already decoded with Sound_DecodeAll(),
+ *  the mixer plays sample->buffer instead. Playing a sample that is already
+ *  playing is a no-op, and playing a sample that was stopped with
+ *  Sound_MixStop() resumes where it left off.
+ *
+ * While a sample is playing, the mixer owns its decoding: don't call
+ *  Sound_Decode(), Sound_Seek(), etc on it from your own code without
+ *  stopping it first. Sound_FreeSample() on a playing sample is safe, though.
+ *
+ *    \param sample The Sound_Sample to play.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_MixStop
+ * \sa Sound_MixSetGain
+ */
+SNDDECLSPEC int SDLCALL Sound_MixPlay(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_MixStop(Sound_Sample *sample)
+ * \brief Stop mixing a sample.
+ *
+ * This is a no-op if the sample isn't playing.
+ *
+ *    \param sample The Sound_Sample to stop.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_MixPlay
+ */
+SNDDECLSPEC int SDLCALL Sound_MixStop(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_MixIsPlaying(Sound_Sample *sample)
+ * \brief Find out if a sample is still on the mixer.
+ *
+ *    \param sample The Sound_Sample to query.
+ *   \return nonzero if the sample is playing, zero if it isn't.
+ *
+ * \sa Sound_MixPlay
+ */
+SNDDECLSPEC int SDLCALL Sound_MixIsPlaying(Sound_Sample *sample);
+
+
+/**
+ * \fn int Sound_MixSetGain(Sound_Sample *sample, float left, float right)
+ * \brief Set how loud a sample plays in each output channel.
+ *
+ * A mono sample is played in both channels, scaled by each gain. A stereo
+ *  sample's left channel is scaled by (left) and its right by (right).
+ *  Gains default to 1.0f. This can be called whether the sample is playing
+ *  or not, and takes effect on the next audio callback. The mixer has to be
+ *  running; see Sound_MixInit().
+ *
+ *    \param sample The Sound_Sample to adjust.
+ *    \param left Gain for the left channel.
+ *    \param right Gain for the right channel.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_MixPlay
+ */
+SNDDECLSPEC int SDLCALL Sound_MixSetGain(Sound_Sample *sample,
+                                         float left, float right);
+
+
+/**
+ * \struct Sound_Playlist
+ * \brief A queue of files that play back to back, with no gaps.
+ *
+ * This is opaque; you only get pointers to it from Sound_NewPlaylist().
+ *
+ * \sa Sound_NewPlaylist
+ */
+typedef struct __SOUND_PLAYLIST__ Sound_Playlist;
+
+
+/**
+ * \fn Sound_Playlist *Sound_NewPlaylist(const Sound_AudioInfo *desired, Uint32 bufferSize)
+ * \brief Start a gapless playlist.
+ *
+ * Opening a sound file means probing decoders, setting up conversion and,
+ *  for some formats (modules, especially), parsing the whole thing up
+ *  front. If you open the next track when the last one runs out, that
+ *  shows up as a gap in the audio and a spike in CPU use. A playlist does
+ *  that on a worker thread ahead of time: while one track plays, the next
+ *  one in the queue is opened and its first buffer is decoded, so reading
+ *  runs from the end of one track straight into the start of the next.
+ *
+ * Every track is opened as if by Sound_NewSampleFromFile(path, desired,
+ *  bufferSize). Pass a (desired) format if you want each track to join the
+ *  last one without a break; with NULL, tracks come out in their own
+ *  formats, and Sound_PlaylistRead() stops at each change.
+ *
+ *    \param desired Format to convert every track to, or NULL to use each
+ *                   track's own format.
+ *    \param bufferSize Decode buffer size for each track, in bytes.
+ *   \return a new playlist with nothing in it, or NULL on error. Specifics
+ *           of the error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_PlaylistAppend
+ * \sa Sound_PlaylistRead
+ * \sa Sound_FreePlaylist
+ */
+SNDDECLSPEC Sound_Playlist * SDLCALL Sound_NewPlaylist(const Sound_AudioInfo *desired,
+                                                       Uint32 bufferSize);
+
+
+/**
+ * \fn int Sound_PlaylistAppend(Sound_Playlist *pl, const char *filename)
+ * \brief Add a file to the end of a playlist.
+ *
+ * The file isn't opened here; the playlist's worker thread opens it when
+ *  it's next in line. If it can't be opened then, it's skipped. This can
+ *  be called at any time, from any thread, including while the playlist is
+ *  being read from.
+ *
+ *    \param pl The playlist to add to.
+ *    \param filename Path of the file to play. The string is copied.
+ *   \return nonzero on success, zero on error. Specifics of the
+ *           error can be gleaned from Sound_GetError().
+ *
+ * \sa Sound_PlaylistRead
+ */
+SNDDECLSPEC int SDLCALL Sound_PlaylistAppend(Sound_Playlist *pl,
+                                             const char *filename);
+
+
+/**
+ * \fn Uint32 Sound_PlaylistRead(Sound_Playlist *pl, void *buffer, Uint32 len, Sound_SampleFlags *state)
+ * \brief Decode the next (len) bytes of a playlist.
+ *
+ * This decodes the current track as needed, and when it ends, carries on
+ *  with the next one in the same call, so there's no gap between them as
+ *  long as both come out in the same format. If the next track's format is
+ *  different, this stops short at the boundary instead: check
+ *  Sound_PlaylistCurrent() for the new format before you read more. A track
+ *  that fails partway through just ends there, and the next one starts.
+ *
+ * If the next track hasn't finished opening yet when the current one ends,
+ *  this waits for it. This must only be called from one thread at a time.
+ *
+ * If fewer than (len) bytes come back, (*state) says why: SOUND_SAMPLEFLAG_EOF
+ *  means there's nothing left in the queue (append more and you can keep
+ *  reading), SOUND_SAMPLEFLAG_EAGAIN means the current track's data isn't
+ *  there yet. Otherwise (*state) is SOUND_SAMPLEFLAG_NONE.
+ *
+ *    \param pl The playlist to read from.
+ *    \param buffer Where to put the decoded audio.
+ *    \param len Maximum number of bytes to read.
+ *    \param state Receives the playlist state, as explained above. Can be
+ *                 NULL if you don't care.
+ *   \return number of bytes copied into (buffer).
+ *
+ * \sa Sound_PlaylistCurrent
+ */
+SNDDECLSPEC Uint32 SDLCALL Sound_PlaylistRead(Sound_Playlist *pl,
+                                              void *buffer, Uint32 len,
+                                              Sound_SampleFlags *state);
+
+
+/**
+ * \fn Sound_Sample *Sound_PlaylistCurrent(Sound_Playlist *pl)
+ * \brief Get the track a playlist is reading from.
+ *
+ * Its (desired) field is the format of what Sound_PlaylistRead() gives you.
+ *  The playlist owns this sample: don't decode from it, seek it or free it.
+ *  It's freed when the playlist moves on to the next track.
+ *
+ *    \param pl The playlist to query.
+ *   \return the current track, or NULL if nothing has been read yet or
+ *           the queue has run dry.
+ *
+ * \sa Sound_PlaylistRead
+ */
+SNDDECLSPEC Sound_Sample * SDLCALL Sound_PlaylistCurrent(Sound_Playlist *pl);
+
+
+/**
+ * \fn void Sound_FreePlaylist(Sound_Playlist *pl)
+ * \brief Stop a playlist and free everything in it.
+ *
+ * This waits for the worker thread to finish opening a track if it's in
+ *  the middle of one, then frees the current track, the one waiting to be
+ *  played, and everything still queued.
+ *
+ *    \param pl The playlist to free. NULL is ignored.
+ *
+ * \sa Sound_NewPlaylist
+ */
+SNDDECLSPEC void SDLCALL Sound_FreePlaylist(Sound_Playlist *pl);
+
 #ifdef __cplusplus
 }
 #endif
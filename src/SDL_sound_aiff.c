@@ -44,7 +44,7 @@ typedef struct S_AIFF_FMT_T
     void (*free)(struct S_AIFF_FMT_T *fmt);
     Uint32 (*read_sample)(Sound_Sample *sample);
     int (*rewind_sample)(Sound_Sample *sample);
-    int (*seek_sample)(Sound_Sample *sample, Uint32 ms);
+    int (*seek_sample)(Sound_Sample *sample, Uint64 frame);
 
 
 #if 0
@@ -72,6 +72,7 @@ typedef struct
 {
     fmt_t fmt;
     Sint32 bytesLeft;
+    int byteswap;  /* swap 16-bit big-endian samples to native on read. */
 } aiff_t;
 
 
@@ -273,6 +274,9 @@ static Uint32 read_sample_fmt_normal(Sound_Sample *sample)
          */
     retval = SDL_RWread(internal->rw, internal->buffer, 1, max);
 
+    if ((a->byteswap) && (retval != (Uint32) -1))
+        __Sound_Swap16(internal->buffer, retval);
+
     a->bytesLeft -= retval;
 
         /* Make sure the read went smoothly... */
@@ -297,14 +301,20 @@ static int rewind_sample_fmt_normal(Sound_Sample *sample)
 } /* rewind_sample_fmt_normal */
 
 
-static int seek_sample_fmt_normal(Sound_Sample *sample, Uint32 ms)
+static int seek_sample_fmt_normal(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     aiff_t *a = (aiff_t *) internal->decoder_private;
     fmt_t *fmt = &a->fmt;
-    int offset = __Sound_convertMsToBytePos(&sample->actual, ms);
-    int pos = (int) (fmt->data_starting_offset + offset);
-    int rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
+    const Uint64 bytepos = __Sound_convertFramesToBytePos(&sample->actual, frame);
+    int offset;
+    int pos;
+    int rc;
+
+    BAIL_IF_MACRO(bytepos > fmt->total_bytes, ERR_PAST_EOF, 0);
+    offset = (int) bytepos;
+    pos = (int) (fmt->data_starting_offset + offset);
+    rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
     BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
     a->bytesLeft = fmt->total_bytes - offset;
     return 1;  /* success. */
@@ -391,6 +401,14 @@ static int read_fmt(SDL_RWops *rw, comm_t *c, fmt_t *fmt)
 } /* read_fmt */
 
 
+static int AIFF_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    return ( (len >= 12) && (SDL_memcmp(header, "FORM", 4) == 0) &&
+             ((SDL_memcmp(header + 8, "AIFF", 4) == 0) ||
+              (SDL_memcmp(header + 8, "AIFC", 4) == 0)) );
+} /* AIFF_probe */
+
+
 static int AIFF_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -441,12 +459,18 @@ static int AIFF_open(Sound_Sample *sample, const char *ext)
 
     BAIL_IF_MACRO(c.sampleRate == 0, "AIFF: Unsupported sample rate.", 0);
 
-    a = (aiff_t *) SDL_malloc(sizeof(aiff_t));
+    a = (aiff_t *) __Sound_Malloc(sizeof(aiff_t));
     BAIL_IF_MACRO(a == NULL, ERR_OUT_OF_MEMORY, 0);
 
+    /* hand out native samples, unless the app wants them big-endian. */
+    a->byteswap = ( (sample->actual.format == AUDIO_S16MSB) &&
+                    (__Sound_WantSwap16(sample, AUDIO_S16MSB)) );
+    if (a->byteswap)
+        sample->actual.format = AUDIO_S16SYS;
+
     if (!read_fmt(rw, &c, &(a->fmt)))
     {
-        SDL_free(a);
+        __Sound_Free(a);
         return 0;
     } /* if */
 
@@ -454,13 +478,13 @@ static int AIFF_open(Sound_Sample *sample, const char *ext)
 
     if (!find_chunk(rw, ssndID))
     {
-        SDL_free(a);
+        __Sound_Free(a);
         BAIL_MACRO("AIFF: No sound data chunk.", 0);
     } /* if */
 
     if (!read_ssnd_chunk(rw, &s))
     {
-        SDL_free(a);
+        __Sound_Free(a);
         BAIL_MACRO("AIFF: Can't read sound data chunk.", 0);
     } /* if */
 
@@ -469,6 +493,7 @@ static int AIFF_open(Sound_Sample *sample, const char *ext)
     internal->decoder_private = (void *) a;
 
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->accurate_seek = 1;
 
     SNDDBG(("AIFF: Accepting data stream.\n"));
     return 1; /* we'll handle this data. */
@@ -480,7 +505,7 @@ static void AIFF_close(Sound_Sample *sample)
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     aiff_t *a = (aiff_t *) internal->decoder_private;
     a->fmt.free(&(a->fmt));
-    SDL_free(a);
+    __Sound_Free(a);
 } /* AIFF_close */
 
 
@@ -504,11 +529,17 @@ static int AIFF_rewind(Sound_Sample *sample)
 } /* AIFF_rewind */
 
 
-static int AIFF_seek(Sound_Sample *sample, Uint32 ms)
+static int AIFF_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     aiff_t *a = (aiff_t *) internal->decoder_private;
-    return a->fmt.seek_sample(sample, ms);
+    return a->fmt.seek_sample(sample, frame);
+} /* AIFF_seek_frames */
+
+
+static int AIFF_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return AIFF_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* AIFF_seek */
 
 static const char *extensions_aiff[] = { "AIFF", "AIF", NULL };
@@ -527,7 +558,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_AIFF =
     AIFF_close,     /*  close() method */
     AIFF_read,      /*   read() method */
     AIFF_rewind,    /* rewind() method */
-    AIFF_seek       /*   seek() method */
+    AIFF_seek,      /*   seek() method */
+    AIFF_probe,     /*  probe() method */
+    NULL,           /*   view() method */
+    AIFF_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 
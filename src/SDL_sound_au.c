@@ -8,7 +8,7 @@
 
 /*
  * Sun/NeXT .au decoder for SDL_sound.
- * Formats supported: 8 and 16 bit linear PCM, 8 bit µ-law.
+ * Formats supported: 8 and 16 bit linear PCM, 8 bit µ-law and A-law.
  * Files without valid header are assumed to be 8 bit µ-law, 8kHz, mono.
  */
 
@@ -45,6 +45,7 @@ enum
     AU_ENC_ULAW_8       = 1,        /* 8-bit ISDN µ-law */
     AU_ENC_LINEAR_8     = 2,        /* 8-bit linear PCM */
     AU_ENC_LINEAR_16    = 3,        /* 16-bit linear PCM */
+    AU_ENC_ALAW_8       = 27,       /* 8-bit ISDN A-law */
 
     /* the rest are unsupported (I have never seen them in the wild) */
     AU_ENC_LINEAR_24    = 4,        /* 24-bit linear PCM */
@@ -55,8 +56,7 @@ enum
     AU_ENC_ADPCM_G721   = 23,
     AU_ENC_ADPCM_G722   = 24,
     AU_ENC_ADPCM_G723_3 = 25,
-    AU_ENC_ADPCM_G723_5 = 26,
-    AU_ENC_ALAW_8       = 27
+    AU_ENC_ADPCM_G723_5 = 26
 };
 
 struct audec
@@ -65,6 +65,7 @@ struct audec
     Uint32 remaining;
     Uint32 start_offset;
     int encoding;
+    int byteswap;  /* swap 16-bit big-endian samples to native on read. */
 };
 
 
@@ -105,6 +106,15 @@ static int read_au_header(SDL_RWops *rw, struct au_file_hdr *hdr)
 
 #define AU_MAGIC 0x2E736E64  /* ".snd", in ASCII (bigendian number) */
 
+static int AU_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    /* headerless .au files are allowed if the extension says so. */
+    if ((ext != NULL) && (SDL_strcasecmp(ext, "au") == 0))
+        return 1;
+    return ((len >= 4) && (SDL_memcmp(header, ".snd", 4) == 0));
+} /* AU_probe */
+
+
 static int AU_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = sample->opaque;
@@ -117,7 +127,7 @@ static int AU_open(Sound_Sample *sample, const char *ext)
     /* read_au_header() will do byte order swapping. */
     BAIL_IF_MACRO(!read_au_header(rw, &hdr), "AU: bad header", 0);
 
-    dec = SDL_malloc(sizeof *dec);
+    dec = __Sound_Calloc(1, sizeof *dec);
     BAIL_IF_MACRO(dec == NULL, ERR_OUT_OF_MEMORY, 0);
     internal->decoder_private = dec;
 
@@ -134,16 +144,25 @@ static int AU_open(Sound_Sample *sample, const char *ext)
                 sample->actual.format = AUDIO_S16SYS;
                 break;
 
+            case AU_ENC_ALAW_8:
+                /* same deal as µ-law. */
+                sample->actual.format = AUDIO_S16SYS;
+                break;
+
             case AU_ENC_LINEAR_8:
                 sample->actual.format = AUDIO_S8;
                 break;
 
             case AU_ENC_LINEAR_16:
+                /* hand out native samples, unless the app wants them BE. */
                 sample->actual.format = AUDIO_S16MSB;
+                dec->byteswap = __Sound_WantSwap16(sample, AUDIO_S16MSB);
+                if (dec->byteswap)
+                    sample->actual.format = AUDIO_S16SYS;
                 break;
 
             default:
-                SDL_free(dec);
+                __Sound_Free(dec);
                 BAIL_MACRO("AU: Unsupported .au encoding", 0);
         } /* switch */
 
@@ -157,7 +176,7 @@ static int AU_open(Sound_Sample *sample, const char *ext)
         {
             if (SDL_RWread(rw, &c, 1, 1) != 1)
             {
-                SDL_free(dec);
+                __Sound_Free(dec);
                 BAIL_MACRO(ERR_IO_ERROR, 0);
             } /* if */
         } /* for */
@@ -183,7 +202,7 @@ static int AU_open(Sound_Sample *sample, const char *ext)
 
     else
     {
-        SDL_free(dec);
+        __Sound_Free(dec);
         BAIL_MACRO("AU: Not an .AU stream.", 0);
     } /* else */    
 
@@ -195,6 +214,7 @@ static int AU_open(Sound_Sample *sample, const char *ext)
                               bytes_per_second ) );
 
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->accurate_seek = 1;
     dec->total = dec->remaining;
     dec->start_offset = SDL_RWtell(rw);
 
@@ -206,65 +226,23 @@ static int AU_open(Sound_Sample *sample, const char *ext)
 static void AU_close(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = sample->opaque;
-    SDL_free(internal->decoder_private);
+    __Sound_Free(internal->decoder_private);
 } /* AU_close */
 
 
-/* table to convert from µ-law encoding to signed 16-bit samples,
-   generated by a throwaway perl script */
-static Sint16 ulaw_to_linear[256] = {
-    -32124,-31100,-30076,-29052,-28028,-27004,-25980,-24956,
-    -23932,-22908,-21884,-20860,-19836,-18812,-17788,-16764,
-    -15996,-15484,-14972,-14460,-13948,-13436,-12924,-12412,
-    -11900,-11388,-10876,-10364, -9852, -9340, -8828, -8316,
-     -7932, -7676, -7420, -7164, -6908, -6652, -6396, -6140,
-     -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092,
-     -3900, -3772, -3644, -3516, -3388, -3260, -3132, -3004,
-     -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980,
-     -1884, -1820, -1756, -1692, -1628, -1564, -1500, -1436,
-     -1372, -1308, -1244, -1180, -1116, -1052,  -988,  -924,
-      -876,  -844,  -812,  -780,  -748,  -716,  -684,  -652,
-      -620,  -588,  -556,  -524,  -492,  -460,  -428,  -396,
-      -372,  -356,  -340,  -324,  -308,  -292,  -276,  -260,
-      -244,  -228,  -212,  -196,  -180,  -164,  -148,  -132,
-      -120,  -112,  -104,   -96,   -88,   -80,   -72,   -64,
-       -56,   -48,   -40,   -32,   -24,   -16,    -8,     0,
-     32124, 31100, 30076, 29052, 28028, 27004, 25980, 24956,
-     23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764,
-     15996, 15484, 14972, 14460, 13948, 13436, 12924, 12412,
-     11900, 11388, 10876, 10364,  9852,  9340,  8828,  8316,
-      7932,  7676,  7420,  7164,  6908,  6652,  6396,  6140,
-      5884,  5628,  5372,  5116,  4860,  4604,  4348,  4092,
-      3900,  3772,  3644,  3516,  3388,  3260,  3132,  3004,
-      2876,  2748,  2620,  2492,  2364,  2236,  2108,  1980,
-      1884,  1820,  1756,  1692,  1628,  1564,  1500,  1436,
-      1372,  1308,  1244,  1180,  1116,  1052,   988,   924,
-       876,   844,   812,   780,   748,   716,   684,   652,
-       620,   588,   556,   524,   492,   460,   428,   396,
-       372,   356,   340,   324,   308,   292,   276,   260,
-       244,   228,   212,   196,   180,   164,   148,   132,
-       120,   112,   104,    96,    88,    80,    72,    64,
-        56,    48,    40,    32,    24,    16,     8,     0
-};
-
-
 static Uint32 AU_read(Sound_Sample *sample)
 {
     int ret;
     Sound_SampleInternal *internal = sample->opaque;
     struct audec *dec = internal->decoder_private;
-    int maxlen;
-    Uint8 *buf;
+    const int companded = ((dec->encoding == AU_ENC_ULAW_8) ||
+                           (dec->encoding == AU_ENC_ALAW_8));
+    Uint8 *buf = (Uint8 *) internal->buffer;
+    int maxlen = internal->buffer_size;
 
-    maxlen = internal->buffer_size;
-    buf = internal->buffer;
-    if (dec->encoding == AU_ENC_ULAW_8)
-    {
-        /* We read µ-law samples into the second half of the buffer, so
-           we can expand them to 16-bit samples afterwards */
+    /* 8-bit µ-law/A-law expands to twice its size, in place. */
+    if (companded)
         maxlen >>= 1;
-        buf += maxlen;
-    } /* if */
 
     if (maxlen > dec->remaining)
         maxlen = dec->remaining;
@@ -279,14 +257,15 @@ static Uint32 AU_read(Sound_Sample *sample)
         if (ret < maxlen)
             sample->flags |= SOUND_SAMPLEFLAG_EAGAIN;
 
-        if (dec->encoding == AU_ENC_ULAW_8)
-        {
-            int i;
-            Sint16 *dst = internal->buffer;
-            for (i = 0; i < ret; i++)
-                dst[i] = ulaw_to_linear[buf[i]];
+        if (dec->byteswap)
+            __Sound_Swap16(buf, ret);
+        else if (dec->encoding == AU_ENC_ULAW_8)
+            __Sound_ULawToLinear((Sint16 *) buf, buf, ret);
+        else if (dec->encoding == AU_ENC_ALAW_8)
+            __Sound_ALawToLinear((Sint16 *) buf, buf, ret);
+
+        if (companded)
             ret <<= 1;                  /* return twice as much as read */
-        } /* if */
     } /* else */
 
     return ret;
@@ -304,15 +283,19 @@ static int AU_rewind(Sound_Sample *sample)
 } /* AU_rewind */
 
 
-static int AU_seek(Sound_Sample *sample, Uint32 ms)
+static int AU_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     struct audec *dec = (struct audec *) internal->decoder_private;
-    int offset = __Sound_convertMsToBytePos(&sample->actual, ms);
+    const Uint64 bytepos = __Sound_convertFramesToBytePos(&sample->actual, frame);
+    int offset;
     int rc;
     int pos;
 
-    if (dec->encoding == AU_ENC_ULAW_8)
+    BAIL_IF_MACRO(bytepos > 0x7FFFFFFF, ERR_PAST_EOF, 0);
+    offset = (int) bytepos;
+
+    if ((dec->encoding == AU_ENC_ULAW_8) || (dec->encoding == AU_ENC_ALAW_8))
         offset >>= 1;  /* halve the byte offset for compression. */
 
     pos = (int) (dec->start_offset + offset);
@@ -320,6 +303,12 @@ static int AU_seek(Sound_Sample *sample, Uint32 ms)
     BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
     dec->remaining = dec->total - offset;
     return 1;
+} /* AU_seek_frames */
+
+
+static int AU_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return AU_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* AU_seek */
 
 /*
@@ -343,7 +332,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_AU =
     AU_close,       /*  close() method */
     AU_read,        /*   read() method */
     AU_rewind,      /* rewind() method */
-    AU_seek         /*   seek() method */
+    AU_seek,        /*   seek() method */
+    AU_probe,       /*  probe() method */
+    NULL,           /*   view() method */
+    AU_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_AU */
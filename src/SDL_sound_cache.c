@@ -0,0 +1,797 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Shared decoded PCM: the cache for Sound_SetCacheBudget(), and the buffers
+ *  behind Sound_NewInstance().
+ *
+ * The first time something is opened under a given key (a filename, or
+ *  whatever the app passes to Sound_NewSampleCached()), it's decoded in full
+ *  and the result is kept here. Opening it again gets a Sound_Sample that
+ *  plays straight out of the cached PCM, through a tiny decoder that lives
+ *  in this file, so it costs about as much as a RAW sample: no parsing, no
+ *  decoding, no conversion. Something whose duration says it won't fit in
+ *  the budget, or whose duration is unknown, is just opened normally; we
+ *  don't decode a whole song to find that out.
+ *
+ * Entries are refcounted; every sample playing from one holds a reference.
+ *  Least-recently-used entries are dropped when the cache is over budget. An
+ *  entry dropped while samples still use it stays alive, outside of the
+ *  cache and its budget, until the last of them is freed.
+ *
+ * Sound_NewInstance() uses the same refcounted entries, but an instance is
+ *  just a cursor: Sound_Decode() points its sample->buffer straight into the
+ *  shared PCM, so it never copies or decodes anything. An entry made for
+ *  instances of a Sound_DecodeAll()'d sample is never in the cache; if that
+ *  sample wants to decode again, it gets a buffer of its own first, so the
+ *  shared data never changes.
+ *
+ * Everything in here is protected by cache_mutex.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#define CACHE_HASH_BUCKETS 256
+
+typedef struct __SOUND_SHAREDPCM__
+{
+    struct __SOUND_SHAREDPCM__ *hash_next;
+    struct __SOUND_SHAREDPCM__ *lru_prev;  /* more recently used. */
+    struct __SOUND_SHAREDPCM__ *lru_next;  /* less recently used. */
+    Uint32 hash;
+    char *key;
+    Sound_AudioInfo requested;  /* what the app passed as "desired". */
+    Sound_AudioInfo info;       /* what the PCM actually is. */
+    const Sound_DecoderInfo *decoder;  /* what originally decoded it. */
+    Uint8 *pcm;
+    Uint32 len;
+    Sint32 total_time;
+    int refcount;
+    int cached;  /* zero once evicted, or if it was never in the cache. */
+} CacheEntry;
+
+static SDL_mutex *cache_mutex = NULL;
+static CacheEntry *cache_hash[CACHE_HASH_BUCKETS];
+static CacheEntry *lru_head = NULL;
+static CacheEntry *lru_tail = NULL;
+static Uint32 cache_budget = 0;  /* 0 == cache is off. */
+static Sound_CacheStats stats;
+
+
+static Uint32 hash_key(const char *key, const Sound_AudioInfo *requested)
+{
+    Uint32 retval = 5381;
+    while (*key)
+        retval = ((retval << 5) + retval) ^ (Uint8) *(key++);
+    retval = ((retval << 5) + retval) ^ requested->format;
+    retval = ((retval << 5) + retval) ^ requested->channels;
+    retval = ((retval << 5) + retval) ^ requested->rate;
+    return retval;
+} /* hash_key */
+
+
+static void lru_unlink(CacheEntry *entry)
+{
+    if (entry->lru_prev != NULL)
+        entry->lru_prev->lru_next = entry->lru_next;
+    else
+        lru_head = entry->lru_next;
+
+    if (entry->lru_next != NULL)
+        entry->lru_next->lru_prev = entry->lru_prev;
+    else
+        lru_tail = entry->lru_prev;
+
+    entry->lru_prev = entry->lru_next = NULL;
+} /* lru_unlink */
+
+
+static void lru_push_front(CacheEntry *entry)
+{
+    entry->lru_prev = NULL;
+    entry->lru_next = lru_head;
+    if (lru_head != NULL)
+        lru_head->lru_prev = entry;
+    else
+        lru_tail = entry;
+    lru_head = entry;
+} /* lru_push_front */
+
+
+static void free_entry(CacheEntry *entry)
+{
+    __Sound_Free(entry->pcm);
+    __Sound_Free(entry->key);
+    __Sound_Free(entry);
+} /* free_entry */
+
+
+/* drop (entry) from the cache; it's freed now if nothing is using it. */
+static void evict_entry(CacheEntry *entry)
+{
+    CacheEntry **bucket = &cache_hash[entry->hash % CACHE_HASH_BUCKETS];
+
+    while (*bucket != entry)
+        bucket = &(*bucket)->hash_next;
+    *bucket = entry->hash_next;
+    entry->hash_next = NULL;
+
+    lru_unlink(entry);
+    entry->cached = 0;
+    stats.entries--;
+    stats.bytes -= entry->len;
+    stats.evictions++;
+
+    if (entry->refcount == 0)
+        free_entry(entry);
+} /* evict_entry */
+
+
+static void enforce_budget(void)
+{
+    while ((lru_tail != NULL) && (stats.bytes > cache_budget))
+        evict_entry(lru_tail);
+} /* enforce_budget */
+
+
+static CacheEntry *find_entry(const char *key, const Sound_AudioInfo *requested)
+{
+    const Uint32 hash = hash_key(key, requested);
+    CacheEntry *entry;
+
+    for (entry = cache_hash[hash % CACHE_HASH_BUCKETS]; entry; entry = entry->hash_next)
+    {
+        if ( (entry->hash == hash) &&
+             (entry->requested.format == requested->format) &&
+             (entry->requested.channels == requested->channels) &&
+             (entry->requested.rate == requested->rate) &&
+             (SDL_strcmp(entry->key, key) == 0) )
+            return entry;
+    } /* for */
+
+    return NULL;
+} /* find_entry */
+
+
+static void release_entry(CacheEntry *entry)
+{
+    SDL_LockMutex(cache_mutex);
+    entry->refcount--;
+    if ((entry->refcount == 0) && (!entry->cached))
+        free_entry(entry);
+    SDL_UnlockMutex(cache_mutex);
+} /* release_entry */
+
+
+/* The decoder that plays from a CacheEntry. decoder_private is the entry. */
+
+static int CACHE_init(void)
+{
+    return 1;  /* always succeeds. */
+} /* CACHE_init */
+
+
+static void CACHE_quit(void)
+{
+    /* it's a no-op. */
+} /* CACHE_quit */
+
+
+static int CACHE_open(Sound_Sample *sample, const char *ext)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    CacheEntry *entry = (CacheEntry *) internal->decoder_private;
+
+    SDL_LockMutex(cache_mutex);
+    entry->refcount++;  /* CACHE_close() gives this back. */
+    SDL_UnlockMutex(cache_mutex);
+
+    SDL_memcpy(&sample->actual, &entry->info, sizeof (Sound_AudioInfo));
+    sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->total_time = entry->total_time;
+    internal->accurate_seek = 1;
+    return 1;
+} /* CACHE_open */
+
+
+static void CACHE_close(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    release_entry((CacheEntry *) internal->decoder_private);
+} /* CACHE_close */
+
+
+static Uint32 CACHE_read(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 retval = (Uint32) SDL_RWread(internal->rw, internal->buffer,
+                                              1, internal->buffer_size);
+    if (retval < internal->buffer_size)
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;  /* it's all in memory. */
+    return retval;
+} /* CACHE_read */
+
+
+static int CACHE_rewind(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    BAIL_IF_MACRO(SDL_RWseek(internal->rw, 0, RW_SEEK_SET) != 0, ERR_IO_ERROR, 0);
+    return 1;
+} /* CACHE_rewind */
+
+
+static int CACHE_seek_frames(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Sint64 pos = (Sint64) __Sound_convertFramesToBytePos(&sample->actual, frame);
+    BAIL_IF_MACRO(SDL_RWseek(internal->rw, pos, RW_SEEK_SET) != pos, ERR_IO_ERROR, 0);
+    return 1;
+} /* CACHE_seek_frames */
+
+
+static int CACHE_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return CACHE_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
+} /* CACHE_seek */
+
+static const char *extensions_cache[] = { NULL };
+static const Sound_DecoderFunctions cache_funcs =
+{
+    {
+        extensions_cache,
+        "Cached PCM",
+        "Ryan C. Gordon <icculus@icculus.org>",
+        "https://icculus.org/SDL_sound/"
+    },
+
+    CACHE_init,       /*   init() method */
+    CACHE_quit,       /*   quit() method */
+    CACHE_open,       /*   open() method */
+    CACHE_close,      /*  close() method */
+    CACHE_read,       /*   read() method */
+    CACHE_rewind,     /* rewind() method */
+    CACHE_seek,       /*   seek() method */
+    NULL,             /*  probe() method */
+    NULL,             /*   view() method */
+    CACHE_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
+};
+
+
+/* Make a sample that plays (entry), and drop the caller's reference. */
+static Sound_Sample *sample_from_entry(CacheEntry *entry, Uint32 bufferSize)
+{
+    SDL_RWops *rw = SDL_RWFromConstMem(entry->pcm, (int) entry->len);
+    Sound_Sample *retval = NULL;
+
+    if (rw == NULL)
+        __Sound_SetError(SDL_GetError());
+    else
+    {
+        /* asking for what the entry holds means no conversion. */
+        retval = __Sound_NewSampleWithDecoder(rw, &cache_funcs, entry,
+                                              &entry->info, bufferSize);
+        if (retval != NULL)
+            retval->decoder = entry->decoder;  /* look like the original. */
+    } /* else */
+
+    release_entry(entry);
+    return retval;
+} /* sample_from_entry */
+
+
+/*
+ * Look for (key) in the cache. Sets (*found) and returns a new sample on a
+ *  hit, or sets (*found) to zero on a miss.
+ */
+static Sound_Sample *cache_lookup(const char *key, const Sound_AudioInfo *requested,
+                                  Uint32 bufferSize, int *found)
+{
+    CacheEntry *entry;
+
+    SDL_LockMutex(cache_mutex);
+    entry = find_entry(key, requested);
+    if (entry == NULL)
+        stats.misses++;
+    else
+    {
+        stats.hits++;
+        entry->refcount++;
+        lru_unlink(entry);
+        lru_push_front(entry);
+    } /* else */
+    SDL_UnlockMutex(cache_mutex);
+
+    *found = (entry != NULL);
+    return (entry != NULL) ? sample_from_entry(entry, bufferSize) : NULL;
+} /* cache_lookup */
+
+
+/* Decode all of (rw), add it to the cache, and return a sample that plays it. */
+static Sound_Sample *cache_fill(SDL_RWops *rw, const char *ext, const char *key,
+                                Sound_AudioInfo *desired,
+                                const Sound_AudioInfo *requested,
+                                Uint32 bufferSize)
+{
+    Sound_Sample *sample = Sound_NewSample(rw, ext, desired, bufferSize);
+    Sound_SampleInternal *internal;
+    CacheEntry *entry;
+    CacheEntry *existing;
+    Uint64 frames;
+    Uint32 len;
+
+    if (sample == NULL)
+        return NULL;  /* Sound_NewSample() set the error. */
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    /*
+     * Don't decode a whole song just to find out it won't fit. If we can't
+     *  tell how big it'll be, or it's too big to keep, hand back a plain
+     *  sample that decodes as it plays.
+     */
+    if (internal->total_time < 0)
+        return sample;
+    else
+    {
+        const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                    * sample->desired.channels;
+        const Uint64 estimate = ((Uint64) internal->total_time * sample->desired.rate
+                                    / 1000) * framesize;
+        if (estimate > cache_budget)
+            return sample;
+    } /* else */
+
+    len = Sound_DecodeAll(sample);
+    if (sample->flags & SOUND_SAMPLEFLAG_ERROR)
+    {
+        Sound_FreeSample(sample);
+        return NULL;  /* the decoder set the error. */
+    } /* if */
+
+    if (len == 0)  /* nothing to cache; give them the empty sample back. */
+    {
+        Sound_Rewind(sample);
+        Sound_SetBufferSize(sample, bufferSize);
+        return sample;
+    } /* if */
+
+    entry = (CacheEntry *) __Sound_Calloc(1, sizeof (CacheEntry));
+    if ((entry == NULL) || ((entry->key = __Sound_StrDup(key)) == NULL))
+    {
+        __Sound_Free(entry);
+        Sound_FreeSample(sample);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+    } /* if */
+
+    frames = len / ((SDL_AUDIO_BITSIZE(sample->desired.format) / 8) * sample->desired.channels);
+    entry->hash = hash_key(key, requested);
+    SDL_memcpy(&entry->requested, requested, sizeof (Sound_AudioInfo));
+    SDL_memcpy(&entry->info, &sample->desired, sizeof (Sound_AudioInfo));
+    entry->decoder = sample->decoder;
+    entry->total_time = (Sint32) ((frames * 1000) / sample->desired.rate);
+    entry->refcount = 1;
+
+    /* take the decoded buffer away from the sample before freeing it. */
+    entry->pcm = (Uint8 *) sample->buffer;
+    entry->len = len;
+    if (internal->buffer == sample->buffer)
+        internal->sdlcvt.buf = internal->buffer = NULL;
+    sample->buffer = NULL;
+    internal->buffer_capacity = 0;
+    Sound_FreeSample(sample);
+
+    SDL_LockMutex(cache_mutex);
+    existing = find_entry(key, requested);
+    if (existing != NULL)  /* someone beat us to it; use theirs. */
+    {
+        existing->refcount++;
+        SDL_UnlockMutex(cache_mutex);
+        free_entry(entry);
+        return sample_from_entry(existing, bufferSize);
+    } /* if */
+
+    /* an entry too big for the cache just belongs to this one sample. */
+    if ((cache_budget > 0) && (entry->len <= cache_budget))
+    {
+        CacheEntry **bucket = &cache_hash[entry->hash % CACHE_HASH_BUCKETS];
+        entry->hash_next = *bucket;
+        *bucket = entry;
+        lru_push_front(entry);
+        entry->cached = 1;
+        stats.entries++;
+        stats.bytes += entry->len;
+        enforce_budget();
+    } /* if */
+    SDL_UnlockMutex(cache_mutex);
+
+    return sample_from_entry(entry, bufferSize);
+} /* cache_fill */
+
+
+static void get_requested(Sound_AudioInfo *requested, const Sound_AudioInfo *desired)
+{
+    if (desired == NULL)
+        SDL_memset(requested, '\0', sizeof (Sound_AudioInfo));
+    else
+        SDL_memcpy(requested, desired, sizeof (Sound_AudioInfo));
+} /* get_requested */
+
+
+Sound_Sample *Sound_NewSampleCached(SDL_RWops *rw, const char *ext,
+                                    const char *key, Sound_AudioInfo *desired,
+                                    Uint32 bufferSize)
+{
+    Sound_AudioInfo requested;
+    Sound_Sample *retval;
+    int found;
+
+    BAIL_IF_MACRO(cache_mutex == NULL, ERR_NOT_INITIALIZED, NULL);
+    BAIL_IF_MACRO(rw == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    if ((key == NULL) || (cache_budget == 0))
+        return Sound_NewSample(rw, ext, desired, bufferSize);
+
+    get_requested(&requested, desired);
+    retval = cache_lookup(key, &requested, bufferSize, &found);
+    if (found)
+    {
+        SDL_RWclose(rw);  /* didn't need it after all. */
+        return retval;
+    } /* if */
+
+    return cache_fill(rw, ext, key, desired, &requested, bufferSize);
+} /* Sound_NewSampleCached */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_CacheEnabled(void)
+{
+    return (cache_budget > 0);
+} /* __Sound_CacheEnabled */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Sound_Sample *__Sound_NewSampleFromFileCached(const char *filename,
+                                              const char *ext,
+                                              Sound_AudioInfo *desired,
+                                              Uint32 bufferSize)
+{
+    Sound_AudioInfo requested;
+    Sound_Sample *retval;
+    SDL_RWops *rw;
+    int found;
+
+    get_requested(&requested, desired);
+    retval = cache_lookup(filename, &requested, bufferSize, &found);
+    if (found)
+        return retval;  /* didn't even have to open the file. */
+
+    rw = SDL_RWFromFile(filename, "rb");
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+    return cache_fill(rw, ext, filename, desired, &requested, bufferSize);
+} /* __Sound_NewSampleFromFileCached */
+
+
+void Sound_SetCacheBudget(Uint32 bytes)
+{
+    if (cache_mutex == NULL)
+    {
+        __Sound_SetError(ERR_NOT_INITIALIZED);
+        return;
+    } /* if */
+
+    SDL_LockMutex(cache_mutex);
+    cache_budget = bytes;
+    stats.budget = bytes;
+    enforce_budget();
+    SDL_UnlockMutex(cache_mutex);
+} /* Sound_SetCacheBudget */
+
+
+void Sound_FlushCache(void)
+{
+    if (cache_mutex == NULL)
+    {
+        __Sound_SetError(ERR_NOT_INITIALIZED);
+        return;
+    } /* if */
+
+    SDL_LockMutex(cache_mutex);
+    while (lru_tail != NULL)
+        evict_entry(lru_tail);
+    SDL_UnlockMutex(cache_mutex);
+} /* Sound_FlushCache */
+
+
+void Sound_GetCacheStats(Sound_CacheStats *_stats)
+{
+    if (_stats == NULL)
+    {
+        __Sound_SetError(ERR_INVALID_ARGUMENT);
+        return;
+    } /* if */
+
+    if (cache_mutex == NULL)
+    {
+        SDL_memset(_stats, '\0', sizeof (Sound_CacheStats));
+        return;
+    } /* if */
+
+    SDL_LockMutex(cache_mutex);
+    SDL_memcpy(_stats, &stats, sizeof (Sound_CacheStats));
+    SDL_UnlockMutex(cache_mutex);
+} /* Sound_GetCacheStats */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_InitCache(void)
+{
+    SDL_memset(cache_hash, '\0', sizeof (cache_hash));
+    SDL_memset(&stats, '\0', sizeof (stats));
+    lru_head = lru_tail = NULL;
+    cache_budget = 0;
+    cache_mutex = SDL_CreateMutex();
+    BAIL_IF_MACRO(cache_mutex == NULL, SDL_GetError(), 0);
+    return 1;
+} /* __Sound_InitCache */
+
+
+/*
+ * This is declared in the internal header. All samples must be freed first.
+ */
+void __Sound_QuitCache(void)
+{
+    if (cache_mutex == NULL)
+        return;
+
+    Sound_FlushCache();
+    SDL_DestroyMutex(cache_mutex);
+    cache_mutex = NULL;
+} /* __Sound_QuitCache */
+
+/* Instances. The sample's shared_pcm is the entry, shared_pos the cursor. */
+
+static int INSTANCE_init(void)
+{
+    return 1;  /* always succeeds. */
+} /* INSTANCE_init */
+
+
+static void INSTANCE_quit(void)
+{
+    /* it's a no-op. */
+} /* INSTANCE_quit */
+
+
+static int INSTANCE_open(Sound_Sample *sample, const char *ext)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    CacheEntry *entry = (CacheEntry *) internal->decoder_private;
+
+    SDL_memcpy(&sample->actual, &entry->info, sizeof (Sound_AudioInfo));
+    sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->total_time = entry->total_time;
+    internal->accurate_seek = 1;
+    return 1;
+} /* INSTANCE_open */
+
+
+static void INSTANCE_close(Sound_Sample *sample)
+{
+    /* release_sample() lets go of shared_pcm. */
+} /* INSTANCE_close */
+
+
+/* only used by Sound_DecodeInto(); Sound_Decode() doesn't copy anything. */
+static Uint32 INSTANCE_read(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const CacheEntry *entry = internal->shared_pcm;
+    const Uint32 avail = entry->len - internal->shared_pos;
+    const Uint32 retval = SDL_min(avail, internal->buffer_size);
+
+    SDL_memcpy(internal->buffer, entry->pcm + internal->shared_pos, retval);
+    internal->shared_pos += retval;
+    if (internal->shared_pos >= entry->len)
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+    return retval;
+} /* INSTANCE_read */
+
+
+static int INSTANCE_rewind(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    internal->shared_pos = 0;
+    return 1;
+} /* INSTANCE_rewind */
+
+
+static int INSTANCE_seek_frames(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint64 pos = __Sound_convertFramesToBytePos(&sample->actual, frame);
+    BAIL_IF_MACRO(pos > internal->shared_pcm->len, ERR_PAST_EOF, 0);
+    internal->shared_pos = (Uint32) pos;
+    return 1;
+} /* INSTANCE_seek_frames */
+
+
+static int INSTANCE_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return INSTANCE_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
+} /* INSTANCE_seek */
+
+static const Sound_DecoderFunctions instance_funcs =
+{
+    {
+        extensions_cache,
+        "Sample instance",
+        "Ryan C. Gordon <icculus@icculus.org>",
+        "https://icculus.org/SDL_sound/"
+    },
+
+    INSTANCE_init,    /*   init() method */
+    INSTANCE_quit,    /*   quit() method */
+    INSTANCE_open,    /*   open() method */
+    INSTANCE_close,   /*  close() method */
+    INSTANCE_read,    /*   read() method */
+    INSTANCE_rewind,  /* rewind() method */
+    INSTANCE_seek,    /*   seek() method */
+    NULL,             /*  probe() method */
+    NULL,             /*   view() method */
+    INSTANCE_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
+};
+
+
+/*
+ * Get (sample)'s audio as an entry, with a new reference for the caller.
+ *  Two threads can make instances of the same sample at once, so checking
+ *  for an entry and handing the buffer over to a new one both happen under
+ *  cache_mutex.
+ */
+static CacheEntry *share_sample(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    CacheEntry *entry;
+
+    SDL_LockMutex(cache_mutex);
+
+    entry = internal->shared_pcm;
+    if ((entry == NULL) && (internal->funcs == &cache_funcs))
+        entry = (CacheEntry *) internal->decoder_private;
+
+    if (entry == NULL)  /* have to make one out of the decoded buffer. */
+    {
+        const Uint32 frame = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+
+        if (!internal->decoded_all)
+        {
+            SDL_UnlockMutex(cache_mutex);
+            BAIL_MACRO(ERR_NOT_DECODED, NULL);
+        } /* if */
+
+        entry = (CacheEntry *) __Sound_Calloc(1, sizeof (CacheEntry));
+        if (entry == NULL)
+        {
+            SDL_UnlockMutex(cache_mutex);
+            BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+        } /* if */
+
+        SDL_memcpy(&entry->info, &sample->desired, sizeof (Sound_AudioInfo));
+        entry->decoder = sample->decoder;
+        entry->pcm = (Uint8 *) sample->buffer;
+        entry->len = sample->buffer_size;
+        entry->total_time = (Sint32) ((((Uint64) (entry->len / frame)) * 1000)
+                                        / sample->desired.rate);
+        entry->refcount = 1;  /* the original sample's. */
+        internal->shared_pcm = entry;
+    } /* if */
+
+    entry->refcount++;
+    SDL_UnlockMutex(cache_mutex);
+    return entry;
+} /* share_sample */
+
+
+Sound_Sample *Sound_NewInstance(Sound_Sample *sample, Uint32 bufferSize)
+{
+    Sound_SampleInternal *internal;
+    Sound_Sample *retval;
+    CacheEntry *entry;
+    Uint32 frame;
+    int resident;
+
+    BAIL_IF_MACRO(cache_mutex == NULL, ERR_NOT_INITIALIZED, NULL);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    /* still compressed? Then the instance decodes it too, from the same RAM. */
+    internal = (Sound_SampleInternal *) sample->opaque;
+    SDL_LockMutex(cache_mutex);
+    resident = ( (!internal->decoded_all) && (internal->shared_pcm == NULL) &&
+                 (__Sound_IsResident(sample)) );
+    SDL_UnlockMutex(cache_mutex);
+    if (resident)
+        return __Sound_NewResidentInstance(sample, bufferSize);
+
+    entry = share_sample(sample);
+    if (entry == NULL)
+        return NULL;  /* share_sample() set the error. */
+
+    retval = __Sound_NewSampleWithDecoder(NULL, &instance_funcs, entry,
+                                          &entry->info, 0);
+    if (retval == NULL)
+    {
+        release_entry(entry);
+        return NULL;
+    } /* if */
+
+    frame = (SDL_AUDIO_BITSIZE(entry->info.format) / 8) * entry->info.channels;
+    if ((bufferSize == 0) || (bufferSize > entry->len))
+        bufferSize = entry->len;
+    if (bufferSize > frame)
+        bufferSize -= bufferSize % frame;
+
+    internal = (Sound_SampleInternal *) retval->opaque;
+    SDL_LockMutex(cache_mutex);
+    internal->shared_pcm = entry;  /* takes over our reference. */
+    SDL_UnlockMutex(cache_mutex);
+    internal->shared_pos = 0;
+    retval->decoder = entry->decoder;  /* look like the original. */
+    retval->buffer = entry->pcm;
+    retval->buffer_size = bufferSize;
+    return retval;
+} /* Sound_NewInstance */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_IsInstance(const Sound_Sample *sample)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    return (internal->funcs == &instance_funcs);
+} /* __Sound_IsInstance */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_InstanceDecode(Sound_Sample *sample, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const CacheEntry *entry = internal->shared_pcm;
+    const Uint32 retval = SDL_min(len, entry->len - internal->shared_pos);
+
+    sample->buffer = entry->pcm + internal->shared_pos;
+    internal->shared_pos += retval;
+    if (internal->shared_pos >= entry->len)
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+    return retval;
+} /* __Sound_InstanceDecode */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_ReleaseSharedPCM(struct __SOUND_SHAREDPCM__ *pcm)
+{
+    release_entry(pcm);
+} /* __Sound_ReleaseSharedPCM */
+
+/* end of SDL_sound_cache.c ... */
+
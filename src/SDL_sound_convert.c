@@ -0,0 +1,370 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Fast paths for the format conversions we see most: float, Sint32 and
+ *  byteswapped Sint16 decoder output going to native Sint16, optionally with
+ *  mono going to stereo at the same time. SDL_ConvertAudio() gets there too,
+ *  but as a chain of filters that each walk the whole buffer; these do it in
+ *  one pass, with SSE2, AVX2 or NEON where we have them. The output is the
+ *  same, bit for bit; test/testconvert.c checks that.
+ *
+ * Everything here converts in place, in the decode buffer, the same as
+ *  SDL_ConvertAudio() does. Conversions that shrink the data walk forward,
+ *  and never store past what they've already loaded; conversions that grow
+ *  it walk backward, so nothing gets overwritten before it's read.
+ *
+ * Anything that isn't handled here (including any change of sample rate)
+ *  goes through SDL_AudioCVT, like it always did.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SOUND_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if SOUND_HAVE_SSE2 && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    SDL_VERSION_ATLEAST(2, 0, 4)
+#define SOUND_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SOUND_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define AUDIO_S16SWAPPED AUDIO_S16MSB
+#else
+#define AUDIO_S16SWAPPED AUDIO_S16LSB
+#endif
+
+
+/*
+ * These do the same math as SDL_ConvertAudio(), in the same order, so the
+ *  output doesn't change. SDL goes through float for everything but a plain
+ *  byteswap: Sint16 becomes x / 32768, Sint32 becomes (x >> 8) / 8388608,
+ *  and float becomes Sint16 as x * 32767, truncated and clamped. So even a
+ *  Sint16 mono to stereo conversion moves values by up to one.
+ *
+ * SDL's own SIMD float to Sint16 code gives -32767 for -1.0f and below,
+ *  where its scalar code gives -32768. We always give -32768.
+ */
+static SDL_INLINE Sint16 cvt_f32_to_s16(const float x)
+{
+    if (x >= 1.0f)
+        return 32767;
+    else if (x <= -1.0f)
+        return -32768;
+    return (Sint16) (x * 32767.0f);
+} /* cvt_f32_to_s16 */
+
+static SDL_INLINE Sint16 cvt_s32_to_s16(const Sint32 x)
+{
+    return cvt_f32_to_s16(((float) (x >> 8)) * (1.0f / 8388608.0f));
+} /* cvt_s32_to_s16 */
+
+static SDL_INLINE Sint16 cvt_s16_to_s16(const Sint16 x)
+{
+    return cvt_f32_to_s16(((float) x) * (1.0f / 32768.0f));
+} /* cvt_s16_to_s16 */
+
+#define cvt_s16_swap(x) ((Sint16) SDL_Swap16((Uint16) (x)))
+
+
+#if SOUND_HAVE_SSE2
+/* four floats to four Sint32s in Sint16 range, as cvt_f32_to_s16() does. */
+static SDL_INLINE __m128i cvt_f32_to_s16_sse2(const __m128 x)
+{
+    const __m128 lo = _mm_set1_ps(-1.0f);
+    const __m128 hi = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128i v = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(x, lo), hi), scale));
+    /* the compare is all ones (-1) where x <= -1.0f, making -32767 -32768. */
+    return _mm_add_epi32(v, _mm_castps_si128(_mm_cmple_ps(x, lo)));
+} /* cvt_f32_to_s16_sse2 */
+
+static SDL_INLINE __m128 cvt_s32_to_f32_sse2(const __m128i x)
+{
+    return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(x, 8)), _mm_set1_ps(1.0f / 8388608.0f));
+} /* cvt_s32_to_f32_sse2 */
+
+#elif SOUND_HAVE_NEON
+static SDL_INLINE int32x4_t cvt_f32_to_s16_neon(const float32x4_t x)
+{
+    const float32x4_t lo = vdupq_n_f32(-1.0f);
+    const float32x4_t hi = vdupq_n_f32(1.0f);
+    const int32x4_t v = vcvtq_s32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(x, lo), hi), 32767.0f));
+    return vaddq_s32(v, vreinterpretq_s32_u32(vcleq_f32(x, lo)));
+} /* cvt_f32_to_s16_neon */
+
+static SDL_INLINE float32x4_t cvt_s32_to_f32_neon(const int32x4_t x)
+{
+    return vmulq_n_f32(vcvtq_f32_s32(vshrq_n_s32(x, 8)), 1.0f / 8388608.0f);
+} /* cvt_s32_to_f32_neon */
+#endif
+
+
+static Uint32 convert_f32_to_s16(Uint8 *buf, Uint32 len)
+{
+    const float *src = (const float *) buf;
+    Sint16 *dst = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (float);
+    Uint32 i = 0;
+
+#if SOUND_HAVE_SSE2
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = cvt_f32_to_s16_sse2(_mm_loadu_ps(src + i));
+        const __m128i b = cvt_f32_to_s16_sse2(_mm_loadu_ps(src + i + 4));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(a, b));
+    } /* for */
+#elif SOUND_HAVE_NEON
+    for (; i + 8 <= count; i += 8)
+    {
+        const int32x4_t a = cvt_f32_to_s16_neon(vld1q_f32(src + i));
+        const int32x4_t b = cvt_f32_to_s16_neon(vld1q_f32(src + i + 4));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+    } /* for */
+#endif
+
+    for (; i < count; i++)
+        dst[i] = cvt_f32_to_s16(src[i]);
+
+    return count * sizeof (Sint16);
+} /* convert_f32_to_s16 */
+
+
+#if SOUND_HAVE_AVX2
+__attribute__((target("avx2")))
+static Uint32 convert_f32_to_s16_avx2(Uint8 *buf, Uint32 len)
+{
+    const float *src = (const float *) buf;
+    Sint16 *dst = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (float);
+    const __m256 lo = _mm256_set1_ps(-1.0f);
+    const __m256 hi = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(32767.0f);
+    Uint32 i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        const __m256 x = _mm256_loadu_ps(src + i);
+        const __m256 y = _mm256_loadu_ps(src + i + 8);
+        const __m256i a = _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(x, lo), hi), scale)),
+                                           _mm256_castps_si256(_mm256_cmp_ps(x, lo, _CMP_LE_OQ)));
+        const __m256i b = _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(y, lo), hi), scale)),
+                                           _mm256_castps_si256(_mm256_cmp_ps(y, lo, _CMP_LE_OQ)));
+        /* packs works per 128-bit lane; put the quarters back in order. */
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+    } /* for */
+
+    for (; i < count; i++)
+        dst[i] = cvt_f32_to_s16(src[i]);
+
+    return count * sizeof (Sint16);
+} /* convert_f32_to_s16_avx2 */
+#endif
+
+
+/* same size in and out (4 bytes per frame), so walking forward is fine. */
+static Uint32 convert_f32_mono_to_s16_stereo(Uint8 *buf, Uint32 len)
+{
+    const float *src = (const float *) buf;
+    Sint16 *dst = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (float);
+    Uint32 i = 0;
+
+#if SOUND_HAVE_SSE2
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = cvt_f32_to_s16_sse2(_mm_loadu_ps(src + i));
+        const __m128i b = cvt_f32_to_s16_sse2(_mm_loadu_ps(src + i + 4));
+        const __m128i v = _mm_packs_epi32(a, b);
+        _mm_storeu_si128((__m128i *) (dst + (i * 2)), _mm_unpacklo_epi16(v, v));
+        _mm_storeu_si128((__m128i *) (dst + (i * 2) + 8), _mm_unpackhi_epi16(v, v));
+    } /* for */
+#elif SOUND_HAVE_NEON
+    for (; i + 8 <= count; i += 8)
+    {
+        const int32x4_t a = cvt_f32_to_s16_neon(vld1q_f32(src + i));
+        const int32x4_t b = cvt_f32_to_s16_neon(vld1q_f32(src + i + 4));
+        const int16x8_t v = vcombine_s16(vqmovn_s32(a), vqmovn_s32(b));
+        const int16x8x2_t z = vzipq_s16(v, v);
+        vst1q_s16(dst + (i * 2), z.val[0]);
+        vst1q_s16(dst + (i * 2) + 8, z.val[1]);
+    } /* for */
+#endif
+
+    for (; i < count; i++)
+        dst[i * 2] = dst[(i * 2) + 1] = cvt_f32_to_s16(src[i]);
+
+    return count * 2 * sizeof (Sint16);
+} /* convert_f32_mono_to_s16_stereo */
+
+
+static Uint32 convert_s32_to_s16(Uint8 *buf, Uint32 len)
+{
+    const Sint32 *src = (const Sint32 *) buf;
+    Sint16 *dst = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (Sint32);
+    Uint32 i = 0;
+
+#if SOUND_HAVE_SSE2
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = cvt_f32_to_s16_sse2(cvt_s32_to_f32_sse2(_mm_loadu_si128((const __m128i *) (src + i))));
+        const __m128i b = cvt_f32_to_s16_sse2(cvt_s32_to_f32_sse2(_mm_loadu_si128((const __m128i *) (src + i + 4))));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(a, b));
+    } /* for */
+#elif SOUND_HAVE_NEON
+    for (; i + 8 <= count; i += 8)
+    {
+        const int32x4_t a = cvt_f32_to_s16_neon(cvt_s32_to_f32_neon(vld1q_s32(src + i)));
+        const int32x4_t b = cvt_f32_to_s16_neon(cvt_s32_to_f32_neon(vld1q_s32(src + i + 4)));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+    } /* for */
+#endif
+
+    for (; i < count; i++)
+        dst[i] = cvt_s32_to_s16(src[i]);
+
+    return count * sizeof (Sint16);
+} /* convert_s32_to_s16 */
+
+
+static Uint32 convert_s32_mono_to_s16_stereo(Uint8 *buf, Uint32 len)
+{
+    const Sint32 *src = (const Sint32 *) buf;
+    Sint16 *dst = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (Sint32);
+    Uint32 i;
+
+    for (i = 0; i < count; i++)
+        dst[i * 2] = dst[(i * 2) + 1] = cvt_s32_to_s16(src[i]);
+
+    return count * 2 * sizeof (Sint16);
+} /* convert_s32_mono_to_s16_stereo */
+
+
+/* SDL does a plain byteswap as-is, without going through float. */
+static Uint32 convert_s16_swap(Uint8 *buf, Uint32 len)
+{
+    Sint16 *ptr = (Sint16 *) buf;
+    const Uint32 count = len / sizeof (Sint16);
+    Uint32 i = 0;
+
+#if SOUND_HAVE_SSE2
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (ptr + i));
+        _mm_storeu_si128((__m128i *) (ptr + i), _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    } /* for */
+#elif SOUND_HAVE_NEON
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint8x16_t v = vld1q_u8((const uint8_t *) (ptr + i));
+        vst1q_u8((uint8_t *) (ptr + i), vrev16q_u8(v));
+    } /* for */
+#endif
+
+    for (; i < count; i++)
+        ptr[i] = cvt_s16_swap(ptr[i]);
+
+    return count * sizeof (Sint16);
+} /* convert_s16_swap */
+
+
+/* these two double the data, so they have to walk backward. */
+static Uint32 convert_s16_swap_mono_to_stereo(Uint8 *buf, Uint32 len)
+{
+    const Uint32 count = len / sizeof (Sint16);
+    const Sint16 *src = ((const Sint16 *) buf) + count;
+    Sint16 *dst = ((Sint16 *) buf) + (count * 2);
+
+    while (src != (const Sint16 *) buf)
+    {
+        const Sint16 val = cvt_s16_to_s16(cvt_s16_swap(*(--src)));
+        *(--dst) = val;
+        *(--dst) = val;
+    } /* while */
+
+    return count * 2 * sizeof (Sint16);
+} /* convert_s16_swap_mono_to_stereo */
+
+
+static Uint32 convert_s16_mono_to_stereo(Uint8 *buf, Uint32 len)
+{
+    const Uint32 count = len / sizeof (Sint16);
+    const Sint16 *src = ((const Sint16 *) buf) + count;
+    Sint16 *dst = ((Sint16 *) buf) + (count * 2);
+
+    while (src != (const Sint16 *) buf)
+    {
+        const Sint16 val = cvt_s16_to_s16(*(--src));
+        *(--dst) = val;
+        *(--dst) = val;
+    } /* while */
+
+    return count * 2 * sizeof (Sint16);
+} /* convert_s16_mono_to_stereo */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Sound_FastConvertFunc __Sound_ChooseFastConvert(const Sound_AudioInfo *src,
+                                                const Sound_AudioInfo *dst)
+{
+    const int same_channels = (src->channels == dst->channels);
+    const int mono_to_stereo = ((src->channels == 1) && (dst->channels == 2));
+
+    if ((src->rate != dst->rate) || (dst->format != AUDIO_S16SYS))
+        return NULL;  /* SDL_AudioCVT has to deal with this one. */
+    else if ((!same_channels) && (!mono_to_stereo))
+        return NULL;
+
+    switch (src->format)
+    {
+        case AUDIO_F32SYS:
+            if (mono_to_stereo)
+                return convert_f32_mono_to_s16_stereo;
+            #if SOUND_HAVE_AVX2
+            if (SDL_HasAVX2())
+                return convert_f32_to_s16_avx2;
+            #endif
+            return convert_f32_to_s16;
+
+        case AUDIO_S32SYS:
+            return mono_to_stereo ? convert_s32_mono_to_s16_stereo : convert_s32_to_s16;
+
+        case AUDIO_S16SWAPPED:
+            return mono_to_stereo ? convert_s16_swap_mono_to_stereo : convert_s16_swap;
+
+        case AUDIO_S16SYS:
+            return mono_to_stereo ? convert_s16_mono_to_stereo : NULL;
+    } /* switch */
+
+    return NULL;
+} /* __Sound_ChooseFastConvert */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_Swap16(void *buf, Uint32 len)
+{
+    convert_s16_swap((Uint8 *) buf, len);
+} /* __Sound_Swap16 */
+
+/* end of SDL_sound_convert.c ... */
+
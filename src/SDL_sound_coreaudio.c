@@ -232,11 +232,11 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
 	UInt32 format_size;
 	
 
-	core_audio_file_container = (CoreAudioFileContainer*)SDL_malloc(sizeof(CoreAudioFileContainer));
+	core_audio_file_container = (CoreAudioFileContainer*)__Sound_Malloc(sizeof(CoreAudioFileContainer));
 	BAIL_IF_MACRO(core_audio_file_container == NULL, ERR_OUT_OF_MEMORY, 0);
 
 
-	audio_file_id = (AudioFileID*)SDL_malloc(sizeof(AudioFileID));
+	audio_file_id = (AudioFileID*)__Sound_Malloc(sizeof(AudioFileID));
 	BAIL_IF_MACRO(audio_file_id == NULL, ERR_OUT_OF_MEMORY, 0);
 
 	error_result = AudioFileOpenWithCallbacks(
@@ -251,8 +251,8 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
 	if (error_result != noErr)
 	{
 		AudioFileClose(*audio_file_id);
-		SDL_free(audio_file_id);
-		SDL_free(core_audio_file_container);
+		__Sound_Free(audio_file_id);
+		__Sound_Free(core_audio_file_container);
 		SNDDBG(("Core Audio: can't grok data. reason: [%s].\n", CoreAudio_FourCCToString(error_result)));
 		BAIL_MACRO("Core Audio: Not valid audio data.", 0);
 	} /* if */
@@ -267,8 +267,8 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
     if (error_result != noErr)
 	{
 		AudioFileClose(*audio_file_id);
-		SDL_free(audio_file_id);
-		SDL_free(core_audio_file_container);
+		__Sound_Free(audio_file_id);
+		__Sound_Free(core_audio_file_container);
 		SNDDBG(("Core Audio: AudioFileGetProperty failed. reason: [%s]", CoreAudio_FourCCToString(error_result)));
 		BAIL_MACRO("Core Audio: Not valid audio data.", 0);
 	} /* if */
@@ -283,8 +283,8 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
     if (error_result != noErr)
 	{
 		AudioFileClose(*audio_file_id);
-		SDL_free(audio_file_id);
-		SDL_free(core_audio_file_container);
+		__Sound_Free(audio_file_id);
+		__Sound_Free(core_audio_file_container);
 		SNDDBG(("Core Audio: AudioFileGetProperty failed. reason: [%s].\n", CoreAudio_FourCCToString(error_result)));
 		BAIL_MACRO("Core Audio: Not valid audio data.", 0);
 	} /* if */
@@ -394,63 +394,57 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
 	if(error_result != noErr)
 	{
 		AudioFileClose(*audio_file_id);
-		SDL_free(audio_file_id);
-		SDL_free(core_audio_file_container);
+		__Sound_Free(audio_file_id);
+		__Sound_Free(core_audio_file_container);
 		SNDDBG(("Core Audio: can't wrap data. reason: [%s].\n", CoreAudio_FourCCToString(error_result)));
 		BAIL_MACRO("Core Audio: Failed to wrap data.", 0);
 	} /* if */
 
 
-	/* The output format must be linear PCM because that's the only type OpenAL knows how to deal with.
-	 * Set the client format to 16 bit signed integer (native-endian) data because that is the most
-	 * optimal format on iPhone/iPod Touch hardware.
-	 * Maintain the channel count and sample rate of the original source format.
+	/* The output format must be linear PCM, but past that, Core Audio's
+	 * converter can hand us anything: integer or float, any rate, mono or
+	 * stereo. So ask it for exactly what the app wants, and it decodes,
+	 * resamples and converts all in one pass, leaving nothing for
+	 * SDL_AudioCVT to do afterwards.
+	 * We default to 16 bit signed integer (native-endian) data, because that
+	 * is the most optimal format on iPhone/iPod Touch hardware, and the
+	 * original sample rate and channel count.
+	 * Core Audio only up- and downmixes between mono and stereo here, so other
+	 * channel counts are left for SDL to convert.
 	 */
+	SDL_zero(output_format);
 	output_format.mSampleRate = actual_format.mSampleRate; // preserve the original sample rate
+	if(sample->desired.rate != 0)
+	{
+		output_format.mSampleRate = (Float64) sample->desired.rate;
+	}
 	output_format.mChannelsPerFrame = actual_format.mChannelsPerFrame; // preserve the number of channels
+	if((sample->desired.channels == 1) || (sample->desired.channels == 2))
+	{
+		output_format.mChannelsPerFrame = sample->desired.channels;
+	}
 	output_format.mFormatID = kAudioFormatLinearPCM; // We want linear PCM data
 	output_format.mFramesPerPacket = 1; // We know for linear PCM, the definition is 1 frame per packet
 
-	if(sample->desired.format == 0)
+	sample->actual.rate = (Uint32) output_format.mSampleRate;
+	sample->actual.channels = (Uint8) output_format.mChannelsPerFrame;
+
+	output_format.mFormatFlags = kAudioFormatFlagIsPacked; // I seem to read failures problems without kAudioFormatFlagIsPacked. From a mailing list post, this seems to be a Core Audio bug.
+	output_format.mBitsPerChannel = SDL_AUDIO_BITSIZE(sample->actual.format);
+	if(SDL_AUDIO_ISFLOAT(sample->actual.format))
 	{
-		// do AUDIO_S16SYS
-		output_format.mFormatFlags = kAudioFormatFlagsNativeEndian | kAudioFormatFlagIsSignedInteger | kAudioFormatFlagIsPacked; // I seem to read failures problems without kAudioFormatFlagIsPacked. From a mailing list post, this seems to be a Core Audio bug.
-		output_format.mBitsPerChannel = 16; // We know we want 16-bit
+		output_format.mFormatFlags |= kAudioFormatFlagIsFloat;
 	}
-	else
+	else if(SDL_AUDIO_ISSIGNED(sample->actual.format))
 	{
-		output_format.mFormatFlags = 0; // clear flags
-		output_format.mFormatFlags |= kAudioFormatFlagIsPacked; // I seem to read failures problems without kAudioFormatFlagIsPacked. From a mailing list post, this seems to be a Core Audio bug.
-		// Mask against bitsize
-		if(0xFF & sample->desired.format)
-		{
-			output_format.mBitsPerChannel = 16; /* 16-bit */
-		}
-		else
-		{
-			output_format.mBitsPerChannel = 8; /* 8-bit */
-		}
-
-		// Mask for signed/unsigned
-		if((1<<15) & sample->desired.format)
-		{
-			output_format.mFormatFlags = output_format.mFormatFlags | kAudioFormatFlagIsSignedInteger;
-
-		}
-		else
-		{
-			// no flag set for unsigned
-		}
-		// Mask for big/little endian
-		if((1<<12) & sample->desired.format)
-		{
-			output_format.mFormatFlags = output_format.mFormatFlags | kAudioFormatFlagIsBigEndian;
-		}
-		else
-		{
-			// no flag set for little endian 
-		}
+		output_format.mFormatFlags |= kAudioFormatFlagIsSignedInteger;
+	}
+	// no flag set for unsigned
+	if(SDL_AUDIO_ISBIGENDIAN(sample->actual.format) && (output_format.mBitsPerChannel > 8))
+	{
+		output_format.mFormatFlags |= kAudioFormatFlagIsBigEndian;
 	}
+	// no flag set for little endian
 
 	output_format.mBytesPerPacket = output_format.mBitsPerChannel/8 * output_format.mChannelsPerFrame; // e.g. 16-bits/8 * channels => so 2-bytes per channel per frame
 	output_format.mBytesPerFrame = output_format.mBitsPerChannel/8 * output_format.mChannelsPerFrame; // For PCM, since 1 frame is 1 packet, it is the same as mBytesPerPacket
@@ -480,17 +474,35 @@ static int CoreAudio_open(Sound_Sample *sample, const char *ext)
 	/* Set the desired client (output) data format */
 	error_result = ExtAudioFileSetProperty(core_audio_file_container->extAudioFileRef, kExtAudioFileProperty_ClientDataFormat, sizeof(output_format), &output_format);
 	if(noErr != error_result)
+	{
+		/* Not everything the app can ask for is something Core Audio will
+		 * convert to (unsigned 16-bit, say). Fall back to native 16-bit at
+		 * the file's own rate and let SDL convert the rest.
+		 */
+		SNDDBG(("Core Audio: client format refused, reason: [%s]. Trying S16SYS.\n", CoreAudio_FourCCToString(error_result)));
+		output_format.mSampleRate = actual_format.mSampleRate;
+		output_format.mChannelsPerFrame = actual_format.mChannelsPerFrame;
+		output_format.mFormatFlags = kAudioFormatFlagsNativeEndian | kAudioFormatFlagIsSignedInteger | kAudioFormatFlagIsPacked;
+		output_format.mBitsPerChannel = 16;
+		output_format.mBytesPerPacket = 2 * output_format.mChannelsPerFrame;
+		output_format.mBytesPerFrame = 2 * output_format.mChannelsPerFrame;
+		sample->actual.rate = (Uint32) output_format.mSampleRate;
+		sample->actual.channels = (Uint8) output_format.mChannelsPerFrame;
+		sample->actual.format = AUDIO_S16SYS;
+		error_result = ExtAudioFileSetProperty(core_audio_file_container->extAudioFileRef, kExtAudioFileProperty_ClientDataFormat, sizeof(output_format), &output_format);
+	}
+	if(noErr != error_result)
 	{
 		ExtAudioFileDispose(core_audio_file_container->extAudioFileRef);
 		AudioFileClose(*audio_file_id);
-		SDL_free(audio_file_id);
-		SDL_free(core_audio_file_container);
+		__Sound_Free(audio_file_id);
+		__Sound_Free(core_audio_file_container);
 		SNDDBG(("Core Audio: ExtAudioFileSetProperty(kExtAudioFileProperty_ClientDataFormat) failed, reason: [%s].\n", CoreAudio_FourCCToString(error_result)));
 		BAIL_MACRO("Core Audio: Not valid audio data.", 0);
 	}	
 
 
-	core_audio_file_container->outputFormat = (AudioStreamBasicDescription*)SDL_malloc(sizeof(AudioStreamBasicDescription));
+	core_audio_file_container->outputFormat = (AudioStreamBasicDescription*)__Sound_Malloc(sizeof(AudioStreamBasicDescription));
 	BAIL_IF_MACRO(core_audio_file_container->outputFormat == NULL, ERR_OUT_OF_MEMORY, 0);
 
 
@@ -511,11 +523,11 @@ static void CoreAudio_close(Sound_Sample *sample)
 	Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
 	CoreAudioFileContainer* core_audio_file_container = (CoreAudioFileContainer *) internal->decoder_private;
 
-	SDL_free(core_audio_file_container->outputFormat);
+	__Sound_Free(core_audio_file_container->outputFormat);
 	ExtAudioFileDispose(core_audio_file_container->extAudioFileRef);
 	AudioFileClose(*core_audio_file_container->audioFileID);
-	SDL_free(core_audio_file_container->audioFileID);
-	SDL_free(core_audio_file_container);
+	__Sound_Free(core_audio_file_container->audioFileID);
+	__Sound_Free(core_audio_file_container);
 } /* CoreAudio_close */
 
 
@@ -545,7 +557,7 @@ static Uint32 CoreAudio_read(Sound_Sample *sample)
 //	printf("buffer_size_in_frames=%ld, internal->buffer_size=%d, internal->buffer=0x%x outputFormat->mBytesPerFrame=%d, sample->buffer_size=%d\n", buffer_size_in_frames, internal->buffer_size, internal->buffer, core_audio_file_container->outputFormat->mBytesPerFrame, sample->buffer_size); 
 
 
-//	void* temp_buffer = SDL_malloc(max_buffer_size);
+//	void* temp_buffer = __Sound_Malloc(max_buffer_size);
 	
 	AudioBufferList audio_buffer_list;
 	audio_buffer_list.mNumberBuffers = 1;
@@ -696,6 +708,23 @@ static int CoreAudio_seek(Sound_Sample *sample, Uint32 ms)
 } /* CoreAudio_seek */
 
 
+/* ExtAudioFileSeek() counts in client format frames, which are ours. */
+static int CoreAudio_seek_frames(Sound_Sample *sample, Uint64 frame)
+{
+	OSStatus error_result = noErr;
+	Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+	CoreAudioFileContainer* core_audio_file_container = (CoreAudioFileContainer *) internal->decoder_private;
+
+	error_result = ExtAudioFileSeek(core_audio_file_container->extAudioFileRef, (SInt64) frame);
+	if(error_result != noErr)
+	{
+		sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+	}
+
+	return 1;
+} /* CoreAudio_seek_frames */
+
+
 static const char *extensions_coreaudio[] =
 {
 	"aif",
@@ -738,7 +767,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_CoreAudio =
     CoreAudio_close,      /*  close() method */
     CoreAudio_read,       /*   read() method */
     CoreAudio_rewind,     /* rewind() method */
-    CoreAudio_seek        /*   seek() method */
+    CoreAudio_seek,       /*   seek() method */
+    NULL,                 /*  probe() method */
+    NULL,                 /*   view() method */
+    CoreAudio_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_COREAUDIO */
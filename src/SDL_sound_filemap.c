@@ -0,0 +1,154 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Memory-mapped file input for Sound_NewSampleFromFileMapped().
+ *
+ * The file is mapped read-only and wrapped in one of SDL's constant-memory
+ *  SDL_RWops, so to the decoders it looks exactly like something that came
+ *  from Sound_NewSampleFromMem(). We just swap in our own close() method to
+ *  unmap it when the sample is done with it.
+ *
+ * Platforms without a mapping implementation here return NULL, and the
+ *  caller falls back to regular file i/o.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#define SOUND_HAVE_FILEMAP 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define SOUND_HAVE_FILEMAP 1
+#else
+#define SOUND_HAVE_FILEMAP 0
+#endif
+
+#if SOUND_HAVE_FILEMAP
+
+static int SDLCALL mapped_close(SDL_RWops *rw)
+{
+    void *base = (void *) rw->hidden.mem.base;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(base);
+#else
+    munmap(base, (size_t) (rw->hidden.mem.stop - rw->hidden.mem.base));
+#endif
+
+    SDL_FreeRW(rw);
+    return 0;
+} /* mapped_close */
+
+
+/* map the whole file read-only; returns NULL on failure. */
+static void *map_file(const char *fname, size_t *len)
+{
+#if defined(_WIN32)
+    HANDLE file, mapping;
+    LARGE_INTEGER size;
+    WCHAR *wfname;
+    void *retval = NULL;
+    int wlen;
+
+    wlen = MultiByteToWideChar(CP_UTF8, 0, fname, -1, NULL, 0);
+    if (wlen <= 0)
+        return NULL;
+    wfname = (WCHAR *) __Sound_Malloc(wlen * sizeof (WCHAR));
+    if (wfname == NULL)
+        return NULL;
+    MultiByteToWideChar(CP_UTF8, 0, fname, -1, wfname, wlen);
+
+    file = CreateFileW(wfname, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    __Sound_Free(wfname);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if ((GetFileSizeEx(file, &size)) && (size.QuadPart > 0) &&
+        (size.QuadPart <= 0x7FFFFFFF))
+    {
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping != NULL)
+        {
+            retval = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);  /* the view keeps the mapping alive. */
+            *len = (size_t) size.QuadPart;
+        } /* if */
+    } /* if */
+
+    CloseHandle(file);
+    return retval;
+#else
+    struct stat statbuf;
+    void *retval = NULL;
+    const int fd = open(fname, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+
+    if ((fstat(fd, &statbuf) == 0) && (S_ISREG(statbuf.st_mode)) &&
+        (statbuf.st_size > 0) && (statbuf.st_size <= 0x7FFFFFFF))
+    {
+        retval = mmap(NULL, (size_t) statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (retval == MAP_FAILED)
+            retval = NULL;
+        else
+            *len = (size_t) statbuf.st_size;
+    } /* if */
+
+    close(fd);  /* the mapping outlives the descriptor. */
+    return retval;
+#endif
+} /* map_file */
+
+
+/*
+ * This is declared in the internal header.
+ */
+SDL_RWops *__Sound_RWFromMappedFile(const char *fname)
+{
+    SDL_RWops *retval;
+    size_t len = 0;
+    void *ptr = map_file(fname, &len);
+
+    if (ptr == NULL)
+        return NULL;
+
+    retval = SDL_RWFromConstMem(ptr, (int) len);
+    if (retval == NULL)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(ptr);
+#else
+        munmap(ptr, len);
+#endif
+        return NULL;
+    } /* if */
+
+    retval->close = mapped_close;
+    return retval;
+} /* __Sound_RWFromMappedFile */
+
+#else
+
+SDL_RWops *__Sound_RWFromMappedFile(const char *fname)
+{
+    return NULL;  /* no mapping support; caller falls back to stdio. */
+} /* __Sound_RWFromMappedFile */
+
+#endif /* SOUND_HAVE_FILEMAP */
+
+/* end of SDL_sound_filemap.c ... */
+
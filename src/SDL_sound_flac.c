@@ -31,43 +31,58 @@
 #define DR_FLAC_NO_WIN32_IO 1
 #define DR_FLAC_NO_CRC 1
 #define DRFLAC_ASSERT(x) SDL_assert((x))
-#define DRFLAC_MALLOC(sz) SDL_malloc((sz))
-#define DRFLAC_REALLOC(p, sz) SDL_realloc((p), (sz))
-#define DRFLAC_FREE(p) SDL_free((p))
+#define DRFLAC_MALLOC(sz) __Sound_Malloc((sz))
+#define DRFLAC_REALLOC(p, sz) __Sound_Realloc((p), (sz))
+#define DRFLAC_FREE(p) __Sound_Free((p))
 #define DRFLAC_COPY_MEMORY(dst, src, sz) SDL_memcpy((dst), (src), (sz))
 #define DRFLAC_ZERO_MEMORY(p, sz) SDL_memset((p), 0, (sz))
 #include "dr_flac.h"
 
+/*
+ * dr_flac takes a short read to mean the end of the stream, so it can't be
+ *  fed from a stream that's running behind (a socket, say). We read ahead of
+ *  it instead, and only let it start on a new FLAC frame when we're holding
+ *  at least the biggest frame this stream could have, plus what dr_flac reads
+ *  ahead on its own. If that's not there yet, FLAC_read() says EAGAIN.
+ */
+#define FLAC_FRAME_OVERHEAD 64  /* frame header, subframe headers, CRC. */
+#define FLAC_INPUT_DEFAULT (64 * 1024)  /* until we know the stream's. */
+
+/*
+ * Without a SEEKTABLE, dr_flac finds a sample by walking every frame from
+ *  the start of the stream (or from where it is, going forward), so every
+ *  seek costs more the further into the file it goes. We note where each
+ *  frame starts instead, as FLAC_read() decodes them and as seeking walks
+ *  past them, and seek from the last frame we know of that's at or before
+ *  the target. The index only ever grows at the end, from the frame right
+ *  after the last one in it, so it's always every frame from the first one
+ *  up to somewhere, with no gaps.
+ */
+typedef struct
+{
+    drflac_uint64 sample;  /* dr_flac sample number (so, times channels). */
+    drflac_uint64 offset;  /* where the frame header starts. */
+} FLAC_indexentry;
+
+typedef struct
+{
+    drflac *dr;
+    Sound_InputBuffer in;
+    Uint32 frame_bytes;  /* have this much buffered before a new frame. */
+    drflac_uint64 pos;   /* where flac_read() will read next. */
+    FLAC_indexentry *index;  /* NULL if we aren't keeping one. */
+    Uint32 index_count;
+    Uint32 index_avail;
+} FLAC_t;
+
 static size_t flac_read(void* pUserData, void* pBufferOut, size_t bytesToRead)
 {
-    Uint8 *ptr = (Uint8 *) pBufferOut;
     Sound_Sample *sample = (Sound_Sample *) pUserData;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    SDL_RWops *rwops = internal->rw;
-    size_t retval = 0;
-
-    /* !!! FIXME: dr_flac treats returning less than bytesToRead as EOF. So we can't EAGAIN. */
-    while (retval < bytesToRead)
-    {
-        const size_t rc = SDL_RWread(rwops, ptr, 1, bytesToRead);
-        if (rc == 0)
-        {
-            sample->flags |= SOUND_SAMPLEFLAG_EOF;
-            break;
-        } /* if */
-        else if (retval == -1)
-        {
-            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-            break;
-        } /* else if */
-        else
-        {
-            retval += rc;
-            ptr += rc;
-        } /* else */
-    } /* while */
-
-    return retval;
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    const size_t br = __Sound_InputRead(internal->rw, &f->in, pBufferOut, bytesToRead);
+    f->pos += br;
+    return br;
 } /* flac_read */
 
 static drflac_bool32 flac_seek(void* pUserData, int offset, drflac_seek_origin origin)
@@ -75,10 +90,124 @@ static drflac_bool32 flac_seek(void* pUserData, int offset, drflac_seek_origin o
     const int whence = (origin == drflac_seek_origin_start) ? RW_SEEK_SET : RW_SEEK_CUR;
     Sound_Sample *sample = (Sound_Sample *) pUserData;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    return (SDL_RWseek(internal->rw, offset, whence) != -1) ? DRFLAC_TRUE : DRFLAC_FALSE;
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    if (!__Sound_InputSeek(internal->rw, &f->in, offset, whence))
+        return DRFLAC_FALSE;
+
+    if (whence == RW_SEEK_SET)
+        f->pos = (drflac_uint64) offset;
+    else
+        f->pos += offset;
+    return DRFLAC_TRUE;
 } /* flac_seek */
 
 
+/*
+ * Where the stream is, as far as dr_flac's bit reader goes: what has been
+ *  read from us, less what's still sitting unconsumed in its caches. Only
+ *  means something between frames, where it's on a byte boundary.
+ */
+static drflac_uint64 flac_stream_pos(const FLAC_t *f)
+{
+    const drflac_bs *bs = &f->dr->bs;
+    drflac_uint64 cached = DRFLAC_CACHE_L1_BITS_REMAINING(bs) / 8;
+    cached += DRFLAC_CACHE_L2_LINES_REMAINING(bs) * sizeof (bs->cacheL2[0]);
+    cached += bs->unalignedByteCount;
+    return f->pos - cached;
+} /* flac_stream_pos */
+
+
+/* Note the frame starting at dr_flac's current position, if it's a new one. */
+static void flac_index_add(FLAC_t *f)
+{
+    const drflac *dr = f->dr;
+
+    if (f->index == NULL)
+        return;  /* not keeping one. */
+    else if (dr->currentSample <= f->index[f->index_count - 1].sample)
+        return;  /* already have it. */
+
+    if (f->index_count == f->index_avail)
+    {
+        const Uint32 newavail = f->index_avail * 2;
+        void *ptr;
+        if (newavail < f->index_avail)
+            return;  /* keep what we have. */
+        ptr = __Sound_Realloc(f->index, newavail * sizeof (FLAC_indexentry));
+        if (ptr == NULL)
+            return;  /* keep what we have; seeks past it just walk further. */
+        f->index = (FLAC_indexentry *) ptr;
+        f->index_avail = newavail;
+    } /* if */
+
+    f->index[f->index_count].sample = dr->currentSample;
+    f->index[f->index_count].offset = flac_stream_pos(f);
+    f->index_count++;
+} /* flac_index_add */
+
+
+/* Last frame in the index that starts at or before (sampnum). */
+static Uint32 flac_index_find(const FLAC_t *f, drflac_uint64 sampnum)
+{
+    Uint32 lo = 0;
+    Uint32 hi = f->index_count;  /* index[0] is sample zero, so lo works. */
+
+    while (hi - lo > 1)
+    {
+        const Uint32 mid = lo + ((hi - lo) / 2);
+        if (f->index[mid].sample <= sampnum)
+            lo = mid;
+        else
+            hi = mid;
+    } /* while */
+
+    return lo;
+} /* flac_index_find */
+
+
+/*
+ * Jump to the closest indexed frame, then skip whole frames without decoding
+ *  them (indexing each one) until we're on the one that has (sampnum), and
+ *  decode just that.
+ */
+static int flac_seek_indexed(FLAC_t *f, drflac_uint64 sampnum)
+{
+    drflac *dr = f->dr;
+    const FLAC_indexentry *entry = &f->index[flac_index_find(f, sampnum)];
+
+    if (!drflac__seek_to_byte(&dr->bs, entry->offset))
+        return 0;
+
+    DRFLAC_ZERO_MEMORY(&dr->currentFrame, sizeof (dr->currentFrame));
+    dr->currentSample = entry->sample;
+
+    while (1)
+    {
+        drflac_uint64 count;
+
+        if (!drflac__read_next_frame_header(&dr->bs, dr->bitsPerSample, &dr->currentFrame.header))
+            return 0;
+
+        count = ((drflac_uint64) dr->currentFrame.header.blockSize) * dr->channels;
+        if (sampnum < dr->currentSample + count)
+        {
+            const drflac_uint64 skip = sampnum - dr->currentSample;
+            if (drflac__decode_frame(dr) != DRFLAC_SUCCESS)
+                return 0;
+            return (drflac_read_s32(dr, skip, NULL) == skip);
+        } /* if */
+
+        if (drflac__seek_to_next_frame(dr) != DRFLAC_SUCCESS)
+            return 0;
+
+        dr->currentSample += count;
+        flac_index_add(f);
+    } /* while */
+
+    return 0;  /* shouldn't hit this. */
+} /* flac_seek_indexed */
+
+
 static int FLAC_init(void)
 {
     return 1;  /* always succeeds. */
@@ -91,23 +220,96 @@ static void FLAC_quit(void)
 } /* FLAC_quit */
 
 
+static int FLAC_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    /* dr_flac skips ID3 tags, and handles Ogg FLAC, too. */
+    return ( (len >= 4) &&
+             ((SDL_memcmp(header, "fLaC", 4) == 0) ||
+              (SDL_memcmp(header, "OggS", 4) == 0) ||
+              (SDL_memcmp(header, "ID3", 3) == 0)) );
+} /* FLAC_probe */
+
+
 static int FLAC_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drflac *dr = drflac_open(flac_read, flac_seek, sample);
+    FLAC_t *f = (FLAC_t *) __Sound_Calloc(1, sizeof (FLAC_t));
+    drflac *dr;
+
+    BAIL_IF_MACRO(f == NULL, ERR_OUT_OF_MEMORY, 0);
+    if (!__Sound_InputReserve(&f->in, FLAC_INPUT_DEFAULT))
+    {
+        __Sound_Free(f);
+        return 0;
+    } /* if */
 
+    internal->decoder_private = f;  /* flac_read() needs this. */
+    dr = drflac_open(flac_read, flac_seek, sample);
     if (!dr)
     {
-        BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_IO_ERROR, 0);
+        __Sound_InputFree(&f->in);
+        __Sound_Free(f);
         BAIL_MACRO("FLAC: Not a FLAC stream.", 0);
     } /* if */
 
+    /*
+     * Worst case for a frame is every subframe stored verbatim, with the
+     *  side channel a bit wider. Ogg FLAC can have a page header in the
+     *  middle of it, too. Keep room for two, so we're not refilling from
+     *  the stream every single frame. Sound_ProbeInfo() won't read a frame.
+     */
+    f->dr = dr;
+    f->frame_bytes = ((((Uint32) dr->maxBlockSize) * dr->channels * (dr->bitsPerSample + 1)) + 7) / 8;
+    f->frame_bytes += FLAC_FRAME_OVERHEAD + (2 * DR_FLAC_BUFFER_SIZE);
+    if (dr->container == drflac_container_ogg)
+        f->frame_bytes += 65536;
+
+    if ((!internal->probe_only) && (!__Sound_InputReserve(&f->in, f->frame_bytes * 2)))
+    {
+        drflac_close(dr);
+        __Sound_InputFree(&f->in);
+        __Sound_Free(f);
+        return 0;
+    } /* if */
+
+    /*
+     * dr_flac seeks fine on its own with a SEEKTABLE, and Ogg FLAC seeks by
+     *  Ogg page, so we only index native FLAC without one. We're sitting on
+     *  the first frame right now; that's the first entry. If we can't get
+     *  the memory, we just go without.
+     */
+    if ( (!internal->probe_only) && (dr->container == drflac_container_native) &&
+         (dr->seekpointCount == 0) )
+    {
+        f->index = (FLAC_indexentry *) __Sound_Malloc(1024 * sizeof (FLAC_indexentry));
+        if (f->index != NULL)
+        {
+            f->index_avail = 1024;
+            f->index_count = 1;
+            f->index[0].sample = 0;
+            f->index[0].offset = flac_stream_pos(f);
+        } /* if */
+    } /* if */
+
     SNDDBG(("FLAC: Accepting data stream.\n"));
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->accurate_seek = 1;
+    internal->block_frames = dr->maxBlockSize;  /* dr_flac decodes whole frames. */
 
     sample->actual.channels = dr->channels;
     sample->actual.rate = dr->sampleRate;
-    sample->actual.format = AUDIO_S32SYS;  /* dr_flac only does Sint32. */
+
+    /*
+     * dr_flac decodes to Sint32 internally. 16-bit streams (that is, most of
+     *  them) lose nothing as Sint16, and if the app wants Sint16 from a
+     *  deeper stream anyhow, drflac_read_s16() just shifts each sample down,
+     *  which beats a separate conversion pass over the whole buffer.
+     */
+    if ( (sample->desired.format == AUDIO_S16SYS) ||
+         ((dr->bitsPerSample <= 16) && (sample->desired.format != AUDIO_S32SYS)) )
+        sample->actual.format = AUDIO_S16SYS;
+    else
+        sample->actual.format = AUDIO_S32SYS;
 
     if (dr->totalSampleCount == 0)
         internal->total_time = -1;
@@ -116,47 +318,140 @@ static int FLAC_open(Sound_Sample *sample, const char *ext)
         const Uint32 rate = (Uint32) dr->sampleRate;
         const Uint64 frames = (Uint64) (dr->totalSampleCount / dr->channels);
         internal->total_time = (frames / rate) * 1000;
-        internal->total_time += ((dr->totalSampleCount % dr->sampleRate) * 1000) / dr->sampleRate;
+        internal->total_time += ((frames % rate) * 1000) / rate;
     } /* else */
 
-    internal->decoder_private = dr;
-
     return 1;
 } /* FLAC_open */
 
 static void FLAC_close(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drflac *dr = (drflac *) internal->decoder_private;
-    drflac_close(dr);
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    drflac_close(f->dr);
+    __Sound_InputFree(&f->in);
+    __Sound_Free(f->index);
+    __Sound_Free(f);
 } /* FLAC_close */
 
 static Uint32 FLAC_read(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drflac *dr = (drflac *) internal->decoder_private;
-    const drflac_uint64 rc = drflac_read_s32(dr, internal->buffer_size / sizeof (drflac_int32), (drflac_int32 *) internal->buffer);
-    /* !!! FIXME: the flac_read callback sets ERROR and EOF flags, but this only tells you about i/o errors, not corruption. */
-    return rc * sizeof (drflac_int32);
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    drflac *dr = f->dr;
+    const int s16 = (sample->actual.format == AUDIO_S16SYS);
+    const Uint32 samplesize = s16 ? sizeof (drflac_int16) : sizeof (drflac_int32);
+    const drflac_uint64 total = internal->buffer_size / samplesize;
+    drflac_uint64 got = 0;
+
+    while (got < total)
+    {
+        drflac_uint64 want = total - got;
+        drflac_uint64 rc;
+
+        if (dr->currentFrame.samplesRemaining > 0)
+        {
+            if (want > dr->currentFrame.samplesRemaining)
+                want = dr->currentFrame.samplesRemaining;
+        } /* if */
+
+        else  /* next read decodes a new frame; is all of it here? */
+        {
+            if ( (__Sound_InputFill(internal->rw, &f->in, f->frame_bytes) < f->frame_bytes) &&
+                 (!f->in.eof) )
+            {
+                sample->flags |= SOUND_SAMPLEFLAG_EAGAIN;
+                break;
+            } /* if */
+
+            flac_index_add(f);  /* we're between frames; note this one. */
+
+            /* one sample per channel gets it decoded, but no further. */
+            if (want > dr->channels)
+                want = dr->channels;
+        } /* else */
+
+        if (s16)
+            rc = drflac_read_s16(dr, want, ((drflac_int16 *) internal->buffer) + got);
+        else
+            rc = drflac_read_s32(dr, want, ((drflac_int32 *) internal->buffer) + got);
+
+        got += rc;
+        if (rc < want)
+        {
+            const int early = ( (dr->totalSampleCount == 0) ||
+                                (dr->currentSample < dr->totalSampleCount) );
+            if ((early) && (!f->in.eof))
+            {
+                /* ran dry mid-frame; dr_flac can't pick that up again. */
+                __Sound_SetError(ERR_IO_ERROR);
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+            } /* if */
+            else
+            {
+                /* !!! FIXME: this could be corruption instead of the end, but dr_flac doesn't say. */
+                sample->flags |= SOUND_SAMPLEFLAG_EOF;
+            } /* else */
+            break;
+        } /* if */
+    } /* while */
+
+    return (Uint32) (got * samplesize);
 } /* FLAC_read */
 
-static int FLAC_rewind(Sound_Sample *sample)
+static int FLAC_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drflac *dr = (drflac *) internal->decoder_private;
-    return (drflac_seek_to_sample(dr, 0) == DRFLAC_TRUE);
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    drflac *dr = f->dr;
+    drflac_uint64 sampnum = ((drflac_uint64) frame) * sample->actual.channels;
+
+    if (f->index != NULL)
+    {
+        const drflac_uint64 framelen = ((drflac_uint64) dr->currentFrame.header.blockSize) * dr->channels;
+        const drflac_uint64 first = dr->currentSample - (framelen - dr->currentFrame.samplesRemaining);
+
+        if ((dr->totalSampleCount > 0) && (sampnum >= dr->totalSampleCount))
+            sampnum = dr->totalSampleCount - 1;  /* dr_flac clamps like this, too. */
+
+        /* dr_flac just moves around in the frame it has decoded already. */
+        if ( (dr->currentFrame.samplesRemaining == 0) ||
+             (sampnum < first) || (sampnum >= first + framelen) )
+            return flac_seek_indexed(f, sampnum);
+    } /* if */
+
+    return (drflac_seek_to_sample(dr, sampnum) == DRFLAC_TRUE);
+} /* FLAC_seek_frames */
+
+
+static int FLAC_rewind(Sound_Sample *sample)
+{
+    return FLAC_seek_frames(sample, 0);
 } /* FLAC_rewind */
 
+
 static int FLAC_seek(Sound_Sample *sample, Uint32 ms)
 {
-    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drflac *dr = (drflac *) internal->decoder_private;
-    const float frames_per_ms = ((float) sample->actual.rate) / 1000.0f;
-    const drflac_uint64 frame_offset = (drflac_uint64) (frames_per_ms * ((float) ms));
-    const drflac_uint64 sampnum = frame_offset * sample->actual.channels;
-    return (drflac_seek_to_sample(dr, sampnum) == DRFLAC_TRUE);
+    return FLAC_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* FLAC_seek */
 
+
+static Uint32 FLAC_memory_usage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    FLAC_t *f = (FLAC_t *) internal->decoder_private;
+    const drflac *dr = f->dr;
+    Uint32 retval = (Uint32) sizeof (FLAC_t) + f->in.alloc;
+
+    retval += f->index_avail * (Uint32) sizeof (FLAC_indexentry);
+
+    /* dr_flac is one block: itself, a frame of samples, and the seektable. */
+    retval += (Uint32) sizeof (drflac);
+    retval += dr->maxBlockSize * dr->channels * (Uint32) sizeof (drflac_int32);
+    retval += dr->seekpointCount * (Uint32) sizeof (drflac_seekpoint);
+    return retval;
+} /* FLAC_memory_usage */
+
 static const char *extensions_flac[] = { "FLAC", "FLA", NULL };
 const Sound_DecoderFunctions __Sound_DecoderFunctions_FLAC =
 {
@@ -173,7 +468,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_FLAC =
     FLAC_close,      /*  close() method */
     FLAC_read,       /*   read() method */
     FLAC_rewind,     /* rewind() method */
-    FLAC_seek        /*   seek() method */
+    FLAC_seek,       /*   seek() method */
+    FLAC_probe,      /*  probe() method */
+    NULL,            /*   view() method */
+    FLAC_seek_frames, /* seek_frames() method */
+    FLAC_memory_usage /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_FLAC */
@@ -0,0 +1,224 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * G.711 µ-law and A-law, shared by the AU, WAV and Shorten decoders.
+ *
+ * Expanding is a table lookup per byte. The loops are unrolled so the
+ *  loads can overlap; they run back to front, so callers can read the
+ *  8-bit data into the start of their output buffer and expand it right
+ *  there, instead of splitting the buffer into halves.
+ *
+ * Companding takes the exponent/segment from a 256 entry table instead of
+ *  searching for it, so each sample is the same short run of shifts and
+ *  masks with no data-dependent loop.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+/* table to convert from µ-law encoding to signed 16-bit samples,
+   generated by a throwaway perl script */
+static const Sint16 ulaw_to_linear[256] = {
+    -32124,-31100,-30076,-29052,-28028,-27004,-25980,-24956,
+    -23932,-22908,-21884,-20860,-19836,-18812,-17788,-16764,
+    -15996,-15484,-14972,-14460,-13948,-13436,-12924,-12412,
+    -11900,-11388,-10876,-10364, -9852, -9340, -8828, -8316,
+     -7932, -7676, -7420, -7164, -6908, -6652, -6396, -6140,
+     -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092,
+     -3900, -3772, -3644, -3516, -3388, -3260, -3132, -3004,
+     -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980,
+     -1884, -1820, -1756, -1692, -1628, -1564, -1500, -1436,
+     -1372, -1308, -1244, -1180, -1116, -1052,  -988,  -924,
+      -876,  -844,  -812,  -780,  -748,  -716,  -684,  -652,
+      -620,  -588,  -556,  -524,  -492,  -460,  -428,  -396,
+      -372,  -356,  -340,  -324,  -308,  -292,  -276,  -260,
+      -244,  -228,  -212,  -196,  -180,  -164,  -148,  -132,
+      -120,  -112,  -104,   -96,   -88,   -80,   -72,   -64,
+       -56,   -48,   -40,   -32,   -24,   -16,    -8,     0,
+     32124, 31100, 30076, 29052, 28028, 27004, 25980, 24956,
+     23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764,
+     15996, 15484, 14972, 14460, 13948, 13436, 12924, 12412,
+     11900, 11388, 10876, 10364,  9852,  9340,  8828,  8316,
+      7932,  7676,  7420,  7164,  6908,  6652,  6396,  6140,
+      5884,  5628,  5372,  5116,  4860,  4604,  4348,  4092,
+      3900,  3772,  3644,  3516,  3388,  3260,  3132,  3004,
+      2876,  2748,  2620,  2492,  2364,  2236,  2108,  1980,
+      1884,  1820,  1756,  1692,  1628,  1564,  1500,  1436,
+      1372,  1308,  1244,  1180,  1116,  1052,   988,   924,
+       876,   844,   812,   780,   748,   716,   684,   652,
+       620,   588,   556,   524,   492,   460,   428,   396,
+       372,   356,   340,   324,   308,   292,   276,   260,
+       244,   228,   212,   196,   180,   164,   148,   132,
+       120,   112,   104,    96,    88,    80,    72,    64,
+        56,    48,    40,    32,    24,    16,     8,     0
+};
+
+/* same thing for A-law, from the Sun reference code's alaw2linear(). */
+static const Sint16 alaw_to_linear[256] = {
+     -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736,
+     -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784,
+     -2752, -2624, -3008, -2880, -2240, -2112, -2496, -2368,
+     -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392,
+    -22016,-20992,-24064,-23040,-17920,-16896,-19968,-18944,
+    -30208,-29184,-32256,-31232,-26112,-25088,-28160,-27136,
+    -11008,-10496,-12032,-11520, -8960, -8448, -9984, -9472,
+    -15104,-14592,-16128,-15616,-13056,-12544,-14080,-13568,
+      -344,  -328,  -376,  -360,  -280,  -264,  -312,  -296,
+      -472,  -456,  -504,  -488,  -408,  -392,  -440,  -424,
+       -88,   -72,  -120,  -104,   -24,    -8,   -56,   -40,
+      -216,  -200,  -248,  -232,  -152,  -136,  -184,  -168,
+     -1376, -1312, -1504, -1440, -1120, -1056, -1248, -1184,
+     -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696,
+      -688,  -656,  -752,  -720,  -560,  -528,  -624,  -592,
+      -944,  -912, -1008,  -976,  -816,  -784,  -880,  -848,
+      5504,  5248,  6016,  5760,  4480,  4224,  4992,  4736,
+      7552,  7296,  8064,  7808,  6528,  6272,  7040,  6784,
+      2752,  2624,  3008,  2880,  2240,  2112,  2496,  2368,
+      3776,  3648,  4032,  3904,  3264,  3136,  3520,  3392,
+     22016, 20992, 24064, 23040, 17920, 16896, 19968, 18944,
+     30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136,
+     11008, 10496, 12032, 11520,  8960,  8448,  9984,  9472,
+     15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568,
+       344,   328,   376,   360,   280,   264,   312,   296,
+       472,   456,   504,   488,   408,   392,   440,   424,
+        88,    72,   120,   104,    24,     8,    56,    40,
+       216,   200,   248,   232,   152,   136,   184,   168,
+      1376,  1312,  1504,  1440,  1120,  1056,  1248,  1184,
+      1888,  1824,  2016,  1952,  1632,  1568,  1760,  1696,
+       688,   656,   752,   720,   560,   528,   624,   592,
+       944,   912,  1008,   976,   816,   784,   880,   848
+};
+
+/*
+ * Position of the highest set bit of (x), for 0 < x < 256, with 0 and 1
+ *  both mapping to zero. This is the µ-law exponent of ((sample + bias) >> 7)
+ *  and the A-law segment of ((magnitude >> 3) >> 4).
+ */
+static const Uint8 exp_lut[256] = {
+    0,0,1,1,2,2,2,2,3,3,3,3,3,3,3,3,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7
+};
+
+
+static void expand(const Sint16 *table, Sint16 *dst,
+                   const Uint8 *src, Uint32 count)
+{
+    /* back to front, so (dst) may start at (src). */
+    dst += count;
+    src += count;
+
+    while (count >= 8)
+    {
+        dst -= 8;
+        src -= 8;
+        dst[7] = table[src[7]];
+        dst[6] = table[src[6]];
+        dst[5] = table[src[5]];
+        dst[4] = table[src[4]];
+        dst[3] = table[src[3]];
+        dst[2] = table[src[2]];
+        dst[1] = table[src[1]];
+        dst[0] = table[src[0]];
+        count -= 8;
+    } /* while */
+
+    while (count--)
+        *(--dst) = table[*(--src)];
+} /* expand */
+
+
+/* This is declared in the internal header. */
+void __Sound_ULawToLinear(Sint16 *dst, const Uint8 *src, Uint32 count)
+{
+    expand(ulaw_to_linear, dst, src, count);
+} /* __Sound_ULawToLinear */
+
+
+/* This is declared in the internal header. */
+void __Sound_ALawToLinear(Sint16 *dst, const Uint8 *src, Uint32 count)
+{
+    expand(alaw_to_linear, dst, src, count);
+} /* __Sound_ALawToLinear */
+
+
+/*
+ * Linear to µ-law, after Craig Reese and Joe Campbell's public domain
+ *  routine (which follows CCITT Recommendation G.711), reworked to avoid
+ *  branches. (sample) must already be in 16-bit range.
+ */
+static SDL_INLINE Uint8 linear_to_ulaw(Sint32 sample)
+{
+    const Sint32 sign = (sample >> 8) & 0x80;
+    Sint32 mag = (sample < 0) ? -sample : sample;
+    int exponent;
+
+    mag = SDL_min(mag, 32635) + 0x84;  /* clip, then add the bias. */
+    exponent = exp_lut[(mag >> 7) & 0xFF];
+    return (Uint8) ~(sign | (exponent << 4) | ((mag >> (exponent + 3)) & 0x0F));
+} /* linear_to_ulaw */
+
+
+/*
+ * Linear to A-law, after the Sun reference code's linear2alaw(), with the
+ *  segment search replaced by a table lookup. (sample) must already be in
+ *  16-bit range.
+ */
+static SDL_INLINE Uint8 linear_to_alaw(Sint32 sample)
+{
+    Sint32 linear = sample >> 3;
+    const Uint8 mask = (linear >= 0) ? 0xD5 : 0x55;
+    int seg;
+
+    if (linear < 0)
+        linear = -linear - 1;
+
+    if (linear > 0xFFF)  /* out of range, return maximum value. */
+        return (Uint8) (0x7F ^ mask);
+
+    seg = exp_lut[linear >> 4];
+    return (Uint8) (((seg << 4) | ((linear >> SDL_max(seg, 1)) & 0x0F)) ^ mask);
+} /* linear_to_alaw */
+
+
+#define CLAMP16(x) (SDL_max(SDL_min((x), 32767), -32768))
+
+/* This is declared in the internal header. */
+void __Sound_LinearToULaw(Uint8 *dst, Uint32 dststride, const Sint32 *src,
+                          Uint32 count, int shift)
+{
+    Uint32 i;
+    for (i = 0; i < count; i++, dst += dststride)
+        *dst = linear_to_ulaw(CLAMP16(src[i] * (1 << shift)));
+} /* __Sound_LinearToULaw */
+
+
+/* This is declared in the internal header. */
+void __Sound_LinearToALaw(Uint8 *dst, Uint32 dststride, const Sint32 *src,
+                          Uint32 count, int shift)
+{
+    Uint32 i;
+    for (i = 0; i < count; i++, dst += dststride)
+        *dst = linear_to_alaw(CLAMP16(src[i] * (1 << shift)));
+} /* __Sound_LinearToALaw */
+
+/* end of SDL_sound_g711.c ... */
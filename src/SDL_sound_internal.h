@@ -95,9 +95,11 @@ typedef struct __SOUND_DECODERFUNCTIONS__
     const Sound_DecoderInfo info;
 
         /*
-         * This is called during the Sound_Init() function. Use this to
-         *  set up any global state that your decoder needs, such as
-         *  initializing an external library, etc.
+         * This is called the first time a sample might be handed to this
+         *  decoder (or from Sound_InitDecoders()), not in Sound_Init(), and
+         *  never from two threads at once. Use this to set up any global
+         *  state that your decoder needs, such as initializing an external
+         *  library, etc.
          *
          * Return non-zero if initialization is successful, zero if there's
          *  a fatal error. If this method fails, then this decoder is
@@ -146,6 +148,21 @@ typedef struct __SOUND_DECODERFUNCTIONS__
          *    void *buffer;        (offlimits until read() method)
          *    Uint32 buffer_size;  (offlimits until read() method)
          *    void *decoder_private; (read and write access)
+         *    Sint32 total_time;   (please fill this in, -1 if unknown)
+         *    int accurate_seek;   (set non-zero if seek() lands exactly on
+         *                          the requested frame, so that decoding
+         *                          from there matches decoding straight
+         *                          through. Sound_DecodeAllParallel() needs
+         *                          this.)
+         *    int probe_only;      (read only. If non-zero, this is for
+         *                          Sound_ProbeInfo(): close() comes right
+         *                          after, with nothing read in between, so
+         *                          skip any setup only decoding needs.)
+         *    Uint32 block_frames; (if the decoder works in fixed-size pieces,
+         *                          the size of one in sample frames, so
+         *                          Sound_SetAutoBufferSize() can make the
+         *                          buffer a whole number of them. Leave it
+         *                          zero if there's no such thing.)
          *
          * in rest of Sound_Sample:
          *    void *opaque;        (this was internal section, above)
@@ -237,24 +254,133 @@ typedef struct __SOUND_DECODERFUNCTIONS__
          *  continue as if nothing happened.
          */
     int (*seek)(Sound_Sample *sample, Uint32 ms);
+
+        /*
+         * Take a quick look at the first few bytes of a stream, and decide
+         *  if this decoder should bother with a full open(). (header) holds
+         *  up to SOUND_PROBE_BYTES bytes from the start of the stream, (len)
+         *  says how many are really there, and (ext) is the same hint that
+         *  open() gets, and may be NULL.
+         *
+         * Return zero if the data doesn't look like yours, non-zero if it
+         *  might be. This only decides the order; open() still makes the
+         *  final call, and a decoder that said no is still tried once every
+         *  decoder that said yes has failed, so a wrong "no" costs time, not
+         *  the file. Don't touch any global state in here; this may be
+         *  called before init() has been.
+         *
+         * This can be NULL if your format has no recognizable signature, in
+         *  which case open() is always tried.
+         */
+    int (*probe)(const Uint8 *header, Uint32 len, const char *ext);
+
+        /*
+         * Like read(), but instead of copying up to (len) bytes into
+         *  internal->buffer, point (*data) at them where they already sit
+         *  in memory, and move past them. This is only called when no
+         *  conversion is needed, so the data must be in sample->actual's
+         *  format as-is. Set flags and return a byte count the same as
+         *  read() does.
+         *
+         * If this sample can't be viewed (it isn't memory-backed, or it's
+         *  compressed...), leave (*data) as NULL and return zero without
+         *  touching anything; SDL_sound will call read() instead.
+         *
+         * This can be NULL if your decoder never has data to view.
+         *  __Sound_ViewRW() does most of the work for uncompressed formats.
+         */
+    Uint32 (*view)(Sound_Sample *sample, const Uint8 **data, Uint32 len);
+
+        /*
+         * Like seek(), but to sample frame (frame), counted at
+         *  sample->actual.rate, instead of to a millisecond. This is what
+         *  Sound_SeekFrames() uses, so a decoder that can land on an exact
+         *  frame should do so here without going through milliseconds.
+         *
+         * This can be NULL, in which case SDL_sound calls seek() with the
+         *  millisecond at or before (frame), and if the decoder sets
+         *  internal->accurate_seek, reads and throws away the few frames
+         *  between there and (frame).
+         */
+    int (*seek_frames)(Sound_Sample *sample, Uint64 frame);
+
+        /*
+         * Roughly how many bytes your decoder has allocated for this
+         *  sample: its private state, tables, index, input buffers...
+         *  but not internal->buffer, which SDL_sound counts itself. This is
+         *  for Sound_GetMemoryUsage(), so a close guess is fine.
+         *
+         * This can be NULL if your decoder's state is small enough not to
+         *  be worth counting.
+         */
+    Uint32 (*memory_usage)(Sound_Sample *sample);
 } Sound_DecoderFunctions;
 
+/* How many bytes of a stream get passed to a decoder's probe() method. */
+#define SOUND_PROBE_BYTES 64
+
 
 typedef void (*MixFunc)(float *dst, void *src, Uint32 frames, float *gains);
 
+/* SDL_AudioStream showed up in SDL 2.0.7. */
+#define SOUND_HAVE_AUDIOSTREAM SDL_VERSION_ATLEAST(2, 0, 7)
+
+/* converts (len) bytes at (buf) in place; returns the new length. */
+typedef Uint32 (*Sound_FastConvertFunc)(Uint8 *buf, Uint32 len);
+
 typedef struct __SOUND_SAMPLEINTERNAL__
 {
     Sound_Sample *next;
     Sound_Sample *prev;
+    Uint32 list_shard;  /* which of the sample lists next and prev are in. */
     SDL_RWops *rw;
     const Sound_DecoderFunctions *funcs;
     SDL_AudioCVT sdlcvt;
+    Sound_FastConvertFunc fastcvt;  /* used instead of sdlcvt if not NULL. */
     void *buffer;
     Uint32 buffer_size;
+    Uint32 buffer_capacity;  /* bytes actually allocated for sample->buffer. */
     void *decoder_private;
     Sint32 total_time;
-    Uint32 mix_position;
+    int accurate_seek;  /* decoder sets this if seek() is frame-exact. */
+    Uint64 frame_pos;   /* Sound_TellFrames(), at sample->desired.rate. */
+    char *filename;     /* NULL unless opened with Sound_NewSampleFromFile. */
+    Uint32 mix_position;   /* bytes of sample->buffer already mixed. */
+    Uint32 mix_available;  /* bytes of sample->buffer decoded for mixing. */
+    float mix_gains[MAX_CHANNELS];
+    int mix_active;
+    Sound_Sample *mix_next;
     MixFunc mix;
+    struct __SOUND_STREAM__ *stream;  /* non-NULL while streaming. */
+    struct __SOUND_RESAMPLER__ *resampler;  /* non-NULL if we resample. */
+    struct __SOUND_SHAREDPCM__ *shared_pcm;  /* buffer shared with instances. */
+    Uint32 shared_pos;  /* an instance's play position in shared_pcm. */
+    int decoded_all;    /* sample->buffer holds the whole decoded sample. */
+    Sound_Stats *stats;  /* NULL unless stats are on. Times are in ticks. */
+    Sound_ResampleQuality resample_quality;
+    Sound_DecodeQuality decode_quality;  /* for the decoder's open(). */
+    int probe_only;  /* a Sound_ProbeInfo() stand-in; only open() and close(). */
+    Sint64 open_pos;  /* rw's position when the decoder opened it. */
+    const char *open_ext;  /* the decoder's own copy of the (ext) it got. */
+    int suspended;    /* Sound_Suspend() closed the decoder; no buffers. */
+    Uint32 block_frames;    /* decoder's natural read size; zero if none. */
+    Uint32 autobuf_max;     /* Sound_SetAutoBufferSize(); zero if it's off. */
+    Uint32 autobuf_calls;   /* Sound_Decode() calls in this window... */
+    Uint64 autobuf_bytes;   /* ...the bytes they handed out... */
+    Uint64 autobuf_ticks;   /* ...and the time spent inside them. */
+    Uint64 autobuf_start;   /* performance counter when the window began. */
+    Sint32 loop_count;      /* Sound_SetLoop() wraps left; -1 forever, 0 off. */
+    Uint64 loop_start;      /* loop region, in frames like frame_pos... */
+    Uint64 loop_end;        /* ...zero to loop at EOF. */
+    Uint8 *loop_head;       /* first buffer of the region, decoded once... */
+    Uint32 loop_head_len;   /* ...its size in bytes, zero until fetched... */
+    Uint32 loop_head_pos;   /* ...how much of it this wrap handed out... */
+    int loop_head_all;      /* ...1 if it's the whole region, 2 if that hit EOF. */
+    int loop_seek_pending;  /* decoder is still at the end; seek after the head. */
+#if SOUND_HAVE_AUDIOSTREAM
+    SDL_AudioStream *audiostream;  /* converts instead of sdlcvt if not NULL. */
+    int audiostream_flushed;  /* decoder hit EOF; just draining the stream. */
+#endif
 } Sound_SampleInternal;
 
 
@@ -273,6 +399,7 @@ typedef struct __SOUND_SAMPLEINTERNAL__
 #define ERR_PREV_ERROR           "Previous decoding already caused an error"
 #define ERR_PREV_EOF             "Previous decoding already triggered EOF"
 #define ERR_CANNOT_SEEK          "Sample is not seekable"
+#define ERR_NOT_DECODED          "Sample is not fully decoded"
 
 /*
  * Call this to set the message returned by Sound_GetError().
@@ -283,12 +410,258 @@ typedef struct __SOUND_SAMPLEINTERNAL__
  */
 void __Sound_SetError(const char *err);
 
+/*
+ * All of SDL_sound's memory, and that of the decoders and the libraries
+ *  bundled with them, goes through these, so Sound_SetAllocator() can
+ *  redirect it. They behave like SDL_malloc() and friends; use them instead
+ *  of those everywhere except for memory that SDL itself will free.
+ */
+void *__Sound_Malloc(size_t len);
+void *__Sound_Calloc(size_t nmemb, size_t len);
+void *__Sound_Realloc(void *ptr, size_t len);
+void __Sound_Free(void *ptr);
+char *__Sound_StrDup(const char *str);
+
 /*
  * Call this to convert milliseconds to an actual byte position, based on
  *  audio data characteristics.
  */
 Uint32 __Sound_convertMsToBytePos(Sound_AudioInfo *info, Uint32 ms);
 
+/*
+ * Convert milliseconds to a sample frame count at (rate) Hz. This is exact
+ *  integer math, so it always agrees with the same conversion done elsewhere;
+ *  use this instead of float math in seek() methods.
+ */
+Uint64 __Sound_convertMsToFrames(Uint32 rate, Uint32 ms);
+
+/*
+ * Byte position of sample frame (frame) in (info)'s format; the frame-based
+ *  counterpart to __Sound_convertMsToBytePos().
+ */
+Uint64 __Sound_convertFramesToBytePos(const Sound_AudioInfo *info, Uint64 frame);
+
+/*
+ * Take (sample) off the mixer's playing list, if it's on there. This is
+ *  called by Sound_FreeSample(), so the mixer never touches a dead sample.
+ */
+void __Sound_MixRemoveSample(Sound_Sample *sample);
+
+/*
+ * Wrap (src) in an SDL_RWops that reads ahead in blocks of (bufsize) bytes.
+ *  Closing the returned RWops closes (src), too. Returns NULL and sets the
+ *  error message on failure, in which case (src) is untouched.
+ */
+SDL_RWops *__Sound_RWBuffered(SDL_RWops *src, Uint32 bufsize);
+
+/*
+ * Map (fname) into memory read-only and return a constant-memory SDL_RWops
+ *  for it, which unmaps the file when closed. Returns NULL without setting
+ *  an error message if the file can't be mapped, or if this platform can't
+ *  map files at all; fall back to SDL_RWFromFile() in that case.
+ */
+SDL_RWops *__Sound_RWFromMappedFile(const char *fname);
+
+/*
+ * If (rw) is one of SDL's memory-backed RWops, return a pointer to its
+ *  current read position and put the number of bytes left in (*avail).
+ *  Decoders can use this to read data in place instead of copying it out.
+ *  The stream position isn't changed. Returns NULL for any other RWops.
+ */
+const Uint8 *__Sound_RWMemoryView(SDL_RWops *rw, size_t *avail);
+
+/*
+ * For a decoder's view() method: if internal->rw is memory-backed, point
+ *  (*data) at up to (len) bytes at its current position, seek past them,
+ *  and return how many there are. Otherwise, (*data) is set to NULL and
+ *  this returns zero.
+ */
+Uint32 __Sound_ViewRW(Sound_Sample *sample, const Uint8 **data, Uint32 len);
+
+/*
+ * Decide whether a zero-byte read from (rw) meant the end of the stream, or
+ *  just that a non-blocking stream (a socket, a pipe...) has nothing for us
+ *  yet. A stream that knows its size and hasn't got there yet is the latter,
+ *  so this returns zero. A stream of unknown size can't tell us, so that's
+ *  always the end, same as the decoders have always assumed.
+ */
+int __Sound_RWAtEOF(SDL_RWops *rw);
+
+/*
+ * Input read ahead of a decoder library that treats a short read as the end
+ *  of the stream, so we can check there's a whole frame's worth of bytes
+ *  before letting it decode, and report SOUND_SAMPLEFLAG_EAGAIN otherwise.
+ */
+typedef struct
+{
+    Uint8 *data;
+    Uint32 alloc;  /* size of (data). */
+    Uint32 pos;    /* next byte of (data) to hand out. */
+    Uint32 len;    /* valid bytes in (data). */
+    int eof;       /* non-zero once __Sound_RWAtEOF() said so. */
+} Sound_InputBuffer;
+
+/*
+ * Make sure (in) can hold (bufsize) bytes, keeping anything it's holding
+ *  now. (in) starts out zeroed. Returns zero and sets the error message if
+ *  out of memory. __Sound_InputFree() gives the memory back.
+ */
+int __Sound_InputReserve(Sound_InputBuffer *in, Uint32 bufsize);
+void __Sound_InputFree(Sound_InputBuffer *in);
+
+/*
+ * Read from (rw) until (in) holds at least (want) bytes, (rw) runs dry, or
+ *  (in) is full. Never waits. Returns how many bytes are buffered; if that's
+ *  less than (want) and (in->eof) isn't set, the stream is just behind.
+ */
+Uint32 __Sound_InputFill(SDL_RWops *rw, Sound_InputBuffer *in, Uint32 want);
+
+/*
+ * Hand out (len) bytes from (in), refilling it from (rw) as needed. This is
+ *  for the decoder library's read callback. It never waits: if (rw) runs
+ *  dry, it returns fewer than (len) bytes, and (in->eof) says whether that
+ *  was the end of the stream or the stream is behind (or failed).
+ */
+size_t __Sound_InputRead(SDL_RWops *rw, Sound_InputBuffer *in,
+                         void *ptr, size_t len);
+
+/*
+ * Seek the decoder's view of (rw), accounting for what (in) has read ahead.
+ *  Relative seeks that stay in the buffer don't touch (rw). Returns non-zero
+ *  on success.
+ */
+int __Sound_InputSeek(SDL_RWops *rw, Sound_InputBuffer *in,
+                      Sint64 offset, int whence);
+
+/*
+ * Wrap (src) in an SDL_RWops that adds its reads, seeks, bytes and time
+ *  spent (in performance counter ticks) to (stats). Returns NULL on error.
+ *  Closing the new RWops closes (src).
+ */
+SDL_RWops *__Sound_RWCounted(SDL_RWops *src, Sound_Stats *stats);
+
+/*
+ * Call the decoder's read() method, and count the time it takes if stats
+ *  are on. Everything that feeds decoded audio into a sample uses this.
+ */
+Uint32 __Sound_DecoderRead(Sound_Sample *sample);
+
+/*
+ * What Sound_SetModuleMixThreads() was last set to; the ModPlug decoder
+ *  hands this to each module it opens.
+ */
+int __Sound_ModuleMixThreads(void);
+
+/*
+ * Sound_FlushPatchCache(); throws out the GUS patches the ModPlug decoder
+ *  loaded for MIDI and ABC songs, except the ones songs are still using.
+ */
+void __Sound_FlushModulePatches(void);
+
+/*
+ * Pick a single-pass converter from (src) to (dst) format, or NULL if
+ *  there isn't one and SDL_AudioCVT should do it. The output never grows by
+ *  more than the matching SDL_AudioCVT's len_mult.
+ */
+Sound_FastConvertFunc __Sound_ChooseFastConvert(const Sound_AudioInfo *src,
+                                                const Sound_AudioInfo *dst);
+
+/*
+ * Byteswap the 16-bit samples in (len) bytes at (buf), in place, with SIMD
+ *  where we have it. Decoders of big-endian PCM use this to hand out native
+ *  samples, so they don't need a conversion pass later.
+ */
+void __Sound_Swap16(void *buf, Uint32 len);
+
+/*
+ * Nonzero if a decoder of 16-bit PCM in (fileformat) should swap it to
+ *  AUDIO_S16SYS as it reads: the file isn't native and the app didn't ask
+ *  for that exact format.
+ */
+#define __Sound_WantSwap16(sample, fileformat) \
+    (((fileformat) != AUDIO_S16SYS) && \
+     ((sample)->desired.format != (fileformat)))
+
+/*
+ * Set up our own rate conversion from sample->actual to (desired), at
+ *  (quality). Returns the len_mult the decode buffer needs, or zero on
+ *  error. If SDL_AudioCVT should handle this one, internal->resampler is
+ *  left NULL and this returns 1.
+ */
+Uint32 __Sound_SetupResampler(Sound_Sample *sample,
+                              const Sound_AudioInfo *desired,
+                              Sound_ResampleQuality quality);
+
+/*
+ * Decode and resample up to (frames) frames of the desired format into
+ *  (buf), which has room for (bufsize) bytes. Returns bytes written, and
+ *  sets the sample's flags like a decoder's read() method would.
+ */
+Uint32 __Sound_Resample(Sound_Sample *sample, Uint8 *buf, Uint32 bufsize,
+                        Uint32 frames);
+
+/* Forget buffered audio, after a seek or rewind. */
+void __Sound_ResetResampler(Sound_Sample *sample);
+
+void __Sound_FreeResampler(Sound_Sample *sample);
+
+/* Bytes the sample's resampler has allocated; zero if it has none. */
+Uint32 __Sound_ResamplerMemory(const Sound_Sample *sample);
+
+
+/*
+ * Make a sample that's handled by (funcs), without looking for a decoder.
+ *  internal->decoder_private is set to (decoder_private) before (funcs)'s
+ *  open() method is called. (rw) is closed if this fails.
+ */
+Sound_Sample *__Sound_NewSampleWithDecoder(SDL_RWops *rw,
+                                           const Sound_DecoderFunctions *funcs,
+                                           void *decoder_private,
+                                           Sound_AudioInfo *desired,
+                                           Uint32 bufferSize);
+
+/*
+ * G.711 codecs, in SDL_sound_g711.c. The expanders turn (count) 8-bit
+ *  µ-law or A-law bytes into 16-bit samples; (dst) may start at the same
+ *  address as (src), so 8-bit data can be read into the front of a buffer
+ *  and expanded where it sits. The compressors take (count) samples from
+ *  (src), shift each left by (shift), clamp to 16 bits and write one byte
+ *  every (dststride) bytes of (dst).
+ */
+void __Sound_ULawToLinear(Sint16 *dst, const Uint8 *src, Uint32 count);
+void __Sound_ALawToLinear(Sint16 *dst, const Uint8 *src, Uint32 count);
+void __Sound_LinearToULaw(Uint8 *dst, Uint32 dststride, const Sint32 *src,
+                          Uint32 count, int shift);
+void __Sound_LinearToALaw(Uint8 *dst, Uint32 dststride, const Sint32 *src,
+                          Uint32 count, int shift);
+
+/* The decoded PCM cache, in SDL_sound_cache.c. */
+int __Sound_InitCache(void);
+void __Sound_QuitCache(void);
+int __Sound_CacheEnabled(void);
+Sound_Sample *__Sound_NewSampleFromFileCached(const char *filename,
+                                              const char *ext,
+                                              Sound_AudioInfo *desired,
+                                              Uint32 bufferSize);
+
+/* Sound_NewInstance() support, also in SDL_sound_cache.c. */
+int __Sound_IsInstance(const Sound_Sample *sample);
+void __Sound_ReleaseSharedPCM(struct __SOUND_SHAREDPCM__ *pcm);
+
+/*
+ * Point an instance's sample->buffer at up to (len) bytes of the shared
+ *  PCM and move its cursor past them. Returns the number of bytes.
+ */
+Uint32 __Sound_InstanceDecode(Sound_Sample *sample, Uint32 len);
+
+/*
+ * Sound_NewSampleResident() support, in SDL_sound_resident.c. The instance
+ *  is a whole new sample, decoding its own way through the same bytes.
+ */
+int __Sound_IsResident(const Sound_Sample *sample);
+Sound_Sample *__Sound_NewResidentInstance(Sound_Sample *sample,
+                                          Uint32 bufferSize);
+
 
 /* These get used all over for lessening code clutter. */
 #define BAIL_MACRO(e, r) { __Sound_SetError(e); return r; }
@@ -0,0 +1,548 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * This is the mixer. It owns a list of playing Sound_Samples, decodes more
+ *  of each one as needed from SDL's audio callback, and sums them into a
+ *  stereo float bus, which is handed to SDL as-is.
+ *
+ * Each sample gets a MixFunc picked for its desired format when it starts
+ *  playing, so the inner loop never has to look at the format. Sint16 and
+ *  float, mono or stereo, get SSE2 or NEON kernels where we have them.
+ *
+ * Since we feed the output device directly, samples have to be decoded at
+ *  the mixer's rate; SDL_sound's usual on-the-fly conversion takes care of
+ *  that if you ask for it in your desired format.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SOUND_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SOUND_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define MIX_CHANNELS 2  /* the bus is always stereo. */
+
+static SDL_AudioDeviceID mix_device = 0;
+static SDL_AudioSpec mix_spec;
+static Sound_Sample *mix_playing = NULL;  /* linked via internal->mix_next. */
+
+
+/*
+ * The mix kernels. One per source format and channel count. These just
+ *  scale each sample point to [-1.0, 1.0] and accumulate into the bus.
+ */
+#define MIX_CVT_U8(x)  ((((float) (x)) - 128.0f) * (1.0f / 128.0f))
+#define MIX_CVT_S8(x)  (((float) (x)) * (1.0f / 128.0f))
+#define MIX_CVT_S16(x) (((float) (x)) * (1.0f / 32768.0f))
+#define MIX_CVT_S32(x) (((float) (x)) * (1.0f / 2147483648.0f))
+#define MIX_CVT_F32(x) (x)
+
+#define MIX_KERNELS(name, type, cvt) \
+    static void mix_##name##_mono(float *dst, void *_src, Uint32 frames, \
+                                  float *gains) \
+    { \
+        const type *src = (const type *) _src; \
+        const float gl = gains[0]; \
+        const float gr = gains[1]; \
+        Uint32 i; \
+        for (i = 0; i < frames; i++, dst += 2) \
+        { \
+            const float val = cvt(src[i]); \
+            dst[0] += val * gl; \
+            dst[1] += val * gr; \
+        } \
+    } \
+    static void mix_##name##_stereo(float *dst, void *_src, Uint32 frames, \
+                                    float *gains) \
+    { \
+        const type *src = (const type *) _src; \
+        const float gl = gains[0]; \
+        const float gr = gains[1]; \
+        Uint32 i; \
+        for (i = 0; i < frames; i++, dst += 2, src += 2) \
+        { \
+            dst[0] += cvt(src[0]) * gl; \
+            dst[1] += cvt(src[1]) * gr; \
+        } \
+    }
+
+MIX_KERNELS(u8, Uint8, MIX_CVT_U8)
+MIX_KERNELS(s8, Sint8, MIX_CVT_S8)
+MIX_KERNELS(s16, Sint16, MIX_CVT_S16)
+MIX_KERNELS(s32, Sint32, MIX_CVT_S32)
+MIX_KERNELS(f32, float, MIX_CVT_F32)
+
+#undef MIX_KERNELS
+
+
+/*
+ * Vector versions of the Sint16 and float kernels, which is what nearly
+ *  everything decodes to. Each does as many whole vectors as it can and
+ *  leaves the last few frames to the scalar kernel above. The gains are
+ *  laid out (left, right, left, right) to match the bus, with the Sint16
+ *  scale folded in.
+ */
+#if SOUND_HAVE_SSE2
+#define MIX_SIMD 1
+
+static void mix_s16_mono_simd(float *dst, void *_src, Uint32 frames,
+                              float *gains)
+{
+    const Sint16 *src = (const Sint16 *) _src;
+    const __m128 g = _mm_setr_ps(gains[0] * (1.0f / 32768.0f),
+                                 gains[1] * (1.0f / 32768.0f),
+                                 gains[0] * (1.0f / 32768.0f),
+                                 gains[1] * (1.0f / 32768.0f));
+    Uint32 i;
+
+    for (i = 0; i + 8 <= frames; i += 8, dst += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+        const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_unpacklo_ps(lo, lo), g)));
+        _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_mul_ps(_mm_unpackhi_ps(lo, lo), g)));
+        _mm_storeu_ps(dst + 8, _mm_add_ps(_mm_loadu_ps(dst + 8), _mm_mul_ps(_mm_unpacklo_ps(hi, hi), g)));
+        _mm_storeu_ps(dst + 12, _mm_add_ps(_mm_loadu_ps(dst + 12), _mm_mul_ps(_mm_unpackhi_ps(hi, hi), g)));
+    } /* for */
+
+    mix_s16_mono(dst, (void *) (src + i), frames - i, gains);
+} /* mix_s16_mono_simd */
+
+
+static void mix_s16_stereo_simd(float *dst, void *_src, Uint32 frames,
+                                float *gains)
+{
+    const Sint16 *src = (const Sint16 *) _src;
+    const __m128 g = _mm_setr_ps(gains[0] * (1.0f / 32768.0f),
+                                 gains[1] * (1.0f / 32768.0f),
+                                 gains[0] * (1.0f / 32768.0f),
+                                 gains[1] * (1.0f / 32768.0f));
+    Uint32 i;
+
+    for (i = 0; i + 4 <= frames; i += 4, dst += 8)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *) (src + (i * 2)));
+        const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+        const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(lo, g)));
+        _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_mul_ps(hi, g)));
+    } /* for */
+
+    mix_s16_stereo(dst, (void *) (src + (i * 2)), frames - i, gains);
+} /* mix_s16_stereo_simd */
+
+
+static void mix_f32_mono_simd(float *dst, void *_src, Uint32 frames,
+                              float *gains)
+{
+    const float *src = (const float *) _src;
+    const __m128 g = _mm_setr_ps(gains[0], gains[1], gains[0], gains[1]);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= frames; i += 4, dst += 8)
+    {
+        const __m128 x = _mm_loadu_ps(src + i);
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_unpacklo_ps(x, x), g)));
+        _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_mul_ps(_mm_unpackhi_ps(x, x), g)));
+    } /* for */
+
+    mix_f32_mono(dst, (void *) (src + i), frames - i, gains);
+} /* mix_f32_mono_simd */
+
+
+static void mix_f32_stereo_simd(float *dst, void *_src, Uint32 frames,
+                                float *gains)
+{
+    const float *src = (const float *) _src;
+    const __m128 g = _mm_setr_ps(gains[0], gains[1], gains[0], gains[1]);
+    Uint32 i;
+
+    for (i = 0; i + 2 <= frames; i += 2, dst += 4)
+    {
+        const __m128 x = _mm_loadu_ps(src + (i * 2));
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(x, g)));
+    } /* for */
+
+    mix_f32_stereo(dst, (void *) (src + (i * 2)), frames - i, gains);
+} /* mix_f32_stereo_simd */
+
+#elif SOUND_HAVE_NEON
+#define MIX_SIMD 1
+
+static SDL_INLINE float32x4_t mix_neon_gains(const float *gains, const float scale)
+{
+    const float g[4] = { gains[0] * scale, gains[1] * scale,
+                         gains[0] * scale, gains[1] * scale };
+    return vld1q_f32(g);
+} /* mix_neon_gains */
+
+
+static void mix_s16_mono_simd(float *dst, void *_src, Uint32 frames,
+                              float *gains)
+{
+    const Sint16 *src = (const Sint16 *) _src;
+    const float32x4_t g = mix_neon_gains(gains, 1.0f / 32768.0f);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= frames; i += 8, dst += 16)
+    {
+        const int16x8_t x = vld1q_s16(src + i);
+        const float32x4x2_t lo = vzipq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),
+                                           vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))));
+        const float32x4x2_t hi = vzipq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))),
+                                           vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))));
+        vst1q_f32(dst, vmlaq_f32(vld1q_f32(dst), lo.val[0], g));
+        vst1q_f32(dst + 4, vmlaq_f32(vld1q_f32(dst + 4), lo.val[1], g));
+        vst1q_f32(dst + 8, vmlaq_f32(vld1q_f32(dst + 8), hi.val[0], g));
+        vst1q_f32(dst + 12, vmlaq_f32(vld1q_f32(dst + 12), hi.val[1], g));
+    } /* for */
+
+    mix_s16_mono(dst, (void *) (src + i), frames - i, gains);
+} /* mix_s16_mono_simd */
+
+
+static void mix_s16_stereo_simd(float *dst, void *_src, Uint32 frames,
+                                float *gains)
+{
+    const Sint16 *src = (const Sint16 *) _src;
+    const float32x4_t g = mix_neon_gains(gains, 1.0f / 32768.0f);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= frames; i += 4, dst += 8)
+    {
+        const int16x8_t x = vld1q_s16(src + (i * 2));
+        const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(x)));
+        const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(x)));
+        vst1q_f32(dst, vmlaq_f32(vld1q_f32(dst), lo, g));
+        vst1q_f32(dst + 4, vmlaq_f32(vld1q_f32(dst + 4), hi, g));
+    } /* for */
+
+    mix_s16_stereo(dst, (void *) (src + (i * 2)), frames - i, gains);
+} /* mix_s16_stereo_simd */
+
+
+static void mix_f32_mono_simd(float *dst, void *_src, Uint32 frames,
+                              float *gains)
+{
+    const float *src = (const float *) _src;
+    const float32x4_t g = mix_neon_gains(gains, 1.0f);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= frames; i += 4, dst += 8)
+    {
+        const float32x4_t x = vld1q_f32(src + i);
+        const float32x4x2_t xx = vzipq_f32(x, x);
+        vst1q_f32(dst, vmlaq_f32(vld1q_f32(dst), xx.val[0], g));
+        vst1q_f32(dst + 4, vmlaq_f32(vld1q_f32(dst + 4), xx.val[1], g));
+    } /* for */
+
+    mix_f32_mono(dst, (void *) (src + i), frames - i, gains);
+} /* mix_f32_mono_simd */
+
+
+static void mix_f32_stereo_simd(float *dst, void *_src, Uint32 frames,
+                                float *gains)
+{
+    const float *src = (const float *) _src;
+    const float32x4_t g = mix_neon_gains(gains, 1.0f);
+    Uint32 i;
+
+    for (i = 0; i + 2 <= frames; i += 2, dst += 4)
+        vst1q_f32(dst, vmlaq_f32(vld1q_f32(dst), vld1q_f32(src + (i * 2)), g));
+
+    mix_f32_stereo(dst, (void *) (src + (i * 2)), frames - i, gains);
+} /* mix_f32_stereo_simd */
+
+#endif
+
+#if MIX_SIMD
+#define MIX_S16_MONO mix_s16_mono_simd
+#define MIX_S16_STEREO mix_s16_stereo_simd
+#define MIX_F32_MONO mix_f32_mono_simd
+#define MIX_F32_STEREO mix_f32_stereo_simd
+#else
+#define MIX_S16_MONO mix_s16_mono
+#define MIX_S16_STEREO mix_s16_stereo
+#define MIX_F32_MONO mix_f32_mono
+#define MIX_F32_STEREO mix_f32_stereo
+#endif
+
+
+static MixFunc choose_mixfunc(const Sound_AudioInfo *info)
+{
+    const int stereo = (info->channels == 2);
+
+    if ((info->channels != 1) && (info->channels != 2))
+        return NULL;
+
+    switch (info->format)
+    {
+        case AUDIO_U8: return stereo ? mix_u8_stereo : mix_u8_mono;
+        case AUDIO_S8: return stereo ? mix_s8_stereo : mix_s8_mono;
+        case AUDIO_S16SYS: return stereo ? MIX_S16_STEREO : MIX_S16_MONO;
+        case AUDIO_S32SYS: return stereo ? mix_s32_stereo : mix_s32_mono;
+        case AUDIO_F32SYS: return stereo ? MIX_F32_STEREO : MIX_F32_MONO;
+    } /* switch */
+
+    return NULL;  /* everything else needs to be converted first. */
+} /* choose_mixfunc */
+
+
+/*
+ * Mix up to (frames) sample frames of (sample) into (bus). Returns zero if
+ *  the sample is done playing and should come off the list, non-zero
+ *  otherwise. Call this with the audio device locked.
+ */
+static int mix_sample(Sound_Sample *sample, float *bus, Uint32 frames)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 framesize = (SDL_AUDIO_BITSIZE(sample->desired.format) / 8)
+                                * sample->desired.channels;
+    Uint32 mixed = 0;
+
+    while (mixed < frames)
+    {
+        Uint32 avail;
+
+        if (internal->mix_position >= internal->mix_available)
+        {
+            if (sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR))
+                return 0;  /* nothing left, we're done. */
+
+            internal->mix_position = 0;
+            internal->mix_available = Sound_Decode(sample);
+            if ((internal->mix_available == 0) &&
+                ((sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR)) == 0))
+                return 1;  /* EAGAIN; try again next callback. */
+            continue;
+        } /* if */
+
+        avail = (internal->mix_available - internal->mix_position) / framesize;
+        if (avail == 0)  /* partial frame? Drop it. */
+        {
+            internal->mix_position = internal->mix_available;
+            continue;
+        } /* if */
+
+        if (avail > (frames - mixed))
+            avail = frames - mixed;
+
+        internal->mix(bus + (mixed * MIX_CHANNELS),
+                      ((Uint8 *) sample->buffer) + internal->mix_position,
+                      avail, internal->mix_gains);
+
+        internal->mix_position += avail * framesize;
+        mixed += avail;
+    } /* while */
+
+    return 1;
+} /* mix_sample */
+
+
+static void SDLCALL mix_callback(void *userdata, Uint8 *stream, int len)
+{
+    const Uint32 frames = ((Uint32) len) / (sizeof (float) * MIX_CHANNELS);
+    Sound_Sample *prev = NULL;
+    Sound_Sample *sample = mix_playing;
+
+    SDL_memset(stream, '\0', len);
+
+    while (sample != NULL)
+    {
+        Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+        Sound_Sample *next = internal->mix_next;
+
+        if (mix_sample(sample, (float *) stream, frames))
+            prev = sample;
+        else  /* done playing; drop it from the list. */
+        {
+            if (prev == NULL)
+                mix_playing = next;
+            else
+                ((Sound_SampleInternal *) prev->opaque)->mix_next = next;
+
+            internal->mix_next = NULL;
+            internal->mix_active = 0;
+        } /* else */
+
+        sample = next;
+    } /* while */
+} /* mix_callback */
+
+
+/* unlink (sample) from the playing list. Call with the device locked. */
+static void mix_unlink(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Sound_Sample *prev = NULL;
+    Sound_Sample *i;
+
+    for (i = mix_playing; i != NULL; i = ((Sound_SampleInternal *) i->opaque)->mix_next)
+    {
+        if (i == sample)
+        {
+            if (prev == NULL)
+                mix_playing = internal->mix_next;
+            else
+                ((Sound_SampleInternal *) prev->opaque)->mix_next = internal->mix_next;
+            break;
+        } /* if */
+        prev = i;
+    } /* for */
+
+    internal->mix_next = NULL;
+    internal->mix_active = 0;
+} /* mix_unlink */
+
+
+int Sound_MixInit(Uint32 rate, Uint16 frames)
+{
+    SDL_AudioSpec want;
+
+    BAIL_IF_MACRO(mix_device != 0, ERR_IS_INITIALIZED, 0);
+    BAIL_IF_MACRO(rate == 0, ERR_INVALID_ARGUMENT, 0);
+
+    SDL_zero(want);
+    want.freq = (int) rate;
+    want.format = AUDIO_F32SYS;
+    want.channels = MIX_CHANNELS;
+    want.samples = frames ? frames : 4096;
+    want.callback = mix_callback;
+
+    /* no allowed changes; SDL converts the bus if the hardware differs. */
+    mix_device = SDL_OpenAudioDevice(NULL, 0, &want, &mix_spec, 0);
+    BAIL_IF_MACRO(mix_device == 0, SDL_GetError(), 0);
+
+    mix_playing = NULL;
+    SDL_PauseAudioDevice(mix_device, 0);
+    return 1;
+} /* Sound_MixInit */
+
+
+void Sound_MixQuit(void)
+{
+    if (mix_device == 0)
+        return;
+
+    SDL_CloseAudioDevice(mix_device);  /* callback won't run after this. */
+    mix_device = 0;
+
+    while (mix_playing != NULL)
+        mix_unlink(mix_playing);
+} /* Sound_MixQuit */
+
+
+int Sound_MixPlay(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    MixFunc mix;
+
+    BAIL_IF_MACRO(mix_device == 0, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(sample->desired.rate != (Uint32) mix_spec.freq,
+                  ERR_UNSUPPORTED_FORMAT, 0);
+
+    mix = choose_mixfunc(&sample->desired);
+    BAIL_IF_MACRO(mix == NULL, ERR_UNSUPPORTED_FORMAT, 0);
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+
+    /* not in the audio callback; reopening a decoder is slow. */
+    BAIL_IF_MACRO(!Sound_Resume(sample), NULL, 0);
+
+    SDL_LockAudioDevice(mix_device);
+    if (!internal->mix_active)
+    {
+        internal->mix = mix;
+
+        /* predecoded with Sound_DecodeAll()? Play what's in the buffer. */
+        if ( (sample->flags & SOUND_SAMPLEFLAG_EOF) &&
+             (internal->mix_available == 0) )
+        {
+            internal->mix_position = 0;
+            internal->mix_available = sample->buffer_size;
+        } /* if */
+
+        internal->mix_next = mix_playing;
+        internal->mix_active = 1;
+        mix_playing = sample;
+    } /* if */
+    SDL_UnlockAudioDevice(mix_device);
+
+    return 1;
+} /* Sound_MixPlay */
+
+
+int Sound_MixStop(Sound_Sample *sample)
+{
+    BAIL_IF_MACRO(mix_device == 0, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    SDL_LockAudioDevice(mix_device);
+    mix_unlink(sample);
+    SDL_UnlockAudioDevice(mix_device);
+    return 1;
+} /* Sound_MixStop */
+
+
+int Sound_MixIsPlaying(Sound_Sample *sample)
+{
+    int retval;
+
+    if ((mix_device == 0) || (sample == NULL))
+        return 0;
+
+    SDL_LockAudioDevice(mix_device);
+    retval = ((Sound_SampleInternal *) sample->opaque)->mix_active;
+    SDL_UnlockAudioDevice(mix_device);
+    return retval;
+} /* Sound_MixIsPlaying */
+
+
+int Sound_MixSetGain(Sound_Sample *sample, float left, float right)
+{
+    Sound_SampleInternal *internal;
+
+    BAIL_IF_MACRO(mix_device == 0, ERR_NOT_INITIALIZED, 0);
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    internal = (Sound_SampleInternal *) sample->opaque;
+    SDL_LockAudioDevice(mix_device);
+    internal->mix_gains[0] = left;
+    internal->mix_gains[1] = right;
+    SDL_UnlockAudioDevice(mix_device);
+
+    return 1;
+} /* Sound_MixSetGain */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_MixRemoveSample(Sound_Sample *sample)
+{
+    if (mix_device == 0)
+        return;
+
+    SDL_LockAudioDevice(mix_device);
+    if (((Sound_SampleInternal *) sample->opaque)->mix_active)
+        mix_unlink(sample);
+    SDL_UnlockAudioDevice(mix_device);
+} /* __Sound_MixRemoveSample */
+
+/* end of SDL_sound_mixer.c ... */
+
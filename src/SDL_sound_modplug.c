@@ -66,16 +66,46 @@ static int MODPLUG_init(void)
 
 static void MODPLUG_quit(void)
 {
-    /* it's a no-op. */
+    ModPlug_Quit();  /* frees the GUS patches that MIDI files loaded. */
 } /* MODPLUG_quit */
 
 
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_FlushModulePatches(void)
+{
+    ModPlug_FlushPatchCache();  /* safe even if MODPLUG_init() never ran. */
+} /* __Sound_FlushModulePatches */
+
+
 /*
  * Most MOD files I've seen have tended to be a few hundred KB, even if some
  * of them were much smaller than that.
  */
 #define CHUNK_SIZE 65536
 
+/* libmodplug renders in slices of this many sample frames (MIXBUFFERSIZE). */
+#define MODPLUG_BLOCK_FRAMES 512
+
+static int MODPLUG_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    int i;
+
+    /* we go by file extension alone; see MODPLUG_open(). */
+    if (ext == NULL)
+        return 0;
+
+    for (i = 0; extensions_modplug[i] != NULL; i++)
+    {
+        if (SDL_strcasecmp(ext, extensions_modplug[i]) == 0)
+            return 1;
+    } /* for */
+
+    return 0;
+} /* MODPLUG_probe */
+
+
 static int MODPLUG_open(Sound_Sample *sample, const char *ext)
 {
     ModPlug_Settings settings;
@@ -85,6 +115,8 @@ static int MODPLUG_open(Sound_Sample *sample, const char *ext)
     size_t size;
     Uint32 retval;
     int has_extension = 0;
+    int borrowed = 0;
+    int unpacked_size;
     int i;
 
     /*
@@ -106,38 +138,113 @@ static int MODPLUG_open(Sound_Sample *sample, const char *ext)
         BAIL_MACRO("MODPLUG: Not a module file.", 0);
     } /* if */
     
-    /* ModPlug needs the entire stream in one big chunk. I don't like it,
-       but I don't think there's any way around it.  !!! FIXME: rework modplug? */
-    data = (Uint8 *) SDL_malloc(CHUNK_SIZE);
-    BAIL_IF_MACRO(data == NULL, ERR_OUT_OF_MEMORY, 0);
-    size = 0;
+    /* ModPlug needs the entire stream in one big chunk. If it's already
+       sitting in memory (Sound_NewSampleFromMem(), a mapped file...), just
+       point ModPlug at it. Otherwise we have to slurp it all in. */
+    data = (Uint8 *) __Sound_RWMemoryView(internal->rw, &size);
+    if (data != NULL)
+        borrowed = 1;
+    else
+    {
+        data = (Uint8 *) __Sound_Malloc(CHUNK_SIZE);
+        BAIL_IF_MACRO(data == NULL, ERR_OUT_OF_MEMORY, 0);
+        size = 0;
 
-    do
+        do
+        {
+            retval = SDL_RWread(internal->rw, &data[size], 1, CHUNK_SIZE);
+            size += retval;
+            if (retval == CHUNK_SIZE)
+            {
+                Uint8 *ptr = (Uint8 *) __Sound_Realloc(data, size + CHUNK_SIZE);
+                if (ptr == NULL)
+                {
+                    __Sound_Free(data);
+                    BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
+                } /* if */
+                data = ptr;
+            } /* if */
+        } while (retval > 0);
+    } /* else */
+
+    /* Packed modules (MMCMP, PP20) get unpacked once, straight into the
+       buffer ModPlug parses, and we drop the packed copy before loading.
+       Otherwise ModPlug_Load() would keep both around while it copies
+       the samples out. If unpacking fails, let the loaders have a go at
+       the raw data like they always did. */
+    unpacked_size = ModPlug_GetUnpackedSize(data, (int) size);
+    if (unpacked_size > 0)
     {
-        retval = SDL_RWread(internal->rw, &data[size], 1, CHUNK_SIZE);
-        size += retval;
-        if (retval == CHUNK_SIZE)
+        Uint8 *unpacked = (Uint8 *) __Sound_Malloc(unpacked_size);
+        if (unpacked == NULL)
         {
-            data = (Uint8 *) SDL_realloc(data, size + CHUNK_SIZE);
-            BAIL_IF_MACRO(data == NULL, ERR_OUT_OF_MEMORY, 0);
+            if (!borrowed)
+                __Sound_Free(data);
+            BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
         } /* if */
-    } while (retval > 0);
 
-    SDL_memcpy(&sample->actual, &sample->desired, sizeof (Sound_AudioInfo));
-    if (sample->actual.rate == 0) sample->actual.rate = 44100;
-    if (sample->actual.channels == 0) sample->actual.channels = 2;
-    if (sample->actual.format == 0) sample->actual.format = AUDIO_S16SYS;
-
-    settings.mChannels=sample->actual.channels;
-    settings.mFrequency=sample->actual.rate;
-    settings.mBits = sample->actual.format & 0xFF;
+        if (!ModPlug_Unpack(data, (int) size, unpacked, unpacked_size))
+            __Sound_Free(unpacked);
+        else
+        {
+            if (!borrowed)
+                __Sound_Free(data);
+            data = unpacked;
+            size = (size_t) unpacked_size;
+            borrowed = 0;
+        } /* else */
+    } /* if */
 
     /* The settings will require some experimenting. I've borrowed some
         of them from the XMMS ModPlug plugin. */
-    settings.mFlags = MODPLUG_ENABLE_OVERSAMPLING;
-    settings.mFlags |= MODPLUG_ENABLE_NOISE_REDUCTION |
-                       MODPLUG_ENABLE_MEGABASS |
-                       MODPLUG_ENABLE_SURROUND;
+    SDL_zero(settings);
+    switch (internal->decode_quality)
+    {
+        case SOUND_DECODE_QUALITY_FAST:
+            settings.mFlags = 0;
+            settings.mResamplingMode = MODPLUG_RESAMPLE_LINEAR;
+            break;
+
+        case SOUND_DECODE_QUALITY_BALANCED:
+            settings.mFlags = MODPLUG_ENABLE_OVERSAMPLING |
+                              MODPLUG_ENABLE_NOISE_REDUCTION;
+            settings.mResamplingMode = MODPLUG_RESAMPLE_SPLINE;
+            break;
+
+        default:
+            settings.mFlags = MODPLUG_ENABLE_OVERSAMPLING;
+            settings.mFlags |= MODPLUG_ENABLE_NOISE_REDUCTION |
+                               MODPLUG_ENABLE_MEGABASS |
+                               MODPLUG_ENABLE_SURROUND;
+            settings.mResamplingMode = MODPLUG_RESAMPLE_FIR;
+            break;
+    } /* switch */
+
+    /* ModPlug mixes at any rate we like, in mono or stereo, and hands back
+       U8, S16, S32 or float in native byte order, so render as close to
+       what the app asked for as that allows. Otherwise we'd mix at 44.1kHz
+       just to have SDL_AudioCVT resample it afterwards. */
+    sample->actual.rate = sample->desired.rate;
+    if ((sample->actual.rate < 4000) || (sample->actual.rate > 192000))
+        sample->actual.rate = 44100;
+    sample->actual.channels = (sample->desired.channels == 1) ? 1 : 2;
+
+    if (sample->desired.format == 0)
+        sample->actual.format = AUDIO_S16SYS;
+    else if (SDL_AUDIO_ISFLOAT(sample->desired.format))
+        sample->actual.format = AUDIO_F32SYS;
+    else if (SDL_AUDIO_BITSIZE(sample->desired.format) == 32)
+        sample->actual.format = AUDIO_S32SYS;
+    else if (SDL_AUDIO_BITSIZE(sample->desired.format) == 8)
+        sample->actual.format = AUDIO_U8;
+    else
+        sample->actual.format = AUDIO_S16SYS;
+
+    settings.mChannels = sample->actual.channels;
+    settings.mFrequency = sample->actual.rate;
+    settings.mBits = SDL_AUDIO_BITSIZE(sample->actual.format);
+    if (SDL_AUDIO_ISFLOAT(sample->actual.format))
+        settings.mFlags |= MODPLUG_ENABLE_FLOAT_OUTPUT;
 
     settings.mReverbDepth = 30;
     settings.mReverbDelay = 100;
@@ -145,20 +252,25 @@ static int MODPLUG_open(Sound_Sample *sample, const char *ext)
     settings.mBassRange = 30;
     settings.mSurroundDepth = 20;
     settings.mSurroundDelay = 20;
-    settings.mChannels = 2;
-    settings.mBits = 16;
-    settings.mFrequency = 44100;
-    settings.mResamplingMode = MODPLUG_RESAMPLE_FIR;
+    settings.mStereoSeparation = 128;
+    settings.mMaxMixChannels = 32;
     settings.mLoopCount = 0;
+    settings.mMixThreads = __Sound_ModuleMixThreads();
 
     /* The buffer may be a bit too large, but that doesn't matter. I think
        it's safe to free it as soon as ModPlug_Load() is finished anyway. */
     module = ModPlug_Load((void *) data, size, &settings);
-    SDL_free(data);
+    if (!borrowed)
+        __Sound_Free(data);
     BAIL_IF_MACRO(module == NULL, "MODPLUG: Not a module file.", 0);
 
-    internal->total_time = ModPlug_GetLength(module);
+    /* Sound_ProbeInfo() would just throw the seek index away again. */
+    if (internal->probe_only)
+        internal->total_time = ModPlug_GetLengthNoIndex(module);
+    else
+        internal->total_time = ModPlug_GetLength(module);
     internal->decoder_private = (void *) module;
+    internal->block_frames = MODPLUG_BLOCK_FRAMES;
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
 
     SNDDBG(("MODPLUG: Accepting data stream\n"));
@@ -204,6 +316,14 @@ static int MODPLUG_seek(Sound_Sample *sample, Uint32 ms)
 } /* MODPLUG_seek */
 
 
+static Uint32 MODPLUG_memory_usage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    ModPlugFile *module = (ModPlugFile *) internal->decoder_private;
+    return (Uint32) ModPlug_GetMemoryUsage(module);
+} /* MODPLUG_memory_usage */
+
+
 const Sound_DecoderFunctions __Sound_DecoderFunctions_MODPLUG =
 {
     {
@@ -219,7 +339,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_MODPLUG =
     MODPLUG_close,      /*  close() method */
     MODPLUG_read,       /*   read() method */
     MODPLUG_rewind,     /* rewind() method */
-    MODPLUG_seek        /*   seek() method */
+    MODPLUG_seek,       /*   seek() method */
+    MODPLUG_probe,      /*  probe() method */
+    NULL,               /*   view() method */
+    NULL,               /* seek_frames() method */
+    MODPLUG_memory_usage /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_MODPLUG */
@@ -9,7 +9,14 @@
 /*
  * MP3 decoder for SDL_sound.
  *
- * !!! FIXME: write something here.
+ * Decoding is done by dr_mp3. dr_mp3 can only seek by decoding from the
+ *  start of the stream, though, and doesn't know how long a stream is, so
+ *  we build a table of where each MPEG frame starts. That means reading
+ *  every frame header in the file, so it waits for the first seek. Until
+ *  then, the duration comes from a Xing/Info (LAME) or VBRI header if the
+ *  first frame has one, and otherwise from the stream size and the first
+ *  frame's bitrate, which is exact for constant bitrate streams; building
+ *  the table fixes it up for VBR streams that don't say how long they are.
  *
  * dr_mp3 is here: https://github.com/mackron/dr_libs/
  */
@@ -22,9 +29,9 @@
 #define DR_MP3_IMPLEMENTATION
 #define DR_MP3_NO_STDIO 1
 #define DRMP3_ASSERT(x) SDL_assert((x))
-#define DRMP3_MALLOC(sz) SDL_malloc((sz))
-#define DRMP3_REALLOC(p, sz) SDL_realloc((p), (sz))
-#define DRMP3_FREE(p) SDL_free((p))
+#define DRMP3_MALLOC(sz) __Sound_Malloc((sz))
+#define DRMP3_REALLOC(p, sz) __Sound_Realloc((p), (sz))
+#define DRMP3_FREE(p) __Sound_Free((p))
 #define DRMP3_COPY_MEMORY(dst, src, sz) SDL_memcpy((dst), (src), (sz))
 #define DRMP3_ZERO_MEMORY(p, sz) SDL_memset((p), 0, (sz))
 
@@ -45,32 +52,56 @@
 
 #include "dr_mp3.h"
 
+/* how much of the stream to search for the first frame. */
+#define MP3_SYNC_WINDOW 16384
+
+/* decode at least this many frames and bytes before a seek target, to */
+/*  refill the bit reservoir (up to 511 bytes) and the synthesis state. */
+#define MP3_PREROLL_FRAMES 2
+#define MP3_PREROLL_BYTES 1024
+
+typedef struct
+{
+    drmp3 dr;
+    Sint64 data_start;     /* stream position of the first frame. */
+    Uint8 header[4];       /* first frame's header, for matching the rest. */
+    Uint32 frame_samples;  /* sample frames per MPEG frame. */
+    Uint32 total_frames;   /* MPEG frames in the stream, zero if unknown. */
+    Uint32 *index;         /* offset of each frame from data_start. */
+    Uint32 index_frames;   /* entries in (index), not counting the end. */
+    int index_built;       /* non-zero once we tried to build (index). */
+    int starved;           /* mp3_read() came up empty, but it's not EOF. */
+} MP3_t;
+
+/*
+ * dr_mp3 holds on to partial frames and asks again, so a stream that's
+ *  running behind can just give it what's there. It does take a read of
+ *  zero bytes to mean the end, though, so when the stream is merely empty
+ *  for now, we note that, and MP3_read() un-ends dr_mp3 and says EAGAIN.
+ *  Opening and seeking can't say EAGAIN, so there they just fail; we never
+ *  wait here, since a source that failed would keep us waiting forever.
+ */
 static size_t mp3_read(void* pUserData, void* pBufferOut, size_t bytesToRead)
 {
     Uint8 *ptr = (Uint8 *) pBufferOut;
     Sound_Sample *sample = (Sound_Sample *) pUserData;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
     SDL_RWops *rwops = internal->rw;
     size_t retval = 0;
 
-    /* !!! FIXME: dr_mp3 treats returning less than bytesToRead as EOF. So we can't EAGAIN. */
     while (retval < bytesToRead)
     {
-        const size_t rc = SDL_RWread(rwops, ptr, 1, bytesToRead);
-        if (rc == 0)
-        {
-            sample->flags |= SOUND_SAMPLEFLAG_EOF;
-            break;
-        } /* if */
-        else if (retval == -1)
-        {
-            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+        const size_t rc = SDL_RWread(rwops, ptr + retval, 1, bytesToRead - retval);
+        if (rc > 0)
+            retval += rc;
+        else if (__Sound_RWAtEOF(rwops))
             break;
-        } /* else if */
         else
         {
-            retval += rc;
-            ptr += rc;
+            if (retval == 0)
+                mp3->starved = 1;
+            break;
         } /* else */
     } /* while */
 
@@ -82,7 +113,14 @@ static drmp3_bool32 mp3_seek(void* pUserData, int offset, drmp3_seek_origin orig
     const int whence = (origin == drmp3_seek_origin_start) ? RW_SEEK_SET : RW_SEEK_CUR;
     Sound_Sample *sample = (Sound_Sample *) pUserData;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    return (SDL_RWseek(internal->rw, offset, whence) != -1) ? DRMP3_TRUE : DRMP3_FALSE;
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    Sint64 pos = (Sint64) offset;
+
+    /* "start" is the first audio frame, not the ID3 tag in front of it. */
+    if (whence == RW_SEEK_SET)
+        pos += mp3->data_start;
+
+    return (SDL_RWseek(internal->rw, pos, whence) != -1) ? DRMP3_TRUE : DRMP3_FALSE;
 } /* mp3_seek */
 
 
@@ -97,28 +135,292 @@ static void MP3_quit(void)
     /* it's a no-op. */
 } /* MP3_quit */
 
+static Uint32 mp3_read_be32(const Uint8 *ptr)
+{
+    return (((Uint32) ptr[0]) << 24) | (((Uint32) ptr[1]) << 16) |
+           (((Uint32) ptr[2]) << 8) | ((Uint32) ptr[3]);
+} /* mp3_read_be32 */
+
+
+/* Frame count from a Xing/Info or VBRI header in (frame), zero if none. */
+static Uint32 mp3_vbr_frame_count(const Uint8 *frame, Uint32 len)
+{
+    const int mpeg1 = DRMP3_HDR_TEST_MPEG1(frame) ? 1 : 0;
+    const int mono = DRMP3_HDR_IS_MONO(frame) ? 1 : 0;
+    Uint32 pos = 4 + (mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17));
+
+    if (DRMP3_HDR_IS_CRC(frame))
+        pos += 2;
+
+    if ( (pos + 12 <= len) &&
+         ((SDL_memcmp(frame + pos, "Xing", 4) == 0) ||
+          (SDL_memcmp(frame + pos, "Info", 4) == 0)) &&
+         (frame[pos + 7] & 0x01) )  /* "frames" field present? */
+        return mp3_read_be32(frame + pos + 8);
+
+    /* VBRI is always 32 bytes past the header. */
+    if ((4 + 32 + 18 <= len) && (SDL_memcmp(frame + 4 + 32, "VBRI", 4) == 0))
+        return mp3_read_be32(frame + 4 + 32 + 14);
+
+    return 0;
+} /* mp3_vbr_frame_count */
+
+
+/*
+ * Find the first audio frame in the stream, skipping any ID3v2 tag. We
+ *  want a frame that the next frame agrees with, same as dr_mp3 does, so
+ *  random 0xFF bytes don't count. Fills in most of (mp3).
+ */
+static int mp3_find_first_frame(SDL_RWops *rw, MP3_t *mp3)
+{
+    Uint8 *buf;
+    Sint64 start = SDL_RWtell(rw);
+    Uint8 tag[10];
+    size_t len;
+    size_t i;
+
+    if (start < 0)
+        return 0;  /* can't seek, can't index. */
+
+    if (SDL_RWread(rw, tag, sizeof (tag), 1) == 1)
+    {
+        if ((SDL_memcmp(tag, "ID3", 3) == 0) && ((tag[6] | tag[7] | tag[8] | tag[9]) & 0x80) == 0)
+        {
+            start += 10 + ((((Sint64) tag[6]) << 21) | (((Sint64) tag[7]) << 14) |
+                           (((Sint64) tag[8]) << 7) | ((Sint64) tag[9]));
+            if (tag[5] & 0x10)  /* footer present */
+                start += 10;
+        } /* if */
+    } /* if */
+
+    buf = (Uint8 *) __Sound_Malloc(MP3_SYNC_WINDOW);
+    if (buf == NULL)
+        return 0;
+
+    len = 0;
+    if (SDL_RWseek(rw, start, RW_SEEK_SET) == start)
+        len = SDL_RWread(rw, buf, 1, MP3_SYNC_WINDOW);
+
+    for (i = 0; i + DRMP3_HDR_SIZE <= len; i++)
+    {
+        const Uint8 *hdr = buf + i;
+        size_t fb;
+
+        if ((!drmp3_hdr_valid(hdr)) || (DRMP3_HDR_IS_FREE_FORMAT(hdr)))
+            continue;  /* we don't index free-format streams. */
+
+        fb = (size_t) (drmp3_hdr_frame_bytes(hdr, 0) + drmp3_hdr_padding(hdr));
+        if ((fb == 0) || (i + fb > len))
+            continue;
+        else if ((i + fb + DRMP3_HDR_SIZE <= len) && (!drmp3_hdr_compare(hdr, hdr + fb)))
+            continue;
+
+        SDL_memcpy(mp3->header, hdr, sizeof (mp3->header));
+        mp3->data_start = start + (Sint64) i;
+        mp3->frame_samples = drmp3_hdr_frame_samples(hdr);
+        mp3->total_frames = mp3_vbr_frame_count(hdr, (Uint32) fb);
+        if (mp3->total_frames > 0)
+            mp3->total_frames++;  /* the Xing frame itself decodes, too. */
+        __Sound_Free(buf);
+        return 1;
+    } /* for */
+
+    __Sound_Free(buf);
+    return 0;
+} /* mp3_find_first_frame */
+
+
+/*
+ * Guess the frame count from the size of the stream, assuming every frame
+ *  is the size of the first one, give or take padding. Leaves the stream
+ *  position wherever it ends up. Returns zero if the size isn't known.
+ */
+static Uint32 mp3_estimate_frames(SDL_RWops *rw, const MP3_t *mp3)
+{
+    const Uint64 bitrate = ((Uint64) drmp3_hdr_bitrate_kbps(mp3->header)) * 1000;
+    const Uint64 rate = drmp3_hdr_sample_rate_hz(mp3->header);
+    Sint64 end = SDL_RWsize(rw);
+    Uint8 tag[3];
+
+    if ((end <= mp3->data_start) || (bitrate == 0))
+        return 0;
+
+    /* don't count an ID3v1 tag as audio. */
+    if ( (end - mp3->data_start > 128) &&
+         (SDL_RWseek(rw, end - 128, RW_SEEK_SET) == end - 128) &&
+         (SDL_RWread(rw, tag, sizeof (tag), 1) == 1) &&
+         (SDL_memcmp(tag, "TAG", 3) == 0) )
+        end -= 128;
+
+    /* bytes per frame is (frame_samples / 8) * (bitrate / rate), on average. */
+    return (Uint32) ((((Uint64) (end - mp3->data_start)) * 8 * rate) /
+                     (bitrate * mp3->frame_samples));
+} /* mp3_estimate_frames */
+
+
+/*
+ * Walk the frame headers from the first frame to the end (or the first
+ *  thing that isn't a matching frame, like an ID3v1 tag), recording where
+ *  each frame starts. Leaves the stream position wherever it ends up.
+ */
+static void mp3_build_index(SDL_RWops *rw, MP3_t *mp3)
+{
+    Uint32 *index = NULL;
+    Uint32 avail = 0;
+    Uint32 count = 0;
+    Sint64 pos = mp3->data_start;
+    Uint8 hdr[DRMP3_HDR_SIZE];
+
+    mp3->index_built = 1;
+
+    while (1)
+    {
+        if (count + 1 >= avail)  /* always leave room for the end offset. */
+        {
+            const Uint32 newavail = avail ? (avail * 2) : 1024;
+            Uint32 *ptr = (Uint32 *) __Sound_Realloc(index, newavail * sizeof (Uint32));
+            if (ptr == NULL)
+            {
+                __Sound_Free(index);
+                return;  /* oh well, we'll go without. */
+            } /* if */
+            index = ptr;
+            avail = newavail;
+        } /* if */
+
+        if ((pos - mp3->data_start) > 0xFFFFFFFF)
+            break;  /* too big to index; keep what we have. */
+        else if (SDL_RWseek(rw, pos, RW_SEEK_SET) != pos)
+            break;
+        else if (SDL_RWread(rw, hdr, sizeof (hdr), 1) != 1)
+            break;
+        else if (!drmp3_hdr_compare(mp3->header, hdr))
+            break;
+
+        index[count++] = (Uint32) (pos - mp3->data_start);
+        pos += drmp3_hdr_frame_bytes(hdr, 0) + drmp3_hdr_padding(hdr);
+    } /* while */
+
+    /* dr_mp3 won't decode a frame cut short by EOF; don't count one. */
+    if ((count > 0) && ((SDL_RWseek(rw, pos - 1, RW_SEEK_SET) != pos - 1) ||
+                        (SDL_RWread(rw, hdr, 1, 1) != 1)))
+    {
+        pos = mp3->data_start + index[--count];
+    } /* if */
+
+    if (count == 0)
+    {
+        __Sound_Free(index);
+        return;
+    } /* if */
+
+    index[count] = (Uint32) (pos - mp3->data_start);
+    mp3->index = index;
+    mp3->index_frames = count;
+    mp3->total_frames = count;  /* trust this over the Xing header. */
+} /* mp3_build_index */
+
+
+static int MP3_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    Uint32 i;
+
+    if ((len >= 3) && (SDL_memcmp(header, "ID3", 3) == 0))
+        return 1;
+
+    /* look for something that could be an MPEG audio frame header. */
+    for (i = 0; i + 3 < len; i++)
+    {
+        if ( (header[i] == 0xFF) &&
+             ((header[i+1] & 0xE0) == 0xE0) &&   /* rest of frame sync */
+             ((header[i+1] & 0x06) != 0x00) &&   /* layer isn't reserved */
+             ((header[i+2] & 0xF0) != 0xF0) &&   /* bitrate isn't bad */
+             ((header[i+2] & 0x0C) != 0x0C) )    /* rate isn't reserved */
+            return 1;
+    } /* for */
+
+    return 0;
+} /* MP3_probe */
+
+
 static int MP3_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drmp3 *dr = (drmp3 *) SDL_calloc(1, sizeof (drmp3));
+    SDL_RWops *rw = internal->rw;
+    const Sint64 pos = SDL_RWtell(rw);
+    MP3_t *mp3 = (MP3_t *) __Sound_Calloc(1, sizeof (MP3_t));
+    drmp3_config config;
+    int indexed = 0;
+
+    BAIL_IF_MACRO(!mp3, ERR_OUT_OF_MEMORY, 0);
+
+    if (mp3_find_first_frame(rw, mp3))
+    {
+        if (mp3->total_frames == 0)  /* no VBR header; assume CBR. */
+            mp3->total_frames = mp3_estimate_frames(rw, mp3);
+        if (mp3->total_frames == 0)  /* no size, either; go count frames. */
+            mp3_build_index(rw, mp3);
+        indexed = (mp3->total_frames > 0);
+    } /* if */
+
+    if (indexed)  /* decode as-is, so our frame count matches dr_mp3's. */
+    {
+        SDL_zero(config);
+        config.outputChannels = DRMP3_HDR_IS_MONO(mp3->header) ? 1 : 2;
+        config.outputSampleRate = drmp3_hdr_sample_rate_hz(mp3->header);
+        SDL_RWseek(rw, mp3->data_start, RW_SEEK_SET);
+    } /* if */
+
+    else  /* couldn't make sense of it ourselves; let dr_mp3 figure it out. */
+    {
+        __Sound_Free(mp3->index);
+        SDL_zerop(mp3);
+        mp3->data_start = (pos < 0) ? 0 : pos;
+        if (pos >= 0)
+            SDL_RWseek(rw, pos, RW_SEEK_SET);
+    } /* else */
+
+    internal->decoder_private = mp3;  /* mp3_seek() needs this. */
 
-    BAIL_IF_MACRO(!dr, ERR_OUT_OF_MEMORY, 0);
-    if (drmp3_init(dr, mp3_read, mp3_seek, sample, NULL) != DRMP3_TRUE)
+    /* we already know everything Sound_ProbeInfo() wants; skip dr_mp3. */
+    if ((indexed) && (internal->probe_only))
     {
-        SDL_free(dr);
-        BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, ERR_IO_ERROR, 0);
-        BAIL_MACRO("MP3: Not an MPEG-1 layer 1-3 stream.", 0);
+        mp3->dr.channels = config.outputChannels;
+        mp3->dr.sampleRate = config.outputSampleRate;
     } /* if */
 
+    else
+    {
+        if (drmp3_init(&mp3->dr, mp3_read, mp3_seek, sample, indexed ? &config : NULL) != DRMP3_TRUE)
+        {
+            __Sound_Free(mp3->index);
+            __Sound_Free(mp3);
+            BAIL_MACRO("MP3: Not an MPEG-1 layer 1-3 stream.", 0);
+        } /* if */
+    } /* else */
+
     SNDDBG(("MP3: Accepting data stream.\n"));
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->block_frames = mp3->frame_samples;  /* zero if we didn't find it. */
+
+    sample->actual.channels = mp3->dr.channels;
+    sample->actual.rate = mp3->dr.sampleRate;
 
-    sample->actual.channels = dr->channels;
-    sample->actual.rate = dr->sampleRate;
-    sample->actual.format = AUDIO_F32SYS;  /* dr_mp3 only does float. */
+    /* dr_mp3 only does float, but we can get at its Sint16 frames if */
+    /*  it isn't resampling. */
+    if ((indexed) && (sample->desired.format == AUDIO_S16SYS))
+        sample->actual.format = AUDIO_S16SYS;
+    else
+        sample->actual.format = AUDIO_F32SYS;
 
-    internal->total_time = -1;  /* !!! FIXME? */
-    internal->decoder_private = dr;
+    if (!indexed)
+        internal->total_time = -1;
+    else
+    {
+        const Uint64 frames = ((Uint64) mp3->total_frames) * mp3->frame_samples;
+        internal->total_time = (Sint32) ((frames * 1000) / sample->actual.rate);
+        internal->accurate_seek = 1;
+    } /* else */
 
     return 1;
 } /* MP3_open */
@@ -126,38 +428,214 @@ static int MP3_open(Sound_Sample *sample, const char *ext)
 static void MP3_close(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drmp3 *dr = (drmp3 *) internal->decoder_private;
-    drmp3_uninit(dr);
-    SDL_free(dr);
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    drmp3_uninit(&mp3->dr);
+    __Sound_Free(mp3->index);
+    __Sound_Free(mp3);
 } /* MP3_close */
 
+/*
+ * Like drmp3_read_f32(), but hands out dr_mp3's decoded Sint16 frames as-is
+ *  instead of going through its float resampler. Only for streams where
+ *  dr_mp3 isn't resampling, which MP3_open() makes sure of.
+ */
+static drmp3_uint64 mp3_read_s16(drmp3 *dr, drmp3_uint64 frames, Sint16 *dst)
+{
+    const drmp3_uint32 channels = dr->channels;
+    drmp3_uint64 total = 0;
+
+    while (total < frames)
+    {
+        const Sint16 *src;
+        drmp3_uint32 avail;
+        drmp3_uint32 i;
+
+        if (dr->framesRemaining == 0)
+        {
+            if (!drmp3_decode_next_frame(dr))
+                break;
+            else if (dr->frameSampleRate != dr->sampleRate)
+            {
+                /* rate changed mid-stream; treat it like the end. */
+                dr->framesRemaining = 0;
+                dr->atEnd = DRMP3_TRUE;
+                break;
+            } /* else if */
+            continue;
+        } /* if */
+
+        avail = dr->framesRemaining;
+        if (avail > frames - total)
+            avail = (drmp3_uint32) (frames - total);
+
+        src = dr->frames + (dr->framesConsumed * dr->frameChannels);
+        if (dr->frameChannels == channels)
+            SDL_memcpy(dst, src, avail * channels * sizeof (Sint16));
+        else if (dr->frameChannels == 1)  /* mono -> stereo */
+        {
+            for (i = 0; i < avail; i++)
+                dst[i * 2] = dst[(i * 2) + 1] = src[i];
+        } /* else if */
+        else  /* stereo -> mono */
+        {
+            for (i = 0; i < avail; i++)
+                dst[i] = (Sint16) ((((Sint32) src[i * 2]) + ((Sint32) src[(i * 2) + 1])) / 2);
+        } /* else */
+
+        dr->framesConsumed += avail;
+        dr->framesRemaining -= avail;
+        dst += avail * channels;
+        total += avail;
+    } /* while */
+
+    return total;
+} /* mp3_read_s16 */
+
 static Uint32 MP3_read(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     const int channels = (int) sample->actual.channels;
-    drmp3 *dr = (drmp3 *) internal->decoder_private;
-    const drmp3_uint64 frames_to_read = (internal->buffer_size / channels) / sizeof (float);
-    const drmp3_uint64 rc = drmp3_read_f32(dr, frames_to_read, (float *) internal->buffer);
-    /* !!! FIXME: the mp3_read callback sets ERROR and EOF flags, but this only tells you about i/o errors, not corruption. */
-    return rc * channels * sizeof (float);
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    const size_t samplesize = (sample->actual.format == AUDIO_S16SYS) ? sizeof (Sint16) : sizeof (float);
+    const drmp3_uint64 frames_to_read = (internal->buffer_size / channels) / samplesize;
+    drmp3_uint64 rc;
+
+    mp3->starved = 0;
+    if (sample->actual.format == AUDIO_S16SYS)
+        rc = mp3_read_s16(&mp3->dr, frames_to_read, (Sint16 *) internal->buffer);
+    else
+        rc = drmp3_read_f32(&mp3->dr, frames_to_read, (float *) internal->buffer);
+
+    if (mp3->starved)
+    {
+        mp3->dr.atEnd = DRMP3_FALSE;  /* it wasn't, really. */
+        sample->flags |= SOUND_SAMPLEFLAG_EAGAIN;
+    } /* if */
+
+    /* !!! FIXME: this could be corruption instead of the end, but dr_mp3 doesn't say. */
+    else if (rc < frames_to_read)
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+
+    return (Uint32) (rc * channels * samplesize);
 } /* MP3_read */
 
 static int MP3_rewind(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drmp3 *dr = (drmp3 *) internal->decoder_private;
-    return (drmp3_seek_to_frame(dr, 0) == DRMP3_TRUE);
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    drmp3dec_init(&mp3->dr.decoder);  /* don't let old state bleed in. */
+    return (drmp3_seek_to_frame(&mp3->dr, 0) == DRMP3_TRUE);
 } /* MP3_rewind */
 
-static int MP3_seek(Sound_Sample *sample, Uint32 ms)
+/*
+ * Seek with the frame index: jump to a few frames before the target, run
+ *  those through the decoder without keeping the output (so the bit
+ *  reservoir and filter state are what they'd be if we had played up to
+ *  here), then hand the stream back to dr_mp3 at the target frame.
+ */
+static int mp3_seek_indexed(Sound_Sample *sample, Uint64 frame_offset)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    drmp3 *dr = &mp3->dr;
+    SDL_RWops *rw = internal->rw;
+    const Uint32 target = (Uint32) (frame_offset / mp3->frame_samples);
+    const Uint32 skip = (Uint32) (frame_offset % mp3->frame_samples);
+    Uint32 first = target;
+    Uint32 len, pos;
+    Uint8 *buf;
+
+    while ( (first > 0) &&
+            (((target - first) < MP3_PREROLL_FRAMES) ||
+             ((mp3->index[target] - mp3->index[first]) < MP3_PREROLL_BYTES)) )
+        first--;
+
+    drmp3dec_init(&dr->decoder);
+
+    len = mp3->index[target] - mp3->index[first];
+    if (len > 0)
+    {
+        const Sint64 start = mp3->data_start + mp3->index[first];
+        buf = (Uint8 *) __Sound_Malloc(len);
+        BAIL_IF_MACRO(buf == NULL, ERR_OUT_OF_MEMORY, 0);
+        if ((SDL_RWseek(rw, start, RW_SEEK_SET) != start) ||
+            (SDL_RWread(rw, buf, len, 1) != 1))
+        {
+            __Sound_Free(buf);
+            BAIL_MACRO(ERR_IO_ERROR, 0);
+        } /* if */
+
+        for (pos = 0; pos < len; )
+        {
+            drmp3dec_frame_info info;
+            drmp3dec_decode_frame(&dr->decoder, buf + pos, (int) (len - pos), dr->frames, &info);
+            if (info.frame_bytes <= 0)
+                break;
+            pos += (Uint32) info.frame_bytes;
+        } /* for */
+        __Sound_Free(buf);
+    } /* if */
+
+    BAIL_IF_MACRO(SDL_RWseek(rw, mp3->data_start + mp3->index[target], RW_SEEK_SET) == -1, ERR_IO_ERROR, 0);
+
+    /* throw away what dr_mp3 had buffered from the old position. */
+    dr->framesConsumed = 0;
+    dr->framesRemaining = 0;
+    dr->dataSize = 0;
+    dr->atEnd = DRMP3_FALSE;
+
+    if (skip > 0)
+        return (drmp3_read_f32(dr, skip, NULL) == skip);
+
+    return 1;
+} /* mp3_seek_indexed */
+
+static int MP3_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    drmp3 *dr = (drmp3 *) internal->decoder_private;
-    const float frames_per_ms = ((float) sample->actual.rate) / 1000.0f;
-    const drmp3_uint64 frame_offset = (drmp3_uint64) (frames_per_ms * ((float) ms));
-    return (drmp3_seek_to_frame(dr, frame_offset) == DRMP3_TRUE);
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    const drmp3_uint64 frame_offset = (drmp3_uint64) frame;
+    int retval;
+
+    /* open() put this off until someone wanted it. */
+    if ((mp3->frame_samples > 0) && (!mp3->index_built))
+    {
+        mp3_build_index(internal->rw, mp3);
+        if (mp3->index != NULL)  /* now we know for sure. */
+        {
+            const Uint64 frames = ((Uint64) mp3->total_frames) * mp3->frame_samples;
+            internal->total_time = (Sint32) ((frames * 1000) / sample->actual.rate);
+        } /* if */
+    } /* if */
+
+    if ((mp3->index != NULL) && (frame_offset < ((Uint64) mp3->index_frames) * mp3->frame_samples))
+        retval = mp3_seek_indexed(sample, frame_offset);
+    else
+    {
+        drmp3dec_init(&mp3->dr.decoder);
+        retval = (drmp3_seek_to_frame(&mp3->dr, frame_offset) == DRMP3_TRUE);
+    } /* else */
+
+    return retval;
+} /* MP3_seek_frames */
+
+
+static int MP3_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return MP3_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* MP3_seek */
 
+
+static Uint32 MP3_memory_usage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    MP3_t *mp3 = (MP3_t *) internal->decoder_private;
+    Uint32 retval = (Uint32) (sizeof (MP3_t) + mp3->dr.dataCapacity);
+    if (mp3->index != NULL)  /* plus the end-of-stream entry. */
+        retval += (mp3->index_frames + 1) * sizeof (Uint32);
+    return retval;
+} /* MP3_memory_usage */
+
 /* dr_mp3 will play layer 1 and 2 files, too */
 static const char *extensions_mp3[] = { "MP3", "MP2", "MP1", NULL };
 const Sound_DecoderFunctions __Sound_DecoderFunctions_MP3 =
@@ -175,7 +653,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_MP3 =
     MP3_close,      /*  close() method */
     MP3_read,       /*   read() method */
     MP3_rewind,     /* rewind() method */
-    MP3_seek        /*   seek() method */
+    MP3_seek,       /*   seek() method */
+    MP3_probe,      /*  probe() method */
+    NULL,           /*   view() method */
+    MP3_seek_frames, /* seek_frames() method */
+    MP3_memory_usage /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_MP3 */
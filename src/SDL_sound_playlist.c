@@ -0,0 +1,319 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Gapless playlists. Opening a track isn't cheap: probing decoders, setting
+ *  up conversion, and for modules, parsing the whole song. Done when the
+ *  previous track runs out, that's an audible gap. A worker thread opens the
+ *  next file in the queue while the current one plays, and decodes its
+ *  first buffer, so Sound_PlaylistRead() can go straight from the last byte
+ *  of one track to the first byte of the next in the same call.
+ *
+ * The worker only ever holds one track ready at a time; it opens the one
+ *  after that when the reader takes it. Everything the two threads share is
+ *  behind one mutex, and the reader only waits on the worker if it hits the
+ *  end of a track before the next one is open.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+typedef struct PlaylistEntry
+{
+    char *filename;
+    struct PlaylistEntry *next;
+} PlaylistEntry;
+
+struct __SOUND_PLAYLIST__
+{
+    Sound_AudioInfo desired;
+    int have_desired;
+    Uint32 buffer_size;
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+
+    /* these are guarded by (lock). */
+    PlaylistEntry *queue;       /* not opened yet. */
+    PlaylistEntry *queue_tail;
+    Sound_Sample *next;         /* opened and primed by the worker. */
+    Uint32 next_avail;          /* bytes already decoded into next->buffer. */
+    int opening;                /* worker is opening a track right now. */
+    int quit;
+
+    /* only the reader touches these. */
+    Sound_Sample *current;
+    Sound_AudioInfo format;     /* what Sound_PlaylistRead() has been giving. */
+    Uint32 cur_pos;
+    Uint32 cur_avail;
+};
+
+
+static int SDLCALL playlist_worker(void *data)
+{
+    Sound_Playlist *pl = (Sound_Playlist *) data;
+
+    SDL_LockMutex(pl->lock);
+    while (!pl->quit)
+    {
+        PlaylistEntry *entry;
+        Sound_Sample *sample;
+        Uint32 avail = 0;
+
+        if ((pl->next != NULL) || (pl->queue == NULL))
+        {
+            SDL_CondWait(pl->cond, pl->lock);
+            continue;
+        } /* if */
+
+        entry = pl->queue;
+        pl->queue = entry->next;
+        if (pl->queue == NULL)
+            pl->queue_tail = NULL;
+        pl->opening = 1;
+        SDL_UnlockMutex(pl->lock);
+
+        sample = Sound_NewSampleFromFile(entry->filename,
+                                         pl->have_desired ? &pl->desired : NULL,
+                                         pl->buffer_size);
+        if (sample == NULL)
+        {
+            SNDDBG(("Playlist: couldn't open [%s]: %s\n", entry->filename,
+                    Sound_GetError()));
+        } /* if */
+        else
+        {
+            avail = Sound_Decode(sample);
+        } /* else */
+
+        __Sound_Free(entry->filename);
+        __Sound_Free(entry);
+
+        SDL_LockMutex(pl->lock);
+        pl->opening = 0;
+        pl->next = sample;
+        pl->next_avail = avail;
+        SDL_CondBroadcast(pl->cond);  /* in case the reader is waiting. */
+    } /* while */
+    SDL_UnlockMutex(pl->lock);
+
+    return 0;
+} /* playlist_worker */
+
+
+/*
+ * Make the worker's primed track the current one, waiting for it if it's
+ *  still being opened. Returns zero if there's nothing left to play.
+ */
+static int take_next(Sound_Playlist *pl)
+{
+    Sound_Sample *sample;
+    Uint32 avail;
+
+    SDL_LockMutex(pl->lock);
+    while ((pl->next == NULL) && ((pl->queue != NULL) || (pl->opening)))
+        SDL_CondWait(pl->cond, pl->lock);
+    sample = pl->next;
+    avail = pl->next_avail;
+    pl->next = NULL;
+    pl->next_avail = 0;
+    SDL_CondBroadcast(pl->cond);  /* slot's free; go open the one after. */
+    SDL_UnlockMutex(pl->lock);
+
+    pl->current = sample;
+    pl->cur_pos = 0;
+    pl->cur_avail = avail;
+    return (sample != NULL);
+} /* take_next */
+
+
+static int same_format(const Sound_AudioInfo *a, const Sound_AudioInfo *b)
+{
+    return ( (a->format == b->format) &&
+             (a->channels == b->channels) &&
+             (a->rate == b->rate) );
+} /* same_format */
+
+
+Sound_Playlist *Sound_NewPlaylist(const Sound_AudioInfo *desired,
+                                  Uint32 bufferSize)
+{
+    Sound_Playlist *pl;
+
+    pl = (Sound_Playlist *) __Sound_Calloc(1, sizeof (Sound_Playlist));
+    BAIL_IF_MACRO(pl == NULL, ERR_OUT_OF_MEMORY, NULL);
+
+    if (desired != NULL)
+    {
+        SDL_memcpy(&pl->desired, desired, sizeof (Sound_AudioInfo));
+        pl->have_desired = 1;
+    } /* if */
+
+    pl->buffer_size = bufferSize;
+    pl->lock = SDL_CreateMutex();
+    pl->cond = SDL_CreateCond();
+    if ((pl->lock == NULL) || (pl->cond == NULL))
+    {
+        if (pl->cond != NULL)
+            SDL_DestroyCond(pl->cond);
+        if (pl->lock != NULL)
+            SDL_DestroyMutex(pl->lock);
+        __Sound_Free(pl);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+    } /* if */
+
+    pl->thread = SDL_CreateThread(playlist_worker, "SDL_sound playlist", pl);
+    if (pl->thread == NULL)
+    {
+        SDL_DestroyCond(pl->cond);
+        SDL_DestroyMutex(pl->lock);
+        __Sound_Free(pl);
+        BAIL_MACRO(SDL_GetError(), NULL);
+    } /* if */
+
+    return pl;
+} /* Sound_NewPlaylist */
+
+
+int Sound_PlaylistAppend(Sound_Playlist *pl, const char *filename)
+{
+    PlaylistEntry *entry;
+
+    BAIL_IF_MACRO(pl == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    entry = (PlaylistEntry *) __Sound_Malloc(sizeof (PlaylistEntry));
+    BAIL_IF_MACRO(entry == NULL, ERR_OUT_OF_MEMORY, 0);
+    entry->filename = __Sound_StrDup(filename);
+    if (entry->filename == NULL)
+    {
+        __Sound_Free(entry);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
+    } /* if */
+    entry->next = NULL;
+
+    SDL_LockMutex(pl->lock);
+    if (pl->queue_tail == NULL)
+        pl->queue = entry;
+    else
+        pl->queue_tail->next = entry;
+    pl->queue_tail = entry;
+    SDL_CondBroadcast(pl->cond);
+    SDL_UnlockMutex(pl->lock);
+
+    return 1;
+} /* Sound_PlaylistAppend */
+
+
+Uint32 Sound_PlaylistRead(Sound_Playlist *pl, void *buffer, Uint32 len,
+                          Sound_SampleFlags *state)
+{
+    Uint8 *dst = (Uint8 *) buffer;
+    Uint32 got = 0;
+
+    if (state != NULL)
+        *state = SOUND_SAMPLEFLAG_NONE;
+
+    BAIL_IF_MACRO(pl == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(buffer == NULL, ERR_INVALID_ARGUMENT, 0);
+
+    while (got < len)
+    {
+        Sound_Sample *sample = pl->current;
+        Uint32 cpy;
+        int changed;
+
+        if (sample == NULL)
+        {
+            if (!take_next(pl))
+            {
+                if (state != NULL)
+                    *state = SOUND_SAMPLEFLAG_EOF;
+                break;
+            } /* if */
+
+            /* can't join these without a gap; let the app catch up first. */
+            sample = pl->current;
+            changed = ((got > 0) && (!same_format(&pl->format, &sample->desired)));
+            SDL_memcpy(&pl->format, &sample->desired, sizeof (Sound_AudioInfo));
+            if (changed)
+                break;
+            continue;
+        } /* if */
+
+        if (pl->cur_pos == pl->cur_avail)
+        {
+            if (sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR))
+            {
+                /* a track that errors out just ends; the list goes on. */
+                Sound_FreeSample(sample);
+                pl->current = NULL;
+                continue;
+            } /* if */
+
+            pl->cur_pos = 0;
+            pl->cur_avail = Sound_Decode(sample);
+            if ((pl->cur_avail == 0) && (sample->flags & SOUND_SAMPLEFLAG_EAGAIN))
+            {
+                if (state != NULL)
+                    *state = SOUND_SAMPLEFLAG_EAGAIN;
+                break;
+            } /* if */
+            continue;
+        } /* if */
+
+        cpy = SDL_min(len - got, pl->cur_avail - pl->cur_pos);
+        SDL_memcpy(dst + got, ((Uint8 *) sample->buffer) + pl->cur_pos, cpy);
+        pl->cur_pos += cpy;
+        got += cpy;
+    } /* while */
+
+    return got;
+} /* Sound_PlaylistRead */
+
+
+Sound_Sample *Sound_PlaylistCurrent(Sound_Playlist *pl)
+{
+    BAIL_IF_MACRO(pl == NULL, ERR_INVALID_ARGUMENT, NULL);
+    return pl->current;
+} /* Sound_PlaylistCurrent */
+
+
+void Sound_FreePlaylist(Sound_Playlist *pl)
+{
+    PlaylistEntry *entry;
+
+    if (pl == NULL)
+        return;
+
+    SDL_LockMutex(pl->lock);
+    pl->quit = 1;
+    SDL_CondBroadcast(pl->cond);
+    SDL_UnlockMutex(pl->lock);
+    SDL_WaitThread(pl->thread, NULL);
+
+    entry = pl->queue;
+    while (entry != NULL)
+    {
+        PlaylistEntry *next = entry->next;
+        __Sound_Free(entry->filename);
+        __Sound_Free(entry);
+        entry = next;
+    } /* while */
+
+    if (pl->next != NULL)
+        Sound_FreeSample(pl->next);
+    if (pl->current != NULL)
+        Sound_FreeSample(pl->current);
+
+    SDL_DestroyCond(pl->cond);
+    SDL_DestroyMutex(pl->lock);
+    __Sound_Free(pl);
+} /* Sound_FreePlaylist */
+
+/* end of SDL_sound_playlist.c ... */
@@ -40,6 +40,13 @@ static void RAW_quit(void)
 } /* RAW_quit */
 
 
+static int RAW_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    /* no magic to look at; see RAW_open(). */
+    return ((ext != NULL) && (SDL_strcasecmp(ext, "RAW") == 0));
+} /* RAW_probe */
+
+
 static int RAW_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = sample->opaque;
@@ -72,6 +79,7 @@ static int RAW_open(Sound_Sample *sample, const char *ext)
          */
     SDL_memcpy(&sample->actual, &sample->desired, sizeof (Sound_AudioInfo));
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->accurate_seek = 1;
 
     if ( (pos = SDL_RWseek(internal->rw, 0, SEEK_END) ) <= 0) {
         BAIL_MACRO("RAW: cannot seek the end of the file \"RAW\".", 0);
@@ -122,6 +130,15 @@ static Uint32 RAW_read(Sound_Sample *sample)
 } /* RAW_read */
 
 
+static Uint32 RAW_view(Sound_Sample *sample, const Uint8 **data, Uint32 len)
+{
+    const Uint32 retval = __Sound_ViewRW(sample, data, len);
+    if ((*data != NULL) && (retval == 0))
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+    return retval;
+} /* RAW_view */
+
+
 static int RAW_rewind(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -130,13 +147,22 @@ static int RAW_rewind(Sound_Sample *sample)
 } /* RAW_rewind */
 
 
-static int RAW_seek(Sound_Sample *sample, Uint32 ms)
+static int RAW_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    int pos = (int) __Sound_convertMsToBytePos(&sample->actual, ms);
-    int err = (SDL_RWseek(internal->rw, pos, SEEK_SET) != pos);
+    const Uint64 bytepos = __Sound_convertFramesToBytePos(&sample->actual, frame);
+    const int pos = (int) bytepos;
+    int err;
+    BAIL_IF_MACRO(bytepos > 0x7FFFFFFF, ERR_PAST_EOF, 0);
+    err = (SDL_RWseek(internal->rw, pos, SEEK_SET) != pos);
     BAIL_IF_MACRO(err, ERR_IO_ERROR, 0);
     return 1;
+} /* RAW_seek_frames */
+
+
+static int RAW_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return RAW_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* RAW_seek */
 
 static const char *extensions_raw[] = { "RAW", NULL };
@@ -155,7 +181,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_RAW =
     RAW_close,      /*  close() method */
     RAW_read,       /*   read() method */
     RAW_rewind,     /* rewind() method */
-    RAW_seek        /*   seek() method */
+    RAW_seek,       /*   seek() method */
+    RAW_probe,      /*  probe() method */
+    RAW_view,       /*   view() method */
+    RAW_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_RAW */
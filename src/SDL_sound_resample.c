@@ -0,0 +1,533 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Sample rate conversion, for when the app picks something other than
+ *  SOUND_RESAMPLE_SDL with Sound_SetResampleQuality().
+ *
+ * Decoded audio is converted to float with the desired channel count first
+ *  (by SDL_AudioCVT, at the original rate), resampled here, and converted to
+ *  the desired format last. The resampler keeps a little bit of input
+ *  around between calls, so it isn't bothered by Sound_Decode() chopping
+ *  the stream into buffers; that's also why a seek or rewind has to reset it.
+ *
+ * Input is kept planar (one array per channel) so the filter loops are
+ *  straight dot products, which is what the SIMD code wants.
+ *
+ * The sinc tiers use a table of windowed-sinc filters: one per fractional
+ *  position ("phase"), interpolated between neighbouring phases. The cutoff
+ *  is lowered when downsampling, so we don't alias.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define SOUND_HAVE_SSE 1
+#include <xmmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SOUND_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define RESAMPLE_MAX_CHANNELS 8
+
+typedef struct __SOUND_RESAMPLER__
+{
+    Sound_ResampleQuality quality;
+    Uint32 channels;
+    Uint32 inrate;
+    Uint32 outrate;
+    int half_taps;         /* filter reaches this far on each side. */
+    int taps;              /* half_taps * 2 */
+    int phases;
+    float *filters;        /* (phases + 1) * taps coefficients. */
+    float *input[RESAMPLE_MAX_CHANNELS];  /* planar input, already converted. */
+    Uint32 input_len;      /* frames in (input). */
+    Uint32 input_alloc;    /* frames we have room for in (input). */
+    Uint32 pos;            /* input frame of the next output frame... */
+    Uint32 pos_num;        /* ...plus (pos_num / outrate) of a frame. */
+    Uint64 total_in;       /* frames fed in since the last reset. */
+    Uint64 total_out;      /* frames handed out since the last reset. */
+    int input_done;        /* decoder hit EOF, and we padded the end. */
+    SDL_AudioCVT cvt_in;   /* decoder output -> float, desired channels. */
+    SDL_AudioCVT cvt_out;  /* float -> desired format. */
+    Sound_FastConvertFunc fastcvt_out;
+} Sound_Resampler;
+
+
+static float dot_product(const float *a, const float *b, int len)
+{
+    float retval = 0.0f;
+    int i = 0;
+
+#if SOUND_HAVE_SSE
+    {
+        __m128 sum = _mm_setzero_ps();
+        float tmp[4];
+        for (; i + 4 <= len; i += 4)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        _mm_storeu_ps(tmp, sum);
+        retval = (tmp[0] + tmp[1]) + (tmp[2] + tmp[3]);
+    }
+#elif SOUND_HAVE_NEON
+    {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        float32x2_t half;
+        for (; i + 4 <= len; i += 4)
+            sum = vmlaq_f32(sum, vld1q_f32(a + i), vld1q_f32(b + i));
+        half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        retval = vget_lane_f32(vpadd_f32(half, half), 0);
+    }
+#endif
+
+    for (; i < len; i++)
+        retval += a[i] * b[i];
+
+    return retval;
+} /* dot_product */
+
+
+/* Build the filter table. Phase (p) is for an output p/phases of the way */
+/*  between two input frames. There's one extra phase, equal to phase zero */
+/*  shifted a frame over, so we can always interpolate with (p + 1). */
+static int build_filters(Sound_Resampler *r, const double rolloff)
+{
+    const int taps = r->taps;
+    const double pi = 3.14159265358979323846;
+    double cutoff = rolloff;
+    int p, k;
+
+    if (r->outrate < r->inrate)  /* downsampling; keep below new Nyquist. */
+        cutoff *= ((double) r->outrate) / ((double) r->inrate);
+
+    r->filters = (float *) __Sound_Malloc(sizeof (float) * taps * (r->phases + 1));
+    BAIL_IF_MACRO(r->filters == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    for (p = 0; p <= r->phases; p++)
+    {
+        const double frac = ((double) p) / ((double) r->phases);
+        float *filter = r->filters + (p * taps);
+        double sum = 0.0;
+
+        for (k = 0; k < taps; k++)
+        {
+            /* distance from this tap's input frame to the output's time. */
+            const double x = ((double) (k - r->half_taps + 1)) - frac;
+            const double w = x / ((double) r->half_taps);
+            double val;
+
+            if ((w <= -1.0) || (w >= 1.0))
+                val = 0.0;
+            else
+            {
+                const double sinc = (x == 0.0) ? 1.0 : (SDL_sin(pi * cutoff * x) / (pi * cutoff * x));
+                const double blackman = 0.42 + (0.5 * SDL_cos(pi * w)) + (0.08 * SDL_cos(2.0 * pi * w));
+                val = sinc * blackman;
+            } /* else */
+
+            filter[k] = (float) val;
+            sum += val;
+        } /* for */
+
+        /* normalize each phase, so DC comes out at the same level. */
+        for (k = 0; k < taps; k++)
+            filter[k] = (float) (filter[k] / sum);
+    } /* for */
+
+    return 1;
+} /* build_filters */
+
+
+static void reset_resampler(Sound_Resampler *r)
+{
+    Uint32 i;
+
+    /* start with enough silence that the first frame has history. */
+    r->input_len = (Uint32) (r->half_taps - 1);
+    for (i = 0; i < r->channels; i++)
+        SDL_memset(r->input[i], '\0', r->input_len * sizeof (float));
+
+    r->pos = r->input_len;
+    r->pos_num = 0;
+    r->total_in = 0;
+    r->total_out = 0;
+    r->input_done = 0;
+} /* reset_resampler */
+
+
+static int grow_input(Sound_Resampler *r, Uint32 frames)
+{
+    Uint32 newalloc = r->input_alloc;
+    Uint32 i;
+
+    if (r->input_len + frames <= r->input_alloc)
+        return 1;
+
+    while (newalloc < r->input_len + frames)
+        newalloc *= 2;
+
+    for (i = 0; i < r->channels; i++)
+    {
+        float *ptr = (float *) __Sound_Realloc(r->input[i], newalloc * sizeof (float));
+        BAIL_IF_MACRO(ptr == NULL, ERR_OUT_OF_MEMORY, 0);
+        r->input[i] = ptr;
+    } /* for */
+
+    r->input_alloc = newalloc;
+    return 1;
+} /* grow_input */
+
+
+/* append (frames) interleaved float frames, or silence if (src) is NULL. */
+static int put_input(Sound_Resampler *r, const float *src, Uint32 frames)
+{
+    const Uint32 channels = r->channels;
+    Uint32 i, ch;
+
+    if (!grow_input(r, frames))
+        return 0;
+
+    for (ch = 0; ch < channels; ch++)
+    {
+        float *dst = r->input[ch] + r->input_len;
+        if (src == NULL)
+            SDL_memset(dst, '\0', frames * sizeof (float));
+        else
+        {
+            for (i = 0; i < frames; i++)
+                dst[i] = src[(i * channels) + ch];
+        } /* else */
+    } /* for */
+
+    r->input_len += frames;
+    return 1;
+} /* put_input */
+
+
+/* How many output frames we can make from what's buffered right now. */
+static Uint32 available_output(const Sound_Resampler *r)
+{
+    const Uint32 last = r->input_len - 1;  /* newest input frame. */
+    Uint64 retval;
+
+    if ((r->input_len == 0) || (r->pos + (Uint32) r->half_taps > last))
+        retval = 0;
+    else
+    {
+        /* output (j) lands on input frame pos + (pos_num + j*inrate) / outrate, */
+        /*  and it's ready if its filter window ends at or before (last). */
+        const Uint64 ahead = ((Uint64) (last - r->half_taps - r->pos)) + 1;
+        retval = ((ahead * r->outrate) - r->pos_num + (r->inrate - 1)) / r->inrate;
+    } /* else */
+
+    if (r->input_done)  /* don't run on into the padding. */
+    {
+        const Uint64 total = ((r->total_in * r->outrate) + (r->inrate - 1)) / r->inrate;
+        const Uint64 left = (total > r->total_out) ? (total - r->total_out) : 0;
+        if (retval > left)
+            retval = left;
+    } /* if */
+
+    return (retval > 0xFFFFFFFF) ? 0xFFFFFFFF : (Uint32) retval;
+} /* available_output */
+
+
+static Uint32 get_output(Sound_Resampler *r, float *dst, Uint32 frames)
+{
+    const Uint32 channels = r->channels;
+    const int taps = r->taps;
+    const int first = 1 - r->half_taps;  /* offset of tap 0 from (pos). */
+    Uint32 avail = available_output(r);
+    Uint32 i, ch, keep;
+
+    if (frames > avail)
+        frames = avail;
+
+    for (i = 0; i < frames; i++)
+    {
+        const float frac = ((float) r->pos_num) / ((float) r->outrate);
+
+        if (r->quality == SOUND_RESAMPLE_LINEAR)
+        {
+            for (ch = 0; ch < channels; ch++)
+            {
+                const float *in = r->input[ch] + r->pos;
+                *(dst++) = in[0] + ((in[1] - in[0]) * frac);
+            } /* for */
+        } /* if */
+
+        else
+        {
+            const float p = frac * (float) r->phases;
+            const int phase = (int) p;
+            const float mix = p - (float) phase;
+            const float *f0 = r->filters + (phase * taps);
+            const float *f1 = f0 + taps;
+            for (ch = 0; ch < channels; ch++)
+            {
+                const float *in = r->input[ch] + r->pos + first;
+                const float a = dot_product(in, f0, taps);
+                const float b = dot_product(in, f1, taps);
+                *(dst++) = a + ((b - a) * mix);
+            } /* for */
+        } /* else */
+
+        r->pos_num += r->inrate;
+        while (r->pos_num >= r->outrate)
+        {
+            r->pos_num -= r->outrate;
+            r->pos++;
+        } /* while */
+    } /* for */
+
+    r->total_out += frames;
+
+    /* drop input that no future output frame can reach. */
+    keep = r->pos - (Uint32) (r->half_taps - 1);
+    if ((keep > 0) && (keep <= r->input_len))
+    {
+        for (ch = 0; ch < channels; ch++)
+            SDL_memmove(r->input[ch], r->input[ch] + keep, (r->input_len - keep) * sizeof (float));
+        r->input_len -= keep;
+        r->pos -= keep;
+    } /* if */
+
+    return frames;
+} /* get_output */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_SetupResampler(Sound_Sample *sample, const Sound_AudioInfo *desired,
+                              Sound_ResampleQuality quality)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const Uint32 dbytes = SDL_AUDIO_BITSIZE(desired->format) / 8;
+    Sound_AudioInfo floatinfo;
+    Sound_Resampler *r;
+    Uint32 len_mult = 1;
+    Uint32 i;
+
+    __Sound_FreeResampler(sample);
+
+    if ((quality == SOUND_RESAMPLE_SDL) || (sample->actual.rate == desired->rate))
+        return 1;  /* nothing for us to do. */
+
+    BAIL_IF_MACRO(desired->channels > RESAMPLE_MAX_CHANNELS, ERR_UNSUPPORTED_FORMAT, 0);
+
+    r = (Sound_Resampler *) __Sound_Calloc(1, sizeof (Sound_Resampler));
+    BAIL_IF_MACRO(r == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    r->quality = quality;
+    r->channels = desired->channels;
+    r->inrate = sample->actual.rate;
+    r->outrate = desired->rate;
+
+    if (quality == SOUND_RESAMPLE_LINEAR)
+    {
+        r->half_taps = 1;
+        r->taps = 2;
+    } /* if */
+    else
+    {
+        r->half_taps = (quality == SOUND_RESAMPLE_SINC_BEST) ? 24 : 8;
+        r->taps = r->half_taps * 2;
+        r->phases = (quality == SOUND_RESAMPLE_SINC_BEST) ? 256 : 64;
+        if (!build_filters(r, (quality == SOUND_RESAMPLE_SINC_BEST) ? 0.95 : 0.90))
+        {
+            __Sound_Free(r);
+            return 0;
+        } /* if */
+    } /* else */
+
+    r->input_alloc = 1024;
+    for (i = 0; i < r->channels; i++)
+    {
+        r->input[i] = (float *) __Sound_Malloc(r->input_alloc * sizeof (float));
+        if (r->input[i] == NULL)
+        {
+            internal->resampler = r;
+            __Sound_FreeResampler(sample);
+            BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
+        } /* if */
+    } /* for */
+
+    if ( (SDL_BuildAudioCVT(&r->cvt_in, sample->actual.format,
+                            sample->actual.channels, sample->actual.rate,
+                            AUDIO_F32SYS, desired->channels,
+                            sample->actual.rate) == -1) ||
+         (SDL_BuildAudioCVT(&r->cvt_out, AUDIO_F32SYS, desired->channels,
+                            desired->rate, desired->format, desired->channels,
+                            desired->rate) == -1) )
+    {
+        internal->resampler = r;
+        __Sound_FreeResampler(sample);
+        BAIL_MACRO(SDL_GetError(), 0);
+    } /* if */
+
+    floatinfo.format = AUDIO_F32SYS;
+    floatinfo.channels = desired->channels;
+    floatinfo.rate = desired->rate;
+    r->fastcvt_out = __Sound_ChooseFastConvert(&floatinfo, desired);
+
+    reset_resampler(r);
+    internal->resampler = r;
+
+    /*
+     * The decode buffer has to hold the decoder's output converted to float
+     *  (that's cvt_in's business), and a full buffer of our float output
+     *  before it goes to the desired format.
+     */
+    if (r->cvt_in.needed)
+        len_mult = SDL_max(len_mult, (Uint32) r->cvt_in.len_mult);
+    if (r->cvt_out.needed)
+        len_mult = SDL_max(len_mult, (Uint32) r->cvt_out.len_mult);
+    len_mult = SDL_max(len_mult, (sizeof (float) + dbytes - 1) / dbytes);
+    return len_mult;
+} /* __Sound_SetupResampler */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_ResetResampler(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    if (internal->resampler != NULL)
+        reset_resampler(internal->resampler);
+} /* __Sound_ResetResampler */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_FreeResampler(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Sound_Resampler *r = internal->resampler;
+    Uint32 i;
+
+    if (r == NULL)
+        return;
+
+    for (i = 0; i < RESAMPLE_MAX_CHANNELS; i++)
+        __Sound_Free(r->input[i]);
+    __Sound_Free(r->filters);
+    __Sound_Free(r);
+    internal->resampler = NULL;
+} /* __Sound_FreeResampler */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_ResamplerMemory(const Sound_Sample *sample)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    const Sound_Resampler *r = internal->resampler;
+    Uint32 retval;
+
+    if (r == NULL)
+        return 0;
+
+    retval = (Uint32) sizeof (Sound_Resampler);
+    retval += r->channels * r->input_alloc * (Uint32) sizeof (float);
+    if (r->filters != NULL)
+        retval += (Uint32) (sizeof (float) * r->taps * (r->phases + 1));
+    return retval;
+} /* __Sound_ResamplerMemory */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_Resample(Sound_Sample *sample, Uint8 *buf, Uint32 bufsize,
+                        Uint32 frames)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    Sound_Resampler *r = internal->resampler;
+    const Uint32 floatframe = sizeof (float) * r->channels;
+    const Uint32 inframe = (SDL_AUDIO_BITSIZE(sample->actual.format) / 8) * sample->actual.channels;
+    void *saved_buffer = internal->buffer;
+    const Uint32 saved_buffer_size = internal->buffer_size;
+    Uint32 chunk = bufsize / internal->sdlcvt.len_mult;
+    Uint32 rc;
+
+    chunk -= chunk % inframe;  /* don't hand the decoder a partial frame. */
+    BAIL_IF_MACRO(chunk == 0, ERR_INVALID_ARGUMENT, 0);
+
+    /* never make more float output than fits in (buf). */
+    if (frames > bufsize / floatframe)
+        frames = bufsize / floatframe;
+
+    internal->buffer = buf;
+    internal->buffer_size = chunk;
+
+    while ((available_output(r) < frames) && (!r->input_done))
+    {
+        Uint32 br = __Sound_DecoderRead(sample);
+        br -= br % inframe;
+
+        if ((br > 0) && (r->cvt_in.needed))
+        {
+            r->cvt_in.buf = buf;
+            r->cvt_in.len = (int) br;
+            SDL_ConvertAudio(&r->cvt_in);
+            br = (Uint32) r->cvt_in.len_cvt;
+        } /* if */
+
+        if ((br > 0) && (!put_input(r, (const float *) buf, br / floatframe)))
+        {
+            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+            break;
+        } /* if */
+        r->total_in += br / floatframe;
+
+        if (sample->flags & SOUND_SAMPLEFLAG_EOF)
+        {
+            /* pad the end, so the last real frames get a full filter. */
+            if (!put_input(r, NULL, (Uint32) r->half_taps + 1))
+            {
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+                break;
+            } /* if */
+            sample->flags &= ~SOUND_SAMPLEFLAG_EOF;  /* not for the app yet. */
+            r->input_done = 1;
+        } /* if */
+
+        else if ((br == 0) || (sample->flags & (SOUND_SAMPLEFLAG_ERROR | SOUND_SAMPLEFLAG_EAGAIN)))
+            break;  /* give the app what we have; try again later. */
+    } /* while */
+
+    internal->buffer = saved_buffer;
+    internal->buffer_size = saved_buffer_size;
+
+    rc = get_output(r, (float *) buf, frames) * floatframe;
+
+    if ((r->input_done) && (available_output(r) == 0))
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+
+    if ((rc > 0) && (r->fastcvt_out != NULL))
+        rc = r->fastcvt_out(buf, rc);
+    else if ((rc > 0) && (r->cvt_out.needed))
+    {
+        r->cvt_out.buf = buf;
+        r->cvt_out.len = (int) rc;
+        SDL_ConvertAudio(&r->cvt_out);
+        rc = (Uint32) r->cvt_out.len_cvt;
+    } /* else if */
+
+    return rc;
+} /* __Sound_Resample */
+
+/* end of SDL_sound_resample.c ... */
+
@@ -0,0 +1,219 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Compressed-resident samples, for Sound_NewSampleResident().
+ *
+ * The encoded stream is read into memory once, and the sample decodes from
+ *  there through one of SDL's constant-memory SDL_RWops, so to the decoders
+ *  it looks exactly like something that came from Sound_NewSampleFromMem().
+ *  Seeking and rewinding are just pointer moves, and a Vorbis or MP3 sound
+ *  effect costs its file size instead of ten times that in PCM.
+ *
+ * The bytes live in a refcounted block, with a ResidentData header in front
+ *  of them. Every sample decoding from the block has its own SDL_RWops on it
+ *  and holds a reference; we swap in our own close() method for that RWops
+ *  to drop it. This is how Sound_NewInstance() gives each instance of a
+ *  resident sample its own decoder without another copy of the data.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#define RESIDENT_CHUNK_SIZE (64 * 1024)
+
+typedef struct
+{
+    SDL_atomic_t refcount;
+    Uint32 len;
+    char *ext;     /* for opening instances with the same decoder. */
+} ResidentData;  /* (len) bytes of encoded data follow this. */
+
+
+static int SDLCALL resident_close(SDL_RWops *rw)
+{
+    ResidentData *res = ((ResidentData *) rw->hidden.mem.base) - 1;
+
+    if (SDL_AtomicDecRef(&res->refcount))
+    {
+        if (res->ext != NULL)
+            __Sound_Free(res->ext);
+        __Sound_Free(res);
+    } /* if */
+
+    SDL_FreeRW(rw);
+    return 0;
+} /* resident_close */
+
+
+/* Make another SDL_RWops on (res), with a new reference for it. */
+static SDL_RWops *resident_rw(ResidentData *res)
+{
+    SDL_RWops *rw = SDL_RWFromConstMem(res + 1, (int) res->len);
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+    rw->close = resident_close;
+    SDL_AtomicIncRef(&res->refcount);
+    return rw;
+} /* resident_rw */
+
+
+/*
+ * Read the rest of (rw) into a new ResidentData, with a refcount of zero.
+ *  Sizes the block right the first time if the stream knows how long it is.
+ */
+static ResidentData *read_resident(SDL_RWops *rw, const char *ext)
+{
+    const Sint64 size = SDL_RWsize(rw);
+    const Sint64 pos = SDL_RWtell(rw);
+    ResidentData *res;
+    Uint32 alloc = RESIDENT_CHUNK_SIZE;
+    Uint32 len = 0;
+    size_t br;
+
+    if ((size >= 0) && (pos >= 0) && (size >= pos))
+    {
+        BAIL_IF_MACRO(size - pos > 0x7FFFFFFF, ERR_OUT_OF_MEMORY, NULL);
+        alloc = (Uint32) (size - pos) + 1;  /* +1 to see EOF in one read. */
+    } /* if */
+
+    res = (ResidentData *) __Sound_Malloc(sizeof (ResidentData) + alloc);
+    BAIL_IF_MACRO(res == NULL, ERR_OUT_OF_MEMORY, NULL);
+
+    while ((br = SDL_RWread(rw, ((Uint8 *) (res + 1)) + len, 1, alloc - len)) > 0)
+    {
+        len += (Uint32) br;
+        if (len == alloc)
+        {
+            void *ptr;
+            if (alloc > 0x3FFFFFFF)
+            {
+                __Sound_Free(res);
+                BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+            } /* if */
+
+            alloc *= 2;
+            ptr = __Sound_Realloc(res, sizeof (ResidentData) + alloc);
+            if (ptr == NULL)
+            {
+                __Sound_Free(res);
+                BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+            } /* if */
+            res = (ResidentData *) ptr;
+        } /* if */
+    } /* while */
+
+    if (len == 0)
+    {
+        __Sound_Free(res);
+        BAIL_MACRO(ERR_UNSUPPORTED_FORMAT, NULL);
+    } /* if */
+
+    /* give back whatever we overshot by, if it's worth the trouble. */
+    if (alloc - len >= RESIDENT_CHUNK_SIZE)
+    {
+        void *ptr = __Sound_Realloc(res, sizeof (ResidentData) + len);
+        if (ptr != NULL)
+            res = (ResidentData *) ptr;
+    } /* if */
+
+    SDL_AtomicSet(&res->refcount, 0);
+    res->len = len;
+    res->ext = NULL;
+    if (ext != NULL)
+    {
+        res->ext = __Sound_StrDup(ext);
+        if (res->ext == NULL)
+        {
+            __Sound_Free(res);
+            BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+        } /* if */
+    } /* if */
+
+    return res;
+} /* read_resident */
+
+
+Sound_Sample *Sound_NewSampleResident(SDL_RWops *rw, const char *ext,
+                                      Sound_AudioInfo *desired,
+                                      Uint32 bufferSize)
+{
+    ResidentData *res;
+    SDL_RWops *memrw;
+
+    BAIL_IF_MACRO(rw == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    res = read_resident(rw, ext);
+    SDL_RWclose(rw);  /* we're done with it either way. */
+    if (res == NULL)
+        return NULL;  /* read_resident() set the error. */
+
+    memrw = resident_rw(res);
+    if (memrw == NULL)
+    {
+        if (res->ext != NULL)
+            __Sound_Free(res->ext);
+        __Sound_Free(res);
+        return NULL;
+    } /* if */
+
+    /* if this fails, it closes memrw, which frees res. */
+    return Sound_NewSample(memrw, ext, desired, bufferSize);
+} /* Sound_NewSampleResident */
+
+
+Sound_Sample *Sound_NewSampleFromFileResident(const char *filename,
+                                              Sound_AudioInfo *desired,
+                                              Uint32 bufferSize)
+{
+    const char *ext;
+    SDL_RWops *rw;
+
+    BAIL_IF_MACRO(filename == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    ext = SDL_strrchr(filename, '.');
+    if (ext != NULL)
+        ext++;
+
+    rw = SDL_RWFromFile(filename, "rb");
+    BAIL_IF_MACRO(rw == NULL, SDL_GetError(), NULL);
+
+    return Sound_NewSampleResident(rw, ext, desired, bufferSize);
+} /* Sound_NewSampleFromFileResident */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_IsResident(const Sound_Sample *sample)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    return ((internal->rw != NULL) && (internal->rw->close == resident_close));
+} /* __Sound_IsResident */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Sound_Sample *__Sound_NewResidentInstance(Sound_Sample *sample,
+                                          Uint32 bufferSize)
+{
+    const Sound_SampleInternal *internal = (const Sound_SampleInternal *) sample->opaque;
+    ResidentData *res = ((ResidentData *) internal->rw->hidden.mem.base) - 1;
+    SDL_RWops *rw = resident_rw(res);
+
+    if (rw == NULL)
+        return NULL;  /* resident_rw() set the error. */
+
+    if (bufferSize == 0)
+        bufferSize = sample->buffer_size;
+
+    return Sound_NewSample(rw, res->ext, &sample->desired, bufferSize);
+} /* __Sound_NewResidentInstance */
+
+/* end of SDL_sound_resident.c ... */
+
@@ -0,0 +1,417 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * A read-ahead SDL_RWops that wraps another one. Most of the decoders parse
+ *  their headers a few bytes at a time, and if the app's RWops is backed by
+ *  something expensive (an archive, a virtual filesystem, a socket...), each
+ *  of those tiny reads can cost a syscall. This reads in bigger blocks and
+ *  serves small reads from memory.
+ *
+ * Seeks that land inside the current block are handled without touching the
+ *  wrapped stream, which also means a decoder that peeks at a header and
+ *  seeks back can do so even on an unseekable stream. Any other seek throws
+ *  the block away and seeks the wrapped stream for real.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+typedef struct
+{
+    SDL_RWops *src;
+    Uint8 *buffer;
+    size_t buffer_size;
+    size_t buffer_pos;  /* next byte of (buffer) to hand out. */
+    size_t buffer_len;  /* valid bytes in (buffer). */
+    Sint64 offset;      /* position in (src) of buffer[0]. */
+} rwbuffer_t;
+
+
+static Sint64 SDLCALL rwbuffer_size(SDL_RWops *rw)
+{
+    rwbuffer_t *b = (rwbuffer_t *) rw->hidden.unknown.data1;
+    return SDL_RWsize(b->src);
+} /* rwbuffer_size */
+
+
+static Sint64 SDLCALL rwbuffer_seek(SDL_RWops *rw, Sint64 offset, int whence)
+{
+    rwbuffer_t *b = (rwbuffer_t *) rw->hidden.unknown.data1;
+    const Sint64 current = b->offset + (Sint64) b->buffer_pos;
+    Sint64 target;
+    Sint64 rc;
+
+    if (whence == RW_SEEK_SET)
+        target = offset;
+    else if (whence == RW_SEEK_CUR)
+        target = current + offset;
+    else  /* RW_SEEK_END: need the real stream for this one. */
+    {
+        rc = SDL_RWseek(b->src, offset, RW_SEEK_END);
+        if (rc >= 0)
+        {
+            b->offset = rc;
+            b->buffer_pos = b->buffer_len = 0;
+        } /* if */
+        return rc;
+    } /* else */
+
+    /* still inside what we've got buffered? Don't bother the source. */
+    if ((target >= b->offset) && (target <= b->offset + (Sint64) b->buffer_len))
+    {
+        b->buffer_pos = (size_t) (target - b->offset);
+        return target;
+    } /* if */
+
+    rc = SDL_RWseek(b->src, target, RW_SEEK_SET);
+    if (rc < 0)
+        return rc;  /* buffer is still valid, leave it alone. */
+
+    b->offset = rc;
+    b->buffer_pos = b->buffer_len = 0;
+    return rc;
+} /* rwbuffer_seek */
+
+
+static size_t SDLCALL rwbuffer_read(SDL_RWops *rw, void *ptr,
+                                    size_t size, size_t maxnum)
+{
+    rwbuffer_t *b = (rwbuffer_t *) rw->hidden.unknown.data1;
+    const size_t total = size * maxnum;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t copied = 0;
+
+    if (total == 0)
+        return 0;
+
+    while (copied < total)
+    {
+        size_t avail = b->buffer_len - b->buffer_pos;
+        size_t br;
+
+        if (avail > 0)
+        {
+            if (avail > total - copied)
+                avail = total - copied;
+            SDL_memcpy(dst + copied, b->buffer + b->buffer_pos, avail);
+            b->buffer_pos += avail;
+            copied += avail;
+            continue;
+        } /* if */
+
+        /* buffer is drained; move the window past it. */
+        b->offset += (Sint64) b->buffer_len;
+        b->buffer_pos = b->buffer_len = 0;
+
+        /* big reads go straight through, no sense copying them twice. */
+        if ((total - copied) >= b->buffer_size)
+        {
+            br = SDL_RWread(b->src, dst + copied, 1, total - copied);
+            b->offset += (Sint64) br;
+            copied += br;
+            break;
+        } /* if */
+
+        br = SDL_RWread(b->src, b->buffer, 1, b->buffer_size);
+        if (br == 0)
+            break;  /* EOF or error. */
+        b->buffer_len = br;
+    } /* while */
+
+    return copied / size;
+} /* rwbuffer_read */
+
+
+static size_t SDLCALL rwbuffer_write(SDL_RWops *rw, const void *ptr,
+                                     size_t size, size_t num)
+{
+    SDL_SetError("Buffered SDL_sound stream is read-only");
+    return 0;
+} /* rwbuffer_write */
+
+
+static int SDLCALL rwbuffer_close(SDL_RWops *rw)
+{
+    rwbuffer_t *b = (rwbuffer_t *) rw->hidden.unknown.data1;
+    const int retval = SDL_RWclose(b->src);
+    __Sound_Free(b->buffer);
+    __Sound_Free(b);
+    SDL_FreeRW(rw);
+    return retval;
+} /* rwbuffer_close */
+
+
+/*
+ * This is declared in the internal header.
+ */
+SDL_RWops *__Sound_RWBuffered(SDL_RWops *src, Uint32 bufsize)
+{
+    SDL_RWops *retval = NULL;
+    rwbuffer_t *b = NULL;
+
+    BAIL_IF_MACRO(src == NULL, ERR_INVALID_ARGUMENT, NULL);
+    BAIL_IF_MACRO(bufsize == 0, ERR_INVALID_ARGUMENT, NULL);
+
+    b = (rwbuffer_t *) __Sound_Calloc(1, sizeof (rwbuffer_t));
+    BAIL_IF_MACRO(b == NULL, ERR_OUT_OF_MEMORY, NULL);
+
+    b->buffer = (Uint8 *) __Sound_Malloc(bufsize);
+    retval = SDL_AllocRW();
+    if ((b->buffer == NULL) || (retval == NULL))
+    {
+        if (retval != NULL)
+            SDL_FreeRW(retval);
+        __Sound_Free(b->buffer);
+        __Sound_Free(b);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+    } /* if */
+
+    b->src = src;
+    b->buffer_size = bufsize;
+    b->offset = SDL_RWtell(src);
+    if (b->offset < 0)
+        b->offset = 0;  /* unseekable; we'll just count from here. */
+
+    retval->size = rwbuffer_size;
+    retval->seek = rwbuffer_seek;
+    retval->read = rwbuffer_read;
+    retval->write = rwbuffer_write;
+    retval->close = rwbuffer_close;
+    retval->type = SDL_RWOPS_UNKNOWN;
+    retval->hidden.unknown.data1 = b;
+    return retval;
+} /* __Sound_RWBuffered */
+
+
+/*
+ * A pass-through SDL_RWops that counts calls, bytes and time for the
+ *  sample's Sound_Stats. Only used when stats are turned on.
+ */
+typedef struct
+{
+    SDL_RWops *src;
+    Sound_Stats *stats;
+} rwcount_t;
+
+
+static Sint64 SDLCALL rwcount_size(SDL_RWops *rw)
+{
+    rwcount_t *c = (rwcount_t *) rw->hidden.unknown.data1;
+    return SDL_RWsize(c->src);
+} /* rwcount_size */
+
+
+static Sint64 SDLCALL rwcount_seek(SDL_RWops *rw, Sint64 offset, int whence)
+{
+    rwcount_t *c = (rwcount_t *) rw->hidden.unknown.data1;
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Sint64 retval = SDL_RWseek(c->src, offset, whence);
+    c->stats->io_ns += SDL_GetPerformanceCounter() - start;  /* ticks, really. */
+    c->stats->rw_seeks++;
+    return retval;
+} /* rwcount_seek */
+
+
+static size_t SDLCALL rwcount_read(SDL_RWops *rw, void *ptr,
+                                   size_t size, size_t maxnum)
+{
+    rwcount_t *c = (rwcount_t *) rw->hidden.unknown.data1;
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const size_t retval = SDL_RWread(c->src, ptr, size, maxnum);
+    c->stats->io_ns += SDL_GetPerformanceCounter() - start;
+    c->stats->rw_reads++;
+    c->stats->encoded_bytes += retval * size;
+    return retval;
+} /* rwcount_read */
+
+
+static size_t SDLCALL rwcount_write(SDL_RWops *rw, const void *ptr,
+                                    size_t size, size_t num)
+{
+    SDL_SetError("Counted SDL_sound stream is read-only");
+    return 0;
+} /* rwcount_write */
+
+
+static int SDLCALL rwcount_close(SDL_RWops *rw)
+{
+    rwcount_t *c = (rwcount_t *) rw->hidden.unknown.data1;
+    const int retval = SDL_RWclose(c->src);
+    __Sound_Free(c);
+    SDL_FreeRW(rw);
+    return retval;
+} /* rwcount_close */
+
+
+/*
+ * This is declared in the internal header.
+ */
+SDL_RWops *__Sound_RWCounted(SDL_RWops *src, Sound_Stats *stats)
+{
+    SDL_RWops *retval = NULL;
+    rwcount_t *c = NULL;
+
+    BAIL_IF_MACRO(src == NULL, ERR_INVALID_ARGUMENT, NULL);
+
+    c = (rwcount_t *) __Sound_Calloc(1, sizeof (rwcount_t));
+    BAIL_IF_MACRO(c == NULL, ERR_OUT_OF_MEMORY, NULL);
+    retval = SDL_AllocRW();
+    if (retval == NULL)
+    {
+        __Sound_Free(c);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, NULL);
+    } /* if */
+
+    c->src = src;
+    c->stats = stats;
+
+    retval->size = rwcount_size;
+    retval->seek = rwcount_seek;
+    retval->read = rwcount_read;
+    retval->write = rwcount_write;
+    retval->close = rwcount_close;
+    retval->type = SDL_RWOPS_UNKNOWN;
+    retval->hidden.unknown.data1 = c;
+    return retval;
+} /* __Sound_RWCounted */
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_RWAtEOF(SDL_RWops *rw)
+{
+    const Sint64 size = SDL_RWsize(rw);
+    Sint64 pos;
+
+    if (size < 0)
+        return 1;  /* no way to know; call it the end, like we always have. */
+
+    pos = SDL_RWtell(rw);
+    return ((pos < 0) || (pos >= size));
+} /* __Sound_RWAtEOF */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_InputReserve(Sound_InputBuffer *in, Uint32 bufsize)
+{
+    Uint8 *ptr;
+
+    if (bufsize <= in->alloc)
+        return 1;
+
+    ptr = (Uint8 *) __Sound_Realloc(in->data, bufsize);
+    BAIL_IF_MACRO(ptr == NULL, ERR_OUT_OF_MEMORY, 0);
+    in->data = ptr;
+    in->alloc = bufsize;
+    return 1;
+} /* __Sound_InputReserve */
+
+
+/*
+ * This is declared in the internal header.
+ */
+void __Sound_InputFree(Sound_InputBuffer *in)
+{
+    __Sound_Free(in->data);
+    SDL_zerop(in);
+} /* __Sound_InputFree */
+
+
+/*
+ * This is declared in the internal header.
+ */
+Uint32 __Sound_InputFill(SDL_RWops *rw, Sound_InputBuffer *in, Uint32 want)
+{
+    if (want > in->alloc)
+        want = in->alloc;
+
+    while ((!in->eof) && ((in->len - in->pos) < want))
+    {
+        size_t br;
+
+        if (in->pos > 0)  /* slide what's left to the front to make room. */
+        {
+            SDL_memmove(in->data, in->data + in->pos, in->len - in->pos);
+            in->len -= in->pos;
+            in->pos = 0;
+        } /* if */
+
+        br = SDL_RWread(rw, in->data + in->len, 1, in->alloc - in->len);
+        if (br == 0)
+        {
+            in->eof = __Sound_RWAtEOF(rw);
+            break;  /* either way, there's nothing more right now. */
+        } /* if */
+        in->len += (Uint32) br;
+    } /* while */
+
+    return in->len - in->pos;
+} /* __Sound_InputFill */
+
+
+/*
+ * This is declared in the internal header.
+ */
+size_t __Sound_InputRead(SDL_RWops *rw, Sound_InputBuffer *in,
+                         void *ptr, size_t len)
+{
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t copied = 0;
+
+    while (copied < len)
+    {
+        size_t avail = in->len - in->pos;
+        if (avail == 0)
+        {
+            if (in->eof)
+                break;
+            else if (__Sound_InputFill(rw, in, in->alloc) == 0)
+                break;  /* at the end, or behind, or broken; caller decides. */
+            avail = in->len - in->pos;
+        } /* if */
+
+        if (avail > len - copied)
+            avail = len - copied;
+        SDL_memcpy(dst + copied, in->data + in->pos, avail);
+        in->pos += (Uint32) avail;
+        copied += avail;
+    } /* while */
+
+    return copied;
+} /* __Sound_InputRead */
+
+
+/*
+ * This is declared in the internal header.
+ */
+int __Sound_InputSeek(SDL_RWops *rw, Sound_InputBuffer *in,
+                      Sint64 offset, int whence)
+{
+    if (whence == RW_SEEK_CUR)
+    {
+        /* still inside what we've got buffered? Don't bother the source. */
+        if ( (offset >= -((Sint64) in->pos)) &&
+             (offset <= (Sint64) (in->len - in->pos)) )
+        {
+            in->pos = (Uint32) (((Sint64) in->pos) + offset);
+            return 1;
+        } /* if */
+
+        offset -= (Sint64) (in->len - in->pos);  /* (rw) is this far ahead. */
+    } /* if */
+
+    in->pos = in->len = 0;
+    in->eof = 0;
+    return (SDL_RWseek(rw, offset, whence) != -1);
+} /* __Sound_InputSeek */
+
+/* end of SDL_sound_rwbuffer.c ... */
+
@@ -35,6 +35,25 @@
 
 #define SHN_BUFSIZ  512
 
+/*
+ * Shorten streams have nothing to seek with built in (there's a seek table
+ *  extension, but most files don't have it), so we make our own: every so
+ *  often, between blocks, the decoder's state is saved. Seeking restores the
+ *  closest saved state before the target, and decodes from there. Seeking
+ *  past what's been decoded so far just decodes forward.
+ */
+#define SHN_SEEKPOINT_SECONDS 1
+
+typedef struct
+{
+    Uint32 frame;       /* frames decoded before this point. */
+    Uint32 stream_pos;  /* RWops offset of the next byte not in bitbuf. */
+    Uint64 bitbuf;
+    int nbits;
+    Sint32 blocksize;
+    Sint32 bitshift;
+} shn_seekpoint;
+
 typedef struct
 {
     Sint32 version;
@@ -49,29 +68,27 @@ typedef struct
     Sint32 *qlpc;
     Sint32 lpcqoffset;
     Sint32 bitshift;
-    int nbitget;
+    Uint64 bitbuf;      /* next bits to read, starting at the top bit. */
+    int nbits;          /* valid bits in bitbuf. */
     int nbyteget;
     Uint8 *getbuf;
     Uint8 *getbufp;
-    Uint32 gbuffer;
     Uint8 *backBuffer;
     Uint32 backBufferSize;
+    Uint32 backBufPos;  /* where the leftovers in backBuffer start. */
     Uint32 backBufLeft;
     Uint32 start_pos;
+    Uint32 read_pos;    /* RWops offset just past what's in getbuf. */
+    Uint32 frame_pos;   /* frames decoded so far, backBuffer included. */
+    int eof;            /* hit SHN_FN_QUIT. */
+    shn_seekpoint *seekpoints;
+    Sint32 *seekstate;  /* each point's wrap and mean history. */
+    Uint32 seekpoint_count;
+    Uint32 seekpoint_alloc;
+    Uint32 next_seekpoint;  /* frame_pos to save the next point at. */
 } shn_t;
 
 
-static const Uint32 mask_table[] =
-{
-    0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x0000000F, 0x0000001F,
-    0x0000003F, 0x0000007F, 0x000000FF, 0x000001FF, 0x000003FF, 0x000007FF,
-    0x00000FFF, 0x00001FFF, 0x00003FFF, 0x00007FFF, 0x0000FFFF, 0x0001FFFF,
-    0x0003FFFF, 0x0007FFFF, 0x000FFFFF, 0x001FFFFF, 0x003FFFFF, 0x007FFFFF,
-    0x00FFFFFF, 0x01FFFFFF, 0x03FFFFFF, 0x07FFFFFF, 0x0FFFFFFF, 0x1FFFFFFF,
-    0x3FFFFFFF, 0x7FFFFFFF, 0xFFFFFFFF
-};
-
-
 static const Uint8 ulaw_outward[13][256] = {
 {127,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,255,254,253,252,251,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128},
 {112,114,116,118,120,122,124,126,127,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,113,115,117,119,121,123,125,255,253,251,249,247,245,243,241,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,254,252,250,248,246,244,242,240},
@@ -175,69 +192,118 @@ static const Uint8 ulaw_outward[13][256] = {
 #endif
 
 
-static int word_get(shn_t *shn, SDL_RWops *rw, Uint32 *word)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+/* count leading zeros; (x) must not be zero. */
+static SDL_INLINE int shn_clz64(Uint64 x)
 {
-    if (shn->nbyteget < 4)
-    {
-        shn->nbyteget += SDL_RWread(rw, shn->getbuf, 1, SHN_BUFSIZ);
-        BAIL_IF_MACRO(shn->nbyteget < 4, NULL, 0);
-        shn->getbufp = shn->getbuf;
-    } /* if */
+#if (defined(__GNUC__) && ((__GNUC__ > 3) || ((__GNUC__ == 3) && (__GNUC_MINOR__ >= 4)))) || defined(__clang__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanReverse64(&idx, x);
+    return 63 - (int) idx;
+#else
+    int retval = 0;
+    if ((x & 0xFFFFFFFF00000000ULL) == 0) { retval += 32; x <<= 32; }
+    if ((x & 0xFFFF000000000000ULL) == 0) { retval += 16; x <<= 16; }
+    if ((x & 0xFF00000000000000ULL) == 0) { retval += 8; x <<= 8; }
+    if ((x & 0xF000000000000000ULL) == 0) { retval += 4; x <<= 4; }
+    if ((x & 0xC000000000000000ULL) == 0) { retval += 2; x <<= 2; }
+    if ((x & 0x8000000000000000ULL) == 0) { retval += 1; }
+    return retval;
+#endif
+} /* shn_clz64 */
 
-    if (word != NULL)
+
+/*
+ * Top up the bit buffer from getbuf, and getbuf from the RWops. Shorten
+ *  streams are big-endian 32-bit words read from the top bit down, which
+ *  is the same thing as reading bytes from the top bit down. Returns zero
+ *  if there wasn't any more data; otherwise, there's at least 57 bits
+ *  ready, or everything that's left in the stream.
+ */
+static int bits_fill(shn_t *shn, SDL_RWops *rw)
+{
+    while (shn->nbits <= 56)
     {
-        *word = (((Sint32) shn->getbufp[0]) << 24) |
-                (((Sint32) shn->getbufp[1]) << 16) |
-                (((Sint32) shn->getbufp[2]) <<  8) |
-                (((Sint32) shn->getbufp[3])      );
-    } /* if */
+        if (shn->nbyteget == 0)
+        {
+            const size_t br = SDL_RWread(rw, shn->getbuf, 1, SHN_BUFSIZ);
+            if (br == 0)
+                return (shn->nbits > 0);
+            shn->nbyteget = (int) br;
+            shn->read_pos += br;
+            shn->getbufp = shn->getbuf;
+        } /* if */
 
-    shn->getbufp += 4;
-    shn->nbyteget -= 4;
+        if ((shn->nbits <= 32) && (shn->nbyteget >= 4))
+        {
+            const Uint64 word = (((Uint32) shn->getbufp[0]) << 24) |
+                                (((Uint32) shn->getbufp[1]) << 16) |
+                                (((Uint32) shn->getbufp[2]) <<  8) |
+                                (((Uint32) shn->getbufp[3])      );
+            shn->bitbuf |= word << (32 - shn->nbits);
+            shn->nbits += 32;
+            shn->getbufp += 4;
+            shn->nbyteget -= 4;
+        } /* if */
+        else
+        {
+            shn->bitbuf |= ((Uint64) *(shn->getbufp++)) << (56 - shn->nbits);
+            shn->nbits += 8;
+            shn->nbyteget--;
+        } /* else */
+    } /* while */
 
     return 1;
-} /* word_get */
+} /* bits_fill */
 
 
+/* Rice code: a unary prefix, a one bit, then (nbin) bits. */
 static int uvar_get(int nbin, shn_t *shn, SDL_RWops *rw, Sint32 *word)
 {
-    Sint32 result;
+    Sint32 result = 0;
 
-    if (shn->nbitget == 0)
+    while (1)
     {
-        BAIL_IF_MACRO(!word_get(shn, rw, &shn->gbuffer), NULL, 0);
-        shn->nbitget = 32;
-    } /* if */
+        int zeros;
+        if ((shn->nbits == 0) && (!bits_fill(shn, rw)))
+            BAIL_MACRO(NULL, 0);
 
-    for (result = 0; !(shn->gbuffer & (1L << --shn->nbitget)); result++)
-    {
-        if (shn->nbitget == 0)
+        if (shn->bitbuf == 0)  /* all the bits we have are prefix. */
         {
-            BAIL_IF_MACRO(!word_get(shn, rw, &shn->gbuffer), NULL, 0);
-            shn->nbitget = 32;
+            result += shn->nbits;
+            shn->nbits = 0;
+            continue;
         } /* if */
-    } /* for */
 
-    while (nbin != 0)
-    {
-        if (shn->nbitget >= nbin)
-        {
-            result = ( (result << nbin) |
-                        ((shn->gbuffer >> (shn->nbitget - nbin)) &
-                        mask_table[nbin]) );
-            shn->nbitget -= nbin;
-            break;
-        } /* if */
-        else
-        {
-            result = (result << shn->nbitget) |
-                     (shn->gbuffer & mask_table[shn->nbitget]);
-            BAIL_IF_MACRO(!word_get(shn, rw, &shn->gbuffer), NULL, 0);
-            nbin -= shn->nbitget;
-            shn->nbitget = 32;
-        } /* else */
+        zeros = shn_clz64(shn->bitbuf);
+        SDL_assert(zeros < shn->nbits);
+        result += zeros;
+        shn->bitbuf <<= zeros;
+        shn->bitbuf <<= 1;  /* two shifts, in case that was all 64 bits. */
+        shn->nbits -= zeros + 1;
+        break;
     } /* while */
 
+    if (nbin > 0)
+    {
+        Uint32 bits;
+        BAIL_IF_MACRO(nbin > 32, "SHN: Corrupt stream", 0);
+        if ((shn->nbits < nbin) && (!bits_fill(shn, rw)))
+            BAIL_MACRO(NULL, 0);
+        BAIL_IF_MACRO(shn->nbits < nbin, NULL, 0);
+
+        bits = (Uint32) (shn->bitbuf >> (64 - nbin));
+        shn->bitbuf <<= nbin;
+        shn->nbits -= nbin;
+        result = (nbin == 32) ? (Sint32) bits :
+                    (Sint32) ((((Uint32) result) << nbin) | bits);
+    } /* if */
+
     if (word != NULL)
         *word = result;
 
@@ -434,7 +500,7 @@ static Sint32 **shn_long2d(Uint32 n0, Uint32 n1)
     Sint32 **array0;
     Uint32 size = (n0 * sizeof (Sint32 *)) + (n0 * n1 * sizeof (Sint32));
 
-    array0 = (Sint32 **) SDL_malloc(size);
+    array0 = (Sint32 **) __Sound_Malloc(size);
     if (array0 != NULL)
     {
         int i;
@@ -533,6 +599,15 @@ static SDL_INLINE int parse_riff_header(shn_t *shn, Sound_Sample *sample)
 } /* parse_riff_header */
 
 
+static int SHN_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    /* with the extension, we search the whole stream; see SHN_open(). */
+    if ((ext != NULL) && (SDL_strcasecmp(ext, "shn") == 0))
+        return 1;
+    return ((len >= 4) && (SDL_memcmp(header, "ajkg", 4) == 0));
+} /* SHN_probe */
+
+
 static int SHN_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -543,7 +618,7 @@ static int SHN_open(Sound_Sample *sample, const char *ext)
     Sint32 chan;
 
     SDL_memset(shn, '\0', sizeof (shn_t));
-    shn->getbufp = shn->getbuf = (Uint8 *) SDL_malloc(SHN_BUFSIZ);
+    shn->getbufp = shn->getbuf = (Uint8 *) __Sound_Malloc(SHN_BUFSIZ);
     shn->datatype = SHN_TYPE_EOF;
     shn->nchan = DEFAULT_NCHAN;
     shn->blocksize = DEFAULT_BLOCK_SIZE;
@@ -588,7 +663,7 @@ static int SHN_open(Sound_Sample *sample, const char *ext)
 
     if (shn->maxnlpc > 0)
     {
-        shn->qlpc = (int *) SDL_malloc((Uint32) (shn->maxnlpc * sizeof (Sint32)));
+        shn->qlpc = (int *) __Sound_Malloc((Uint32) (shn->maxnlpc * sizeof (Sint32)));
         if (shn->qlpc == NULL)
         {
             __Sound_SetError(ERR_OUT_OF_MEMORY);
@@ -613,9 +688,9 @@ static int SHN_open(Sound_Sample *sample, const char *ext)
         return 0;
     } /* if */
 
-    shn->start_pos = SDL_RWtell(rw);
+    shn->start_pos = shn->read_pos = SDL_RWtell(rw);
 
-    shn = (shn_t *) SDL_malloc(sizeof (shn_t));
+    shn = (shn_t *) __Sound_Malloc(sizeof (shn_t));
     if (shn == NULL)
     {
         __Sound_SetError(ERR_OUT_OF_MEMORY);
@@ -627,17 +702,27 @@ static int SHN_open(Sound_Sample *sample, const char *ext)
 
     SNDDBG(("SHN: Accepting data stream.\n"));
     sample->flags = SOUND_SAMPLEFLAG_NONE;
+    internal->block_frames = (Uint32) shn->blocksize;  /* the rest goes to backBuffer. */
+    if (SDL_RWseek(rw, 0, RW_SEEK_CUR) >= 0)
+    {
+        /*
+         * Seeks are exact, but we don't set accurate_seek; seeking forward
+         *  into new territory means decoding everything up to there, which
+         *  would make Sound_DecodeAllParallel() slower, not faster.
+         */
+        sample->flags |= SOUND_SAMPLEFLAG_CANSEEK;
+    } /* if */
     return 1; /* we'll handle this data. */
 
 shn_open_puke:
     if (_shn.getbuf)
-        SDL_free(_shn.getbuf);
+        __Sound_Free(_shn.getbuf);
     if (_shn.buffer != NULL)
-        SDL_free(_shn.buffer);
+        __Sound_Free(_shn.buffer);
     if (_shn.offset != NULL)
-        SDL_free(_shn.offset);
+        __Sound_Free(_shn.offset);
     if (_shn.qlpc != NULL)
-        SDL_free(_shn.qlpc);
+        __Sound_Free(_shn.qlpc);
 
     return 0;
 } /* SHN_open */
@@ -681,137 +766,122 @@ static void SHN_close(Sound_Sample *sample)
     shn_t *shn = (shn_t *) internal->decoder_private;
 
     if (shn->qlpc != NULL)
-        SDL_free(shn->qlpc);
+        __Sound_Free(shn->qlpc);
 
     if (shn->backBuffer != NULL)
-        SDL_free(shn->backBuffer);
+        __Sound_Free(shn->backBuffer);
 
     if (shn->offset != NULL)
-        SDL_free(shn->offset);
+        __Sound_Free(shn->offset);
 
     if (shn->buffer != NULL)
-        SDL_free(shn->buffer);
+        __Sound_Free(shn->buffer);
 
     if (shn->getbuf != NULL)
-        SDL_free(shn->getbuf);
+        __Sound_Free(shn->getbuf);
 
-    SDL_free(shn);
-} /* SHN_close */
+    if (shn->seekpoints != NULL)
+        __Sound_Free(shn->seekpoints);
 
+    if (shn->seekstate != NULL)
+        __Sound_Free(shn->seekstate);
+
+    __Sound_Free(shn);
+} /* SHN_close */
 
-/* xLaw conversions... */
 
-/* adapted by ajr for int input */
-static Uint8 Slinear2ulaw(int sample)
+/* Sint32s of history each seek point saves. */
+static SDL_INLINE Uint32 seekstate_size(const shn_t *shn)
 {
-/*
-** This routine converts from linear to ulaw.
-**
-** Craig Reese: IDA/Supercomputing Research Center
-** Joe Campbell: Department of Defense
-** 29 September 1989
-**
-** References:
-** 1) CCITT Recommendation G.711  (very difficult to follow)
-** 2) "A New Digital Technique for Implementation of Any
-**     Continuous PCM Companding Law," Villeret, Michel,
-**     et al. 1973 IEEE Int. Conf. on Communications, Vol 1,
-**     1973, pg. 11.12-11.17
-** 3) MIL-STD-188-113,"Interoperability and Performance Standards
-**     for Analog-to_Digital Conversion Techniques,"
-**     17 February 1987
-**
-** Input: Signed 16 bit linear sample
-** Output: 8 bit ulaw sample
-*/
-
-#define BIAS 0x84   /* define the add-in bias for 16 bit samples */
-#define CLIP 32635
-
-  int sign, exponent, mantissa;
-  Uint8 ulawbyte;
-  static const int exp_lut[256] = {0,0,1,1,2,2,2,2,3,3,3,3,3,3,3,3,
-                                   4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-                                   5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-                                   5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-                                   6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-                                   6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-                                   6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-                                   6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-                                   7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7};
-
-    /* Get the sample into sign-magnitude. */
-    if (sample >= 0)
-        sign = 0;
-    else
-    {
-        sign = 0x80;
-        sample = -sample;
-    } /* else */
+    return (Uint32) (shn->nchan * (shn->nwrap + MAX_MACRO(1, shn->nmean)));
+} /* seekstate_size */
 
-    /* clip the magnitude */
-    if (sample > CLIP)
-        sample = CLIP;
 
-    /* Convert from 16 bit linear to ulaw. */
-    sample = sample + BIAS;
-    exponent = exp_lut[( sample >> 7 ) & 0xFF];
-    mantissa = (sample >> (exponent + 3)) & 0x0F;
-    ulawbyte = ~(sign | (exponent << 4) | mantissa);
+/* Save the decoder's state; this must be between blocks, at channel zero. */
+static void add_seekpoint(Sound_Sample *sample, shn_t *shn)
+{
+    const Uint32 statesize = seekstate_size(shn);
+    const int nmean = MAX_MACRO(1, shn->nmean);
+    shn_seekpoint *point;
+    Sint32 *state;
+    int chan;
 
-    return ulawbyte;
-} /* Slinear2ulaw */
+    if (shn->seekpoint_count == shn->seekpoint_alloc)
+    {
+        const Uint32 alloc = (shn->seekpoint_alloc == 0) ? 64 : shn->seekpoint_alloc * 2;
+        void *ptr = __Sound_Realloc(shn->seekpoints, alloc * sizeof (shn_seekpoint));
+        if (ptr == NULL)
+            return;  /* oh well, seeking will just be slower. */
+        shn->seekpoints = (shn_seekpoint *) ptr;
+
+        ptr = __Sound_Realloc(shn->seekstate, alloc * statesize * sizeof (Sint32));
+        if (ptr == NULL)
+            return;
+        shn->seekstate = (Sint32 *) ptr;
+        shn->seekpoint_alloc = alloc;
+    } /* if */
 
+    point = &shn->seekpoints[shn->seekpoint_count];
+    state = shn->seekstate + (shn->seekpoint_count * statesize);
+    point->frame = shn->frame_pos;
+    point->stream_pos = shn->read_pos - shn->nbyteget;
+    point->bitbuf = shn->bitbuf;
+    point->nbits = shn->nbits;
+    point->blocksize = shn->blocksize;
+    point->bitshift = shn->bitshift;
 
-/* this is derived from the Sun code - it is a bit simpler and has int input */
-#define QUANT_MASK      (0xf)           /* Quantization field mask. */
-#define NSEGS           (8)             /* Number of A-law segments. */
-#define SEG_SHIFT       (4)             /* Left shift for segment number. */
+    for (chan = 0; chan < shn->nchan; chan++)
+    {
+        SDL_memcpy(state, shn->buffer[chan] - shn->nwrap, shn->nwrap * sizeof (Sint32));
+        state += shn->nwrap;
+        SDL_memcpy(state, shn->offset[chan], nmean * sizeof (Sint32));
+        state += nmean;
+    } /* for */
 
+    shn->seekpoint_count++;
+    shn->next_seekpoint = shn->frame_pos + (sample->actual.rate * SHN_SEEKPOINT_SECONDS);
+} /* add_seekpoint */
 
-static Uint8 Slinear2alaw(Sint32 linear)
-{
-    int	seg;
-    Uint8 aval, mask;
-    static const Sint32 seg_aend[NSEGS] =
-    {
-        0x1f,0x3f,0x7f,0xff,0x1ff,0x3ff,0x7ff,0xfff
-    };
 
-    linear >>= 3;
-    if(linear >= 0)
-        mask = 0xd5;		/* sign (7th) bit = 1 */
-    else
-    {
-        mask = 0x55;		/* sign bit = 0 */
-        linear = -linear - 1;
-    } /* else */
+static int restore_seekpoint(Sound_Sample *sample, shn_t *shn, Uint32 idx)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const shn_seekpoint *point = &shn->seekpoints[idx];
+    const Sint32 *state = shn->seekstate + (idx * seekstate_size(shn));
+    const int nmean = MAX_MACRO(1, shn->nmean);
+    int chan;
 
-    /* Convert the scaled magnitude to segment number. */
-    for (seg = 0; (seg < NSEGS) && (linear > seg_aend[seg]); seg++);
+    BAIL_IF_MACRO(SDL_RWseek(internal->rw, point->stream_pos, RW_SEEK_SET) !=
+                  point->stream_pos, ERR_IO_ERROR, 0);
 
-    /* Combine the sign, segment, and quantization bits. */
-    if (seg >= NSEGS)    /* out of range, return maximum value. */
-        return (Uint8) (0x7F ^ mask);
+    shn->read_pos = point->stream_pos;
+    shn->nbyteget = 0;
+    shn->getbufp = shn->getbuf;
+    shn->bitbuf = point->bitbuf;
+    shn->nbits = point->nbits;
+    shn->blocksize = point->blocksize;
+    shn->bitshift = point->bitshift;
+    shn->frame_pos = point->frame;
+    shn->backBufPos = shn->backBufLeft = 0;
+    shn->eof = 0;
 
-    aval = (Uint8) seg << SEG_SHIFT;
-    if (seg < 2)
-        aval |= (linear >> 1) & QUANT_MASK;
-    else
-        aval |= (linear >> seg) & QUANT_MASK;
+    for (chan = 0; chan < shn->nchan; chan++)
+    {
+        SDL_memcpy(shn->buffer[chan] - shn->nwrap, state, shn->nwrap * sizeof (Sint32));
+        state += shn->nwrap;
+        SDL_memcpy(shn->offset[chan], state, nmean * sizeof (Sint32));
+        state += nmean;
+    } /* for */
 
-    return (aval ^ mask);
-} /* Slinear2alaw */
+    return 1;
+} /* restore_seekpoint */
 
 
-/* convert from signed ints to a given type and write */
+/*
+ * Convert from signed ints to a given type and write. If the whole block
+ *  fits in the output buffer, it goes straight there; otherwise, it goes to
+ *  backBuffer and the next read picks up the rest.
+ */
 static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -821,12 +891,19 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
     Sint32 nitem = shn->blocksize;
     int datasize = ((sample->actual.format & 0xFF) / 8);
     Uint32 bsiz = shn->nchan * nitem * datasize;
+    Uint8 *dst = ((Uint8 *) internal->buffer) + bw;
 
     SDL_assert(shn->backBufLeft == 0);
 
-    if (shn->backBufferSize < bsiz)
+    shn->frame_pos += nitem;
+
+    if ( (internal->buffer_size - bw < bsiz) ||
+         ((((size_t) dst) % datasize) != 0) )
+        dst = NULL;  /* doesn't fit; use backBuffer. */
+
+    if ((dst == NULL) && (shn->backBufferSize < bsiz))
     {
-        void *rc = SDL_realloc(shn->backBuffer, bsiz);
+        void *rc = __Sound_Realloc(shn->backBuffer, bsiz);
         if (rc == NULL)
         {
             sample->flags |= SOUND_SAMPLEFLAG_ERROR;
@@ -836,12 +913,15 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
         shn->backBufferSize = bsiz;
     } /* if */
 
+    if (dst == NULL)
+        dst = shn->backBuffer;
+
     switch (shn->datatype)
     {
         case SHN_TYPE_AU1: /* leave the conversion to fix_bitshift() */
         case SHN_TYPE_AU2:
         {
-            Uint8 *writebufp = shn->backBuffer;
+            Uint8 *writebufp = dst;
             if (shn->nchan == 1)
             {
                 for (i = 0; i < nitem; i++)
@@ -860,7 +940,7 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
 
         case SHN_TYPE_U8:
         {
-            Uint8 *writebufp = shn->backBuffer;
+            Uint8 *writebufp = dst;
             if (shn->nchan == 1)
             {
                 for (i = 0; i < nitem; i++)
@@ -879,7 +959,7 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
 
         case SHN_TYPE_S8:
         {
-            Sint8 *writebufp = (Sint8 *) shn->backBuffer;
+            Sint8 *writebufp = (Sint8 *) dst;
             if (shn->nchan == 1)
             {
                 for(i = 0; i < nitem; i++)
@@ -899,7 +979,7 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
         case SHN_TYPE_S16HL:
         case SHN_TYPE_S16LH:
         {
-            Sint16 *writebufp = (Sint16 *) shn->backBuffer;
+            Sint16 *writebufp = (Sint16 *) dst;
             if (shn->nchan == 1)
             {
                 for (i = 0; i < nitem; i++)
@@ -919,7 +999,7 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
         case SHN_TYPE_U16HL:
         case SHN_TYPE_U16LH:
         {
-            Uint16 *writebufp = (Uint16 *) shn->backBuffer;
+            Uint16 *writebufp = (Uint16 *) dst;
             if (shn->nchan == 1)
             {
                 for (i = 0; i < nitem; i++)
@@ -938,26 +1018,17 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
 
         case SHN_TYPE_ULAW:
         {
-            Uint8 *writebufp = shn->backBuffer;
-            if (shn->nchan == 1)
-            {
-                for(i = 0; i < nitem; i++)
-                    *writebufp++ = Slinear2ulaw(CAPMAXSHORT((data0[i] << 3)));
-            } /* if */
-            else
+            for (chan = 0; chan < shn->nchan; chan++)
             {
-                for(i = 0; i < nitem; i++)
-                {
-                    for(chan = 0; chan < shn->nchan; chan++)
-                        *writebufp++ = Slinear2ulaw(CAPMAXSHORT((shn->buffer[chan][i] << 3)));
-                } /* for */
-            } /* else */
+                __Sound_LinearToULaw(dst + chan, shn->nchan,
+                                     shn->buffer[chan], nitem, 3);
+            } /* for */
         } /* case */
         break;
 
         case SHN_TYPE_AU3:
         {
-            Uint8 *writebufp = shn->backBuffer;
+            Uint8 *writebufp = dst;
             if (shn->nchan == 1)
             {
                 for (i = 0; i < nitem; i++)
@@ -984,28 +1055,22 @@ static Uint32 put_to_buffers(Sound_Sample *sample, Uint32 bw)
 
         case SHN_TYPE_ALAW:
         {
-            Uint8 *writebufp = shn->backBuffer;
-            if (shn->nchan == 1)
-            {
-                for (i = 0; i < nitem; i++)
-                    *writebufp++ = Slinear2alaw(CAPMAXSHORT((data0[i] << 3)));
-            } /* if */
-            else
+            for (chan = 0; chan < shn->nchan; chan++)
             {
-                for (i = 0; i < nitem; i++)
-                {
-                    for(chan = 0; chan < shn->nchan; chan++)
-                        *writebufp++ = Slinear2alaw(CAPMAXSHORT((shn->buffer[chan][i] << 3)));
-                } /* for */
-            }/* else */
+                __Sound_LinearToALaw(dst + chan, shn->nchan,
+                                     shn->buffer[chan], nitem, 3);
+            } /* for */
         } /* case */
         break;
     } /* switch */
 
+    if (dst != shn->backBuffer)
+        return bsiz;
+
     i = MIN_MACRO(internal->buffer_size - bw, bsiz);
     SDL_memcpy((char *)internal->buffer + bw, shn->backBuffer, i);
+    shn->backBufPos = i;
     shn->backBufLeft = bsiz - i;
-    SDL_memcpy(shn->backBuffer, shn->backBuffer + i, shn->backBufLeft);
     return i;
 } /* put_to_buffers */
 
@@ -1016,7 +1081,6 @@ static Uint32 SHN_read(Sound_Sample *sample)
 {
     Uint32 retval = 0;
     Sint32 chan = 0;
-    Uint32 cpyBytes = 0;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     SDL_RWops *rw = internal->rw;
     shn_t *shn = (shn_t *) internal->decoder_private;
@@ -1028,16 +1092,25 @@ static Uint32 SHN_read(Sound_Sample *sample)
     if (shn->backBufLeft > 0)
     {
         retval = MIN_MACRO(shn->backBufLeft, internal->buffer_size);
-        SDL_memcpy(internal->buffer, shn->backBuffer, retval);
+        SDL_memcpy(internal->buffer, shn->backBuffer + shn->backBufPos, retval);
+        shn->backBufPos += retval;
         shn->backBufLeft -= retval;
-        SDL_memcpy(shn->backBuffer, shn->backBuffer + retval, shn->backBufLeft);
     } /* if */
 
     SDL_assert((shn->backBufLeft == 0) || (retval == internal->buffer_size));
 
+    if ((shn->eof) && (shn->backBufLeft == 0))
+    {
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+        return retval;
+    } /* if */
+
     /* get commands from file and execute them */
     while (retval < internal->buffer_size)
     {
+        if ((chan == 0) && (shn->frame_pos >= shn->next_seekpoint))
+            add_seekpoint(sample, shn);
+
         if (!uvar_get(SHN_FNSIZE, shn, rw, &cmd))
         {
             sample->flags |= SOUND_SAMPLEFLAG_ERROR;
@@ -1046,6 +1119,7 @@ static Uint32 SHN_read(Sound_Sample *sample)
 
         if (cmd == SHN_FN_QUIT)
         {
+            shn->eof = 1;
             sample->flags |= SOUND_SAMPLEFLAG_EOF;
             return retval;
         } /* if */
@@ -1255,35 +1329,112 @@ static int SHN_rewind(Sound_Sample *sample)
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     shn_t *shn = (shn_t *) internal->decoder_private;
 
-#if 0
-    int rc = SDL_RWseek(internal->rw, shn->start_pos, SEEK_SET);
-    BAIL_IF_MACRO(rc != shn->start_pos, ERR_IO_ERROR, 0);
-    /* !!! FIXME: set state. */
-    return 1;
-#else
+    /* nothing's been read since SHN_open(); we're already there. */
+    if ((shn->frame_pos == 0) && (shn->read_pos == shn->start_pos) &&
+        (shn->backBufLeft == 0) && (!shn->eof))
+        return 1;
+
     /*
-     * !!! FIXME: This is really unacceptable; state should be reset and
-     * !!! FIXME:  the RWops should be pointed to the start of the data
-     * !!! FIXME:  to decode. The below kludge adds unneeded overhead and
-     * !!! FIXME:  risk of failure.
+     * The first SHN_read() saves a seek point before it reads anything,
+     *  which is the state SHN_open() left us in, so going back there resets
+     *  everything in place.
      */
+    if ((shn->seekpoint_count > 0) && (shn->seekpoints[0].frame == 0))
+        return restore_seekpoint(sample, shn, 0);
+
+    /* couldn't save that point (out of memory?). Do it the slow way. */
     BAIL_IF_MACRO(SDL_RWseek(internal->rw, 0, SEEK_SET) != 0, ERR_IO_ERROR, 0);
     SHN_close(sample);
     return SHN_open(sample, "SHN");
-#endif
 } /* SHN_rewind */
 
 
+static int SHN_seek_frames(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    shn_t *shn = (shn_t *) internal->decoder_private;
+    const Uint32 framesize = shn->nchan * ((sample->actual.format & 0xFF) / 8);
+    const Uint32 target = (Uint32) frame;
+    Uint32 current = shn->frame_pos - (shn->backBufLeft / framesize);
+    void *saved_buffer = internal->buffer;
+    const Uint32 saved_buffer_size = internal->buffer_size;
+    Uint8 scratch[1024];
+    Uint32 skip;
+    Uint32 lo = 0;
+    Uint32 hi = shn->seekpoint_count;
+
+    BAIL_IF_MACRO(frame > 0xFFFFFFFF, ERR_PAST_EOF, 0);
+
+    /* find the last seek point at or before the target... */
+    while (lo < hi)
+    {
+        const Uint32 mid = lo + ((hi - lo) / 2);
+        if (shn->seekpoints[mid].frame <= target)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* while */
+
+    /* ...and go there, unless decoding on from here is closer. */
+    if ( (lo > 0) && ((target < current) ||
+                      (shn->seekpoints[lo - 1].frame > current)) )
+    {
+        BAIL_IF_MACRO(!restore_seekpoint(sample, shn, lo - 1), NULL, 0);
+        current = shn->frame_pos;
+    } /* if */
+
+    BAIL_IF_MACRO(target < current, "SHN: Can't seek backwards here", 0);
+
+    /* drop anything decoded between there and the target. */
+    skip = (target - current) * framesize;
+    if (shn->backBufLeft > 0)
+    {
+        const Uint32 cpy = MIN_MACRO(skip, shn->backBufLeft);
+        shn->backBufPos += cpy;
+        shn->backBufLeft -= cpy;
+        skip -= cpy;
+    } /* if */
+
+    internal->buffer = scratch;
+    while ((skip > 0) && (!shn->eof))
+    {
+        Uint32 br;
+        internal->buffer_size = MIN_MACRO(skip, sizeof (scratch));
+        br = SHN_read(sample);
+        if ((br == 0) || (sample->flags & SOUND_SAMPLEFLAG_ERROR))
+            break;
+        skip -= br;
+    } /* while */
+    internal->buffer = saved_buffer;
+    internal->buffer_size = saved_buffer_size;
+
+    BAIL_IF_MACRO(sample->flags & SOUND_SAMPLEFLAG_ERROR, NULL, 0);
+    return 1;  /* past the end just leaves us at EOF. */
+} /* SHN_seek_frames */
+
+
 static int SHN_seek(Sound_Sample *sample, Uint32 ms)
 {
-    /*
-     * (This CAN be done for SHNs that have a seek table at the end of the
-     *  stream, btw.)
-     */
-    BAIL_MACRO("SHN: Seeking not implemented", 0);
+    return SHN_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* SHN_seek */
 
 
+static Uint32 SHN_memory_usage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    shn_t *shn = (shn_t *) internal->decoder_private;
+    const Uint32 nchan = (Uint32) shn->nchan;
+    Uint32 retval = (Uint32) sizeof (shn_t) + SHN_BUFSIZ + shn->backBufferSize;
+
+    /* the shn_long2d() arrays: a row pointer and a row per channel. */
+    retval += nchan * (Uint32) (sizeof (Sint32 *) + (shn->blocksize + shn->nwrap) * sizeof (Sint32));
+    retval += nchan * (Uint32) (sizeof (Sint32 *) + MAX_MACRO(1, shn->nmean) * sizeof (Sint32));
+    retval += (Uint32) (MAX_MACRO(0, shn->maxnlpc) * sizeof (Sint32));
+    retval += shn->seekpoint_alloc * (Uint32) (sizeof (shn_seekpoint) + seekstate_size(shn) * sizeof (Sint32));
+    return retval;
+} /* SHN_memory_usage */
+
+
 static const char *extensions_shn[] = { "SHN", NULL };
 const Sound_DecoderFunctions __Sound_DecoderFunctions_SHN =
 {
@@ -1300,7 +1451,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_SHN =
     SHN_close,      /*  close() method */
     SHN_read,       /*   read() method */
     SHN_rewind,     /* rewind() method */
-    SHN_seek        /*   seek() method */
+    SHN_seek,       /*   seek() method */
+    SHN_probe,      /*  probe() method */
+    NULL,           /*   view() method */
+    SHN_seek_frames, /* seek_frames() method */
+    SHN_memory_usage /* memory_usage() method */
 };
 
 #endif  /* defined SOUND_SUPPORTS_SHN */
@@ -41,6 +41,15 @@ static void FMT_quit(void)
 } /* FMT_quit */
 
 
+static int FMT_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    if (header can NOT possibly be this format)
+        return 0;
+
+    return 1;  /* maybe; let FMT_open() decide. */
+} /* FMT_probe */
+
+
 static int FMT_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -135,7 +144,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_FMT =
     FMT_close,      /*  close() method */
     FMT_read,       /*   read() method */
     FMT_rewind,     /* rewind() method */
-    FMT_seek        /*   seek() method */
+    FMT_seek,       /*   seek() method */
+    FMT_probe,      /*  probe() method */
+    NULL,           /*   view() method */
+    NULL,           /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_FMT */
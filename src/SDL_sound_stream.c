@@ -0,0 +1,229 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/*
+ * Background streaming. A worker thread runs Sound_Decode() ahead of the
+ *  app and pushes the results into a ring buffer; the app pulls from the
+ *  other end with Sound_ReadStream(), which never blocks and never calls
+ *  into a decoder, so it's safe to use from an audio callback.
+ *
+ * The ring is single-producer/single-consumer: the worker only moves the
+ *  write counter, the reader only moves the read counter, and both are
+ *  atomics, so there is no lock between them. The counters run freely and
+ *  wrap at 2^32, which is why the ring size is a power of two.
+ */
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+typedef struct __SOUND_STREAM__
+{
+    Sound_Sample *sample;
+    SDL_Thread *thread;
+    SDL_sem *wakeup;
+    Uint8 *ring;
+    Uint32 ring_size;       /* power of two. */
+    Uint32 low_water;       /* wake the worker when we drop below this. */
+    SDL_atomic_t write_pos; /* only the worker changes this. */
+    SDL_atomic_t read_pos;  /* only the reader changes this. */
+    SDL_atomic_t sleeping;  /* worker is waiting for space. */
+    SDL_atomic_t done;      /* worker hit EOF/error; holds those flags. */
+    SDL_atomic_t quit;      /* Sound_StopStreaming() wants the worker gone. */
+} Sound_Stream;
+
+
+static void wake_worker(Sound_Stream *stream)
+{
+    if (SDL_AtomicCAS(&stream->sleeping, 1, 0))
+        SDL_SemPost(stream->wakeup);
+} /* wake_worker */
+
+
+/* copy (len) bytes into the ring at counter (pos), wrapping as needed. */
+static void ring_put(Sound_Stream *stream, Uint32 pos, const Uint8 *src, Uint32 len)
+{
+    const Uint32 offset = pos & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(len, stream->ring_size - offset);
+    SDL_memcpy(stream->ring + offset, src, first);
+    if (first < len)
+        SDL_memcpy(stream->ring, src + first, len - first);
+} /* ring_put */
+
+
+static void ring_get(Sound_Stream *stream, Uint32 pos, Uint8 *dst, Uint32 len)
+{
+    const Uint32 offset = pos & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(len, stream->ring_size - offset);
+    SDL_memcpy(dst, stream->ring + offset, first);
+    if (first < len)
+        SDL_memcpy(dst + first, stream->ring, len - first);
+} /* ring_get */
+
+
+static int SDLCALL stream_worker(void *data)
+{
+    Sound_Stream *stream = (Sound_Stream *) data;
+    Sound_Sample *sample = stream->sample;
+
+    while (!SDL_AtomicGet(&stream->quit))
+    {
+        const Uint32 wpos = (Uint32) SDL_AtomicGet(&stream->write_pos);
+        const Uint32 rpos = (Uint32) SDL_AtomicGet(&stream->read_pos);
+        const Uint32 space = stream->ring_size - (wpos - rpos);
+        Uint32 br;
+
+        if (space < sample->buffer_size)  /* full enough; wait for reader. */
+        {
+            SDL_AtomicSet(&stream->sleeping, 1);
+
+            /* recheck, in case the reader drained it before we flagged. */
+            if ((Uint32) SDL_AtomicGet(&stream->read_pos) == rpos)
+                SDL_SemWaitTimeout(stream->wakeup, 100);
+            SDL_AtomicSet(&stream->sleeping, 0);
+            continue;
+        } /* if */
+
+        br = Sound_Decode(sample);
+        if (br > 0)
+        {
+            ring_put(stream, wpos, (const Uint8 *) sample->buffer, br);
+            SDL_AtomicSet(&stream->write_pos, (int) (wpos + br));
+        } /* if */
+
+        if (sample->flags & (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR))
+        {
+            SDL_AtomicSet(&stream->done, (int) (sample->flags &
+                          (SOUND_SAMPLEFLAG_EOF | SOUND_SAMPLEFLAG_ERROR)));
+            break;
+        } /* if */
+
+        if ((br == 0) && (sample->flags & SOUND_SAMPLEFLAG_EAGAIN))
+            SDL_Delay(1);  /* decoder is starved itself; don't spin. */
+    } /* while */
+
+    return 0;
+} /* stream_worker */
+
+
+int Sound_StartStreaming(Sound_Sample *sample, Uint32 prefetch, Uint32 lowWater)
+{
+    Sound_SampleInternal *internal;
+    Sound_Stream *stream;
+    Uint32 size = 1;
+
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+    BAIL_IF_MACRO(internal->stream != NULL, ERR_IS_INITIALIZED, 0);
+    BAIL_IF_MACRO(!Sound_Resume(sample), NULL, 0);
+
+    /* need room for at least two decoded chunks to get anywhere. */
+    if (prefetch < sample->buffer_size * 2)
+        prefetch = sample->buffer_size * 2;
+    while ((size < prefetch) && (size < 0x80000000))
+        size <<= 1;
+    BAIL_IF_MACRO(size < prefetch, ERR_INVALID_ARGUMENT, 0);
+
+    stream = (Sound_Stream *) __Sound_Calloc(1, sizeof (Sound_Stream));
+    BAIL_IF_MACRO(stream == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    stream->sample = sample;
+    stream->ring_size = size;
+    stream->low_water = (lowWater == 0 || lowWater > size) ? (size / 2) : lowWater;
+    stream->ring = (Uint8 *) __Sound_Malloc(size);
+    stream->wakeup = SDL_CreateSemaphore(0);
+    if ((stream->ring == NULL) || (stream->wakeup == NULL))
+    {
+        if (stream->wakeup != NULL)
+            SDL_DestroySemaphore(stream->wakeup);
+        __Sound_Free(stream->ring);
+        __Sound_Free(stream);
+        BAIL_MACRO(ERR_OUT_OF_MEMORY, 0);
+    } /* if */
+
+    internal->stream = stream;
+    stream->thread = SDL_CreateThread(stream_worker, "SDL_sound stream", stream);
+    if (stream->thread == NULL)
+    {
+        internal->stream = NULL;
+        SDL_DestroySemaphore(stream->wakeup);
+        __Sound_Free(stream->ring);
+        __Sound_Free(stream);
+        BAIL_MACRO(SDL_GetError(), 0);
+    } /* if */
+
+    return 1;
+} /* Sound_StartStreaming */
+
+
+int Sound_StopStreaming(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal;
+    Sound_Stream *stream;
+
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+    stream = internal->stream;
+    if (stream == NULL)
+        return 1;  /* not streaming, nothing to do. */
+
+    SDL_AtomicSet(&stream->quit, 1);
+    SDL_SemPost(stream->wakeup);
+    SDL_WaitThread(stream->thread, NULL);
+
+    internal->stream = NULL;
+    SDL_DestroySemaphore(stream->wakeup);
+    __Sound_Free(stream->ring);
+    __Sound_Free(stream);
+    return 1;
+} /* Sound_StopStreaming */
+
+
+Uint32 Sound_ReadStream(Sound_Sample *sample, void *buffer, Uint32 len,
+                        Sound_SampleFlags *state)
+{
+    Sound_SampleInternal *internal;
+    Sound_Stream *stream;
+    Uint32 wpos, rpos, avail;
+    int done;
+
+    if (state != NULL)
+        *state = SOUND_SAMPLEFLAG_NONE;
+
+    BAIL_IF_MACRO(sample == NULL, ERR_INVALID_ARGUMENT, 0);
+    BAIL_IF_MACRO(buffer == NULL, ERR_INVALID_ARGUMENT, 0);
+    internal = (Sound_SampleInternal *) sample->opaque;
+    stream = internal->stream;
+    BAIL_IF_MACRO(stream == NULL, ERR_NOT_INITIALIZED, 0);
+
+    /* read (done) before (write_pos), so we can't miss the final chunk. */
+    done = SDL_AtomicGet(&stream->done);
+    wpos = (Uint32) SDL_AtomicGet(&stream->write_pos);
+    rpos = (Uint32) SDL_AtomicGet(&stream->read_pos);
+    avail = wpos - rpos;
+
+    if (len > avail)
+    {
+        len = avail;
+        if (state != NULL)
+            *state = done ? (Sound_SampleFlags) done : SOUND_SAMPLEFLAG_EAGAIN;
+    } /* if */
+
+    if (len > 0)
+    {
+        ring_get(stream, rpos, (Uint8 *) buffer, len);
+        SDL_AtomicSet(&stream->read_pos, (int) (rpos + len));
+    } /* if */
+
+    if ((avail - len) < stream->low_water)
+        wake_worker(stream);
+
+    return len;
+} /* Sound_ReadStream */
+
+/* end of SDL_sound_stream.c ... */
+
@@ -27,6 +27,16 @@
 
 #if SOUND_SUPPORTS_VOC
 
+/* One block of output, found while VOC_open() walks the file. */
+typedef struct
+{
+    Uint32  out_pos;        /* bytes of output before this block. */
+    Uint32  data_pos;       /* stream offset of the block's waveform data. */
+    Uint32  len;            /* bytes of output in this block. */
+    Uint8   silent;         /* silence blocks have no data to read. */
+    Uint8   size;           /* word length of data */
+} voc_block;
+
 /* Private data for VOC file */
 typedef struct vocstuff {
     Uint32  rest;           /* bytes remaining in current block */
@@ -41,6 +51,8 @@ typedef struct vocstuff {
     Uint32  bufpos;         /* byte position in internal->buffer. */
     Uint32  start_pos;      /* offset to seek to in stream when rewinding. */
     int     error;          /* error condition (as opposed to EOF). */
+    voc_block *blocks;      /* every block with output in it, in order. */
+    Uint32  block_count;
 } vs_t;
 
 
@@ -143,12 +155,11 @@ static int voc_get_block(Sound_Sample *sample, vs_t *v)
     Uint32 new_rate_long;
     Uint8 trash[6];
     Uint16 period;
-    Uint32 bytes_per_second;
     int i;
 
-    v->silent = 0;
     while (v->rest == 0)
     {
+        v->silent = 0;
         if (SDL_RWread(src, &block, sizeof (block), 1) != 1)
             return 1;  /* assume that's the end of the file. */
 
@@ -190,12 +201,6 @@ static int voc_get_block(Sound_Sample *sample, vs_t *v)
                 v->extended = 0;
                 v->rest = sblen - 2;
                 v->size = ST_SIZE_BYTE;
-
-                bytes_per_second = sample->actual.rate
-                    * sample->actual.channels;
-                internal->total_time += ( v->rest ) / bytes_per_second * 1000;
-                internal->total_time += (v->rest % bytes_per_second) * 1000
-                                            / bytes_per_second;
                 return 1;
 
             case VOC_DATA_16:
@@ -228,12 +233,6 @@ static int voc_get_block(Sound_Sample *sample, vs_t *v)
                 if (!voc_readbytes(src, v, trash, sizeof (Uint8) * 6))
                     return 0;
                 v->rest = sblen - 12;
-
-                bytes_per_second = ((v->size == ST_SIZE_WORD) ? (2) : (1)) *
-                                    sample->actual.rate * v->channels;
-                internal->total_time += v->rest / bytes_per_second * 1000;
-                internal->total_time += ( v->rest % bytes_per_second ) * 1000
-                                            / bytes_per_second;
                 return 1;
 
             case VOC_CONT:
@@ -262,9 +261,6 @@ static int voc_get_block(Sound_Sample *sample, vs_t *v)
                     v->rate = uc;
                 v->rest = period;
                 v->silent = 1;
-
-                internal->total_time += (period) / (v->rate) * 1000;
-                internal->total_time += (period % v->rate) * 1000 / v->rate;
                 return 1;
 
             case VOC_LOOP:
@@ -366,6 +362,7 @@ static int voc_read_waveform(Sound_Sample *sample, int fill_buf, Uint32 max)
 
         done = max;
         v->rest -= done;
+        v->bufpos += done;
     } /* if */
 
     else
@@ -405,6 +402,72 @@ static int voc_read_waveform(Sound_Sample *sample, int fill_buf, Uint32 max)
 } /* voc_read_waveform */
 
 
+/*
+ * Walk every block in the file, starting with the one voc_get_block() just
+ *  read, and note where each one's output lands. That gets us the length
+ *  up front, and lets VOC_seek() jump straight to the right block. This
+ *  only reads block headers; waveform data is skipped over.
+ */
+static void voc_build_index(Sound_Sample *sample, vs_t *v)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    SDL_RWops *src = internal->rw;
+    const Uint32 framesize = ((sample->actual.format & 0xFF) / 8) * sample->actual.channels;
+    Uint32 alloc = 0;
+    Uint32 out_pos = 0;
+
+    while (v->rest > 0)
+    {
+        const Sint64 pos = SDL_RWtell(src);
+        voc_block *block;
+
+        if (pos < 0)
+            break;
+
+        if (v->block_count == alloc)
+        {
+            void *ptr;
+            alloc = (alloc == 0) ? 16 : alloc * 2;
+            ptr = __Sound_Realloc(v->blocks, alloc * sizeof (voc_block));
+            if (ptr == NULL)
+            {
+                /* go without; VOC_seek() will do it the slow way. */
+                __Sound_Free(v->blocks);
+                v->blocks = NULL;
+                v->block_count = 0;
+                break;
+            } /* if */
+            v->blocks = (voc_block *) ptr;
+        } /* if */
+
+        block = &v->blocks[v->block_count++];
+        block->out_pos = out_pos;
+        block->data_pos = (Uint32) pos;
+        block->len = v->rest;
+        block->silent = (Uint8) v->silent;
+        block->size = (Uint8) v->size;
+        out_pos += v->rest;
+
+        if ((!v->silent) && (SDL_RWseek(src, v->rest, RW_SEEK_CUR) < 0))
+            break;
+
+        v->rest = 0;
+        if (!voc_get_block(sample, v))
+            break;  /* decoding will report this when it gets there. */
+    } /* while */
+
+    v->error = 0;
+    if ((framesize > 0) && (sample->actual.rate > 0))
+        internal->total_time = (Sint32) ((((Uint64) (out_pos / framesize)) * 1000) / sample->actual.rate);
+} /* voc_build_index */
+
+
+static int VOC_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    return ((len >= 20) && (SDL_memcmp(header, "Creative Voice File\032", 20) == 0));
+} /* VOC_probe */
+
+
 static int VOC_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -413,20 +476,20 @@ static int VOC_open(Sound_Sample *sample, const char *ext)
     if (!voc_check_header(internal->rw))
         return 0;
 
-    v = (vs_t *) SDL_calloc(1, sizeof (vs_t));
+    v = (vs_t *) __Sound_Calloc(1, sizeof (vs_t));
     BAIL_IF_MACRO(v == NULL, ERR_OUT_OF_MEMORY, 0);
 
     v->start_pos = SDL_RWtell(internal->rw);
     v->rate = -1;
     if (!voc_get_block(sample, v))
     {
-        SDL_free(v);
+        __Sound_Free(v);
         return 0;
     } /* if */
 
     if (v->rate == -1)
     {
-        SDL_free(v);
+        __Sound_Free(v);
         BAIL_MACRO("VOC: data had no sound!", 0);
     } /* if */
 
@@ -434,6 +497,19 @@ static int VOC_open(Sound_Sample *sample, const char *ext)
     sample->actual.format = (v->size == ST_SIZE_WORD) ? AUDIO_S16LSB:AUDIO_U8;
     sample->actual.channels = v->channels;
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
+    internal->accurate_seek = 1;
+
+    /* ...then go back for the first block, like VOC_rewind() does. */
+    voc_build_index(sample, v);
+    if (SDL_RWseek(internal->rw, v->start_pos, SEEK_SET) != v->start_pos)
+    {
+        __Sound_Free(v->blocks);
+        __Sound_Free(v);
+        BAIL_MACRO(ERR_IO_ERROR, 0);
+    } /* if */
+    v->rest = 0;
+    v->extended = 0;
+
     internal->decoder_private = v;
     return 1;
 } /* VOC_open */
@@ -442,7 +518,9 @@ static int VOC_open(Sound_Sample *sample, const char *ext)
 static void VOC_close(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    SDL_free(internal->decoder_private);
+    vs_t *v = (vs_t *) internal->decoder_private;
+    __Sound_Free(v->blocks);
+    __Sound_Free(v);
 } /* VOC_close */
 
 
@@ -454,7 +532,7 @@ static Uint32 VOC_read(Sound_Sample *sample)
     v->bufpos = 0;
     while (v->bufpos < internal->buffer_size)
     {
-        Uint32 rc = voc_read_waveform(sample, 1, internal->buffer_size);
+        Uint32 rc = voc_read_waveform(sample, 1, internal->buffer_size - v->bufpos);
         if (rc == 0)
         {
             sample->flags |= (v->error) ? 
@@ -483,20 +561,55 @@ static int VOC_rewind(Sound_Sample *sample)
     int rc = SDL_RWseek(internal->rw, v->start_pos, SEEK_SET);
     BAIL_IF_MACRO(rc != v->start_pos, ERR_IO_ERROR, 0);
     v->rest = 0;
+    v->extended = 0;
     return 1;
 } /* VOC_rewind */
 
 
+/* Jump right to (offset) bytes into the output, using the block index. */
+static int voc_seek_indexed(Sound_Sample *sample, vs_t *v, Uint32 offset)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    const voc_block *block;
+    Uint32 lo = 0;
+    Uint32 hi = v->block_count;
+    Uint32 pos;
+
+    while (lo < hi)  /* find the last block that starts at or before it. */
+    {
+        const Uint32 mid = lo + ((hi - lo) / 2);
+        if (v->blocks[mid].out_pos <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* while */
+
+    SDL_assert(lo > 0);  /* the first block starts at zero. */
+    block = &v->blocks[lo - 1];
+    if (offset > block->out_pos + block->len)
+        offset = block->out_pos + block->len;  /* past the end? EOF, then. */
+
+    offset -= block->out_pos;
+    pos = block->data_pos + (block->silent ? 0 : offset);
+    BAIL_IF_MACRO(SDL_RWseek(internal->rw, pos, RW_SEEK_SET) != pos, ERR_IO_ERROR, 0);
+
+    v->rest = block->len - offset;
+    v->silent = block->silent;
+    v->size = block->size;
+    v->extended = 0;
+    v->bufpos = 0;
+    return 1;
+} /* voc_seek_indexed */
+
+
 static int VOC_seek(Sound_Sample *sample, Uint32 ms)
 {
     /*
      * VOCs don't lend themselves well to seeking, since you have to
-     *  parse each section, which is an arbitrary size. The best we can do
-     *  is rewind, set a flag saying not to write the waveforms to a buffer,
-     *  and decode to the point that we want. Ugh. Fortunately, there's
-     *  really no such thing as a large VOC, due to the era and hardware that
-     *  spawned them, so even though this is inefficient, this is still a
-     *  relatively fast operation in most cases.
+     *  parse each section, which is an arbitrary size. VOC_open() builds an
+     *  index of the blocks, so normally we can go right there. If that
+     *  failed, the best we can do is rewind, set a flag saying not to write
+     *  the waveforms to a buffer, and decode to the point that we want.
      */
 
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -505,6 +618,9 @@ static int VOC_seek(Sound_Sample *sample, Uint32 ms)
     int origpos = SDL_RWtell(internal->rw);
     int origrest = v->rest;
 
+    if (v->block_count > 0)
+        return voc_seek_indexed(sample, v, offset);
+
     BAIL_IF_MACRO(!VOC_rewind(sample), NULL, 0);
 
     v->bufpos = 0;
@@ -542,7 +658,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_VOC =
     VOC_close,      /*  close() method */
     VOC_read,       /*   read() method */
     VOC_rewind,     /* rewind() method */
-    VOC_seek        /*   seek() method */
+    VOC_seek,       /*   seek() method */
+    VOC_probe,      /*  probe() method */
+    NULL,           /*   view() method */
+    NULL,           /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_VOC */
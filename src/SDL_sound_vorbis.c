@@ -53,9 +53,9 @@
 #define qsort SDL_qsort
 #define pow SDL_pow
 #define floor SDL_floor
-#define malloc SDL_malloc
-#define realloc SDL_realloc
-#define free SDL_free
+#define malloc __Sound_Malloc
+#define realloc __Sound_Realloc
+#define free __Sound_Free
 #define alloca(x) ((void *) SDL_stack_alloc(Uint8, (x)))
 #define dealloca(x) SDL_stack_free((x))
 #define ldexp(v, e) SDL_scalbn((v), (e))
@@ -95,31 +95,218 @@ static const char *vorbis_error_string(const int err)
     return "VORBIS: unknown error";
 } /* vorbis_error_string */
 
+/*
+ * stb_vorbis can carve everything it needs out of one buffer we hand it,
+ *  instead of doing dozens of mallocs for codebooks and tables on every
+ *  open and freeing them on close. Closed samples give their buffer back to
+ *  a small pool, so once things are warmed up, opening and closing lots of
+ *  short sound effects doesn't touch the heap at all.
+ *
+ * We don't know how much a stream needs until it's open, so arena_size
+ *  starts at a guess and grows to the largest stream seen so far; if a
+ *  stream doesn't fit, we try again with a bigger arena (and past
+ *  VORBIS_ARENA_MAX, let stb_vorbis use the heap like it used to).
+ */
+#define VORBIS_ARENA_MIN (256 * 1024)
+#define VORBIS_ARENA_MAX (16 * 1024 * 1024)
+#define VORBIS_ARENA_ROUND (64 * 1024)
+#define VORBIS_POOL_MAX 8  /* idle arenas kept around for reuse. */
+
+typedef struct VorbisArena
+{
+    struct VorbisArena *next;
+    Uint32 size;  /* bytes after this header. */
+} VorbisArena;
+
+static SDL_mutex *arena_mutex = NULL;
+static VorbisArena *arena_pool = NULL;
+static Uint32 arena_pool_count = 0;
+static Uint32 arena_size = VORBIS_ARENA_MIN;  /* guarded by arena_mutex. */
+
+/* Get an arena of at least (*size) bytes. Updates (*size) to the real one. */
+static VorbisArena *arena_get(Uint32 *size)
+{
+    VorbisArena *retval = NULL;
+    VorbisArena **prev;
+
+    SDL_LockMutex(arena_mutex);
+    if (*size < arena_size)
+        *size = arena_size;
+    for (prev = &arena_pool; *prev != NULL; prev = &(*prev)->next)
+    {
+        if ((*prev)->size >= *size)
+        {
+            retval = *prev;
+            *prev = retval->next;
+            arena_pool_count--;
+            break;
+        } /* if */
+    } /* for */
+    SDL_UnlockMutex(arena_mutex);
+
+    if (retval == NULL)
+    {
+        retval = (VorbisArena *) __Sound_Malloc(sizeof (VorbisArena) + *size);
+        if (retval == NULL)
+            return NULL;
+        retval->size = *size;
+    } /* if */
+
+    *size = retval->size;
+    retval->next = NULL;
+    return retval;
+} /* arena_get */
+
+/* Hand an arena back; it's pooled unless it's too small to be useful. */
+static void arena_put(VorbisArena *arena)
+{
+    if (arena == NULL)
+        return;
+
+    SDL_LockMutex(arena_mutex);
+    if ((arena->size >= arena_size) && (arena_pool_count < VORBIS_POOL_MAX))
+    {
+        arena->next = arena_pool;
+        arena_pool = arena;
+        arena_pool_count++;
+        arena = NULL;
+    } /* if */
+    SDL_UnlockMutex(arena_mutex);
+
+    __Sound_Free(arena);  /* no-op if it went in the pool. */
+} /* arena_put */
+
+/*
+ * Remember that streams can need (needed) bytes, for the next arena_get().
+ *  Pooled arenas that are now too small get freed.
+ */
+static void arena_note_size(Uint32 needed)
+{
+    VorbisArena *unwanted = NULL;
+
+    needed = (needed + (VORBIS_ARENA_ROUND - 1)) & ~(VORBIS_ARENA_ROUND - 1);
+    SDL_LockMutex(arena_mutex);
+    if ((needed > arena_size) && (needed <= VORBIS_ARENA_MAX))
+    {
+        VorbisArena **prev = &arena_pool;
+        arena_size = needed;
+        while (*prev != NULL)
+        {
+            VorbisArena *arena = *prev;
+            if (arena->size >= arena_size)
+                prev = &arena->next;
+            else
+            {
+                *prev = arena->next;
+                arena->next = unwanted;
+                unwanted = arena;
+                arena_pool_count--;
+            } /* else */
+        } /* while */
+    } /* if */
+    SDL_UnlockMutex(arena_mutex);
+
+    while (unwanted != NULL)
+    {
+        VorbisArena *next = unwanted->next;
+        __Sound_Free(unwanted);
+        unwanted = next;
+    } /* while */
+} /* arena_note_size */
+
+
 static int VORBIS_init(void)
 {
-    return 1;  /* always succeeds. */
+    arena_mutex = SDL_CreateMutex();
+    BAIL_IF_MACRO(arena_mutex == NULL, SDL_GetError(), 0);
+    arena_pool = NULL;
+    arena_pool_count = 0;
+    arena_size = VORBIS_ARENA_MIN;
+    return 1;
 } /* VORBIS_init */
 
 static void VORBIS_quit(void)
 {
-    /* it's a no-op. */
+    while (arena_pool != NULL)
+    {
+        VorbisArena *next = arena_pool->next;
+        __Sound_Free(arena_pool);
+        arena_pool = next;
+    } /* while */
+    arena_pool_count = 0;
+
+    SDL_DestroyMutex(arena_mutex);
+    arena_mutex = NULL;
 } /* VORBIS_quit */
 
+static int VORBIS_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    return ((len >= 4) && (SDL_memcmp(header, "OggS", 4) == 0));
+} /* VORBIS_probe */
+
+
 static int VORBIS_open(Sound_Sample *sample, const char *ext)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     SDL_RWops *rw = internal->rw;
+    const Sint64 start = SDL_RWtell(rw);
+    Uint32 size = 0;
     int err = 0;
-    stb_vorbis *stb = stb_vorbis_open_rwops(rw, 0, &err, NULL);
+    stb_vorbis *stb = NULL;
     unsigned int num_frames;
 
+    while (size <= VORBIS_ARENA_MAX)
+    {
+        stb_vorbis_alloc alloc;
+        VorbisArena *arena = arena_get(&size);
+        if (arena == NULL)
+            break;  /* let stb_vorbis try the heap. */
+
+        alloc.alloc_buffer = (char *) (arena + 1);
+        alloc.alloc_buffer_length_in_bytes = (int) arena->size;
+        stb = stb_vorbis_open_rwops(rw, 0, &err, &alloc);
+        if (stb != NULL)
+        {
+            const stb_vorbis_info info = stb_vorbis_get_info(stb);
+            arena_note_size(info.setup_memory_required +
+                            info.setup_temp_memory_required +
+                            info.temp_memory_required);
+            break;
+        } /* if */
+
+        if (err != VORBIS_outofmem)
+        {
+            arena_put(arena);
+            break;  /* not a space problem; more of it won't help. */
+        } /* if */
+
+        size *= 2;
+        arena_note_size(size);  /* so nobody else tries this one again. */
+        arena_put(arena);
+        BAIL_IF_MACRO(SDL_RWseek(rw, start, RW_SEEK_SET) != start, ERR_IO_ERROR, 0);
+    } /* while */
+
+    if ((stb == NULL) && ((err == VORBIS_outofmem) || (err == VORBIS__no_error)))
+    {
+        BAIL_IF_MACRO(SDL_RWseek(rw, start, RW_SEEK_SET) != start, ERR_IO_ERROR, 0);
+        stb = stb_vorbis_open_rwops(rw, 0, &err, NULL);  /* heap it is. */
+    } /* if */
+
     BAIL_IF_MACRO(!stb, vorbis_error_string(err), 0);
 
     SNDDBG(("VORBIS: Accepting data stream.\n"));
 
     internal->decoder_private = stb;
     sample->flags = SOUND_SAMPLEFLAG_CANSEEK;
-    sample->actual.format = AUDIO_F32SYS;
+    internal->accurate_seek = 1;
+    internal->block_frames = (Uint32) (stb->blocksize_1 / 2);  /* a long-block packet. */
+
+    /* stb_vorbis can make Sint16 itself, cheaper than converting later. */
+    if (sample->desired.format == AUDIO_S16SYS)
+        sample->actual.format = AUDIO_S16SYS;
+    else
+        sample->actual.format = AUDIO_F32SYS;
+
     sample->actual.channels = stb->channels;
     sample->actual.rate = stb->sample_rate;
     num_frames = stb_vorbis_stream_length_in_samples(stb);
@@ -140,7 +327,10 @@ static void VORBIS_close(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     stb_vorbis *stb = (stb_vorbis *) internal->decoder_private;
+    char *buffer = stb->alloc.alloc_buffer;  /* stb lives in here, too. */
     stb_vorbis_close(stb);
+    if (buffer != NULL)
+        arena_put(((VorbisArena *) buffer) - 1);
 } /* VORBIS_close */
 
 
@@ -152,11 +342,20 @@ static Uint32 VORBIS_read(Sound_Sample *sample)
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     stb_vorbis *stb = (stb_vorbis *) internal->decoder_private;
     const int channels = (int) sample->actual.channels;
-    const int want_samples = (int) (internal->buffer_size / sizeof (float));
 
     stb_vorbis_get_error(stb);  /* clear any error state */
-    rc = stb_vorbis_get_samples_float_interleaved(stb, channels, (float *) internal->buffer, want_samples);
-    retval = (Uint32) (rc * channels * sizeof (float));  /* rc == number of sample frames read */
+    if (sample->actual.format == AUDIO_S16SYS)
+    {
+        const int want_samples = (int) (internal->buffer_size / sizeof (Sint16));
+        rc = stb_vorbis_get_samples_short_interleaved(stb, channels, (short *) internal->buffer, want_samples);
+        retval = (Uint32) (rc * channels * sizeof (Sint16));  /* rc == number of sample frames read */
+    } /* if */
+    else
+    {
+        const int want_samples = (int) (internal->buffer_size / sizeof (float));
+        rc = stb_vorbis_get_samples_float_interleaved(stb, channels, (float *) internal->buffer, want_samples);
+        retval = (Uint32) (rc * channels * sizeof (float));  /* rc == number of sample frames read */
+    } /* else */
     err = stb_vorbis_get_error(stb);
 
     if (retval == 0)
@@ -186,18 +385,38 @@ static int VORBIS_rewind(Sound_Sample *sample)
 } /* VORBIS_rewind */
 
 
-static int VORBIS_seek(Sound_Sample *sample, Uint32 ms)
+static int VORBIS_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     stb_vorbis *stb = (stb_vorbis *) internal->decoder_private;
-    const float frames_per_ms = ((float) sample->actual.rate) / 1000.0f;
-    const Uint32 frame_offset = (Uint32) (frames_per_ms * ((float) ms));
-    const unsigned int sampnum = (unsigned int) frame_offset;
+    const unsigned int sampnum = (unsigned int) frame;
+    BAIL_IF_MACRO(frame > 0xFFFFFFFF, ERR_PAST_EOF, 0);
     BAIL_IF_MACRO(!stb_vorbis_seek(stb, sampnum), vorbis_error_string(stb_vorbis_get_error(stb)), 0);
     return 1;
+} /* VORBIS_seek_frames */
+
+
+static int VORBIS_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return VORBIS_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* VORBIS_seek */
 
 
+static Uint32 VORBIS_memory_usage(Sound_Sample *sample)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    stb_vorbis *stb = (stb_vorbis *) internal->decoder_private;
+    const stb_vorbis_info info = stb_vorbis_get_info(stb);
+    char *buffer = stb->alloc.alloc_buffer;
+
+    if (buffer != NULL)  /* the whole arena is ours, used or not. */
+        return (Uint32) sizeof (VorbisArena) + (((VorbisArena *) buffer) - 1)->size;
+
+    return (Uint32) sizeof (stb_vorbis) + info.setup_memory_required +
+           info.temp_memory_required;
+} /* VORBIS_memory_usage */
+
+
 static const char *extensions_vorbis[] = { "OGG", NULL };
 const Sound_DecoderFunctions __Sound_DecoderFunctions_VORBIS =
 {
@@ -214,7 +433,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_VORBIS =
     VORBIS_close,      /*  close() method */
     VORBIS_read,       /*   read() method */
     VORBIS_rewind,     /* rewind() method */
-    VORBIS_seek        /*   seek() method */
+    VORBIS_seek,       /*   seek() method */
+    VORBIS_probe,      /*  probe() method */
+    NULL,              /*   view() method */
+    VORBIS_seek_frames, /* seek_frames() method */
+    VORBIS_memory_usage /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_VORBIS */
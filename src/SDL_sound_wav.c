@@ -72,6 +72,8 @@ static SDL_INLINE int read_uint8(SDL_RWops *rw, Uint8 *ui8)
 
 #define FMT_NORMAL 0x0001    /* Uncompressed waveform data.     */
 #define FMT_ADPCM  0x0002    /* ADPCM compressed waveform data. */
+#define FMT_ALAW   0x0006    /* G.711 A-law waveform data. */
+#define FMT_MULAW  0x0007    /* G.711 µ-law waveform data. */
 #define FMT_IMA    0x0011    /* IMA ADPCM compressed waveform data. */
 
 typedef struct
@@ -80,20 +82,6 @@ typedef struct
     Sint16 iCoef2;
 } ADPCMCOEFSET;
 
-typedef struct
-{
-    Uint8 bPredictor;
-    Uint16 iDelta;
-    Sint16 iSamp1;
-    Sint16 iSamp2;
-} ADPCMBLOCKHEADER;
-
-typedef struct
-{
-    Sint16 iPrevSamp;
-    Uint8 iStepIndex;
-} IMAADPCMDATA;
-
 typedef struct S_WAV_FMT_T
 {
     Uint32 chunkID;
@@ -113,8 +101,9 @@ typedef struct S_WAV_FMT_T
 
     void (*free)(struct S_WAV_FMT_T *fmt);
     Uint32 (*read_sample)(Sound_Sample *sample);
+    Uint32 (*view_sample)(Sound_Sample *sample, const Uint8 **data, Uint32 len);
     int (*rewind_sample)(Sound_Sample *sample);
-    int (*seek_sample)(Sound_Sample *sample, Uint32 ms);
+    int (*seek_sample)(Sound_Sample *sample, Uint64 frame);
 
     union
     {
@@ -124,29 +113,23 @@ typedef struct S_WAV_FMT_T
             Uint16 wSamplesPerBlock;
             Uint16 wNumCoef;
             ADPCMCOEFSET *aCoef;
-            ADPCMBLOCKHEADER *blockheaders;
+            Uint8 *blockbuf;  /* one encoded block (wBlockAlign bytes). */
+            Sint16 *decoded;  /* one decoded block, for partial reads.  */
+            Uint32 block_frames;
             Uint32 samples_left_in_block;
-            int nibble_state;
-            Sint8 nibble;
         } adpcm;
 
         struct
         {
-            /* per channel decoder state */
-            IMAADPCMDATA *d;
-            /* auxiliary buffer */
-            Uint8 *buf;
+            Uint8 *buf;       /* one encoded block (wBlockAlign bytes). */
+            Sint16 *decoded;  /* one decoded block, for partial reads.  */
 
             Uint16 block_frames;
             Uint16 block_framesets;
             Uint16 enc_frameset_size;
             Uint16 headerset_size;
-            Uint16 dec_frame_size;
-            Uint16 dec_frameset_size;
-            Uint16 rem_block_framesets;
-
-            /* whether the next word(s) are the start of a new block */
-            int read_header;
+            Uint32 decoded_frames;
+            Uint32 samples_left_in_block;
         } ima;
 
         /* put other format-specific data here... */
@@ -263,14 +246,45 @@ static Uint32 read_sample_fmt_normal(Sound_Sample *sample)
 } /* read_sample_fmt_normal */
 
 
-static int seek_sample_fmt_normal(Sound_Sample *sample, Uint32 ms)
+/*
+ * Sound_DecodeView() lands here for uncompressed WAVs from memory...
+ */
+static Uint32 view_sample_fmt_normal(Sound_Sample *sample,
+                                     const Uint8 **data, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    wav_t *w = (wav_t *) internal->decoder_private;
+    Uint32 retval;
+
+    if (len > (Uint32) w->bytesLeft)
+        len = (Uint32) w->bytesLeft;
+
+    retval = __Sound_ViewRW(sample, data, len);
+    if (*data == NULL)
+        return 0;  /* not memory-backed; read it normally. */
+
+    w->bytesLeft -= retval;
+    if ((retval == 0) || (w->bytesLeft == 0))
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+
+    return retval;
+} /* view_sample_fmt_normal */
+
+
+static int seek_sample_fmt_normal(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
     fmt_t *fmt = w->fmt;
-    int offset = __Sound_convertMsToBytePos(&sample->actual, ms);
-    int pos = (int) (fmt->data_starting_offset + offset);
-    int rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
+    const Uint64 bytepos = __Sound_convertFramesToBytePos(&sample->actual, frame);
+    int offset;
+    int pos;
+    int rc;
+
+    BAIL_IF_MACRO(bytepos > fmt->total_bytes, ERR_PAST_EOF, 0);
+    offset = (int) bytepos;
+    pos = (int) (fmt->data_starting_offset + offset);
+    rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
     BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
     w->bytesLeft = fmt->total_bytes - offset;
     return 1;  /* success. */
@@ -289,6 +303,7 @@ static int read_fmt_normal(SDL_RWops *rw, fmt_t *fmt)
     /* (don't need to read more from the RWops...) */
     fmt->free = NULL;
     fmt->read_sample = read_sample_fmt_normal;
+    fmt->view_sample = view_sample_fmt_normal;
     fmt->rewind_sample = rewind_sample_fmt_normal;
     fmt->seek_sample = seek_sample_fmt_normal;
     return 1;
@@ -297,193 +312,261 @@ static int read_fmt_normal(SDL_RWops *rw, fmt_t *fmt)
 
 
 /*****************************************************************************
- * ADPCM compression handler...                                              *
+ * G.711 (A-law and µ-law) handler...                                        *
  *****************************************************************************/
 
-#define FIXED_POINT_COEF_BASE      256
-#define FIXED_POINT_ADAPTION_BASE  256
-#define SMALLEST_ADPCM_DELTA       16
-
-
-static SDL_INLINE int read_adpcm_block_headers(Sound_Sample *sample)
+/*
+ * Sound_Decode() lands here for A-law and µ-law WAVs. Each byte becomes a
+ *  16-bit sample, so we read into the front half of the buffer and expand
+ *  the data in place.
+ */
+static Uint32 read_sample_fmt_g711(Sound_Sample *sample)
 {
+    Uint32 retval;
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    SDL_RWops *rw = internal->rw;
     wav_t *w = (wav_t *) internal->decoder_private;
-    fmt_t *fmt = w->fmt;
-    ADPCMBLOCKHEADER *headers = fmt->fmt.adpcm.blockheaders;
-    int i;
-    int max = fmt->wChannels;
+    Uint8 *buf = (Uint8 *) internal->buffer;
+    Uint32 max = internal->buffer_size / 2;
 
-    if (w->bytesLeft < fmt->wBlockAlign)
-    {
+    if (max > (Uint32) w->bytesLeft)
+        max = (Uint32) w->bytesLeft;
+
+    SDL_assert(max > 0);
+
+    retval = SDL_RWread(internal->rw, buf, 1, max);
+
+    w->bytesLeft -= retval;
+
+        /* Make sure the read went smoothly... */
+    if ((retval == 0) || (w->bytesLeft == 0))
         sample->flags |= SOUND_SAMPLEFLAG_EOF;
+
+    else if (retval == -1)
+        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+
+        /* (next call this EAGAIN may turn into an EOF or error.) */
+    else if (retval < max)
+        sample->flags |= SOUND_SAMPLEFLAG_EAGAIN;
+
+    if (retval == (Uint32) -1)
         return 0;
-    } /* if */
 
-    w->bytesLeft -= fmt->wBlockAlign;
+    if (w->fmt->wFormatTag == FMT_ALAW)
+        __Sound_ALawToLinear((Sint16 *) buf, buf, retval);
+    else
+        __Sound_ULawToLinear((Sint16 *) buf, buf, retval);
+
+    return retval * 2;
+} /* read_sample_fmt_g711 */
 
-    for (i = 0; i < max; i++)
-        BAIL_IF_MACRO(!read_uint8(rw, &headers[i].bPredictor), NULL, 0);
 
-    for (i = 0; i < max; i++)
-        BAIL_IF_MACRO(!read_le16(rw, &headers[i].iDelta), NULL, 0);
+static int seek_sample_fmt_g711(Sound_Sample *sample, Uint64 frame)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    wav_t *w = (wav_t *) internal->decoder_private;
+    fmt_t *fmt = w->fmt;
+    /* the output is 16-bit, the file is 8-bit. */
+    const Uint64 bytepos = __Sound_convertFramesToBytePos(&sample->actual, frame) / 2;
+    int offset;
+    int pos;
+    int rc;
 
-    for (i = 0; i < max; i++)
-        BAIL_IF_MACRO(!read_le16s(rw, &headers[i].iSamp1), NULL, 0);
+    BAIL_IF_MACRO(bytepos > fmt->total_bytes, ERR_PAST_EOF, 0);
+    offset = (int) bytepos;
+    pos = (int) (fmt->data_starting_offset + offset);
+    rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
+    BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
+    w->bytesLeft = fmt->total_bytes - offset;
+    return 1;  /* success. */
+} /* seek_sample_fmt_g711 */
 
-    for (i = 0; i < max; i++)
-        BAIL_IF_MACRO(!read_le16s(rw, &headers[i].iSamp2), NULL, 0);
 
-    fmt->fmt.adpcm.samples_left_in_block = fmt->fmt.adpcm.wSamplesPerBlock;
-    fmt->fmt.adpcm.nibble_state = 0;
+static int read_fmt_g711(SDL_RWops *rw, fmt_t *fmt)
+{
+    /* (don't need to read more from the RWops...) */
+    BAIL_IF_MACRO(fmt->wBitsPerSample != 8, "WAV: Unsupported sample size.", 0);
+    fmt->free = NULL;
+    fmt->read_sample = read_sample_fmt_g711;
+    fmt->rewind_sample = rewind_sample_fmt_normal;
+    fmt->seek_sample = seek_sample_fmt_g711;
     return 1;
-} /* read_adpcm_block_headers */
+} /* read_fmt_g711 */
 
 
-static SDL_INLINE void do_adpcm_nibble(Uint8 nib,
-                                       ADPCMBLOCKHEADER *header,
-                                       Sint32 lPredSamp)
-{
-	static const Sint32 max_audioval = ((1<<(16-1))-1);
-	static const Sint32 min_audioval = -(1<<(16-1));
-	static const Sint32 AdaptionTable[] =
-    {
-		230, 230, 230, 230, 307, 409, 512, 614,
-		768, 614, 512, 409, 307, 230, 230, 230
-	};
 
-    Sint32 lNewSamp;
-    Sint32 delta;
+/*****************************************************************************
+ * ADPCM compression handler...                                              *
+ *****************************************************************************/
 
-    if (nib & 0x08)
-        lNewSamp = lPredSamp + (header->iDelta * (nib - 0x10));
-	else
-        lNewSamp = lPredSamp + (header->iDelta * nib);
+#define FIXED_POINT_COEF_BASE      256
+#define FIXED_POINT_ADAPTION_BASE  256
+#define SMALLEST_ADPCM_DELTA       16
 
-        /* clamp value... */
-    if (lNewSamp < min_audioval)
-        lNewSamp = min_audioval;
-    else if (lNewSamp > max_audioval)
-        lNewSamp = max_audioval;
 
-    delta = ((Sint32) header->iDelta * AdaptionTable[nib]) /
-              FIXED_POINT_ADAPTION_BASE;
+static const Sint32 adpcm_adaption_table[16] =
+{
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230
+};
 
-	if (delta < SMALLEST_ADPCM_DELTA)
-	    delta = SMALLEST_ADPCM_DELTA;
 
-    header->iDelta = delta;
-	header->iSamp2 = header->iSamp1;
-	header->iSamp1 = lNewSamp;
-} /* do_adpcm_nibble */
+static SDL_INLINE Sint16 adpcm_le16s(const Uint8 *p)
+{
+    return (Sint16) (((Uint16) p[0]) | (((Uint16) p[1]) << 8));
+} /* adpcm_le16s */
 
 
-static SDL_INLINE int decode_adpcm_sample_frame(Sound_Sample *sample)
+/*
+ * Decode one whole MS ADPCM block from (blk) into (frames) interleaved
+ *  Sint16 sample frames at (out). The block layout is a header of
+ *  per-channel predictor indexes, deltas and the two seed samples, followed
+ *  by nibbles interleaved across channels, high nibble first. Each channel
+ *  is decoded in its own pass, so the inner loop only carries that
+ *  channel's state and never has to reload per-frame bookkeeping.
+ *
+ * Nothing is written to (out) if the block is corrupt.
+ */
+static int decode_adpcm_block(const fmt_t *fmt, const Uint8 *blk,
+                              Uint32 frames, Sint16 *out)
 {
-    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
-    wav_t *w = (wav_t *) internal->decoder_private;
-    fmt_t *fmt = w->fmt;
-    ADPCMBLOCKHEADER *headers = fmt->fmt.adpcm.blockheaders;
-    SDL_RWops *rw = internal->rw;
-    int i;
-    int max = fmt->wChannels;
-    Sint32 delta;
-    Uint8 nib = fmt->fmt.adpcm.nibble;
+    const Uint32 chans = fmt->wChannels;
+    const Uint8 *nibbles = blk + (7 * chans);
+    Uint32 c;
+
+    for (c = 0; c < chans; c++)
+    {
+        BAIL_IF_MACRO(blk[c] >= fmt->fmt.adpcm.wNumCoef,
+                      "WAV: Corrupt ADPCM block", 0);
+    } /* for */
 
-    for (i = 0; i < max; i++)
+    for (c = 0; c < chans; c++)
     {
-        Uint8 byte;
-        Sint16 iCoef1 = fmt->fmt.adpcm.aCoef[headers[i].bPredictor].iCoef1;
-        Sint16 iCoef2 = fmt->fmt.adpcm.aCoef[headers[i].bPredictor].iCoef2;
-        Sint32 lPredSamp = ((headers[i].iSamp1 * iCoef1) +
-                            (headers[i].iSamp2 * iCoef2)) / 
-                             FIXED_POINT_COEF_BASE;
-
-        if (fmt->fmt.adpcm.nibble_state == 0)
+        const ADPCMCOEFSET *coef = &fmt->fmt.adpcm.aCoef[blk[c]];
+        const Sint32 iCoef1 = coef->iCoef1;
+        const Sint32 iCoef2 = coef->iCoef2;
+        Sint32 iDelta = (Uint16) adpcm_le16s(blk + chans + (c * 2));
+        Sint32 iSamp1 = adpcm_le16s(blk + (3 * chans) + (c * 2));
+        Sint32 iSamp2 = adpcm_le16s(blk + (5 * chans) + (c * 2));
+        Sint16 *dst = out + c;
+        Uint32 n = c;  /* nibble index into the block's data. */
+        Uint32 i;
+
+        /* the first two sample frames are stored verbatim in the header. */
+        *dst = (Sint16) iSamp2;
+        dst += chans;
+        if (frames > 1)
         {
-            BAIL_IF_MACRO(!read_uint8(rw, &nib), NULL, 0);
-            fmt->fmt.adpcm.nibble_state = 1;
-            do_adpcm_nibble(nib >> 4, &headers[i], lPredSamp);
+            *dst = (Sint16) iSamp1;
+            dst += chans;
         } /* if */
-        else
+
+        for (i = 2; i < frames; i++, n += chans, dst += chans)
         {
-            fmt->fmt.adpcm.nibble_state = 0;
-            do_adpcm_nibble(nib & 0x0F, &headers[i], lPredSamp);
-        } /* else */
+            const Uint32 nib = (nibbles[n >> 1] >> ((~n & 1) << 2)) & 0x0F;
+            const Sint32 lPredSamp = ((iSamp1 * iCoef1) + (iSamp2 * iCoef2)) /
+                                       FIXED_POINT_COEF_BASE;
+            Sint32 lNewSamp = lPredSamp + (iDelta * (((Sint32) nib ^ 8) - 8));
+            lNewSamp = SDL_max(SDL_min(lNewSamp, 32767), -32768);
+
+            iDelta = (Uint16) SDL_max((iDelta * adpcm_adaption_table[nib]) /
+                                        FIXED_POINT_ADAPTION_BASE,
+                                      SMALLEST_ADPCM_DELTA);
+            iSamp2 = iSamp1;
+            iSamp1 = lNewSamp;
+            *dst = (Sint16) lNewSamp;
+        } /* for */
     } /* for */
 
-    fmt->fmt.adpcm.nibble = nib;
     return 1;
-} /* decode_adpcm_sample_frame */
+} /* decode_adpcm_block */
 
 
-static SDL_INLINE void put_adpcm_sample_frame1(void *_buf, fmt_t *fmt)
+/*
+ * Read the next encoded block into the block buffer. Returns zero and sets
+ *  the EOF or ERROR flag on (sample) if there isn't another whole block.
+ */
+static int read_adpcm_block(Sound_Sample *sample)
 {
-    Uint16 *buf = (Uint16 *) _buf;
-    ADPCMBLOCKHEADER *headers = fmt->fmt.adpcm.blockheaders;
-    int i;
-    for (i = 0; i < fmt->wChannels; i++)
-        *(buf++) = headers[i].iSamp1;
-} /* put_adpcm_sample_frame1 */
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    wav_t *w = (wav_t *) internal->decoder_private;
+    fmt_t *fmt = w->fmt;
 
+    if (w->bytesLeft < fmt->wBlockAlign)
+    {
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+        return 0;
+    } /* if */
 
-static SDL_INLINE void put_adpcm_sample_frame2(void *_buf, fmt_t *fmt)
-{
-    Uint16 *buf = (Uint16 *) _buf;
-    ADPCMBLOCKHEADER *headers = fmt->fmt.adpcm.blockheaders;
-    int i;
-    for (i = 0; i < fmt->wChannels; i++)
-        *(buf++) = headers[i].iSamp2;
-} /* put_adpcm_sample_frame2 */
+    if (SDL_RWread(internal->rw, fmt->fmt.adpcm.blockbuf,
+                   fmt->wBlockAlign, 1) != 1)
+    {
+        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+        BAIL_MACRO(ERR_IO_ERROR, 0);
+    } /* if */
+
+    w->bytesLeft -= fmt->wBlockAlign;
+    return 1;
+} /* read_adpcm_block */
 
 
 /*
  * Sound_Decode() lands here for ADPCM-encoded WAVs...
+ *
+ * Blocks that fit in what's left of the output buffer are decoded straight
+ *  into it. Otherwise the block is decoded to (decoded) and handed out from
+ *  there over as many calls as it takes.
  */
 static Uint32 read_sample_fmt_adpcm(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
     fmt_t *fmt = w->fmt;
+    const Uint32 framesize = fmt->sample_frame_size;
+    const Uint32 block_frames = fmt->fmt.adpcm.block_frames;
+    Uint8 *out = (Uint8 *) internal->buffer;
+    Uint32 avail = internal->buffer_size / framesize;
     Uint32 bw = 0;
 
-    while (bw < internal->buffer_size)
+    while (avail > 0)
     {
-        /* write ongoing sample frame before reading more data... */
-        switch (fmt->fmt.adpcm.samples_left_in_block)
+        Uint32 left = fmt->fmt.adpcm.samples_left_in_block;
+        if (left > 0)  /* drain the partially-consumed block first. */
         {
-            case 0:  /* need to read a new block... */
-                if (!read_adpcm_block_headers(sample))
-                {
-                    if ((sample->flags & SOUND_SAMPLEFLAG_EOF) == 0)
-                        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-                    return bw;
-                } /* if */
-
-                /* only write first sample frame for now. */
-                put_adpcm_sample_frame2((Uint8 *) internal->buffer + bw, fmt);
-                fmt->fmt.adpcm.samples_left_in_block--;
-                bw += fmt->sample_frame_size;
-                break;
+            const Uint32 cpy = (left < avail) ? left : avail;
+            const Sint16 *src = fmt->fmt.adpcm.decoded +
+                                ((block_frames - left) * fmt->wChannels);
+            SDL_memcpy(out + bw, src, cpy * framesize);
+            fmt->fmt.adpcm.samples_left_in_block -= cpy;
+            bw += cpy * framesize;
+            avail -= cpy;
+            continue;
+        } /* if */
 
-            case 1:  /* output last sample frame of block... */
-                put_adpcm_sample_frame1((Uint8 *) internal->buffer + bw, fmt);
-                fmt->fmt.adpcm.samples_left_in_block--;
-                bw += fmt->sample_frame_size;
+        if (!read_adpcm_block(sample))
+            break;
+
+        if (block_frames <= avail)
+        {
+            if (!decode_adpcm_block(fmt, fmt->fmt.adpcm.blockbuf,
+                                    block_frames, (Sint16 *) (out + bw)))
+            {
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
                 break;
+            } /* if */
+            bw += block_frames * framesize;
+            avail -= block_frames;
+        } /* if */
 
-            default: /* output latest sample frame and read a new one... */
-                put_adpcm_sample_frame1((Uint8 *) internal->buffer + bw, fmt);
-                fmt->fmt.adpcm.samples_left_in_block--;
-                bw += fmt->sample_frame_size;
-
-                if (!decode_adpcm_sample_frame(sample))
-                {
-                    sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-                    return bw;
-                } /* if */
-        } /* switch */
+        else
+        {
+            if (!decode_adpcm_block(fmt, fmt->fmt.adpcm.blockbuf,
+                                    block_frames, fmt->fmt.adpcm.decoded))
+            {
+                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+                break;
+            } /* if */
+            fmt->fmt.adpcm.samples_left_in_block = block_frames;
+        } /* else */
     } /* while */
 
     return bw;
@@ -496,10 +579,13 @@ static Uint32 read_sample_fmt_adpcm(Sound_Sample *sample)
 static void free_fmt_adpcm(fmt_t *fmt)
 {
     if (fmt->fmt.adpcm.aCoef != NULL)
-        SDL_free(fmt->fmt.adpcm.aCoef);
+        __Sound_Free(fmt->fmt.adpcm.aCoef);
 
-    if (fmt->fmt.adpcm.blockheaders != NULL)
-        SDL_free(fmt->fmt.adpcm.blockheaders);
+    if (fmt->fmt.adpcm.blockbuf != NULL)
+        __Sound_Free(fmt->fmt.adpcm.blockbuf);
+
+    if (fmt->fmt.adpcm.decoded != NULL)
+        __Sound_Free(fmt->fmt.adpcm.decoded);
 } /* free_fmt_adpcm */
 
 
@@ -512,46 +598,42 @@ static int rewind_sample_fmt_adpcm(Sound_Sample *sample)
 } /* rewind_sample_fmt_adpcm */
 
 
-static int seek_sample_fmt_adpcm(Sound_Sample *sample, Uint32 ms)
+static int seek_sample_fmt_adpcm(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
     fmt_t *fmt = w->fmt;
-    Uint32 origsampsleft = fmt->fmt.adpcm.samples_left_in_block;
+    const Uint32 block_frames = fmt->fmt.adpcm.block_frames;
+    Uint32 block = (Uint32) (frame / block_frames);
+    Sint32 skipsize = (Sint32) (block * fmt->wBlockAlign);
     int origpos = SDL_RWtell(internal->rw);
-    int offset = __Sound_convertMsToBytePos(&sample->actual, ms);
-    int bpb = (fmt->fmt.adpcm.wSamplesPerBlock * fmt->sample_frame_size);
-    int skipsize = (offset / bpb) * fmt->wBlockAlign;
     int pos = skipsize + fmt->data_starting_offset;
-    int rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
+    int rc;
+
+    BAIL_IF_MACRO(frame / block_frames > 0xFFFFFFFF, ERR_PAST_EOF, 0);
+    BAIL_IF_MACRO(skipsize + fmt->wBlockAlign > (Sint32) fmt->total_bytes,
+                  ERR_IO_ERROR, 0);
+
+    rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
     BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
 
-    /* The offset we need is in this block, so we need to decode to there. */
-    skipsize += (offset % bpb);
-    rc = (offset % bpb);  /* bytes into this block we need to decode */
-    if (!read_adpcm_block_headers(sample))
+    /*
+     * The offset we need is in this block, so decode it whole and start
+     *  handing frames out from the right place. The block buffer is scratch,
+     *  so a failure here leaves the old position intact once we seek back.
+     */
+    if ((SDL_RWread(internal->rw, fmt->fmt.adpcm.blockbuf,
+                    fmt->wBlockAlign, 1) != 1) ||
+        (!decode_adpcm_block(fmt, fmt->fmt.adpcm.blockbuf,
+                             block_frames, fmt->fmt.adpcm.decoded)))
     {
         SDL_RWseek(internal->rw, origpos, SEEK_SET);  /* try to make sane. */
         return 0;
     } /* if */
 
-    /* first sample frame of block is a freebie. :) */
-    fmt->fmt.adpcm.samples_left_in_block--;
-    rc -= fmt->sample_frame_size;
-    while (rc > 0)
-    {
-        if (!decode_adpcm_sample_frame(sample))
-        {
-            SDL_RWseek(internal->rw, origpos, SEEK_SET);
-            fmt->fmt.adpcm.samples_left_in_block = origsampsleft;
-            return 0;
-        } /* if */
-
-        fmt->fmt.adpcm.samples_left_in_block--;
-        rc -= fmt->sample_frame_size;
-    } /* while */
-
-    w->bytesLeft = fmt->total_bytes - skipsize;
+    fmt->fmt.adpcm.samples_left_in_block = block_frames -
+                                           (Uint32) (frame % block_frames);
+    w->bytesLeft = fmt->total_bytes - (skipsize + fmt->wBlockAlign);
     return 1;  /* success. */
 } /* seek_sample_fmt_adpcm */
 
@@ -578,7 +660,7 @@ static int read_fmt_adpcm(SDL_RWops *rw, fmt_t *fmt)
     /* fmt->free() is always called, so these malloc()s will be cleaned up. */
 
     i = sizeof (ADPCMCOEFSET) * fmt->fmt.adpcm.wNumCoef;
-    fmt->fmt.adpcm.aCoef = (ADPCMCOEFSET *) SDL_malloc(i);
+    fmt->fmt.adpcm.aCoef = (ADPCMCOEFSET *) __Sound_Malloc(i);
     BAIL_IF_MACRO(fmt->fmt.adpcm.aCoef == NULL, ERR_OUT_OF_MEMORY, 0);
 
     for (i = 0; i < fmt->fmt.adpcm.wNumCoef; i++)
@@ -587,9 +669,28 @@ static int read_fmt_adpcm(SDL_RWops *rw, fmt_t *fmt)
         BAIL_IF_MACRO(!read_le16s(rw, &fmt->fmt.adpcm.aCoef[i].iCoef2), NULL, 0);
     } /* for */
 
-    i = sizeof (ADPCMBLOCKHEADER) * fmt->wChannels;
-    fmt->fmt.adpcm.blockheaders = (ADPCMBLOCKHEADER *) SDL_malloc(i);
-    BAIL_IF_MACRO(fmt->fmt.adpcm.blockheaders == NULL, ERR_OUT_OF_MEMORY, 0);
+    /*
+     * A block is a 7 byte header per channel, then one nibble per channel
+     *  for every sample frame after the two stored in the header. Trust
+     *  wBlockAlign over wSamplesPerBlock if they disagree, so we never
+     *  decode past the end of the block.
+     */
+    BAIL_IF_MACRO(fmt->wChannels == 0, "WAV: Invalid ADPCM format", 0);
+    BAIL_IF_MACRO(fmt->wBlockAlign < (7 * fmt->wChannels),
+                  "WAV: Invalid ADPCM block size", 0);
+    BAIL_IF_MACRO(fmt->fmt.adpcm.wSamplesPerBlock == 0,
+                  "WAV: Invalid ADPCM block size", 0);
+    i = 2 + ((fmt->wBlockAlign - (7 * fmt->wChannels)) * 2) / fmt->wChannels;
+    if (i > fmt->fmt.adpcm.wSamplesPerBlock)
+        i = fmt->fmt.adpcm.wSamplesPerBlock;
+    fmt->fmt.adpcm.block_frames = (Uint32) i;
+
+    fmt->fmt.adpcm.blockbuf = (Uint8 *) __Sound_Malloc(fmt->wBlockAlign);
+    BAIL_IF_MACRO(fmt->fmt.adpcm.blockbuf == NULL, ERR_OUT_OF_MEMORY, 0);
+
+    i = sizeof (Sint16) * fmt->wChannels * fmt->fmt.adpcm.block_frames;
+    fmt->fmt.adpcm.decoded = (Sint16 *) __Sound_Malloc(i);
+    BAIL_IF_MACRO(fmt->fmt.adpcm.decoded == NULL, ERR_OUT_OF_MEMORY, 0);
 
     return 1;
 } /* read_fmt_adpcm */
@@ -622,158 +723,199 @@ static const int ima_step_table[89] =
 /* 1 frameset = 4 bytes (per channel) = 8 nibbles = 8 frames */
 #define FRAMESET_FRAMES 8
 
+/*
+ * The two tables above, folded together: for decoder state (s) (the step
+ *  index times 16) and nibble (n), ima_diff_table[s+n] is the signed
+ *  difference to add to the previous sample and ima_next_state[s+n] is the
+ *  already-clamped state for the next nibble. This turns the per-nibble
+ *  bit tests and index clamping into two loads. Built by WAV_init().
+ */
+static Sint32 ima_diff_table[89 * 16];
+static Uint16 ima_next_state[89 * 16];
+
 
-static int read_ima_block_headers(SDL_RWops *rw, IMAADPCMDATA *d,
-                                  Uint16 chan_count, Sint16 *out)
+static void init_ima_tables(void)
 {
-    Uint16 i;
-    Uint8 dummy;
+    int i, nib;
 
-    for (i = 0; i < chan_count; i++)
+    for (i = 0; i < 89; i++)
     {
-        BAIL_IF_MACRO(!read_le16(rw, &d[i].iPrevSamp), NULL, 0);
-        BAIL_IF_MACRO(!read_uint8(rw, &d[i].iStepIndex), NULL, 0);
-        BAIL_IF_MACRO(!read_uint8(rw, &dummy), NULL, 0);
-
-        out[i] = d[i].iPrevSamp;
+        const int step = ima_step_table[i];
+        for (nib = 0; nib < 16; nib++)
+        {
+            int diff = step >> 3;
+            int index = i + ima_index_table[nib];
+
+            if (nib & 0x4)
+                diff += step >> 0;
+            if (nib & 0x2)
+                diff += step >> 1;
+            if (nib & 0x1)
+                diff += step >> 2;
+            if (nib & 0x8)
+                diff = -diff;
+
+            ima_diff_table[(i * 16) + nib] = diff;
+            ima_next_state[(i * 16) + nib] = SDL_max(SDL_min(index, 88), 0) * 16;
+        } /* for */
     } /* for */
-
-    return(1);
-} /* read_ima_block_headers */
+} /* init_ima_tables */
 
 
-static Sint16 decode_ima_nibble(Uint8 nibble, IMAADPCMDATA *state)
+/*
+ * Decode one IMA ADPCM block (a header per channel, then (framesets) groups
+ *  of 4 bytes per channel) into 1 + (framesets * 8) interleaved Sint16
+ *  sample frames at (out). Channels don't depend on each other, so each one
+ *  is decoded in its own pass with its state kept in locals.
+ */
+static void decode_ima_block(const fmt_t *fmt, const Uint8 *blk,
+                             Uint32 framesets, Sint16 *out)
 {
-    int step = ima_step_table[state->iStepIndex];
-    int diff = 0;
-    int samp, index;
-
-    if (nibble & 0x4)
-        diff += step >> 0;
-    if (nibble & 0x2)
-        diff += step >> 1;
-    if (nibble & 0x1)
-        diff += step >> 2;
-
-    diff += step >> 3;
+    const Uint32 chans = fmt->wChannels;
+    const Uint32 stride = fmt->fmt.ima.enc_frameset_size;
+    Uint32 c;
 
-    if (nibble & 0x8)
-        diff = -diff;
-
-    samp = state->iPrevSamp + diff;
-    samp = SDL_max(SDL_min(samp, 32767), -32768);
-    state->iPrevSamp = samp;
+    for (c = 0; c < chans; c++)
+    {
+        const Uint8 *hdr = blk + (c * 4);
+        const Uint8 *src = blk + fmt->fmt.ima.headerset_size + (c * 4);
+        Sint32 samp = (Sint16) (((Uint16) hdr[0]) | (((Uint16) hdr[1]) << 8));
+        Uint32 state = SDL_min(hdr[2], 88) * 16;
+        Sint16 *dst = out + c;
+        Uint32 i, j;
 
-    index = state->iStepIndex + ima_index_table[nibble];
-    state->iStepIndex = SDL_max(SDL_min(index, 88), 0);
+        *dst = (Sint16) samp;
+        dst += chans;
 
-    return samp;
-} /* decode_ima_nibble */
+        for (i = 0; i < framesets; i++, src += stride)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                const Uint32 lo = state + (src[j] & 0xF);
+                Uint32 hi;
+
+                samp += ima_diff_table[lo];
+                samp = SDL_max(SDL_min(samp, 32767), -32768);
+                state = ima_next_state[lo];
+                *dst = (Sint16) samp;
+                dst += chans;
+
+                hi = state + (src[j] >> 4);
+                samp += ima_diff_table[hi];
+                samp = SDL_max(SDL_min(samp, 32767), -32768);
+                state = ima_next_state[hi];
+                *dst = (Sint16) samp;
+                dst += chans;
+            } /* for */
+        } /* for */
+    } /* for */
+} /* decode_ima_block */
 
 
-static int read_ima_frameset(SDL_RWops *rw, wav_t *wav, Sint16 *out)
+/*
+ * Read the next (possibly short, at the end of the data) block into the
+ *  block buffer. Returns the number of framesets in it, or -1 and sets the
+ *  EOF or ERROR flag on (sample) if there isn't another block.
+ */
+static int read_ima_block(Sound_Sample *sample)
 {
-    fmt_t *fmt = wav->fmt;
-    Uint16 i, j;
-    Uint8 *fs_buf = fmt->fmt.ima.buf;
-    Uint32 fs_buf_size = fmt->fmt.ima.enc_frameset_size;
-    Uint16 chan_count = fmt->wChannels;
-    IMAADPCMDATA *data = fmt->fmt.ima.d;
-
-    /* read encoded frameset into temp buffer */
-    BAIL_IF_MACRO(!SDL_RWread(rw, fs_buf, fs_buf_size, 1), NULL, 0);
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    wav_t *w = (wav_t *) internal->decoder_private;
+    fmt_t *fmt = w->fmt;
+    Uint32 framesets;
+    Uint32 bytes;
 
-    for (i = 0; i < chan_count; i++)
+    if (w->bytesLeft < fmt->fmt.ima.headerset_size)
     {
-        for (j = 0; j < 4; j++)
-        {
-            Uint8 byte = fs_buf[i*4+j];
-            Sint16 *_out = out + j*chan_count*2+i;
+        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+        return -1;
+    } /* if */
 
-            /* low nibble */
-            *_out = decode_ima_nibble(byte & 0xF, &data[i]);
+    bytes = ((Uint32) w->bytesLeft < fmt->wBlockAlign) ?
+                (Uint32) w->bytesLeft : fmt->wBlockAlign;
 
-            _out += chan_count;
+    if (SDL_RWread(internal->rw, fmt->fmt.ima.buf, bytes, 1) != 1)
+    {
+        sample->flags |= SOUND_SAMPLEFLAG_ERROR;
+        BAIL_MACRO(ERR_IO_ERROR, -1);
+    } /* if */
 
-            /* high nibble */
-            *_out = decode_ima_nibble(byte >> 4, &data[i]);
-        }
-    } /* for */
+    w->bytesLeft -= bytes;
 
-    return(1);
-} /* read_ima_frameset */
+    framesets = (bytes - fmt->fmt.ima.headerset_size) /
+                    fmt->fmt.ima.enc_frameset_size;
+    if (framesets > fmt->fmt.ima.block_framesets)
+        framesets = fmt->fmt.ima.block_framesets;
+    return (int) framesets;
+} /* read_ima_block */
 
 
+/*
+ * Sound_Decode() lands here for IMA ADPCM-encoded WAVs...
+ *
+ * Same scheme as the MS ADPCM handler: whole blocks go straight into the
+ *  output buffer when they fit, otherwise through (decoded).
+ */
 static Uint32 read_sample_fmt_ima(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
     fmt_t *fmt = w->fmt;
-    void *const out_buf = internal->buffer;
+    const Uint32 framesize = fmt->sample_frame_size;
+    Uint8 *out = (Uint8 *) internal->buffer;
+    Uint32 avail = internal->buffer_size / framesize;
     Uint32 bw = 0;
-    int rc;
 
-    while (1)
+    while (avail > 0)
     {
-        if (fmt->fmt.ima.read_header)
-        {
-            if (w->bytesLeft < fmt->fmt.ima.headerset_size)
-            {
-                sample->flags |= SOUND_SAMPLEFLAG_EOF;
-                break;
-            } /* if */
-
-            if (bw+fmt->fmt.ima.dec_frame_size > internal->buffer_size)
-                break;
-
-            rc = read_ima_block_headers(internal->rw, fmt->fmt.ima.d,
-                                        fmt->wChannels, (Sint16*) (out_buf+bw));
-
-            if (!rc)
-            {
-                sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-                return 0;
-            } /* if */
-
-            w->bytesLeft -= fmt->fmt.ima.headerset_size;
-            bw += fmt->fmt.ima.dec_frame_size;
-
-            fmt->fmt.ima.read_header = 0;
-            fmt->fmt.ima.rem_block_framesets = fmt->fmt.ima.block_framesets;
-        } /* if */
-
-        if (w->bytesLeft < fmt->fmt.ima.enc_frameset_size)
+        Uint32 frames;
+        int framesets;
+        Uint32 left = fmt->fmt.ima.samples_left_in_block;
+        if (left > 0)  /* drain the partially-consumed block first. */
         {
-            sample->flags |= SOUND_SAMPLEFLAG_EOF;
-            break;
+            const Uint32 cpy = (left < avail) ? left : avail;
+            const Sint16 *src = fmt->fmt.ima.decoded +
+                    ((fmt->fmt.ima.decoded_frames - left) * fmt->wChannels);
+            SDL_memcpy(out + bw, src, cpy * framesize);
+            fmt->fmt.ima.samples_left_in_block -= cpy;
+            bw += cpy * framesize;
+            avail -= cpy;
+            continue;
         } /* if */
 
-        if (bw+fmt->fmt.ima.dec_frameset_size > internal->buffer_size)
+        framesets = read_ima_block(sample);
+        if (framesets < 0)
             break;
 
-        rc = read_ima_frameset(internal->rw, w, (Sint16*) (out_buf+bw));
-
-        if (!rc)
+        frames = 1 + (((Uint32) framesets) * FRAMESET_FRAMES);
+        if (frames <= avail)
         {
-            sample->flags |= SOUND_SAMPLEFLAG_ERROR;
-            return 0;
+            decode_ima_block(fmt, fmt->fmt.ima.buf, (Uint32) framesets,
+                             (Sint16 *) (out + bw));
+            bw += frames * framesize;
+            avail -= frames;
         } /* if */
 
-        bw += fmt->fmt.ima.dec_frameset_size;
-        w->bytesLeft -= fmt->fmt.ima.enc_frameset_size;
-
-        if (--fmt->fmt.ima.rem_block_framesets == 0)
-            fmt->fmt.ima.read_header = 1;
+        else
+        {
+            decode_ima_block(fmt, fmt->fmt.ima.buf, (Uint32) framesets,
+                             fmt->fmt.ima.decoded);
+            fmt->fmt.ima.decoded_frames = frames;
+            fmt->fmt.ima.samples_left_in_block = frames;
+        } /* else */
     } /* while */
 
-    return(bw);
+    return bw;
 } /* read_sample_fmt_ima */
 
 
 static void free_fmt_ima(fmt_t *fmt)
 {
-    free(fmt->fmt.ima.d);
-    free(fmt->fmt.ima.buf);
+    if (fmt->fmt.ima.buf != NULL)
+        __Sound_Free(fmt->fmt.ima.buf);
+
+    if (fmt->fmt.ima.decoded != NULL)
+        __Sound_Free(fmt->fmt.ima.decoded);
 } /* free_fmt_ima */
 
 
@@ -781,80 +923,62 @@ static int rewind_sample_fmt_ima(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
-    fmt_t *fmt = w->fmt;
-
-    fmt->fmt.ima.read_header = 1;
-
-    return(1);
+    w->fmt->fmt.ima.samples_left_in_block = 0;
+    return 1;
 } /* rewind_sample_fmt_ima */
 
 
-static int seek_sample_fmt_ima(Sound_Sample *sample, Uint32 ms)
+static int seek_sample_fmt_ima(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
     fmt_t *fmt = w->fmt;
-    Sint16 *dummy_buf = (Sint16*) (fmt->fmt.ima.buf +
-                                   fmt->fmt.ima.enc_frameset_size);
-    Uint32 i;
-    int rc, pos;
+    const Uint32 block_frames = 1 + (fmt->fmt.ima.block_framesets *
+                                     FRAMESET_FRAMES);
+    const Uint32 block = (Uint32) (frame / block_frames);
+    const Uint32 offset = (Uint32) (frame % block_frames);
+    Sint32 origbytesleft = w->bytesLeft;
+    int origpos = SDL_RWtell(internal->rw);
+    int pos = block * fmt->wBlockAlign + fmt->data_starting_offset;
+    int framesets;
+    Uint32 frames;
+    int rc;
 
-    Uint32 seek_frames = (fmt->dwSamplesPerSec * ms) / 1000;
-    Uint32 seek_blocks = seek_frames / fmt->fmt.ima.block_frames;
-    Uint32 seek_framesets;
-    seek_frames %= fmt->fmt.ima.block_frames;
+    BAIL_IF_MACRO(frame / block_frames > 0xFFFFFFFF, ERR_PAST_EOF, 0);
+    BAIL_IF_MACRO(block * fmt->wBlockAlign >= fmt->total_bytes, ERR_IO_ERROR, 0);
 
-    w->bytesLeft = fmt->total_bytes;
-    pos = seek_blocks * fmt->wBlockAlign + fmt->data_starting_offset;
     rc = SDL_RWseek(internal->rw, pos, SEEK_SET);
     BAIL_IF_MACRO(rc != pos, ERR_IO_ERROR, 0);
-    w->bytesLeft -= seek_blocks * fmt->wBlockAlign;
+    w->bytesLeft = fmt->total_bytes - (block * fmt->wBlockAlign);
 
-    fmt->fmt.ima.read_header = 0;
-
-    if (seek_frames == 0)
+    /* decode the block the offset is in, and start from the right frame. */
+    framesets = read_ima_block(sample);
+    if (framesets < 0)
     {
-        fmt->fmt.ima.read_header = 1;
-        return(1);
-    } /* if */
-
-    rc = read_ima_block_headers(internal->rw, fmt->fmt.ima.d,
-                                fmt->wChannels, dummy_buf);
-    BAIL_IF_MACRO(!rc, NULL, 0);
-    w->bytesLeft -= fmt->fmt.ima.headerset_size;
-
-    if (w->bytesLeft < fmt->fmt.ima.headerset_size)
-    {
-        sample->flags |= SOUND_SAMPLEFLAG_EOF;
-        return(1);
+        SDL_RWseek(internal->rw, origpos, SEEK_SET);  /* try to make sane. */
+        w->bytesLeft = origbytesleft;
+        return 0;
     } /* if */
 
-    seek_frames -= 1;
-    seek_framesets = seek_frames / FRAMESET_FRAMES;
-
-    for (i = 0; i < seek_framesets; i++)
-    {
-        rc = read_ima_frameset(internal->rw, w, dummy_buf);
-        BAIL_IF_MACRO(!rc, NULL, 0);
-        w->bytesLeft -= fmt->fmt.ima.enc_frameset_size;
-    } /* for */
-
-    fmt->fmt.ima.rem_block_framesets =
-        fmt->fmt.ima.block_framesets - seek_framesets;
-
-    if (w->bytesLeft < fmt->fmt.ima.enc_frameset_size)
-        sample->flags |= SOUND_SAMPLEFLAG_EOF;
+    frames = 1 + (((Uint32) framesets) * FRAMESET_FRAMES);
+    decode_ima_block(fmt, fmt->fmt.ima.buf, (Uint32) framesets,
+                     fmt->fmt.ima.decoded);
+    fmt->fmt.ima.decoded_frames = frames;
 
-    return(1);  /* success. */
+    fmt->fmt.ima.samples_left_in_block = (offset < frames) ? frames - offset : 0;
+    return 1;  /* success. */
 } /* seek_sample_fmt_ima */
 
 
 static int read_fmt_ima(SDL_RWops *rw, fmt_t *fmt)
 {
     Uint16 chan = fmt->wChannels;
-    Sint16 extraBytes;
+    Uint16 extraBytes;
+    Uint32 maxsets;
     int rc;
 
+    SDL_memset(&fmt->fmt.ima, '\0', sizeof (fmt->fmt.ima));
+
     /* setup function pointers */
     fmt->free = free_fmt_ima;
     fmt->read_sample = read_sample_fmt_ima;
@@ -868,18 +992,30 @@ static int read_fmt_ima(SDL_RWops *rw, fmt_t *fmt)
     rc = SDL_RWseek(rw, extraBytes-2, SEEK_CUR);
     BAIL_IF_MACRO(!rc, NULL, 0);
 
-    fmt->fmt.ima.block_framesets = (fmt->fmt.ima.block_frames-1) / FRAMESET_FRAMES;
     fmt->fmt.ima.enc_frameset_size = 4 * chan;
     fmt->fmt.ima.headerset_size = 4 * chan;
-    fmt->fmt.ima.dec_frame_size = sizeof(Uint16) * chan;
-    fmt->fmt.ima.dec_frameset_size = fmt->fmt.ima.dec_frame_size * FRAMESET_FRAMES;
-    fmt->fmt.ima.read_header = 1;
 
-    fmt->fmt.ima.d = malloc(sizeof(IMAADPCMDATA) * chan);
+    BAIL_IF_MACRO(chan == 0, "WAV: Invalid IMA ADPCM format", 0);
+    BAIL_IF_MACRO(fmt->wBlockAlign < fmt->fmt.ima.headerset_size,
+                  "WAV: Invalid IMA ADPCM block size", 0);
+    BAIL_IF_MACRO(fmt->fmt.ima.block_frames == 0,
+                  "WAV: Invalid IMA ADPCM block size", 0);
+
+    /* never trust the header to ask for more than a block can hold. */
+    maxsets = (fmt->wBlockAlign - fmt->fmt.ima.headerset_size) /
+                fmt->fmt.ima.enc_frameset_size;
+    fmt->fmt.ima.block_framesets = (fmt->fmt.ima.block_frames-1) / FRAMESET_FRAMES;
+    if (fmt->fmt.ima.block_framesets > maxsets)
+        fmt->fmt.ima.block_framesets = (Uint16) maxsets;
+
+    /* fmt->free() is always called, so these malloc()s will be cleaned up. */
+
+    fmt->fmt.ima.buf = (Uint8 *) __Sound_Malloc(fmt->wBlockAlign);
+    BAIL_IF_MACRO(fmt->fmt.ima.buf == NULL, ERR_OUT_OF_MEMORY, 0);
 
-    size_t buf_size = fmt->fmt.ima.enc_frameset_size +
-                      fmt->fmt.ima.dec_frameset_size;
-    fmt->fmt.ima.buf = malloc(buf_size);
+    fmt->fmt.ima.decoded = (Sint16 *) __Sound_Malloc(sizeof (Sint16) * chan *
+                     (1 + fmt->fmt.ima.block_framesets * FRAMESET_FRAMES));
+    BAIL_IF_MACRO(fmt->fmt.ima.decoded == NULL, ERR_OUT_OF_MEMORY, 0);
 
     return(1);
 } /* read_fmt_ima */
@@ -892,6 +1028,7 @@ static int read_fmt_ima(SDL_RWops *rw, fmt_t *fmt)
 
 static int WAV_init(void)
 {
+    init_ima_tables();
     return 1;  /* always succeeds. */
 } /* WAV_init */
 
@@ -915,6 +1052,11 @@ static int read_fmt(SDL_RWops *rw, fmt_t *fmt)
             SNDDBG(("WAV: Appears to be ADPCM compressed audio.\n"));
             return read_fmt_adpcm(rw, fmt);
 
+        case FMT_ALAW:
+        case FMT_MULAW:
+            SNDDBG(("WAV: Appears to be G.711 compressed audio.\n"));
+            return read_fmt_g711(rw, fmt);
+
         case FMT_IMA:
             if (fmt->wBitsPerSample == 4)
             {
@@ -962,6 +1104,13 @@ static int find_chunk(SDL_RWops *rw, Uint32 id)
 } /* find_chunk */
 
 
+static int WAV_probe(const Uint8 *header, Uint32 len, const char *ext)
+{
+    return ( (len >= 12) && (SDL_memcmp(header, "RIFF", 4) == 0) &&
+             (SDL_memcmp(header + 8, "WAVE", 4) == 0) );
+} /* WAV_probe */
+
+
 static int WAV_open_internal(Sound_Sample *sample, const char *ext, fmt_t *fmt)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -980,7 +1129,9 @@ static int WAV_open_internal(Sound_Sample *sample, const char *ext, fmt_t *fmt)
 
     sample->actual.channels = (Uint8) fmt->wChannels;
     sample->actual.rate = fmt->dwSamplesPerSec;
-    if (fmt->wBitsPerSample == 4)
+    if ((fmt->wFormatTag == FMT_ALAW) || (fmt->wFormatTag == FMT_MULAW))
+        sample->actual.format = AUDIO_S16SYS;  /* expanded as we read. */
+    else if (fmt->wBitsPerSample == 4)
         sample->actual.format = AUDIO_S16SYS;
     else if (fmt->wBitsPerSample == 8)
         sample->actual.format = AUDIO_U8;
@@ -999,7 +1150,7 @@ static int WAV_open_internal(Sound_Sample *sample, const char *ext, fmt_t *fmt)
     BAIL_IF_MACRO(!find_chunk(rw, dataID), "WAV: No data chunk.", 0);
     BAIL_IF_MACRO(!read_data_chunk(rw, &d), "WAV: Can't read data chunk.", 0);
 
-    w = (wav_t *) SDL_malloc(sizeof(wav_t));
+    w = (wav_t *) __Sound_Malloc(sizeof(wav_t));
     BAIL_IF_MACRO(w == NULL, ERR_OUT_OF_MEMORY, 0);
     w->fmt = fmt;
     fmt->total_bytes = w->bytesLeft = d.chunkSize;
@@ -1014,7 +1165,10 @@ static int WAV_open_internal(Sound_Sample *sample, const char *ext, fmt_t *fmt)
 
     sample->flags = SOUND_SAMPLEFLAG_NONE;
     if (fmt->seek_sample != NULL)
+    {
         sample->flags |= SOUND_SAMPLEFLAG_CANSEEK;
+        internal->accurate_seek = 1;
+    } /* if */
 
     SNDDBG(("WAV: Accepting data stream.\n"));
     return 1; /* we'll handle this data. */
@@ -1025,7 +1179,7 @@ static int WAV_open(Sound_Sample *sample, const char *ext)
 {
     int rc;
 
-    fmt_t *fmt = (fmt_t *) SDL_calloc(1, sizeof (fmt_t));
+    fmt_t *fmt = (fmt_t *) __Sound_Calloc(1, sizeof (fmt_t));
     BAIL_IF_MACRO(fmt == NULL, ERR_OUT_OF_MEMORY, 0);
 
     rc = WAV_open_internal(sample, ext, fmt);
@@ -1033,7 +1187,7 @@ static int WAV_open(Sound_Sample *sample, const char *ext)
     {
         if (fmt->free != NULL)
             fmt->free(fmt);
-        SDL_free(fmt);
+        __Sound_Free(fmt);
     } /* if */
 
     return rc;
@@ -1048,8 +1202,8 @@ static void WAV_close(Sound_Sample *sample)
     if (w->fmt->free != NULL)
         w->fmt->free(w->fmt);
 
-    SDL_free(w->fmt);
-    SDL_free(w);
+    __Sound_Free(w->fmt);
+    __Sound_Free(w);
 } /* WAV_close */
 
 
@@ -1061,6 +1215,16 @@ static Uint32 WAV_read(Sound_Sample *sample)
 } /* WAV_read */
 
 
+static Uint32 WAV_view(Sound_Sample *sample, const Uint8 **data, Uint32 len)
+{
+    Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
+    wav_t *w = (wav_t *) internal->decoder_private;
+    if (w->fmt->view_sample == NULL)
+        return 0;  /* compressed; SDL_sound will call WAV_read(). */
+    return w->fmt->view_sample(sample, data, len);
+} /* WAV_view */
+
+
 static int WAV_rewind(Sound_Sample *sample)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
@@ -1073,11 +1237,17 @@ static int WAV_rewind(Sound_Sample *sample)
 } /* WAV_rewind */
 
 
-static int WAV_seek(Sound_Sample *sample, Uint32 ms)
+static int WAV_seek_frames(Sound_Sample *sample, Uint64 frame)
 {
     Sound_SampleInternal *internal = (Sound_SampleInternal *) sample->opaque;
     wav_t *w = (wav_t *) internal->decoder_private;
-    return w->fmt->seek_sample(sample, ms);
+    return w->fmt->seek_sample(sample, frame);
+} /* WAV_seek_frames */
+
+
+static int WAV_seek(Sound_Sample *sample, Uint32 ms)
+{
+    return WAV_seek_frames(sample, __Sound_convertMsToFrames(sample->actual.rate, ms));
 } /* WAV_seek */
 
 
@@ -1097,7 +1267,11 @@ const Sound_DecoderFunctions __Sound_DecoderFunctions_WAV =
     WAV_close,      /*  close() method */
     WAV_read,       /*   read() method */
     WAV_rewind,     /* rewind() method */
-    WAV_seek        /*   seek() method */
+    WAV_seek,       /*   seek() method */
+    WAV_probe,      /*  probe() method */
+    WAV_view,       /*   view() method */
+    WAV_seek_frames, /* seek_frames() method */
+    NULL /* memory_usage() method */
 };
 
 #endif /* SOUND_SUPPORTS_WAV */
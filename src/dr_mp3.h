@@ -2295,8 +2295,11 @@ static drmp3_bool32 drmp3_decode_next_frame(drmp3* pMP3)
 
             size_t bytesRead = pMP3->onRead(pMP3->pUserData, pMP3->pData + pMP3->dataSize, (pMP3->dataCapacity - pMP3->dataSize));
             if (bytesRead == 0) {
-                pMP3->atEnd = DRMP3_TRUE;
-                return DRMP3_FALSE; // No data.
+                if (pMP3->dataSize == 0) {
+                    pMP3->atEnd = DRMP3_TRUE;
+                    return DRMP3_FALSE; // No data.
+                }
+                // Still have the tail of the stream to decode.
             }
 
             pMP3->dataSize += bytesRead;
@@ -5,117 +5,38 @@
  *          Markus Fick <webmaster@mark-f.de> spline + fir-resampler
 */
 
+// the interpolating mixers and the click removal have vector versions,
+// which init_modplug_filters() puts in the mix tables if the cpu has them.
+// (the intrinsics headers go first, libmodplug.h defines _mm_free.)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MODPLUG_HAVE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MODPLUG_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
 #include "libmodplug.h"
-#include <math.h>
+
+#if defined(MODPLUG_HAVE_SSE2) || defined(MODPLUG_HAVE_NEON)
+#define MODPLUG_HAVE_VECMIX 1
+static int gbVecMix = 0;
+static void initVecMixFunctionTables(void);
+#endif
 
 // 4x256 taps polyphase FIR resampling filter
 extern short int gFastSinc[];
 extern short int gKaiserSinc[]; // 8-taps polyphase
-/*
- *-----------------------------------------------------------------------------
- cubic spline interpolation doc,
-   (derived from "digital image warping", g. wolberg)
-
-   interpolation polynomial: f(x) = A3*(x-floor(x))**3 + A2*(x-floor(x))**2 +
-     A1*(x-floor(x)) + A0
-
-   with Y = equispaced data points (dist=1), YD = first derivates of data points and IP = floor(x)
-   the A[0..3] can be found by solving
-     A0  = Y[IP]
-     A1  = YD[IP]
-     A2  = 3*(Y[IP+1]-Y[IP])-2.0*YD[IP]-YD[IP+1]
-     A3  = -2.0 * (Y[IP+1]-Y[IP]) + YD[IP] - YD[IP+1]
-
-   with the first derivates as
-     YD[IP]    = 0.5 * (Y[IP+1] - Y[IP-1]);
-     YD[IP+1]  = 0.5 * (Y[IP+2] - Y[IP])
-
-   the coefs becomes
-     A0 = Y[IP]
-     A1 = YD[IP]
-        =  0.5*(Y[IP+1] - Y[IP-1]);
-     A2 =  3.0*(Y[IP+1]-Y[IP])-2.0*YD[IP]-YD[IP+1]
-        =  3.0*(Y[IP+1]-Y[IP]) - 0.5*2.0*(Y[IP+1]-Y[IP-1]) - 0.5*(Y[IP+2]-Y[IP])
-        =  3.0*Y[IP+1] - 3.0*Y[IP] - Y[IP+1] + Y[IP-1] - 0.5*Y[IP+2] + 0.5*Y[IP]
-        = -0.5*Y[IP+2] + 2.0 * Y[IP+1] - 2.5*Y[IP] + Y[IP-1]
-        = Y[IP-1] + 2 * Y[IP+1] - 0.5 * (5.0 * Y[IP] + Y[IP+2])
-     A3 = -2.0*(Y[IP+1]-Y[IP]) + YD[IP] + YD[IP+1]
-        = -2.0*Y[IP+1] + 2.0*Y[IP] + 0.5*(Y[IP+1]-Y[IP-1]) + 0.5*(Y[IP+2]-Y[IP])
-        = -2.0*Y[IP+1] + 2.0*Y[IP] + 0.5*Y[IP+1] - 0.5*Y[IP-1] + 0.5*Y[IP+2] - 0.5*Y[IP]
-        =  0.5 * Y[IP+2] - 1.5 * Y[IP+1] + 1.5 * Y[IP] - 0.5 * Y[IP-1]
-	=  0.5 * (3.0 * (Y[IP] - Y[IP+1]) - Y[IP-1] + YP[IP+2])
-
-   then interpolated data value is (horner rule)
-     out = (((A3*x)+A2)*x+A1)*x+A0
-
-   this gives parts of data points Y[IP-1] to Y[IP+2] of
-     part       x**3    x**2    x**1    x**0
-      Y[IP-1]    -0.5     1      -0.5    0
-      Y[IP]       1.5    -2.5     0      1
-      Y[IP+1]    -1.5     2       0.5    0
-      Y[IP+2]     0.5    -0.5     0      0
- *---------------------------------------------------------------------------
- */
+// interpolation lookup tables; see mkmixtables.c for how they're made.
 // number of bits used to scale spline coefs
 #define SPLINE_QUANTBITS	14
 #define SPLINE_QUANTSCALE	(1L<<SPLINE_QUANTBITS)
 #define SPLINE_8SHIFT		(SPLINE_QUANTBITS-8)
 #define SPLINE_16SHIFT		(SPLINE_QUANTBITS)
-// forces coefsset to unity gain
-#define SPLINE_CLAMPFORUNITY
 // log2(number) of precalculated splines (range is [4..14])
 #define SPLINE_FRACBITS 10
 #define SPLINE_LUTLEN (1L<<SPLINE_FRACBITS)
 
-signed short CzCUBICSPLINE_lut[4*(1L<<SPLINE_FRACBITS)];
-
-static void initCzCUBICSPLINE()
-{
-	int _LIi;
-	int _LLen		= (1L<<SPLINE_FRACBITS);
-	float _LFlen	= 1.0f / (float)_LLen;
-	float _LScale	= (float)SPLINE_QUANTSCALE;
-	for(_LIi=0;_LIi<_LLen;_LIi++)
-	{	float _LCm1, _LC0, _LC1, _LC2;
-		float _LX = ((float)_LIi)*_LFlen;
-		int _LSum,_LIdx	= _LIi<<2;
-		_LCm1 = (float)floor( 0.5 + _LScale*(-0.5*_LX*_LX*_LX + 1.0*_LX*_LX - 0.5*_LX ) );
-		_LC0 = (float)floor( 0.5 + _LScale*( 1.5*_LX*_LX*_LX - 2.5*_LX*_LX + 1.0 ) );
-		_LC1 = (float)floor( 0.5 + _LScale*(-1.5*_LX*_LX*_LX + 2.0*_LX*_LX + 0.5*_LX ) );
-		_LC2 = (float)floor( 0.5 + _LScale*( 0.5*_LX*_LX*_LX - 0.5*_LX*_LX) );
-		CzCUBICSPLINE_lut[_LIdx+0] = (signed short)( (_LCm1 < -_LScale) ? -_LScale : ((_LCm1 > _LScale) ? _LScale : _LCm1) );
-		CzCUBICSPLINE_lut[_LIdx+1] = (signed short)( (_LC0  < -_LScale) ? -_LScale : ((_LC0  > _LScale) ? _LScale : _LC0 ) );
-		CzCUBICSPLINE_lut[_LIdx+2] = (signed short)( (_LC1  < -_LScale) ? -_LScale : ((_LC1  > _LScale) ? _LScale : _LC1 ) );
-		CzCUBICSPLINE_lut[_LIdx+3] = (signed short)( (_LC2  < -_LScale) ? -_LScale : ((_LC2  > _LScale) ? _LScale : _LC2 ) );
-#ifdef SPLINE_CLAMPFORUNITY
-		_LSum = CzCUBICSPLINE_lut[_LIdx+0]+CzCUBICSPLINE_lut[_LIdx+1]+CzCUBICSPLINE_lut[_LIdx+2]+CzCUBICSPLINE_lut[_LIdx+3];
-		if( _LSum != SPLINE_QUANTSCALE )
-		{	int _LMax = _LIdx;
-			if( CzCUBICSPLINE_lut[_LIdx+1]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+1;
-			if( CzCUBICSPLINE_lut[_LIdx+2]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+2;
-			if( CzCUBICSPLINE_lut[_LIdx+3]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+3;
-			CzCUBICSPLINE_lut[_LMax] += ((signed short)SPLINE_QUANTSCALE-_LSum);
-		}
-#endif
-	}
-}
-
-/*
-  ------------------------------------------------------------------------------
-   fir interpolation doc,
-     (derived from "an engineer's guide to fir digital filters", n.j. loy)
-
-     calculate coefficients for ideal lowpass filter (with cutoff = fc in 
-	0..1 (mapped to 0..nyquist))
-     c[-N..N] = (i==0) ? fc : SDL_sin(fc*pi*i)/(pi*i)
-
-     then apply selected window to coefficients
-      c[-N..N] *= w(0..N)
-     with n in 2*N and w(n) being a window function (see loy)
-
-     then calculate gain and scale filter coefs to have unity gain.
-  ------------------------------------------------------------------------------
-*/
 // quantizer scale of window coefs
 #define WFIR_QUANTBITS		15
 #define WFIR_QUANTSCALE		(1L<<WFIR_QUANTBITS)
@@ -128,115 +49,17 @@ static void initCzCUBICSPLINE()
 #define WFIR_LOG2WIDTH		3
 #define WFIR_WIDTH			(1L<<WFIR_LOG2WIDTH)
 #define WFIR_SMPSPERWING	((WFIR_WIDTH-1)>>1)
-// cutoff (1.0 == pi/2)
-#define WFIR_CUTOFF		0.90f
-// wfir type
-#define WFIR_HANN		0
-#define WFIR_HAMMING		1
-#define WFIR_BLACKMANEXACT	2
-#define WFIR_BLACKMAN3T61	3
-#define WFIR_BLACKMAN3T67	4
-#define WFIR_BLACKMAN4T92	5
-#define WFIR_BLACKMAN4T74	6
-#define WFIR_KAISER4T		7
-#define WFIR_TYPE		WFIR_BLACKMANEXACT
-// wfir help
-#ifndef M_zPI
-#define M_zPI		3.1415926535897932384626433832795
-#endif
-#define M_zEPS		1e-8
-#define M_zBESSELEPS	1e-21
-
-    static float CzWINDOWEDFIR_coef( int _PCnr, float _POfs, float _PCut, int _PWidth, int _PType )
-//OLD args to coef: float _PPos, float _PFc, int _PLen )
-	{	
-		double	_LWidthM1       = _PWidth-1;
-		double	_LWidthM1Half   = 0.5*_LWidthM1;
-		double	_LPosU          = ((double)_PCnr - _POfs);
-		double	_LPos           = _LPosU-_LWidthM1Half;
-		double	_LPIdl          = 2.0*M_zPI/_LWidthM1;
-		double	_LWc,_LSi;
-		if( SDL_fabs(_LPos)<M_zEPS ) {
-			_LWc	= 1.0;
-			_LSi	= _PCut;
-		} else {	
-			switch( _PType )
-			{	
-			case WFIR_HANN:
-				_LWc = 0.50 - 0.50 * SDL_cos(_LPIdl*_LPosU);
-				break;
-			case WFIR_HAMMING:
-				_LWc = 0.54 - 0.46 * SDL_cos(_LPIdl*_LPosU);
-				break;
-			case WFIR_BLACKMANEXACT:
-				_LWc = 0.42 - 0.50 * SDL_cos(_LPIdl*_LPosU) + 
-					0.08 * SDL_cos(2.0*_LPIdl*_LPosU);
-				break;
-			case WFIR_BLACKMAN3T61:
-				_LWc = 0.44959 - 0.49364 * SDL_cos(_LPIdl*_LPosU) + 
-					0.05677 * SDL_cos(2.0*_LPIdl*_LPosU);
-				break;
-			case WFIR_BLACKMAN3T67:
-				_LWc = 0.42323 - 0.49755 * SDL_cos(_LPIdl*_LPosU) + 
-					0.07922 * SDL_cos(2.0*_LPIdl*_LPosU);
-				break;
-			case WFIR_BLACKMAN4T92:
-				_LWc = 0.35875 - 0.48829 * SDL_cos(_LPIdl*_LPosU) + 
-					0.14128 * SDL_cos(2.0*_LPIdl*_LPosU) - 
-					0.01168 * SDL_cos(3.0*_LPIdl*_LPosU);
-				break;
-			case WFIR_BLACKMAN4T74:
-				_LWc = 0.40217 - 0.49703 * SDL_cos(_LPIdl*_LPosU) + 
-					0.09392 * SDL_cos(2.0*_LPIdl*_LPosU) - 
-					0.00183 * SDL_cos(3.0*_LPIdl*_LPosU);
-				break;
-			case WFIR_KAISER4T:
-				_LWc = 0.40243 - 0.49804 * SDL_cos(_LPIdl*_LPosU) + 
-					0.09831 * SDL_cos(2.0*_LPIdl*_LPosU) - 
-					0.00122 * SDL_cos(3.0*_LPIdl*_LPosU);
-				break;
-			default:
-				_LWc = 1.0;
-				break;
-			}
-			_LPos	 *= M_zPI;
-			_LSi	 = SDL_sin(_PCut*_LPos)/_LPos;
-		}
-		return (float)(_LWc*_LSi);
-	}
 
-static signed short CzWINDOWEDFIR_lut[WFIR_LUTLEN*WFIR_WIDTH];
-
-static void initCzWINDOWEDFIR()
-{	
-	int _LPcl;
-	float _LPcllen	= (float)(1L<<WFIR_FRACBITS);	// number of precalculated lines for 0..1 (-1..0)
-	float _LNorm	= 1.0f / (float)(2.0f * _LPcllen);
-	float _LCut		= WFIR_CUTOFF;
-	float _LScale	= (float)WFIR_QUANTSCALE;
-	for( _LPcl=0;_LPcl<WFIR_LUTLEN;_LPcl++ )
-	{	
-		float _LGain,_LCoefs[WFIR_WIDTH];
-		float _LOfs		= ((float)_LPcl-_LPcllen)*_LNorm;
-		int _LCc,_LIdx	= _LPcl<<WFIR_LOG2WIDTH;
-		for( _LCc=0,_LGain=0.0f;_LCc<WFIR_WIDTH;_LCc++ )
-		{	_LGain	+= (_LCoefs[_LCc] = CzWINDOWEDFIR_coef( _LCc, _LOfs, _LCut, WFIR_WIDTH, WFIR_TYPE ));
-		}
-		_LGain = 1.0f/_LGain;
-		for( _LCc=0;_LCc<WFIR_WIDTH;_LCc++ )
-		{	float _LCoef = (float)floor( 0.5 + _LScale*_LCoefs[_LCc]*_LGain );
-		CzWINDOWEDFIR_lut[_LIdx+_LCc] = (signed short)( (_LCoef<-_LScale)?-_LScale:((_LCoef>_LScale)?_LScale:_LCoef) );
-		}
-	}
-}
+#include "mixtables.h"
 
 void init_modplug_filters(void)
 {
     static int inited_filters = 0;
     if (inited_filters) return;
     inited_filters = 1;
-    initCzCUBICSPLINE();
-    initCzWINDOWEDFIR();
+#ifdef MODPLUG_HAVE_VECMIX
+    initVecMixFunctionTables();
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -447,6 +270,244 @@ void init_modplug_filters(void)
        vol2_r += (CzWINDOWEDFIR_lut[firidx+7]*(int)p[(poshi+8-4)*2+1]);    \
    int vol_r   = ((vol1_r>>1)+(vol2_r>>1)) >> (WFIR_16BITSHIFT-1);
 
+/////////////////////////////////////////////////////////////////////////////
+// Vectorised spline + fir interpolation
+//
+// These give exactly what the macros above give: the products and partial
+// sums are the same, only added in a different order, which doesn't matter
+// for (wrapping) integer adds. The stereo ones work on interleaved frames.
+
+#ifdef MODPLUG_HAVE_VECMIX
+
+#ifdef MODPLUG_HAVE_SSE2
+
+// [a0+a1+a2+a3, b0+b1+b2+b3, c0+c1+c2+c3, d0+d1+d2+d3]
+static SDL_INLINE __m128i VecHSum4(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+	const __m128i ab = _mm_add_epi32(_mm_unpacklo_epi32(a, b), _mm_unpackhi_epi32(a, b));
+	const __m128i cd = _mm_add_epi32(_mm_unpacklo_epi32(c, d), _mm_unpackhi_epi32(c, d));
+	return _mm_add_epi32(_mm_unpacklo_epi64(ab, cd), _mm_unpackhi_epi64(ab, cd));
+}
+
+static SDL_INLINE __m128i VecLoad8x8(const signed char *p)
+{
+	const __m128i x = _mm_loadl_epi64((const __m128i *)p);
+	return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+}
+
+static SDL_INLINE int VecSplineMono8(const signed short *lut, const signed char *p)
+{
+	const __m128i x = _mm_setr_epi16(p[0], p[1], p[2], p[3], 0, 0, 0, 0);
+	const __m128i m = _mm_madd_epi16(_mm_loadl_epi64((const __m128i *)lut), x);
+	return (_mm_cvtsi128_si32(m) + _mm_cvtsi128_si32(_mm_srli_si128(m, 4))) >> SPLINE_8SHIFT;
+}
+
+static SDL_INLINE int VecSplineMono16(const signed short *lut, const signed short *p)
+{
+	const __m128i m = _mm_madd_epi16(_mm_loadl_epi64((const __m128i *)lut),
+	                                 _mm_loadl_epi64((const __m128i *)p));
+	return (_mm_cvtsi128_si32(m) + _mm_cvtsi128_si32(_mm_srli_si128(m, 4))) >> SPLINE_16SHIFT;
+}
+
+static SDL_INLINE __m128i VecSplineStereo(const signed short *lut, __m128i x)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c = _mm_loadl_epi64((const __m128i *)lut);
+	const __m128i l = _mm_madd_epi16(x, _mm_unpacklo_epi16(c, zero));
+	const __m128i r = _mm_madd_epi16(x, _mm_unpacklo_epi16(zero, c));
+	return VecHSum4(l, r, zero, zero);
+}
+
+static SDL_INLINE void VecSplineStereo8(const signed short *lut, const signed char *p, int *vol_l, int *vol_r)
+{
+	const __m128i v = _mm_srai_epi32(VecSplineStereo(lut, VecLoad8x8(p)), SPLINE_8SHIFT);
+	*vol_l = _mm_cvtsi128_si32(v);
+	*vol_r = _mm_cvtsi128_si32(_mm_srli_si128(v, 4));
+}
+
+static SDL_INLINE void VecSplineStereo16(const signed short *lut, const signed short *p, int *vol_l, int *vol_r)
+{
+	const __m128i v = _mm_srai_epi32(VecSplineStereo(lut, _mm_loadu_si128((const __m128i *)p)), SPLINE_16SHIFT);
+	*vol_l = _mm_cvtsi128_si32(v);
+	*vol_r = _mm_cvtsi128_si32(_mm_srli_si128(v, 4));
+}
+
+static SDL_INLINE int VecFirMono8(const signed short *lut, const signed char *p)
+{
+	const __m128i m = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)lut), VecLoad8x8(p));
+	const __m128i s = _mm_add_epi32(m, _mm_unpackhi_epi64(m, m));
+	return (_mm_cvtsi128_si32(s) + _mm_cvtsi128_si32(_mm_srli_si128(s, 4))) >> WFIR_8SHIFT;
+}
+
+static SDL_INLINE int VecFirMono16(const signed short *lut, const signed short *p)
+{
+	const __m128i m = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)lut),
+	                                 _mm_loadu_si128((const __m128i *)p));
+	// vol1 in lane 0, vol2 in lane 2
+	const __m128i s = _mm_srai_epi32(_mm_add_epi32(m, _mm_srli_si128(m, 4)), 1);
+	return (_mm_cvtsi128_si32(s) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(s, s))) >> (WFIR_16BITSHIFT-1);
+}
+
+// [vol1_l, vol2_l, vol1_r, vol2_r] of the frames in x0 (taps 0-3) and x1 (taps 4-7)
+static SDL_INLINE __m128i VecFirStereo(const signed short *lut, __m128i x0, __m128i x1)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c = _mm_loadu_si128((const __m128i *)lut);
+	const __m128i cl0 = _mm_unpacklo_epi16(c, zero);
+	const __m128i cl1 = _mm_unpackhi_epi16(c, zero);
+	const __m128i cr0 = _mm_unpacklo_epi16(zero, c);
+	const __m128i cr1 = _mm_unpackhi_epi16(zero, c);
+	return VecHSum4(_mm_madd_epi16(x0, cl0), _mm_madd_epi16(x1, cl1),
+	                _mm_madd_epi16(x0, cr0), _mm_madd_epi16(x1, cr1));
+}
+
+static SDL_INLINE void VecFirStereo8(const signed short *lut, const signed char *p, int *vol_l, int *vol_r)
+{
+	const __m128i x = _mm_loadu_si128((const __m128i *)p);
+	const __m128i x0 = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+	const __m128i x1 = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+	const __m128i s = VecFirStereo(lut, x0, x1);
+	const __m128i v = _mm_srai_epi32(_mm_add_epi32(s, _mm_srli_si128(s, 4)), WFIR_8SHIFT);
+	*vol_l = _mm_cvtsi128_si32(v);
+	*vol_r = _mm_cvtsi128_si32(_mm_unpackhi_epi64(v, v));
+}
+
+static SDL_INLINE void VecFirStereo16(const signed short *lut, const signed short *p, int *vol_l, int *vol_r)
+{
+	const __m128i s = _mm_srai_epi32(VecFirStereo(lut, _mm_loadu_si128((const __m128i *)p),
+	                                              _mm_loadu_si128((const __m128i *)(p+8))), 1);
+	const __m128i v = _mm_srai_epi32(_mm_add_epi32(s, _mm_srli_si128(s, 4)), WFIR_16BITSHIFT-1);
+	*vol_l = _mm_cvtsi128_si32(v);
+	*vol_r = _mm_cvtsi128_si32(_mm_unpackhi_epi64(v, v));
+}
+
+#else // MODPLUG_HAVE_NEON
+
+static SDL_INLINE int VecHSum(int32x4_t v)
+{
+	const int32x2_t s = vadd_s32(vget_low_s32(v), vget_high_s32(v));
+	return vget_lane_s32(vpadd_s32(s, s), 0);
+}
+
+static SDL_INLINE int VecSplineMono8(const signed short *lut, const signed char *p)
+{
+	const int16_t x[4] = { p[0], p[1], p[2], p[3] };
+	return VecHSum(vmull_s16(vld1_s16(lut), vld1_s16(x))) >> SPLINE_8SHIFT;
+}
+
+static SDL_INLINE int VecSplineMono16(const signed short *lut, const signed short *p)
+{
+	return VecHSum(vmull_s16(vld1_s16(lut), vld1_s16(p))) >> SPLINE_16SHIFT;
+}
+
+static SDL_INLINE void VecSplineStereo8(const signed short *lut, const signed char *p, int *vol_l, int *vol_r)
+{
+	const int16x8_t x = vmovl_s8(vld1_s8(p));
+	const int16x4x2_t lr = vuzp_s16(vget_low_s16(x), vget_high_s16(x));
+	const int16x4_t c = vld1_s16(lut);
+	*vol_l = VecHSum(vmull_s16(c, lr.val[0])) >> SPLINE_8SHIFT;
+	*vol_r = VecHSum(vmull_s16(c, lr.val[1])) >> SPLINE_8SHIFT;
+}
+
+static SDL_INLINE void VecSplineStereo16(const signed short *lut, const signed short *p, int *vol_l, int *vol_r)
+{
+	const int16x4x2_t lr = vld2_s16(p);
+	const int16x4_t c = vld1_s16(lut);
+	*vol_l = VecHSum(vmull_s16(c, lr.val[0])) >> SPLINE_16SHIFT;
+	*vol_r = VecHSum(vmull_s16(c, lr.val[1])) >> SPLINE_16SHIFT;
+}
+
+static SDL_INLINE int VecFir8(const int16x8_t c, const int16x8_t x)
+{
+	return VecHSum(vmlal_s16(vmull_s16(vget_low_s16(c), vget_low_s16(x)),
+	                         vget_high_s16(c), vget_high_s16(x))) >> WFIR_8SHIFT;
+}
+
+static SDL_INLINE int VecFir16(const int16x8_t c, const int16x8_t x)
+{
+	const int vol1 = VecHSum(vmull_s16(vget_low_s16(c), vget_low_s16(x)));
+	const int vol2 = VecHSum(vmull_s16(vget_high_s16(c), vget_high_s16(x)));
+	return ((vol1>>1)+(vol2>>1)) >> (WFIR_16BITSHIFT-1);
+}
+
+static SDL_INLINE int VecFirMono8(const signed short *lut, const signed char *p)
+{
+	return VecFir8(vld1q_s16(lut), vmovl_s8(vld1_s8(p)));
+}
+
+static SDL_INLINE int VecFirMono16(const signed short *lut, const signed short *p)
+{
+	return VecFir16(vld1q_s16(lut), vld1q_s16(p));
+}
+
+static SDL_INLINE void VecFirStereo8(const signed short *lut, const signed char *p, int *vol_l, int *vol_r)
+{
+	const int8x8x2_t lr = vld2_s8(p);
+	const int16x8_t c = vld1q_s16(lut);
+	*vol_l = VecFir8(c, vmovl_s8(lr.val[0]));
+	*vol_r = VecFir8(c, vmovl_s8(lr.val[1]));
+}
+
+static SDL_INLINE void VecFirStereo16(const signed short *lut, const signed short *p, int *vol_l, int *vol_r)
+{
+	const int16x8x2_t lr = vld2q_s16(p);
+	const int16x8_t c = vld1q_s16(lut);
+	*vol_l = VecFir16(c, lr.val[0]);
+	*vol_r = VecFir16(c, lr.val[1]);
+}
+
+#endif
+
+#define SNDMIX_GETMONOVOL8VECSPLINE \
+	int poshi	= nPos >> 16; \
+	int poslo	= (nPos >> SPLINE_FRACSHIFT) & SPLINE_FRACMASK; \
+	int vol		= VecSplineMono8(CzCUBICSPLINE_lut+poslo, p+poshi-1);
+
+#define SNDMIX_GETMONOVOL16VECSPLINE \
+	int poshi	= nPos >> 16; \
+	int poslo	= (nPos >> SPLINE_FRACSHIFT) & SPLINE_FRACMASK; \
+	int vol		= VecSplineMono16(CzCUBICSPLINE_lut+poslo, p+poshi-1);
+
+#define SNDMIX_GETMONOVOL8VECFIRFILTER \
+	int poshi  = nPos >> 16;\
+	int poslo  = (nPos & 0xFFFF);\
+	int firidx = ((poslo+WFIR_FRACHALVE)>>WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+	int vol    = VecFirMono8(CzWINDOWEDFIR_lut+firidx, p+poshi+1-4);
+
+#define SNDMIX_GETMONOVOL16VECFIRFILTER \
+	int poshi  = nPos >> 16;\
+	int poslo  = (nPos & 0xFFFF);\
+	int firidx = ((poslo+WFIR_FRACHALVE)>>WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+	int vol    = VecFirMono16(CzWINDOWEDFIR_lut+firidx, p+poshi+1-4);
+
+#define SNDMIX_GETSTEREOVOL8VECSPLINE \
+    int poshi	= nPos >> 16; \
+    int poslo	= (nPos >> SPLINE_FRACSHIFT) & SPLINE_FRACMASK; \
+    int vol_l, vol_r; \
+    VecSplineStereo8(CzCUBICSPLINE_lut+poslo, p+(poshi-1)*2, &vol_l, &vol_r);
+
+#define SNDMIX_GETSTEREOVOL16VECSPLINE \
+    int poshi	= nPos >> 16; \
+    int poslo	= (nPos >> SPLINE_FRACSHIFT) & SPLINE_FRACMASK; \
+    int vol_l, vol_r; \
+    VecSplineStereo16(CzCUBICSPLINE_lut+poslo, p+(poshi-1)*2, &vol_l, &vol_r);
+
+#define SNDMIX_GETSTEREOVOL8VECFIRFILTER \
+    int poshi   = nPos >> 16;\
+    int poslo   = (nPos & 0xFFFF);\
+    int firidx  = ((poslo+WFIR_FRACHALVE)>>WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+    int vol_l, vol_r; \
+    VecFirStereo8(CzWINDOWEDFIR_lut+firidx, p+(poshi+1-4)*2, &vol_l, &vol_r);
+
+#define SNDMIX_GETSTEREOVOL16VECFIRFILTER \
+    int poshi   = nPos >> 16;\
+    int poslo   = (nPos & 0xFFFF);\
+    int firidx  = ((poslo+WFIR_FRACHALVE)>>WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+    int vol_l, vol_r; \
+    VecFirStereo16(CzWINDOWEDFIR_lut+firidx, p+(poshi+1-4)*2, &vol_l, &vol_r);
+
+#endif // MODPLUG_HAVE_VECMIX
+
 /////////////////////////////////////////////////////////////////////////////
 
 #define SNDMIX_STOREMONOVOL\
@@ -1206,6 +1267,243 @@ END_RAMPMIX_STFLT_INTERFACE()
 
 #endif
 
+#ifdef MODPLUG_HAVE_VECMIX
+
+//////////////////////////////////////////////////////
+// Vectorised spline + fir mix
+
+BEGIN_MIX_INTERFACE(VecMono8BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECSPLINE
+	SNDMIX_STOREMONOVOL
+END_MIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecMono16BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECSPLINE
+	SNDMIX_STOREMONOVOL
+END_MIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecMono8BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECSPLINE
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecMono16BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECSPLINE
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecStereo8BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECSPLINE
+	SNDMIX_STORESTEREOVOL
+END_MIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecStereo16BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECSPLINE
+	SNDMIX_STORESTEREOVOL
+END_MIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecStereo8BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECSPLINE
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecStereo16BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECSPLINE
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecMono8BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECFIRFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecMono16BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECFIRFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecMono8BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECFIRFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecMono16BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECFIRFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecStereo8BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECFIRFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_INTERFACE()
+
+BEGIN_MIX_INTERFACE(VecStereo16BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECFIRFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecStereo8BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECFIRFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_INTERFACE()
+
+BEGIN_RAMPMIX_INTERFACE(VecStereo16BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECFIRFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_INTERFACE()
+
+#ifndef NO_FILTER
+
+BEGIN_MIX_FLT_INTERFACE(VecFilterMono8BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECSPLINE
+	SNDMIX_PROCESSFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_FLT_INTERFACE()
+
+BEGIN_MIX_FLT_INTERFACE(VecFilterMono16BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECSPLINE
+	SNDMIX_PROCESSFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_FLT_INTERFACE()
+
+BEGIN_RAMPMIX_FLT_INTERFACE(VecFilterMono8BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECSPLINE
+	SNDMIX_PROCESSFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_FLT_INTERFACE()
+
+BEGIN_RAMPMIX_FLT_INTERFACE(VecFilterMono16BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECSPLINE
+	SNDMIX_PROCESSFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_FLT_INTERFACE()
+
+BEGIN_MIX_STFLT_INTERFACE(VecFilterStereo8BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECSPLINE
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_STFLT_INTERFACE()
+
+BEGIN_MIX_STFLT_INTERFACE(VecFilterStereo16BitSplineMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECSPLINE
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_STFLT_INTERFACE()
+
+BEGIN_RAMPMIX_STFLT_INTERFACE(VecFilterStereo8BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECSPLINE
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_STFLT_INTERFACE()
+
+BEGIN_RAMPMIX_STFLT_INTERFACE(VecFilterStereo16BitSplineRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECSPLINE
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_STFLT_INTERFACE()
+
+BEGIN_MIX_FLT_INTERFACE(VecFilterMono8BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECFIRFILTER
+	SNDMIX_PROCESSFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_FLT_INTERFACE()
+
+BEGIN_MIX_FLT_INTERFACE(VecFilterMono16BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECFIRFILTER
+	SNDMIX_PROCESSFILTER
+	SNDMIX_STOREMONOVOL
+END_MIX_FLT_INTERFACE()
+
+BEGIN_RAMPMIX_FLT_INTERFACE(VecFilterMono8BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETMONOVOL8VECFIRFILTER
+	SNDMIX_PROCESSFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_FLT_INTERFACE()
+
+BEGIN_RAMPMIX_FLT_INTERFACE(VecFilterMono16BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETMONOVOL16VECFIRFILTER
+	SNDMIX_PROCESSFILTER
+	SNDMIX_RAMPMONOVOL
+END_RAMPMIX_FLT_INTERFACE()
+
+BEGIN_MIX_STFLT_INTERFACE(VecFilterStereo8BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECFIRFILTER
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_STFLT_INTERFACE()
+
+BEGIN_MIX_STFLT_INTERFACE(VecFilterStereo16BitFirFilterMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECFIRFILTER
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_STORESTEREOVOL
+END_MIX_STFLT_INTERFACE()
+
+BEGIN_RAMPMIX_STFLT_INTERFACE(VecFilterStereo8BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP8
+	SNDMIX_GETSTEREOVOL8VECFIRFILTER
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_STFLT_INTERFACE()
+
+BEGIN_RAMPMIX_STFLT_INTERFACE(VecFilterStereo16BitFirFilterRampMix)
+	SNDMIX_BEGINSAMPLELOOP16
+	SNDMIX_GETSTEREOVOL16VECFIRFILTER
+	SNDMIX_PROCESSSTEREOFILTER
+	SNDMIX_RAMPSTEREOVOL
+END_RAMPMIX_STFLT_INTERFACE()
+
+#else
+#define VecFilterMono8BitSplineMix	VecMono8BitSplineMix
+#define VecFilterMono16BitSplineMix	VecMono16BitSplineMix
+#define VecFilterMono8BitSplineRampMix	VecMono8BitSplineRampMix
+#define VecFilterMono16BitSplineRampMix	VecMono16BitSplineRampMix
+#define VecFilterStereo8BitSplineMix	VecStereo8BitSplineMix
+#define VecFilterStereo16BitSplineMix	VecStereo16BitSplineMix
+#define VecFilterStereo8BitSplineRampMix	VecStereo8BitSplineRampMix
+#define VecFilterStereo16BitSplineRampMix	VecStereo16BitSplineRampMix
+#define VecFilterMono8BitFirFilterMix	VecMono8BitFirFilterMix
+#define VecFilterMono16BitFirFilterMix	VecMono16BitFirFilterMix
+#define VecFilterMono8BitFirFilterRampMix	VecMono8BitFirFilterRampMix
+#define VecFilterMono16BitFirFilterRampMix	VecMono16BitFirFilterRampMix
+#define VecFilterStereo8BitFirFilterMix	VecStereo8BitFirFilterMix
+#define VecFilterStereo16BitFirFilterMix	VecStereo16BitFirFilterMix
+#define VecFilterStereo8BitFirFilterRampMix	VecStereo8BitFirFilterRampMix
+#define VecFilterStereo16BitFirFilterRampMix	VecStereo16BitFirFilterRampMix
+#endif
+
+#endif // MODPLUG_HAVE_VECMIX
+
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Mix function tables
@@ -1226,7 +1524,7 @@ END_RAMPMIX_STFLT_INTERFACE()
 #define MIXNDX_SPLINESRC    0x20
 #define MIXNDX_FIRSRC       0x30
 
-const LPMIXINTERFACE gpMixFunctionTable[2*2*16] =
+LPMIXINTERFACE gpMixFunctionTable[2*2*16] =
 {
 	// No SRC
 	Mono8BitMix, Mono16BitMix, Stereo8BitMix, Stereo16BitMix,
@@ -1268,7 +1566,7 @@ const LPMIXINTERFACE gpMixFunctionTable[2*2*16] =
         FilterStereo8BitFirFilterRampMix, FilterStereo16BitFirFilterRampMix
 };
 
-const LPMIXINTERFACE gpFastMixFunctionTable[2*2*16] =
+LPMIXINTERFACE gpFastMixFunctionTable[2*2*16] =
 {
 	// No SRC
 	FastMono8BitMix, FastMono16BitMix, Stereo8BitMix, Stereo16BitMix,
@@ -1311,6 +1609,46 @@ const LPMIXINTERFACE gpFastMixFunctionTable[2*2*16] =
         FilterStereo8BitFirFilterRampMix, FilterStereo16BitFirFilterRampMix,
 };
 
+#ifdef MODPLUG_HAVE_VECMIX
+// Replaces the spline + fir part of both tables (they're the same there).
+static const LPMIXINTERFACE gpVecMixFunctionTable[2*16] =
+{
+	// Spline SRC
+	VecMono8BitSplineMix, VecMono16BitSplineMix, VecStereo8BitSplineMix,
+        VecStereo16BitSplineMix, VecMono8BitSplineRampMix,
+        VecMono16BitSplineRampMix, VecStereo8BitSplineRampMix,
+        VecStereo16BitSplineRampMix,
+	// Spline SRC, Filter
+	VecFilterMono8BitSplineMix, VecFilterMono16BitSplineMix,
+        VecFilterStereo8BitSplineMix, VecFilterStereo16BitSplineMix,
+	VecFilterMono8BitSplineRampMix, VecFilterMono16BitSplineRampMix,
+        VecFilterStereo8BitSplineRampMix, VecFilterStereo16BitSplineRampMix,
+
+	// FirFilter SRC
+	VecMono8BitFirFilterMix, VecMono16BitFirFilterMix,
+        VecStereo8BitFirFilterMix, VecStereo16BitFirFilterMix,
+        VecMono8BitFirFilterRampMix, VecMono16BitFirFilterRampMix,
+        VecStereo8BitFirFilterRampMix, VecStereo16BitFirFilterRampMix,
+	// FirFilter SRC, Filter
+	VecFilterMono8BitFirFilterMix, VecFilterMono16BitFirFilterMix,
+        VecFilterStereo8BitFirFilterMix, VecFilterStereo16BitFirFilterMix,
+	VecFilterMono8BitFirFilterRampMix, VecFilterMono16BitFirFilterRampMix,
+        VecFilterStereo8BitFirFilterRampMix, VecFilterStereo16BitFirFilterRampMix,
+};
+
+static void initVecMixFunctionTables(void)
+{
+#if defined(MODPLUG_HAVE_SSE2)
+	if (!SDL_HasSSE2()) return;
+#elif SDL_VERSION_ATLEAST(2, 0, 6)
+	if (!SDL_HasNEON()) return;
+#endif
+	SDL_memcpy(&gpMixFunctionTable[MIXNDX_SPLINESRC], gpVecMixFunctionTable, sizeof (gpVecMixFunctionTable));
+	SDL_memcpy(&gpFastMixFunctionTable[MIXNDX_SPLINESRC], gpVecMixFunctionTable, sizeof (gpVecMixFunctionTable));
+	gbVecMix = 1;
+}
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////
 
@@ -1425,136 +1763,346 @@ static LONG MPPFASTCALL GetSampleCount(MODCHANNEL *pChn, LONG nSamples)
 }
 
 
-UINT CSoundFile_CreateStereoMix(CSoundFile *_this, int count)
-//-----------------------------------------
+// Where a channel mixes to: the song's own buffers, or a mixing thread's.
+typedef struct MODMIXTARGET
 {
-	LPLONG pOfsL, pOfsR;
-	DWORD nchused, nchmixed;
-    UINT nrampsamples;
+	int *pSoundBuffer;
+	LPLONG pDryROfsVol;
+	LPLONG pDryLOfsVol;
+#ifndef MODPLUG_NO_REVERB
+	int *pReverbBuffer;
+	UINT *pnReverbSend;
+#endif
+} MODMIXTARGET;
 
-	if (!count) return 0;
-	if (_this->gnChannels > 2) X86_InitMixBuffer(_this->MixRearBuffer, count*2);
-	nchused = nchmixed = 0;
-	for (UINT nChn=0; nChn<_this->m_nMixChannels; nChn++)
+// Mixes count samples of one channel, returns 1 if it was actually mixed
+// (as opposed to just played silently) the last time round.
+static UINT MixChannel(CSoundFile *_this, MODCHANNEL * const pChannel, int count,
+                       const MODMIXTARGET *pTarget, BOOL bCanMix)
+//---------------------------------------------------------------------
+{
+	const LPMIXINTERFACE *pMixFuncTable;
+	LPLONG pOfsL, pOfsR;
+	UINT nFlags, nrampsamples, naddmix = 0;
+	LONG nSmpCount;
+	int nsamples;
+	int *pbuffer;
+
+	pOfsR = pTarget->pDryROfsVol;
+	pOfsL = pTarget->pDryLOfsVol;
+	nFlags = 0;
+	if (pChannel->dwFlags & CHN_16BIT) nFlags |= MIXNDX_16BIT;
+	if (pChannel->dwFlags & CHN_STEREO) nFlags |= MIXNDX_STEREO;
+#ifndef NO_FILTER
+	if (pChannel->dwFlags & CHN_FILTER) nFlags |= MIXNDX_FILTER;
+#endif
+	if (!(pChannel->dwFlags & CHN_NOIDO))
 	{
-		const LPMIXINTERFACE *pMixFuncTable;
-		MODCHANNEL * const pChannel = &_this->Chn[_this->ChnMix[nChn]];
-		UINT nFlags, nMasterCh;
-		LONG nSmpCount;
-		int nsamples;
-		int *pbuffer;
+		// use hq-fir mixer?
+		if( (_this->gdwSoundSetup & (SNDMIX_HQRESAMPLER|SNDMIX_ULTRAHQSRCMODE)) == 
+			(SNDMIX_HQRESAMPLER|SNDMIX_ULTRAHQSRCMODE) )
+			nFlags += MIXNDX_FIRSRC;
+		else if( (_this->gdwSoundSetup & (SNDMIX_HQRESAMPLER)) == SNDMIX_HQRESAMPLER )
+			nFlags += MIXNDX_SPLINESRC;
+		else
+			nFlags += MIXNDX_LINEARSRC; // use
+	}
+	if ((nFlags < 0x40) && (pChannel->nLeftVol == pChannel->nRightVol)
+	 && ((!pChannel->nRampLength) || (pChannel->nLeftRamp == pChannel->nRightRamp)))
+	{
+		pMixFuncTable = gpFastMixFunctionTable;
+	} else
+	{
+		pMixFuncTable = gpMixFunctionTable;
+	}
+	nsamples = count;
+#ifndef MODPLUG_NO_REVERB
+	pbuffer = (_this->gdwSoundSetup & SNDMIX_REVERB) ? pTarget->pReverbBuffer : pTarget->pSoundBuffer;
+	if (pChannel->dwFlags & CHN_NOREVERB) pbuffer = pTarget->pSoundBuffer;
+	if (pChannel->dwFlags & CHN_REVERB) pbuffer = pTarget->pReverbBuffer;
+	if (pbuffer == pTarget->pReverbBuffer)
+	{
+		if (!*pTarget->pnReverbSend) SDL_memset(pTarget->pReverbBuffer, 0, count * 8);
+		*pTarget->pnReverbSend += count;
+	}
+#else
+	pbuffer = pTarget->pSoundBuffer;
+#endif
+	////////////////////////////////////////////////////
+SampleLooping:
+	nrampsamples = nsamples;
+	if (pChannel->nRampLength > 0)
+	{
+		if ((LONG)nrampsamples > pChannel->nRampLength) nrampsamples = pChannel->nRampLength;
+	}
+	if ((nSmpCount = GetSampleCount(pChannel, nrampsamples)) <= 0)
+	{
+		// Stopping the channel
+		pChannel->pCurrentSample = NULL;
+		pChannel->nLength = 0;
+		pChannel->nPos = 0;
+		pChannel->nPosLo = 0;
+		pChannel->nRampLength = 0;
+		X86_EndChannelOfs(pChannel, pbuffer, nsamples);
+		*pOfsR += pChannel->nROfs;
+		*pOfsL += pChannel->nLOfs;
+		pChannel->nROfs = pChannel->nLOfs = 0;
+		pChannel->dwFlags &= ~CHN_PINGPONGFLAG;
+		return 0;
+	}
+	// Should we mix this channel ?
+	if ((!bCanMix)
+	 || ((!pChannel->nRampLength) && (!(pChannel->nLeftVol|pChannel->nRightVol))))
+	{
+		LONG delta = (pChannel->nInc * (LONG)nSmpCount) + (LONG)pChannel->nPosLo;
+		pChannel->nPosLo = delta & 0xFFFF;
+		pChannel->nPos += (delta >> 16);
+		pChannel->nROfs = pChannel->nLOfs = 0;
+		pbuffer += nSmpCount*2;
+		naddmix = 0;
+	} else
+	// Do mixing
+	{
+		// Choose function for mixing
+		LPMIXINTERFACE pMixFunc;
+		pMixFunc = (pChannel->nRampLength) ? pMixFuncTable[nFlags|MIXNDX_RAMP] : pMixFuncTable[nFlags];
+		int *pbufmax = pbuffer + (nSmpCount*2);
+		pChannel->nROfs = - *(pbufmax-2);
+		pChannel->nLOfs = - *(pbufmax-1);
+		pMixFunc(pChannel, pbuffer, pbufmax);
+		pChannel->nROfs += *(pbufmax-2);
+		pChannel->nLOfs += *(pbufmax-1);
+		pbuffer = pbufmax;
+		naddmix = 1;
 
-		if (!pChannel->pCurrentSample) continue;
-		nMasterCh = (_this->ChnMix[nChn] < _this->m_nChannels) ? _this->ChnMix[nChn]+1 : pChannel->nMasterChn;
-		pOfsR = &_this->gnDryROfsVol;
-		pOfsL = &_this->gnDryLOfsVol;
-		nFlags = 0;
-		if (pChannel->dwFlags & CHN_16BIT) nFlags |= MIXNDX_16BIT;
-		if (pChannel->dwFlags & CHN_STEREO) nFlags |= MIXNDX_STEREO;
-	#ifndef NO_FILTER
-		if (pChannel->dwFlags & CHN_FILTER) nFlags |= MIXNDX_FILTER;
-	#endif
-		if (!(pChannel->dwFlags & CHN_NOIDO))
-		{
-			// use hq-fir mixer?
-			if( (_this->gdwSoundSetup & (SNDMIX_HQRESAMPLER|SNDMIX_ULTRAHQSRCMODE)) == 
-				(SNDMIX_HQRESAMPLER|SNDMIX_ULTRAHQSRCMODE) )
-				nFlags += MIXNDX_FIRSRC;
-			else if( (_this->gdwSoundSetup & (SNDMIX_HQRESAMPLER)) == SNDMIX_HQRESAMPLER )
-				nFlags += MIXNDX_SPLINESRC;
-			else
-				nFlags += MIXNDX_LINEARSRC; // use
-		}
-		if ((nFlags < 0x40) && (pChannel->nLeftVol == pChannel->nRightVol)
-		 && ((!pChannel->nRampLength) || (pChannel->nLeftRamp == pChannel->nRightRamp)))
-		{
-			pMixFuncTable = gpFastMixFunctionTable;
-		} else
+	}
+	nsamples -= nSmpCount;
+	if (pChannel->nRampLength)
+	{
+		pChannel->nRampLength -= nSmpCount;
+		if (pChannel->nRampLength <= 0)
 		{
-			pMixFuncTable = gpMixFunctionTable;
+			pChannel->nRampLength = 0;
+			pChannel->nRightVol = pChannel->nNewRightVol;
+			pChannel->nLeftVol = pChannel->nNewLeftVol;
+			pChannel->nRightRamp = pChannel->nLeftRamp = 0;
+			if ((pChannel->dwFlags & CHN_NOTEFADE) && (!(pChannel->nFadeOutVol)))
+			{
+				pChannel->nLength = 0;
+				pChannel->pCurrentSample = NULL;
+			}
 		}
-		nsamples = count;
+	}
+	if (nsamples > 0) goto SampleLooping;
+	return naddmix;
+}
+
+
+/////////////////////////////////////////////////////////////////////////
+// Mixing threads
+//
+// Each channel mixes into its own partial buffer and only touches its own
+// MODCHANNEL, so the channels can be shared out between threads; the
+// partial buffers are added up afterwards. Integer adds don't care about
+// order, so the result is the same as mixing them one after another.
+// Only the first m_nMaxMixChannels channels are done like this: whether a
+// channel past that gets mixed at all depends on how many before it were.
+
+#define MIXTHREAD_MINCHANNELS	8
+
+typedef struct MODMIXWORKER
+{
+	struct MODMIXPOOL *pPool;
+	SDL_Thread *thread;
+	SDL_sem *go;
+	UINT nIndex;
+	UINT nchused;
+	MODMIXTARGET target;
+	LONG nDryROfsVol, nDryLOfsVol;
+	int MixSoundBuffer[MIXBUFFERSIZE*2];
 #ifndef MODPLUG_NO_REVERB
-		pbuffer = (_this->gdwSoundSetup & SNDMIX_REVERB) ? _this->MixReverbBuffer : _this->MixSoundBuffer;
-		if (pChannel->dwFlags & CHN_NOREVERB) pbuffer = _this->MixSoundBuffer;
-		if (pChannel->dwFlags & CHN_REVERB) pbuffer = _this->MixReverbBuffer;
-		if (pbuffer == _this->MixReverbBuffer)
-		{
-			if (!_this->gnReverbSend) SDL_memset(_this->MixReverbBuffer, 0, count * 8);
-			_this->gnReverbSend += count;
-		}
-#else
-		pbuffer = _this->MixSoundBuffer;
+	UINT nReverbSend;
+	int MixReverbBuffer[MIXBUFFERSIZE*2];
 #endif
+} MODMIXWORKER;
+
+typedef struct MODMIXPOOL
+{
+	CSoundFile *pSndFile;
+	SDL_sem *done;
+	UINT nThreads;		// workers + the thread calling CSoundFile_Read()
+	UINT nWorkers;
+	UINT nChannels;		// ChnMix[0..nChannels) are mixed in parallel
+	int nCount;
+	BOOL bQuit;
+	BYTE AddMix[MAX_CHANNELS];
+	MODMIXWORKER Workers[1];
+} MODMIXPOOL;
+
+// Mixes every nThreads'th channel, starting at nIndex.
+static UINT MixChannelShare(MODMIXPOOL *pPool, UINT nIndex, const MODMIXTARGET *pTarget)
+//--------------------------------------------------------------------------
+{
+	CSoundFile *_this = pPool->pSndFile;
+	UINT nchused = 0;
+	for (UINT nChn=nIndex; nChn<pPool->nChannels; nChn+=pPool->nThreads)
+	{
+		MODCHANNEL * const pChannel = &_this->Chn[_this->ChnMix[nChn]];
+		pPool->AddMix[nChn] = 0;
+		if (!pChannel->pCurrentSample) continue;
 		nchused++;
-		////////////////////////////////////////////////////
-	SampleLooping:
-		nrampsamples = nsamples;
-		if (pChannel->nRampLength > 0)
-		{
-			if ((LONG)nrampsamples > pChannel->nRampLength) nrampsamples = pChannel->nRampLength;
-		}
-		if ((nSmpCount = GetSampleCount(pChannel, nrampsamples)) <= 0)
+		pPool->AddMix[nChn] = (BYTE)MixChannel(_this, pChannel, pPool->nCount, pTarget, TRUE);
+	}
+	return nchused;
+}
+
+static int SDLCALL MixWorkerThread(void *data)
+//--------------------------------------------
+{
+	MODMIXWORKER *pWorker = (MODMIXWORKER *)data;
+	MODMIXPOOL *pPool = pWorker->pPool;
+	for (;;)
+	{
+		SDL_SemWait(pWorker->go);
+		if (pPool->bQuit) break;
+		X86_InitMixBuffer(pWorker->MixSoundBuffer, pPool->nCount*2);
+		pWorker->nDryROfsVol = pWorker->nDryLOfsVol = 0;
+	#ifndef MODPLUG_NO_REVERB
+		pWorker->nReverbSend = 0;
+	#endif
+		pWorker->nchused = MixChannelShare(pPool, pWorker->nIndex, &pWorker->target);
+		SDL_SemPost(pPool->done);
+	}
+	return 0;
+}
+
+static void FreeMixPool(MODMIXPOOL *pPool)
+//----------------------------------------
+{
+	UINT i;
+	pPool->bQuit = TRUE;
+	for (i=0; i<pPool->nWorkers; i++) SDL_SemPost(pPool->Workers[i].go);
+	for (i=0; i<pPool->nWorkers; i++)
+	{
+		SDL_WaitThread(pPool->Workers[i].thread, NULL);
+		SDL_DestroySemaphore(pPool->Workers[i].go);
+	}
+	if (pPool->done) SDL_DestroySemaphore(pPool->done);
+	__Sound_Free(pPool);
+}
+
+BOOL CSoundFile_SetMixThreads(CSoundFile *_this, UINT nThreads)
+//-------------------------------------------------------------
+{
+	MODMIXPOOL *pPool;
+	UINT i;
+
+	if (_this->pMixPool)
+	{
+		FreeMixPool(_this->pMixPool);
+		_this->pMixPool = NULL;
+	}
+	if (nThreads < 2) return TRUE;
+	if (nThreads > MAX_MIXTHREADS) nThreads = MAX_MIXTHREADS;
+
+	pPool = (MODMIXPOOL *)__Sound_Calloc(1, sizeof (MODMIXPOOL) + (nThreads-2) * sizeof (MODMIXWORKER));
+	if (!pPool) return FALSE;
+	pPool->pSndFile = _this;
+	pPool->done = SDL_CreateSemaphore(0);
+	if (!pPool->done)
+	{
+		__Sound_Free(pPool);
+		return FALSE;
+	}
+	for (i=0; i<nThreads-1; i++)
+	{
+		MODMIXWORKER *pWorker = &pPool->Workers[i];
+		pWorker->pPool = pPool;
+		pWorker->nIndex = i+1;
+		pWorker->target.pSoundBuffer = pWorker->MixSoundBuffer;
+		pWorker->target.pDryROfsVol = &pWorker->nDryROfsVol;
+		pWorker->target.pDryLOfsVol = &pWorker->nDryLOfsVol;
+	#ifndef MODPLUG_NO_REVERB
+		pWorker->target.pReverbBuffer = pWorker->MixReverbBuffer;
+		pWorker->target.pnReverbSend = &pWorker->nReverbSend;
+	#endif
+		pWorker->go = SDL_CreateSemaphore(0);
+		if (!pWorker->go) break;
+		pWorker->thread = SDL_CreateThread(MixWorkerThread, "ModPlug mix", pWorker);
+		if (!pWorker->thread)
 		{
-			// Stopping the channel
-			pChannel->pCurrentSample = NULL;
-			pChannel->nLength = 0;
-			pChannel->nPos = 0;
-			pChannel->nPosLo = 0;
-			pChannel->nRampLength = 0;
-			X86_EndChannelOfs(pChannel, pbuffer, nsamples);
-			*pOfsR += pChannel->nROfs;
-			*pOfsL += pChannel->nLOfs;
-			pChannel->nROfs = pChannel->nLOfs = 0;
-			pChannel->dwFlags &= ~CHN_PINGPONGFLAG;
-			continue;
+			SDL_DestroySemaphore(pWorker->go);
+			break;
 		}
-		// Should we mix this channel ?
-		UINT naddmix;
-		if (((nchmixed >= _this->m_nMaxMixChannels) && (!(_this->gdwSoundSetup & SNDMIX_DIRECTTODISK)))
-		 || ((!pChannel->nRampLength) && (!(pChannel->nLeftVol|pChannel->nRightVol))))
-		{
-			LONG delta = (pChannel->nInc * (LONG)nSmpCount) + (LONG)pChannel->nPosLo;
-			pChannel->nPosLo = delta & 0xFFFF;
-			pChannel->nPos += (delta >> 16);
-			pChannel->nROfs = pChannel->nLOfs = 0;
-			pbuffer += nSmpCount*2;
-			naddmix = 0;
-		} else
-		// Do mixing
-		{
-			// Choose function for mixing
-			LPMIXINTERFACE pMixFunc;
-			pMixFunc = (pChannel->nRampLength) ? pMixFuncTable[nFlags|MIXNDX_RAMP] : pMixFuncTable[nFlags];
-			int *pbufmax = pbuffer + (nSmpCount*2);
-			pChannel->nROfs = - *(pbufmax-2);
-			pChannel->nLOfs = - *(pbufmax-1);
-			pMixFunc(pChannel, pbuffer, pbufmax);
-			pChannel->nROfs += *(pbufmax-2);
-			pChannel->nLOfs += *(pbufmax-1);
-			pbuffer = pbufmax;
-			naddmix = 1;
+		pPool->nWorkers++;
+	}
+	if (!pPool->nWorkers)
+	{
+		FreeMixPool(pPool);
+		return FALSE;
+	}
+	// the threads take every nThreads'th channel, so this has to be exact.
+	pPool->nThreads = pPool->nWorkers + 1;
+	_this->pMixPool = pPool;
+	return TRUE;
+}
 
-		}
-		nsamples -= nSmpCount;
-		if (pChannel->nRampLength)
+
+UINT CSoundFile_CreateStereoMix(CSoundFile *_this, int count)
+//-----------------------------------------
+{
+	MODMIXPOOL *pPool = _this->pMixPool;
+	MODMIXTARGET target;
+	DWORD nchused, nchmixed;
+	UINT nChn = 0;
+
+	if (!count) return 0;
+	if (_this->gnChannels > 2) X86_InitMixBuffer(_this->MixRearBuffer, count*2);
+	target.pSoundBuffer = _this->MixSoundBuffer;
+	target.pDryROfsVol = &_this->gnDryROfsVol;
+	target.pDryLOfsVol = &_this->gnDryLOfsVol;
+#ifndef MODPLUG_NO_REVERB
+	target.pReverbBuffer = _this->MixReverbBuffer;
+	target.pnReverbSend = &_this->gnReverbSend;
+#endif
+	nchused = nchmixed = 0;
+	if ((pPool) && (_this->m_nMixChannels >= MIXTHREAD_MINCHANNELS))
+	{
+		UINT i, j;
+		pPool->nCount = count;
+		pPool->nChannels = _this->m_nMixChannels;
+		if ((pPool->nChannels > _this->m_nMaxMixChannels) && (!(_this->gdwSoundSetup & SNDMIX_DIRECTTODISK)))
+			pPool->nChannels = _this->m_nMaxMixChannels;
+		for (i=0; i<pPool->nWorkers; i++) SDL_SemPost(pPool->Workers[i].go);
+		nchused += MixChannelShare(pPool, 0, &target);
+		for (i=0; i<pPool->nWorkers; i++) SDL_SemWait(pPool->done);
+		for (i=0; i<pPool->nWorkers; i++)
 		{
-			pChannel->nRampLength -= nSmpCount;
-			if (pChannel->nRampLength <= 0)
+			MODMIXWORKER *pWorker = &pPool->Workers[i];
+			for (j=0; j<(UINT)count*2; j++) _this->MixSoundBuffer[j] += pWorker->MixSoundBuffer[j];
+		#ifndef MODPLUG_NO_REVERB
+			if (pWorker->nReverbSend)
 			{
-				pChannel->nRampLength = 0;
-				pChannel->nRightVol = pChannel->nNewRightVol;
-				pChannel->nLeftVol = pChannel->nNewLeftVol;
-				pChannel->nRightRamp = pChannel->nLeftRamp = 0;
-				if ((pChannel->dwFlags & CHN_NOTEFADE) && (!(pChannel->nFadeOutVol)))
-				{
-					pChannel->nLength = 0;
-					pChannel->pCurrentSample = NULL;
-				}
+				if (!_this->gnReverbSend) SDL_memset(_this->MixReverbBuffer, 0, count * 8);
+				for (j=0; j<(UINT)count*2; j++) _this->MixReverbBuffer[j] += pWorker->MixReverbBuffer[j];
+				_this->gnReverbSend += pWorker->nReverbSend;
 			}
+		#endif
+			_this->gnDryROfsVol += pWorker->nDryROfsVol;
+			_this->gnDryLOfsVol += pWorker->nDryLOfsVol;
+			nchused += pWorker->nchused;
 		}
-		if (nsamples > 0) goto SampleLooping;
-		nchmixed += naddmix;
+		for (nChn=0; nChn<pPool->nChannels; nChn++) nchmixed += pPool->AddMix[nChn];
+	}
+	for (; nChn<_this->m_nMixChannels; nChn++)
+	{
+		MODCHANNEL * const pChannel = &_this->Chn[_this->ChnMix[nChn]];
+		BOOL bCanMix;
+
+		if (!pChannel->pCurrentSample) continue;
+		nchused++;
+		bCanMix = (nchmixed < _this->m_nMaxMixChannels) || (_this->gdwSoundSetup & SNDMIX_DIRECTTODISK);
+		nchmixed += MixChannel(_this, pChannel, count, &target, bCanMix);
 	}
 	return nchused;
 }
@@ -1673,6 +2221,32 @@ DWORD MPPASMCALL X86_Convert32To32(LPVOID lp16, int *pBuffer, DWORD lSampleCount
 	return lSampleCount * 4;
 }
 
+// Clip and convert to 32 bit float, -1.0 to 1.0
+DWORD MPPASMCALL X86_Convert32ToFloat(LPVOID lpf, int *pBuffer, DWORD lSampleCount, LPLONG lpMin, LPLONG lpMax)
+{
+	UINT i ;
+	int vumin = *lpMin, vumax = *lpMax;
+	float *p = (float *)lpf;
+	const float scale = 1.0f / (float)(MIXING_CLIPMAX + 1);
+
+	for ( i=0; i<lSampleCount; i++)
+	{
+		int n = pBuffer[i];
+		if (n < MIXING_CLIPMIN)
+			n = MIXING_CLIPMIN;
+		else if (n > MIXING_CLIPMAX)
+			n = MIXING_CLIPMAX;
+		if (n < vumin)
+			vumin = n;
+		else if (n > vumax)
+			vumax = n;
+		p[i] = (float)n * scale;
+	}
+	*lpMin = vumin;
+	*lpMax = vumax;
+	return lSampleCount * 4;
+}
+
 //---GCCFIX: Asm replaced with C function
 // Will fill in later.
 void MPPASMCALL X86_InitMixBuffer(int *pBuffer, UINT nSamples)
@@ -1701,6 +2275,69 @@ VOID MPPASMCALL X86_MonoFromStereo(int *pMixBuf, UINT nSamples)
 //---GCCFIX: Asm replaced with C function
 #define OFSDECAYSHIFT    8
 #define OFSDECAYMASK     0xFF
+
+#ifdef MODPLUG_HAVE_VECMIX
+// Both offsets decay in one register, and once they're both zero they stay
+// zero, so the rest of the buffer is just cleared/left alone.
+#ifdef MODPLUG_HAVE_SSE2
+#define VECOFS_T		__m128i
+#define VECOFS_LOAD(r,l)	_mm_setr_epi32(r, l, 0, 0)
+#define VECOFS_DECAY(o)		_mm_srai_epi32(_mm_add_epi32(o, _mm_and_si128(_mm_srai_epi32(_mm_sub_epi32(_mm_setzero_si128(), o), 31), _mm_set1_epi32(OFSDECAYMASK))), OFSDECAYSHIFT)
+#define VECOFS_SUB(a,b)		_mm_sub_epi32(a, b)
+#define VECOFS_ISZERO(o)	(_mm_movemask_epi8(_mm_cmpeq_epi32(o, _mm_setzero_si128())) == 0xFFFF)
+#define VECOFS_STORE(p,x)	_mm_storel_epi64((__m128i *)(p), x)
+#define VECOFS_ADD(p,x)		_mm_storel_epi64((__m128i *)(p), _mm_add_epi32(_mm_loadl_epi64((const __m128i *)(p)), x))
+#define VECOFS_R(o)		_mm_cvtsi128_si32(o)
+#define VECOFS_L(o)		_mm_cvtsi128_si32(_mm_srli_si128(o, 4))
+#else
+#define VECOFS_T		int32x2_t
+#define VECOFS_LOAD(r,l)	vset_lane_s32(l, vdup_n_s32(r), 1)
+#define VECOFS_DECAY(o)		vshr_n_s32(vadd_s32(o, vand_s32(vshr_n_s32(vneg_s32(o), 31), vdup_n_s32(OFSDECAYMASK))), OFSDECAYSHIFT)
+#define VECOFS_SUB(a,b)		vsub_s32(a, b)
+#define VECOFS_ISZERO(o)	(vget_lane_u64(vreinterpret_u64_s32(o), 0) == 0)
+#define VECOFS_STORE(p,x)	vst1_s32((int32_t *)(p), x)
+#define VECOFS_ADD(p,x)		vst1_s32((int32_t *)(p), vadd_s32(vld1_s32((const int32_t *)(p)), x))
+#define VECOFS_R(o)		vget_lane_s32(o, 0)
+#define VECOFS_L(o)		vget_lane_s32(o, 1)
+#endif
+
+static void VecStereoFill(int *pBuffer, UINT nSamples, LPLONG lpROfs, LPLONG lpLOfs)
+{
+	VECOFS_T ofs = VECOFS_LOAD(*lpROfs, *lpLOfs);
+	UINT i;
+
+	for (i=0; i<nSamples; i++)
+	{
+		const VECOFS_T x = VECOFS_DECAY(ofs);
+		ofs = VECOFS_SUB(ofs, x);
+		VECOFS_STORE(pBuffer+i*2, x);
+		if (VECOFS_ISZERO(ofs))
+		{
+			i++;
+			break;
+		}
+	}
+	if (i < nSamples) X86_InitMixBuffer(pBuffer+i*2, (nSamples-i)*2);
+	*lpROfs = VECOFS_R(ofs);
+	*lpLOfs = VECOFS_L(ofs);
+}
+
+static void VecEndChannelOfs(MODCHANNEL *pChannel, int *pBuffer, UINT nSamples)
+{
+	VECOFS_T ofs = VECOFS_LOAD(pChannel->nROfs, pChannel->nLOfs);
+
+	for (UINT i=0; i<nSamples; i++)
+	{
+		const VECOFS_T x = VECOFS_DECAY(ofs);
+		ofs = VECOFS_SUB(ofs, x);
+		VECOFS_ADD(pBuffer+i*2, x);
+		if (VECOFS_ISZERO(ofs)) break;
+	}
+	pChannel->nROfs = VECOFS_R(ofs);
+	pChannel->nLOfs = VECOFS_L(ofs);
+}
+#endif
+
 void MPPASMCALL X86_StereoFill(int *pBuffer, UINT nSamples, LPLONG lpROfs, LPLONG lpLOfs)
 //----------------------------------------------------------------------------
 {
@@ -1712,6 +2349,13 @@ void MPPASMCALL X86_StereoFill(int *pBuffer, UINT nSamples, LPLONG lpROfs, LPLON
 		X86_InitMixBuffer(pBuffer, nSamples*2);
 		return;
 	}
+#ifdef MODPLUG_HAVE_VECMIX
+	if (gbVecMix)
+	{
+		VecStereoFill(pBuffer, nSamples, lpROfs, lpLOfs);
+		return;
+	}
+#endif
 	for (UINT i=0; i<nSamples; i++)
 	{
 		int x_r = (rofs + (((-rofs)>>31) & OFSDECAYMASK)) >> OFSDECAYSHIFT;
@@ -1733,6 +2377,13 @@ void MPPASMCALL X86_EndChannelOfs(MODCHANNEL *pChannel, int *pBuffer, UINT nSamp
 	int lofs = pChannel->nLOfs;
 
 	if ((!rofs) && (!lofs)) return;
+#ifdef MODPLUG_HAVE_VECMIX
+	if (gbVecMix)
+	{
+		VecEndChannelOfs(pChannel, pBuffer, nSamples);
+		return;
+	}
+#endif
 	for (UINT i=0; i<nSamples; i++)
 	{
 		int x_r = (rofs + (((-rofs)>>31) & OFSDECAYMASK)) >> OFSDECAYSHIFT;
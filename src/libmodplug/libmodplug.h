@@ -73,8 +73,15 @@ inline LONG MulDiv (long a, long b, long c)
 
 #define  GHND   0
 
-#define GlobalAllocPtr(x, size) ((int8_t *) SDL_calloc(1, (size)))
-#define GlobalFreePtr(p) SDL_free((void *)(p))
+/* memory comes from SDL_sound's allocator; see Sound_SetAllocator(). */
+extern void *__Sound_Malloc(size_t len);
+extern void *__Sound_Calloc(size_t nmemb, size_t len);
+extern void *__Sound_Realloc(void *ptr, size_t len);
+extern void __Sound_Free(void *ptr);
+extern char *__Sound_StrDup(const char *str);
+
+#define GlobalAllocPtr(x, size) ((int8_t *) __Sound_Calloc(1, (size)))
+#define GlobalFreePtr(p) __Sound_Free((void *)(p))
 
 #ifndef FALSE
 #define FALSE	0
@@ -114,10 +121,10 @@ char *rwops_fgets(char *buf, int buflen, SDL_RWops *rwops);
 #define _mm_read_SBYTES(buf,sz,f)	SDL_RWread(f, buf, 1, sz)
 #define _mm_feof(f)					(SDL_RWtell(f) >= SDL_RWsize(f))
 #define _mm_fclose(f)				SDL_RWclose(f)
-#define DupStr(h,buf,sz)			SDL_strdup(buf)
-#define _mm_calloc(h,n,sz)			SDL_calloc(n,sz)
-#define _mm_recalloc(h,buf,sz,elsz)	SDL_realloc(buf,sz)
-#define _mm_free(h,p)				SDL_free(p)
+#define DupStr(h,buf,sz)			__Sound_StrDup(buf)
+#define _mm_calloc(h,n,sz)			__Sound_Calloc(n,sz)
+#define _mm_recalloc(h,buf,sz,elsz)	__Sound_Realloc(buf,sz)
+#define _mm_free(h,p)				__Sound_Free(p)
 
 
 #define MODPLUG_EXPORT
@@ -404,6 +411,7 @@ typedef const BYTE * LPCBYTE;
 #define REVERBBUFFERSIZE4	((REVERBBUFFERSIZE*7) / 19)
 
 #define MIXBUFFERSIZE		512
+#define MAX_MIXTHREADS		8
 #define MIXING_ATTENUATION	4
 #define MIXING_CLIPMIN		(-0x08000000)
 #define MIXING_CLIPMAX		(0x07FFFFFF)
@@ -620,6 +628,29 @@ typedef struct MODMIDICFG
 
 #define NOTE_MAX                        120 //Defines maximum notevalue as well as maximum number of notes.
 
+// Zeroed memory that lives as long as its owner, handed out of a few big
+// blocks. ModArena_Release only gives memory back if it was the latest
+// allocation; everything goes at once with ModArena_Free.
+typedef struct _MODARENABLOCK MODARENABLOCK;
+
+typedef struct _MODARENA
+{
+	MODARENABLOCK *pBlocks;		// Most recent first
+	DWORD dwNextSize;
+} MODARENA;
+
+LPVOID ModArena_Alloc(MODARENA *pArena, DWORD nBytes);
+void ModArena_Release(MODARENA *pArena, LPVOID p);
+void ModArena_Free(MODARENA *pArena);
+DWORD ModArena_GetSize(const MODARENA *pArena);
+
+typedef struct _MODSEEKPOINT
+{
+	DWORD dwTime;		// Milliseconds from the start of the song
+	UINT nPos;			// Row, as counted by CSoundFile_SetCurrentPos
+	BYTE nSpeed, nTempo;
+} MODSEEKPOINT;
+
 typedef struct CSoundFile
 {
 	MODCHANNEL Chn[MAX_CHANNELS];					// Channels
@@ -653,6 +684,7 @@ typedef struct CSoundFile
 	UINT m_nStereoSeparation;
 	UINT m_nMaxMixChannels;
 	DWORD gdwSoundSetup, gdwMixingFreq, gnBitsPerSample, gnChannels;
+	BOOL gbFloatOutput;		// 32 bits per sample are floats
 	UINT gnVolumeRampSamples;
     UINT gSampleSize;
     int MixSoundBuffer[MIXBUFFERSIZE*4];
@@ -719,6 +751,11 @@ typedef struct CSoundFile
     LONG gnRvbROfsVol;
     LONG gnRvbLOfsVol;
     int gbInitPlugins;
+    struct MODMIXPOOL *pMixPool;	// NULL unless mixing with threads
+    MODSEEKPOINT *pSeekIndex;		// Start of every row, NULL until first seek
+    UINT nSeekPoints;
+    DWORD dwSongLength;				// Milliseconds, valid with pSeekIndex
+    MODARENA m_Arena;				// Patterns and samples
 } CSoundFile;
 
 typedef struct _ModPlug_Settings ModPlug_Settings;
@@ -728,6 +765,9 @@ void delete_CSoundFile(CSoundFile *_this);
 	UINT CSoundFile_GetMaxPosition(CSoundFile *_this);
 	void CSoundFile_SetCurrentPos(CSoundFile *_this, UINT nPos);
 	DWORD CSoundFile_GetLength(CSoundFile *_this, BOOL bAdjust, BOOL bTotal);
+	BOOL CSoundFile_BuildSeekIndex(CSoundFile *_this);
+	DWORD CSoundFile_GetSongTime(CSoundFile *_this);
+	BOOL CSoundFile_SeekTime(CSoundFile *_this, DWORD dwTime);
 	void CSoundFile_SetRepeatCount(CSoundFile *_this, int n);
 	BOOL CSoundFile_SetPatternName(CSoundFile *_this, UINT nPat, LPCSTR lpszName);
 	// Module Loaders
@@ -777,6 +817,7 @@ void delete_CSoundFile(CSoundFile *_this);
 	BOOL CSoundFile_SetMixConfig(CSoundFile *_this, UINT nStereoSeparation, UINT nMaxMixChannels);
 	BOOL CSoundFile_SetWaveConfig(CSoundFile *_this, UINT nRate,UINT nBits,UINT nChannels);
 	BOOL CSoundFile_SetResamplingMode(CSoundFile *_this, UINT nMode); // SRCMODE_XXXX
+	BOOL CSoundFile_SetMixThreads(CSoundFile *_this, UINT nThreads); // 0 or 1 for none
 	DWORD CSoundFile_InitSysInfo(CSoundFile *_this);
 
 	//GCCFIX -- added these functions back in!
@@ -862,10 +903,10 @@ void delete_CSoundFile(CSoundFile *_this);
 	int CSoundFile_FrequencyToTranspose(DWORD freq);
 	void CSoundFile_FrequencyToTransposeInstrument(MODINSTRUMENT *psmp);
 
-	MODCOMMAND *CSoundFile_AllocatePattern(UINT rows, UINT nchns);
-	signed char* CSoundFile_AllocateSample(UINT nbytes);
-	void CSoundFile_FreePattern(LPVOID pat);
-	void CSoundFile_FreeSample(LPVOID p);
+	MODCOMMAND *CSoundFile_AllocatePattern(CSoundFile *_this, UINT rows, UINT nchns);
+	signed char* CSoundFile_AllocateSample(CSoundFile *_this, UINT nbytes);
+	void CSoundFile_FreePattern(CSoundFile *_this, LPVOID pat);
+	void CSoundFile_FreeSample(CSoundFile *_this, LPVOID p);
 	UINT CSoundFile_Normalize24BitBuffer(LPBYTE pbuffer, UINT cbsizebytes, DWORD lmax24, DWORD dwByteInc);
 
 
@@ -105,7 +105,7 @@ BOOL CSoundFile_Read669(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	dwMemPos = 0x1F1 + pfh->samples * 25;
 	for (UINT npat=0; npat<pfh->patterns; npat++)
 	{
-		_this->Patterns[npat] = CSoundFile_AllocatePattern(64, _this->m_nChannels);
+		_this->Patterns[npat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels);
 		if (!_this->Patterns[npat]) break;
 		_this->PatternSize[npat] = 64;
 		MODCOMMAND *m = _this->Patterns[npat];
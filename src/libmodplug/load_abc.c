@@ -187,6 +187,7 @@ typedef struct _ABCHANDLE
 	int dronegm, dronepitch[2], dronevol[2];
 	ABCTRACK *tp, *tpc, *tpr;
 	uint32_t tracktime;
+	MODARENA trackhandle;	// tracks and events; only freed by ABC_Cleanup
 } ABCHANDLE;
 
 /* !!! FIXME: global state */
@@ -401,7 +402,7 @@ static ABCEVENT *abc_new_event(ABCHANDLE *h, uint32_t abctick, const char data[]
     ABCEVENT   *retval;
 		int i;
 
-    retval = (ABCEVENT *)_mm_calloc(h->trackhandle, 1,sizeof(ABCEVENT));
+    retval = (ABCEVENT *)ModArena_Alloc(&h->trackhandle, sizeof(ABCEVENT));
 		retval->next        = NULL;
     retval->tracktick   = abctick;
 		for( i=0; i<6; i++ )
@@ -416,7 +417,7 @@ static ABCEVENT *abc_copy_event(ABCHANDLE *h, ABCEVENT *se)
 // =============================================================================
 {
 	ABCEVENT *e;
-	e = (ABCEVENT *)_mm_calloc(h->trackhandle, 1,sizeof(ABCEVENT));
+	e = (ABCEVENT *)ModArena_Alloc(&h->trackhandle, sizeof(ABCEVENT));
 	e->next        = NULL;
 	e->tracktick   = se->tracktick;
 	e->flg         = se->flg;
@@ -481,7 +482,7 @@ static ABCTRACK *abc_new_track(ABCHANDLE *h, const char *voice, int pos)
 {
 	ABCTRACK *retval;
 	if( !pos ) global_voiceno++;
-	retval = (ABCTRACK *)_mm_calloc(h->trackhandle, 1,sizeof(ABCTRACK));
+	retval = (ABCTRACK *)ModArena_Alloc(&h->trackhandle, sizeof(ABCTRACK));
 	retval->next         = NULL;
 	retval->vno          = global_voiceno;
 	retval->vpos         = pos;
@@ -878,14 +879,12 @@ static void abc_remove_unnecessary_events(ABCHANDLE *h)
 							el->next = ep->next;
 							if( !el->next )
 								tp->tail = el;
-							_mm_free(h->trackhandle,ep);
 							ep = el->next;
 						}
 						else {
 							tp->head = ep->next;
 							if( !tp->head )
 								tp->tail = NULL;
-							_mm_free(h->trackhandle,ep);
 							ep = tp->head;
 						}
 						break;
@@ -907,12 +906,10 @@ static void abc_remove_unnecessary_events(ABCHANDLE *h)
 		if( !tp->head ) { // no need to keep empty tracks...
 			if( ptp ) {
 				ptp->next = tp->next;
-				_mm_free(h->trackhandle,tp);
 				tp = ptp;
 			}
 			else if (tp->next) {
 				h->track = tp->next;
-				_mm_free(h->trackhandle,tp);
 				tp = h->track;
 			} else {
 				break;
@@ -1680,7 +1677,7 @@ static void	abc_set_parts(char **d, char *p)
 	int i,k,m,n;
 	size_t j, size;
 	char *q;
-	if( *d ) SDL_free(*d);
+	if( *d ) __Sound_Free(*d);
 	*d = 0;
 	if( !p ) return;
 	for( i=0; p[i] && p[i] != '%'; i++ ) {
@@ -1815,20 +1812,13 @@ static void abc_stripoff(ABCHANDLE *h, ABCTRACK *tp, uint32_t tt)
 	for( e1 = tp->head; e1 && e1->tracktick <= tt; e1=e1->next )
 		e2 = e1;
 	if( e2 ) {
-		e1 = e2->next;
 		tp->tail = e2;
 		e2->next = NULL;
 	}
 	else {
-		e1 = tp->tail;
 		tp->head = NULL;
 		tp->tail = NULL;
 	}
-	while( e1 ) {
-		e2 = e1->next;
-		_mm_free(h->trackhandle,e1);
-		e1 = e2;
-	}
 }
 
 static void abc_keeptiednotes(ABCHANDLE *h, uint32_t fromtime, uint32_t totime) {
@@ -2225,7 +2215,7 @@ static ABCHANDLE *ABC_Init(void)
     ABCHANDLE   *retval;
 		char *p;
 		char buf[10];
-    retval = (ABCHANDLE *)SDL_calloc(1,sizeof(ABCHANDLE));
+    retval = (ABCHANDLE *)__Sound_Calloc(1,sizeof(ABCHANDLE));
 		if( !retval ) return NULL;
 
 		retval->track       = NULL;
@@ -2257,37 +2247,21 @@ static ABCHANDLE *ABC_Init(void)
     return retval;
 }
 
-static void ABC_CleanupTrack(ABCTRACK *tp)
-{
-	ABCEVENT *ep, *en;
-	if( tp ) {
-		for( ep=tp->head; ep; ep = en ) {
-			en=ep->next;
-			SDL_free(ep);
-		}
-		tp->head = NULL;
-	}
-}
-
 static void ABC_CleanupMacro(ABCMACRO *m)
 {
 	if( m->name )
-		SDL_free(m->name);
+		__Sound_Free(m->name);
 	if( m->subst )
-		SDL_free(m->subst);
-	SDL_free(m);
+		__Sound_Free(m->subst);
+	__Sound_Free(m);
 }
 
 // =====================================================================================
 static void ABC_CleanupTracks(ABCHANDLE *handle)
 // =====================================================================================
 {
-	ABCTRACK *tp, *tn;
 	if(handle) {
-		for( tp=handle->track; tp; tp = tn ) {
-			tn=tp->next;
-			ABC_CleanupTrack(tp);
-		}
+		ModArena_Free(&handle->trackhandle);
 		handle->track = NULL;
 	}
 }
@@ -2319,10 +2293,10 @@ static void ABC_Cleanup(ABCHANDLE *handle)
 		ABC_CleanupMacros(handle);
 		ABC_CleanupTracks(handle);
 		if( handle->line )
-			SDL_free(handle->line);
+			__Sound_Free(handle->line);
 		if( handle->beatstring )
-			SDL_free(handle->beatstring);
-		SDL_free(handle);
+			__Sound_Free(handle->beatstring);
+		__Sound_Free(handle);
 	}
 }
 
@@ -2343,7 +2317,7 @@ static ABCEVENT *abc_next_note(ABCEVENT *e)
 	return e;
 }
 
-static int ABC_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], ABCHANDLE *h, int numpat, int channels)
+static int ABC_ReadPatterns(CSoundFile *_this, MODCOMMAND *pattern[], WORD psize[], ABCHANDLE *h, int numpat, int channels)
 // =====================================================================================
 {
 	int pat,row,i,ch,trillbits;
@@ -2359,7 +2333,7 @@ static int ABC_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], ABCHANDLE *h, i
 	for( t = h->track; t; t = t->next ) t->capostart = t->head;
 	trillbits = 0; // trill effect admininstration: one bit per channel, max 32 channnels
 	for( pat = 0; pat < numpat; pat++ ) {
-		pattern[pat] = CSoundFile_AllocatePattern(64, channels);
+		pattern[pat] = CSoundFile_AllocatePattern(_this, 64, channels);
 		if( !pattern[pat] ) return 0;
 		psize[pat] = 64;
 		for( row = 0; row < 64; row++ ) {
@@ -3395,8 +3369,8 @@ static char *abc_continuated(ABCHANDLE *h, MMFILE *mmf, char *p) {
 	int continued;
 	pm = p;
 	while( pm[SDL_strlen(pm)-1]=='\\' ) {
-		p1 = SDL_strdup(pm);
-		if( p2 ) SDL_free(p2);
+		p1 = __Sound_StrDup(pm);
+		if( p2 ) __Sound_Free(p2);
 		continued = 1;
 		while( continued ) {
 			continued = 0;
@@ -3418,7 +3392,7 @@ static char *abc_continuated(ABCHANDLE *h, MMFILE *mmf, char *p) {
 			}
 		}
 		const size_t macrolinelen = SDL_strlen(p1)+SDL_strlen(pm)+1;
-		p2 = (char *)SDL_malloc(macrolinelen);
+		p2 = (char *)__Sound_Malloc(macrolinelen);
 		if( !p2 ) {
 			abc_message("macro line too long\n%s", p1);
 			return p1;
@@ -3427,7 +3401,7 @@ static char *abc_continuated(ABCHANDLE *h, MMFILE *mmf, char *p) {
 		SDL_strlcpy(p2,p1,macrolinelen);
 		SDL_strlcat(p2,pm,macrolinelen);
 		pm = p2;
-		SDL_free(p1);
+		__Sound_Free(p1);
 	}
 	return pm;
 }
@@ -3782,7 +3756,7 @@ BOOL CSoundFile_ReadABC(CSoundFile *_this, const uint8_t *lpStream, DWORD dwMemL
 					pm = abc_continuated(h, mmstack[mmsp], p);
 					abc_new_macro(h, pm+2);
 					if( pm != p ) {
-						SDL_free(pm);
+						__Sound_Free(pm);
 						if( h->tp ) abcnolegato = !h->tp->legato;
 						if( !abcnolegato ) abcnoslurs = 0;
 					}
@@ -4690,19 +4664,19 @@ BOOL CSoundFile_ReadABC(CSoundFile *_this, const uint8_t *lpStream, DWORD dwMemL
 			break;
 		_this->Order[t] = orderlist[t];
 	}
-	SDL_free(orderlist);	// get rid of orderlist memory
+	__Sound_Free(orderlist);	// get rid of orderlist memory
 	// ==============================
 	// Load the pattern info now!
-	if( ABC_ReadPatterns(_this->Patterns, _this->PatternSize, h, numpat, _this->m_nChannels) ) {
+	if( ABC_ReadPatterns(_this, _this->Patterns, _this->PatternSize, h, numpat, _this->m_nChannels) ) {
 		// :^(  need one more channel to handle the global events ;^b
 		_this->m_nChannels++;
 		h->tp = abc_locate_track(h, "", 99);
 		abc_add_sync(h, h->tp, h->tracktime);
 		for( t=0; t<numpat; t++ ) {
-			CSoundFile_FreePattern(_this->Patterns[t]);
+			CSoundFile_FreePattern(_this, _this->Patterns[t]);
 			_this->Patterns[t] = NULL;
 		}
-		ABC_ReadPatterns(_this->Patterns, _this->PatternSize, h, numpat, _this->m_nChannels);
+		ABC_ReadPatterns(_this, _this->Patterns, _this->PatternSize, h, numpat, _this->m_nChannels);
 	}
 	// load instruments after building the patterns (chan == 10 track handling)
 	if( !PAT_Load_Instruments(_this) ) {
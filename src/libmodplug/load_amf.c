@@ -206,7 +206,7 @@ BOOL CSoundFile_ReadAMF(CSoundFile *_this, LPCBYTE lpStream, const DWORD dwMemLe
 		}
 		for (UINT iPat=0; iPat<numpats; iPat++)
 		{
-			MODCOMMAND *p = CSoundFile_AllocatePattern(64, _this->m_nChannels);
+			MODCOMMAND *p = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels);
 			if (!p) break;
 			_this->Patterns[iPat] = p;
 			_this->PatternSize[iPat] = 64;
@@ -350,7 +350,7 @@ BOOL CSoundFile_ReadAMF(CSoundFile *_this, LPCBYTE lpStream, const DWORD dwMemLe
 		if (realtrackcnt < pTrackMap[iTrkMap]) realtrackcnt = pTrackMap[iTrkMap];
 	}
 	// Store tracks positions
-	BYTE **pTrackData = (BYTE **) SDL_malloc(sizeof (BYTE *) * realtrackcnt);
+	BYTE **pTrackData = (BYTE **) __Sound_Malloc(sizeof (BYTE *) * realtrackcnt);
     if (!pTrackData) return TRUE;
 	SDL_memset(pTrackData, 0, sizeof(BYTE *) * realtrackcnt);
 	for (UINT iTrack=0; iTrack<realtrackcnt; iTrack++) if (dwMemPos <= dwMemLength - 3)
@@ -366,7 +366,7 @@ BOOL CSoundFile_ReadAMF(CSoundFile *_this, LPCBYTE lpStream, const DWORD dwMemLe
 	// Create the patterns from the list of tracks
 	for (UINT iPat=0; iPat<pfh->numorders; iPat++)
 	{
-		MODCOMMAND *p = CSoundFile_AllocatePattern(_this->PatternSize[iPat], _this->m_nChannels);
+		MODCOMMAND *p = CSoundFile_AllocatePattern(_this, _this->PatternSize[iPat], _this->m_nChannels);
 		if (!p) break;
 		_this->Patterns[iPat] = p;
 		for (UINT iChn=0; iChn<_this->m_nChannels; iChn++)
@@ -386,7 +386,7 @@ BOOL CSoundFile_ReadAMF(CSoundFile *_this, LPCBYTE lpStream, const DWORD dwMemLe
 			}
 		}
 	}
-	SDL_free(pTrackData);
+	__Sound_Free(pTrackData);
 	// Read Sample Data
 	for (UINT iSeek=1; iSeek<=maxsampleseekpos; iSeek++)
 	{
@@ -95,7 +95,7 @@ BOOL CSoundFile_ReadAMS(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		dwMemPos += tmp;
 	}
 	// Read Pattern Names
-	_this->m_lpszPatternNames = (char *) SDL_malloc(pfh->patterns * 32);  // changed from CHAR
+	_this->m_lpszPatternNames = (char *) __Sound_Malloc(pfh->patterns * 32);  // changed from CHAR
 	if (!_this->m_lpszPatternNames) return TRUE;
 	_this->m_nPatternNames = pfh->patterns;
 	SDL_memset(_this->m_lpszPatternNames, 0, _this->m_nPatternNames * 32);
@@ -129,7 +129,7 @@ BOOL CSoundFile_ReadAMS(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		dwMemPos += 4;
 		if ((len >= dwMemLength) || (dwMemPos + len > dwMemLength)) return TRUE;
 		_this->PatternSize[iPat] = 64;
-		MODCOMMAND *m = CSoundFile_AllocatePattern(_this->PatternSize[iPat], _this->m_nChannels);
+		MODCOMMAND *m = CSoundFile_AllocatePattern(_this, _this->PatternSize[iPat], _this->m_nChannels);
 		if (!m) return TRUE;
 		_this->Patterns[iPat] = m;
 		const BYTE *p = lpStream + dwMemPos;
@@ -332,7 +332,7 @@ BOOL CSoundFile_ReadAMS2(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		dwMemPos += 5 + panenv->points*3;
 		pitchenv = (AMS2ENVELOPE *)(lpStream+dwMemPos);
 		dwMemPos += 5 + pitchenv->points*3;
-		INSTRUMENTHEADER *penv = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER));
+		INSTRUMENTHEADER *penv = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER));
 		if (!penv) return TRUE;
 		SDL_memset(smpmap, 0, sizeof(smpmap));
 		SDL_memset(penv, 0, sizeof(INSTRUMENTHEADER));
@@ -446,7 +446,7 @@ BOOL CSoundFile_ReadAMS2(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 				CSoundFile_SetPatternName(_this, ipat, s);
 			}
 			_this->PatternSize[ipat] = numrows;
-			_this->Patterns[ipat] = CSoundFile_AllocatePattern(numrows, _this->m_nChannels);
+			_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this, numrows, _this->m_nChannels);
 			if (!_this->Patterns[ipat]) return TRUE;
 			// Unpack Pattern Data
 			LPCBYTE psrc = lpStream + dwMemPos;
@@ -522,7 +522,7 @@ BOOL CSoundFile_ReadAMS2(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 void AMSUnpack(const char *psrc, UINT inputlen, char *pdest, UINT dmax, char packcharacter)
 {
 	UINT tmplen = dmax;
-	signed char *amstmp = (signed char *) SDL_malloc(tmplen);
+	signed char *amstmp = (signed char *) __Sound_Malloc(tmplen);
 	
 	if (!amstmp) return;
 	// Unpack Loop
@@ -582,6 +582,6 @@ void AMSUnpack(const char *psrc, UINT inputlen, char *pdest, UINT dmax, char pac
 			pdest[i] = old;
 		}
 	}
-	SDL_free(amstmp);
+	__Sound_Free(amstmp);
 }
 
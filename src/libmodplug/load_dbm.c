@@ -140,7 +140,7 @@ BOOL CSoundFile_ReadDBM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 				UINT nsmp;
 
 				if (chunk_pos + sizeof(DBMINSTRUMENT) > dwMemPos) break;
-				if ((penv = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL) break;
+				if ((penv = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL) break;
 				pih = (DBMINSTRUMENT *)(lpStream+chunk_pos);
 				nsmp = bswapBE16(pih->sampleno);
 				psmp = ((nsmp) && (nsmp < MAX_SAMPLES)) ? &_this->Ins[nsmp] : NULL;
@@ -235,7 +235,7 @@ BOOL CSoundFile_ReadDBM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 				nRows = bswapBE16(pph->rows);
 				if ((nRows >= 4) && (nRows <= 256))
 				{
-					MODCOMMAND *m = CSoundFile_AllocatePattern(nRows, _this->m_nChannels);
+					MODCOMMAND *m = CSoundFile_AllocatePattern(_this, nRows, _this->m_nChannels);
 					if (m)
 					{
 						LPBYTE pkdata = (LPBYTE)&pph->patterndata;
@@ -142,7 +142,7 @@ BOOL CSoundFile_ReadDMF(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 					dwPos += 8;
 					if ((pt->jmpsize >= dwMemLength) || (dwPos + pt->jmpsize + 4 >= dwMemLength)) break;
 					_this->PatternSize[npat] = (WORD)ticks;
-					MODCOMMAND *m = CSoundFile_AllocatePattern(_this->PatternSize[npat], _this->m_nChannels);
+					MODCOMMAND *m = CSoundFile_AllocatePattern(_this, _this->PatternSize[npat], _this->m_nChannels);
 					if (!m) goto dmfexit;
 					_this->Patterns[npat] = m;
 					DWORD d = dwPos;
@@ -131,7 +131,7 @@ BOOL CSoundFile_ReadDSM(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 			if (dwMemPos + ppatt->patt_len >= dwMemLength) break;
 			DWORD dwPos = dwMemPos;
 			dwMemPos += ppatt->patt_len;
-			MODCOMMAND *m = CSoundFile_AllocatePattern(64, _this->m_nChannels);
+			MODCOMMAND *m = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels);
 			if (!m) break;
 			_this->PatternSize[nPat] = 64;
 			_this->Patterns[nPat] = m;
@@ -123,7 +123,7 @@ BOOL CSoundFile_ReadFAR(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		if (rows > 256) rows = 256;
 		if (rows < 16) rows = 16;
 		_this->PatternSize[ipat] = rows;
-		if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(rows, _this->m_nChannels)) == NULL) return TRUE;
+		if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this, rows, _this->m_nChannels)) == NULL) return TRUE;
 		MODCOMMAND *m = _this->Patterns[ipat];
 		UINT patbrk = lpStream[dwMemPos];
 		const BYTE *p = lpStream + dwMemPos + 2;
@@ -268,7 +268,7 @@ BOOL CSoundFile_ReadIT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		dwMemPos += 8;
 		if ((dwMemPos + len <= dwMemLength) && (len <= MAX_PATTERNS*MAX_PATTERNNAME) && (len >= MAX_PATTERNNAME))
 		{
-			_this->m_lpszPatternNames = (char *) SDL_malloc(len);
+			_this->m_lpszPatternNames = (char *) __Sound_Malloc(len);
 			if (_this->m_lpszPatternNames)
 			{
 				_this->m_nPatternNames = len / MAX_PATTERNNAME;
@@ -348,7 +348,7 @@ BOOL CSoundFile_ReadIT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 	{
 		if ((inspos[nins] > 0) && (inspos[nins] < dwMemLength - sizeof(ITOLDINSTRUMENT)))
 		{
-			INSTRUMENTHEADER *penv = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER));
+			INSTRUMENTHEADER *penv = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER));
 			if (!penv) continue;
 			_this->Headers[nins+1] = penv;
 			SDL_memset(penv, 0, sizeof(INSTRUMENTHEADER));
@@ -427,7 +427,7 @@ BOOL CSoundFile_ReadIT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		if ((!patpos[npat]) || ((DWORD)patpos[npat] >= dwMemLength - 4))
 		{
 			_this->PatternSize[npat] = 64;
-			_this->Patterns[npat] = CSoundFile_AllocatePattern(64, _this->m_nChannels);
+			_this->Patterns[npat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels);
 			continue;
 		}
 
@@ -436,7 +436,7 @@ BOOL CSoundFile_ReadIT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		if ((rows < 4) || (rows > 256)) continue;
 		if (8+len > dwMemLength || patpos[npat] > dwMemLength - (8+len)) continue;
 		_this->PatternSize[npat] = rows;
-		if ((_this->Patterns[npat] = CSoundFile_AllocatePattern(rows, _this->m_nChannels)) == NULL) continue;
+		if ((_this->Patterns[npat] = CSoundFile_AllocatePattern(_this, rows, _this->m_nChannels)) == NULL) continue;
 		SDL_memset(lastvalue, 0, sizeof(lastvalue));
 		SDL_memset(chnmask, 0, sizeof(chnmask));
 		MODCOMMAND *m = _this->Patterns[npat];
@@ -274,7 +274,7 @@ BOOL CSoundFile_ReadMDL(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 				if (!_this->Headers[nins])
 				{
 					UINT note = 12;
-					if ((_this->Headers[nins] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL) break;
+					if ((_this->Headers[nins] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL) break;
 					INSTRUMENTHEADER *penv = _this->Headers[nins];
 					SDL_memset(penv, 0, sizeof(INSTRUMENTHEADER));
 					penv->nGlobalVol = 64;
@@ -318,7 +318,7 @@ BOOL CSoundFile_ReadMDL(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 			}
 			for (j=1; j<=_this->m_nInstruments; j++) if (!_this->Headers[j])
 			{
-				_this->Headers[j] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER));
+				_this->Headers[j] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER));
 				if (_this->Headers[j]) SDL_memset(_this->Headers[j], 0, sizeof(INSTRUMENTHEADER));
 			}
 			break;
@@ -395,7 +395,7 @@ BOOL CSoundFile_ReadMDL(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	{
 		for (UINT ipat=0; ipat<npatterns; ipat++)
 		{
-			if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this->PatternSize[ipat], _this->m_nChannels)) == NULL) break;
+			if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this, _this->PatternSize[ipat], _this->m_nChannels)) == NULL) break;
 			for (UINT chn=0; chn<_this->m_nChannels; chn++) if ((patterntracks[ipat*32+chn]) && (patterntracks[ipat*32+chn] <= ntracks))
 			{
 				MODCOMMAND *m = _this->Patterns[ipat] + chn;
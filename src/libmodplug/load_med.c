@@ -659,7 +659,7 @@ BOOL CSoundFile_ReadMed(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 			lines = pmb->lines + 1;
 			tracks = pmb->numtracks;
 			if (!tracks) tracks = _this->m_nChannels;
-			if ((_this->Patterns[iBlk] = CSoundFile_AllocatePattern(lines, _this->m_nChannels)) == NULL) continue;
+			if ((_this->Patterns[iBlk] = CSoundFile_AllocatePattern(_this, lines, _this->m_nChannels)) == NULL) continue;
 			_this->PatternSize[iBlk] = lines;
 			MODCOMMAND *p = _this->Patterns[iBlk];
 			LPBYTE s = (LPBYTE)(lpStream + dwPos + 2);
@@ -691,7 +691,7 @@ BOOL CSoundFile_ReadMed(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 			lines = (pmb->lines >> 8) + 1;
 			tracks = pmb->numtracks >> 8;
 			if (!tracks) tracks = _this->m_nChannels;
-			if ((_this->Patterns[iBlk] = CSoundFile_AllocatePattern(lines, _this->m_nChannels)) == NULL) continue;
+			if ((_this->Patterns[iBlk] = CSoundFile_AllocatePattern(_this, lines, _this->m_nChannels)) == NULL) continue;
 			_this->PatternSize[iBlk] = (WORD)lines;
 			DWORD dwBlockInfo = bswapBE32(pmb->info);
 			if ((dwBlockInfo) && (dwBlockInfo < dwMemLength - sizeof(MMD1BLOCKINFO)))
@@ -101,6 +101,7 @@ typedef struct _MIDHANDLE
 	int tempo;
 	int percussion;
 	long deltatime;
+	MODARENA trackhandle;	// tracks and events; only freed by MID_Cleanup
 } MIDHANDLE;
 
 static void mid_message(const char *s1, const char *s2)
@@ -152,7 +153,7 @@ static MIDEVENT *mid_new_event(MIDHANDLE *h)
 {
     MIDEVENT   *retval;
 
-    retval = (MIDEVENT *)_mm_calloc(h->trackhandle, 1,sizeof(MIDEVENT));
+    retval = (MIDEVENT *)ModArena_Alloc(&h->trackhandle, sizeof(MIDEVENT));
 		retval->next      = NULL;
     retval->tracktick = h->tracktime;
 		retval->flg       = 0;
@@ -169,7 +170,7 @@ static MIDTRACK *mid_new_track(MIDHANDLE *h, int mch, int pos)
 // =====================================================================================
 {
     MIDTRACK *retval;
-    retval = (MIDTRACK *)_mm_calloc(h->trackhandle, 1,sizeof(MIDTRACK));
+    retval = (MIDTRACK *)ModArena_Alloc(&h->trackhandle, sizeof(MIDTRACK));
 		retval->next       = NULL;
     retval->vpos       = pos;
 		retval->instr      = 1;
@@ -654,35 +655,19 @@ BOOL CSoundFile_TestMID(const BYTE *lpStream, DWORD dwMemLength)
 static MIDHANDLE *MID_Init(void)
 {
 	MIDHANDLE *retval;
-	retval = (MIDHANDLE *)SDL_calloc(1,sizeof(MIDHANDLE));
+	retval = (MIDHANDLE *)__Sound_Calloc(1,sizeof(MIDHANDLE));
 	if( !retval ) return NULL;
 	retval->track      = NULL;
 	retval->percussion = 0;
 	return retval;
 }
 
-static void MID_CleanupTrack(MIDTRACK *tp)
-{
-	MIDEVENT *ep, *en;
-	if( tp ) {
-		for( ep=tp->head; ep; ep = en ) {
-			en=ep->next;
-			SDL_free(ep);
-		}
-		tp->head = NULL;
-	}
-}
-
 // =====================================================================================
 static void MID_CleanupTracks(MIDHANDLE *handle)
 // =====================================================================================
 {
-	MIDTRACK *tp, *tn;
 	if(handle) {
-		for( tp=handle->track; tp; tp = tn ) {
-			tn=tp->next;
-			MID_CleanupTrack(tp);
-		}
+		ModArena_Free(&handle->trackhandle);
 		handle->track = NULL;
 	}
 }
@@ -693,7 +678,7 @@ static void MID_Cleanup(MIDHANDLE *handle)
 {
 	if(handle) {
 		MID_CleanupTracks(handle);
-		SDL_free(handle);
+		__Sound_Free(handle);
 		handle = 0;
 	}
 }
@@ -732,7 +717,7 @@ static MIDEVENT *mid_next_note(MIDEVENT *e)
 	return e;
 }
 
-static int MID_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], MIDHANDLE *h, int numpat, int channels)
+static int MID_ReadPatterns(CSoundFile *_this, MODCOMMAND *pattern[], WORD psize[], MIDHANDLE *h, int numpat, int channels)
 // =====================================================================================
 {
 	int pat,row,i,ch;
@@ -747,7 +732,7 @@ static int MID_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], MIDHANDLE *h, i
 	// initialize start points of event list in tracks
 	for( t = h->track; t; t = t->next ) t->workevent = t->head;
 	for( pat = 0; pat < numpat; pat++ ) {
-		pattern[pat] = CSoundFile_AllocatePattern(64, channels);
+		pattern[pat] = CSoundFile_AllocatePattern(_this, 64, channels);
 		if( !pattern[pat] ) return 0;
 		psize[pat] = 64;
 		for( row = 0; row < 64; row++ ) {
@@ -906,11 +891,7 @@ static ULONG mid_next_tracktick(MIDEVENT *e)
 // cut off alle events that follow the given event
 static void mid_stripoff(MIDTRACK *tp, MIDEVENT *e)
 {
-	MIDEVENT *ep, *en;
-	for( ep=e->next; ep; ep = en ) {
-		en=ep->next;
-		SDL_free(ep);
-	}
+	// the events cut off stay in h->trackhandle until MID_Cleanup
 	e->next  = NULL;
 	tp->tail = e;
 	tp->workevent = tp->head;
@@ -1377,7 +1358,7 @@ BOOL CSoundFile_ReadMID(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	}
 	// ==============================
 	// Load the pattern info now!
-	if( MID_ReadPatterns(_this->Patterns, _this->PatternSize, h, numpats, _this->m_nChannels) ) {
+	if( MID_ReadPatterns(_this, _this->Patterns, _this->PatternSize, h, numpats, _this->m_nChannels) ) {
 		// :^(  need one more channel to handle the global events ;^b
 		_this->m_nChannels++;
 		h->tp = mid_new_track(h, h->track->chan, 0xff);
@@ -1385,10 +1366,10 @@ BOOL CSoundFile_ReadMID(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		ttp->next = h->tp;
 		mid_add_sync(h, h->tp);
 		for( t=0; t<numpats; t++ ) {
-			CSoundFile_FreePattern(_this->Patterns[t]);
+			CSoundFile_FreePattern(_this, _this->Patterns[t]);
 			_this->Patterns[t] = NULL;
 		}
-		MID_ReadPatterns(_this->Patterns, _this->PatternSize, h, numpats, _this->m_nChannels);
+		MID_ReadPatterns(_this, _this->Patterns, _this->PatternSize, h, numpats, _this->m_nChannels);
 	}
 	// ============================================================
 	// set panning positions
@@ -222,7 +222,7 @@ BOOL CSoundFile_ReadMod(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	{
 		if (ipat < MAX_PATTERNS)
 		{
-			if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(64, _this->m_nChannels)) == NULL) break;
+			if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels)) == NULL) break;
 			_this->PatternSize[ipat] = 64;
 			if (dwMemPos + _this->m_nChannels*256 >= dwMemLength) break;
 			MODCOMMAND *m = _this->Patterns[ipat];
@@ -246,7 +246,7 @@ BOOL CSoundFile_ReadMT2(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		if ((iPat < MAX_PATTERNS) && (nLines > 0) && (nLines <= 256))
 		{
 			_this->PatternSize[iPat] = nLines;
-			_this->Patterns[iPat] = CSoundFile_AllocatePattern(nLines, _this->m_nChannels);
+			_this->Patterns[iPat] = CSoundFile_AllocatePattern(_this, nLines, _this->m_nChannels);
 			if (!_this->Patterns[iPat]) return TRUE;
 			MODCOMMAND *m = _this->Patterns[iPat];
 			UINT len = wDataLen;
@@ -338,7 +338,7 @@ BOOL CSoundFile_ReadMT2(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		INSTRUMENTHEADER *penv = NULL;
 		if (iIns <= _this->m_nInstruments)
 		{
-			penv = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER));
+			penv = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER));
 			_this->Headers[iIns] = penv;
 			if (penv)
 			{
@@ -104,7 +104,7 @@ BOOL CSoundFile_ReadMTM(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 	for (UINT pat=0; pat<=pmh->lastpattern; pat++)
 	{
 		_this->PatternSize[pat] = 64;
-		if ((_this->Patterns[pat] = CSoundFile_AllocatePattern(64, _this->m_nChannels)) == NULL) break;
+		if ((_this->Patterns[pat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels)) == NULL) break;
 		for (UINT n=0; n<32; n++) if ((pSeq[n]) && (pSeq[n] <= pmh->numtracks) && (n < _this->m_nChannels))
 		{
 			LPCBYTE p = pTracks + 192 * (pSeq[n]-1);
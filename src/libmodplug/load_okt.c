@@ -112,7 +112,7 @@ BOOL CSoundFile_ReadOKT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		if (!rows) rows = 64;
 		if (npat < MAX_PATTERNS)
 		{
-			if ((_this->Patterns[npat] = CSoundFile_AllocatePattern(rows, _this->m_nChannels)) == NULL) return TRUE;
+			if ((_this->Patterns[npat] = CSoundFile_AllocatePattern(_this, rows, _this->m_nChannels)) == NULL) return TRUE;
 			MODCOMMAND *m = _this->Patterns[npat];
 			_this->PatternSize[npat] = rows;
 			UINT imax = _this->m_nChannels*rows;
@@ -142,6 +142,55 @@ typedef struct {
 static BYTE pat_gm_used[MAXSMP];
 static BYTE pat_loops[MAXSMP];
 
+// Every patch a song uses is read and decoded once, then shared with the
+// songs after it; timidity.cfg is only parsed once as well. Songs hold a
+// reference to the sample data they share, and ModPlug_FlushPatchCache
+// throws out whatever isn't referenced.
+//
+// Songs load, unload and flush from whatever thread they like, so pat_mutex
+// guards the cache, and everything above it too: the sequencer loaders hold
+// it the whole time they run (see pat_lock), since they fill in the shared
+// midipat, pat_gm_used and pat_loops tables as they go.
+typedef struct _PATCACHE
+{
+	struct _PATCACHE *next;
+	char fname[128];	// pat_build_path
+	char opt[PATH_MAX];	// options after the file name in timidity.cfg
+	int ok;				// pat_readpat_attr found the file
+	WaveHeader hw;
+	MODINSTRUMENT ins;	// as PATsample left it, NULL pSample until then
+	BYTE looped;
+	int refcount;		// songs using ins.pSample
+} PATCACHE;
+
+static PATCACHE *pat_cache = NULL;
+static int pat_patnames_loaded = 0;
+static SDL_mutex *pat_mutex = NULL;
+
+int pat_cache_init(void)
+{
+	if( !pat_mutex ) pat_mutex = SDL_CreateMutex();
+	return pat_mutex != NULL;
+}
+
+void pat_cache_quit(void)
+{
+	pat_flush_cache();
+	if( pat_mutex ) SDL_DestroyMutex(pat_mutex);
+	pat_mutex = NULL;
+}
+
+// SDL mutexes are recursive, so the functions below can take it again
+void pat_lock(void)
+{
+	if( pat_mutex ) SDL_LockMutex(pat_mutex);
+}
+
+void pat_unlock(void)
+{
+	if( pat_mutex ) SDL_UnlockMutex(pat_mutex);
+}
+
 /**************************************************************************
 **************************************************************************/
 
@@ -291,6 +340,8 @@ void pat_init_patnames(void)
 	char line[PATH_MAX];
 	char cfgsources[5][PATH_MAX];
 	MMSTREAM *mmcfg;
+	if( pat_patnames_loaded ) return;
+	pat_patnames_loaded = 1;
     SDL_memset(cfgsources, 0, sizeof (cfgsources));
 	SDL_strlcpy(pathforpat, PATHFORPAT, PATH_MAX);
 	SDL_strlcpy(timiditycfg, TIMIDITYCFG, PATH_MAX);
@@ -544,6 +595,94 @@ static int pat_readpat_attr(int pat, WaveHeader *hw, int layer)
 	return 1;
 }
 
+static PATCACHE *pat_cache_get(int pat)
+{
+	char fname[128];
+	char *opt;
+	PATCACHE *pc;
+	opt = pat_build_path(fname, sizeof (fname), pat);
+	if( !opt ) opt = "";
+	for( pc = pat_cache; pc; pc = pc->next ) {
+		if( !SDL_strcmp(pc->fname, fname) && !SDL_strcmp(pc->opt, opt) ) return pc;
+	}
+	pc = (PATCACHE *)__Sound_Calloc(1, sizeof (PATCACHE));
+	if( !pc ) return NULL;
+	SDL_strlcpy(pc->fname, fname, sizeof (pc->fname));
+	SDL_strlcpy(pc->opt, opt, sizeof (pc->opt));
+	pc->ok = pat_readpat_attr(pat, &pc->hw, 0);
+	pc->next = pat_cache;
+	pat_cache = pc;
+	return pc;
+}
+
+static int pat_readpat_attr_cached(int pat, WaveHeader *hw)
+{
+	PATCACHE *pc = pat_cache_get(pat);
+	if( !pc ) return pat_readpat_attr(pat, hw, 0);
+	if( pc->ok ) SDL_memcpy(hw, &pc->hw, sizeof (WaveHeader));
+	return pc->ok;
+}
+
+// Move a freshly loaded sample out of the song's memory and into the cache
+static void pat_cache_adopt(PATCACHE *pc, CSoundFile *cs, MODINSTRUMENT *q, int smp)
+{
+	// same layout as CSoundFile_AllocateSample gave CSoundFile_ReadSample
+	UINT nbytes = (((q->nLength + 6) * 2) + 39) & ~7;
+	signed char *p;
+	if( !q->pSample || !(q->uFlags & CHN_16BIT) || (q->uFlags & CHN_STEREO) ) return;
+	p = (signed char *)__Sound_Malloc(nbytes);
+	if( !p ) return;
+	SDL_memcpy(p, q->pSample - 16, nbytes);
+	CSoundFile_FreeSample(cs, q->pSample);
+	q->pSample = p + 16;
+	SDL_memcpy(&pc->ins, q, sizeof (MODINSTRUMENT));
+	pc->looped = pat_loops[smp-1];
+	pc->refcount = 1;
+}
+
+// Drop the song's references to cached samples, and free any it loaded itself
+// (pat_cache_adopt couldn't take them). Songs call this when they're deleted,
+// and PAT_Load_Instruments when it fails partway.
+void PAT_ReleaseSamples(void *c)
+{
+	CSoundFile *of = (CSoundFile *)c;
+	PATCACHE *pc;
+	UINT t;
+	pat_lock();
+	for( t = 1; t < of->m_nSamples && t < MAX_SAMPLES; t++ ) {
+		if( !of->Ins[t].pSample ) continue;
+		for( pc = pat_cache; pc; pc = pc->next ) {
+			if( pc->ins.pSample == of->Ins[t].pSample ) {
+				pc->refcount--;
+				break;
+			}
+		}
+		if( !pc ) CSoundFile_FreeSample(of, of->Ins[t].pSample);
+		of->Ins[t].pSample = NULL;
+	}
+	of->Ins[0].pSample = NULL; // a copy of the last one
+	pat_unlock();
+}
+
+void pat_flush_cache(void)
+{
+	PATCACHE **ppc;
+	pat_lock();
+	ppc = &pat_cache;
+	while( *ppc ) {
+		PATCACHE *pc = *ppc;
+		if( pc->refcount ) {
+			ppc = &pc->next;
+			continue;
+		}
+		*ppc = pc->next;
+		if( pc->ins.pSample ) __Sound_Free(pc->ins.pSample - 16);
+		__Sound_Free(pc);
+	}
+	pat_patnames_loaded = 0;
+	pat_unlock();
+}
+
 static void pat_amplify(char *b, int num, int amp, int m)
 {
 	char *pb;
@@ -689,7 +828,7 @@ BOOL CSoundFile_TestPAT(const BYTE *lpStream, DWORD dwMemLength)
 static PATHANDLE *PAT_Init(void)
 {
     PATHANDLE   *retval;
-    retval = (PATHANDLE *)SDL_calloc(1,sizeof(PATHANDLE));
+    retval = (PATHANDLE *)__Sound_Calloc(1,sizeof(PATHANDLE));
 		if( !retval ) return NULL;
     return retval;
 }
@@ -699,7 +838,7 @@ static void PAT_Cleanup(PATHANDLE *handle)
 // =====================================================================================
 {
 	if(handle) {
-		SDL_free(handle);
+		__Sound_Free(handle);
 	}
 }
 
@@ -735,7 +874,7 @@ int pat_modnote(int midinote)
 	return n;
 }
 
-static void PAT_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], PATHANDLE *h, int numpat)
+static void PAT_ReadPatterns(CSoundFile *_this, MODCOMMAND *pattern[], WORD psize[], PATHANDLE *h, int numpat)
 // =====================================================================================
 {
 	int pat,row,i,ch;
@@ -747,7 +886,7 @@ static void PAT_ReadPatterns(MODCOMMAND *pattern[], WORD psize[], PATHANDLE *h,
 
 	tt2 = (h->samples - 1) * 16 + 128;
 	for( pat = 0; pat < numpat; pat++ ) {
-		pattern[pat] = CSoundFile_AllocatePattern(64, h->samples);
+		pattern[pat] = CSoundFile_AllocatePattern(_this, 64, h->samples);
 		if( !pattern[pat] ) return;
 		psize[pat] = 64;
 		for( row = 0; row < 64; row++ ) {
@@ -919,7 +1058,7 @@ static void PATinst(INSTRUMENTHEADER *d, int smp, int gm)
 {
 	WaveHeader hw;
 	char s[32];
-	if( pat_readpat_attr(gm-1, &hw, 0) ) {
+	if( pat_readpat_attr_cached(gm-1, &hw) ) {
 		pat_setpat_inst(&hw, d, smp);
 	}
 	else {
@@ -972,15 +1111,23 @@ static void pat_setpat_attr(WaveHeader *hw, MODINSTRUMENT *q)
 static void PATsample(CSoundFile *cs, MODINSTRUMENT *q, int smp, int gm)
 {
 	WaveHeader hw;
+	PATCACHE *pc = pat_cache_get(gm-1);
+	if( pc && pc->ins.pSample ) { // decoded for an earlier song
+		SDL_memcpy(q, &pc->ins, sizeof (MODINSTRUMENT));
+		pat_loops[smp-1] = pc->looped;
+		pc->refcount++;
+		return;
+	}
 	q->nGlobalVol = 64;
 	q->nPan       = 128;
 	q->uFlags     = CHN_16BIT;
-	if( pat_readpat_attr(gm-1, &hw, 0) ) {
+	if( pc ? pc->ok : pat_readpat_attr(gm-1, &hw, 0) ) {
 		char *p;
+		if( pc ) SDL_memcpy(&hw, &pc->hw, sizeof (WaveHeader));
 		pat_setpat_attr(&hw, q);
 		pat_loops[smp-1] = (q->uFlags & CHN_LOOP)? 1: 0;
-		if( hw.modes & PAT_16BIT ) p = (char *)SDL_malloc(hw.wave_size);
-		else p = (char *)SDL_malloc(hw.wave_size * sizeof(char)*2);
+		if( hw.modes & PAT_16BIT ) p = (char *)__Sound_Malloc(hw.wave_size);
+		else p = (char *)__Sound_Malloc(hw.wave_size * sizeof(char)*2);
 		if( p ) {
 			if( hw.modes & PAT_16BIT ) {
 				dec_pat_Decompress16Bit((short int *)p, hw.wave_size>>1, gm - 1);
@@ -990,7 +1137,8 @@ static void PATsample(CSoundFile *cs, MODINSTRUMENT *q, int smp, int gm)
 				dec_pat_Decompress8Bit((short int *)p, hw.wave_size, gm - 1);
 				CSoundFile_ReadSample(cs, q, (hw.modes&PAT_UNSIGNED)?RS_PCM16U:RS_PCM16S, (LPSTR)p, hw.wave_size * sizeof(short int));
 			}
-			SDL_free(p);
+			__Sound_Free(p);
+			if( pc ) pat_cache_adopt(pc, cs, q, smp);
 		}
 	}
 	else {
@@ -1002,11 +1150,11 @@ static void PATsample(CSoundFile *cs, MODINSTRUMENT *q, int smp, int gm)
 		q->nVolume    = 256;
 		q->uFlags    |= CHN_LOOP;
 		q->uFlags    |= CHN_16BIT;
-		p = (char *)SDL_malloc(q->nLength*sizeof(char)*2);
+		p = (char *)__Sound_Malloc(q->nLength*sizeof(char)*2);
 		if( p ) {
 			dec_pat_Decompress8Bit((short int *)p, q->nLength, smp + MAXSMP - 1);
 			CSoundFile_ReadSample(cs, q, RS_PCM16S, (LPSTR)p, q->nLength*2);
-			SDL_free(p);
+			__Sound_Free(p);
 		}
 	}
 }
@@ -1020,7 +1168,7 @@ BOOL PAT_Load_Instruments(void *c)
 	of->m_nSamples     = pat_numsmp() + 1; // xmms modplug does not use slot zero
 	of->m_nInstruments = pat_numinstr() + 1;
 	for(t=1; t<of->m_nInstruments; t++) { // xmms modplug doesn't use slot zero
-		if( (of->Headers[t] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL ) return FALSE;
+		if( (of->Headers[t] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL ) return FALSE;
 		SDL_memset(of->Headers[t], 0, sizeof(INSTRUMENTHEADER));
 		PATinst(of->Headers[t], t, pat_smptogm(t));
 	}
@@ -1029,7 +1177,11 @@ BOOL PAT_Load_Instruments(void *c)
 	}
 	// copy last of the mohicans to entry 0 for XMMS modinfo to work....
 	t = of->m_nInstruments - 1;
-	if( (of->Headers[0] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL ) return FALSE;
+	if( (of->Headers[0] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL ) {
+		// the song won't get deleted as MID/ABC, so give the patches back now
+		PAT_ReleaseSamples(of);
+		return FALSE;
+	}
 	SDL_memcpy(of->Headers[0], of->Headers[t], sizeof(INSTRUMENTHEADER));
 	t = of->m_nSamples - 1;
 	SDL_memcpy(&of->Ins[0], &of->Ins[t], sizeof(MODINSTRUMENT));
@@ -1083,7 +1235,7 @@ BOOL CSoundFile_ReadPAT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	for(t=1; t<(int)_this->m_nInstruments; t++) { // xmms modplug doesn't use slot zero
 		WaveHeader hw;
 		char s[32];
-		if( (d = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL ) {
+		if( (d = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL ) {
 			avoid_reentry = 0;
 			return FALSE;
 		}
@@ -1104,8 +1256,8 @@ BOOL CSoundFile_ReadPAT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		pat_get_waveheader(mmfile, &hw, t);
 		pat_setpat_attr(&hw, q);
 		if ( hw.wave_size == 0 ) p = NULL;
-		else if( hw.modes & PAT_16BIT ) p = (char *)SDL_malloc(hw.wave_size);
-		else p = (char *)SDL_malloc(hw.wave_size * sizeof(char) * 2);
+		else if( hw.modes & PAT_16BIT ) p = (char *)__Sound_Malloc(hw.wave_size);
+		else p = (char *)__Sound_Malloc(hw.wave_size * sizeof(char) * 2);
 		if( p ) {
 			mmreadSBYTES(p, hw.wave_size, mmfile);
 			if( hw.modes & PAT_16BIT ) {
@@ -1115,12 +1267,12 @@ BOOL CSoundFile_ReadPAT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 				pat_blowup_to16bit((short int *)p, hw.wave_size);
 				CSoundFile_ReadSample(_this, q, (hw.modes&PAT_UNSIGNED)?RS_PCM16U:RS_PCM16S, (LPSTR)p, hw.wave_size * sizeof(short int));
 			}
-			SDL_free(p);
+			__Sound_Free(p);
 		}
 	}
 	// copy last of the mohicans to entry 0 for XMMS modinfo to work....
 	t = _this->m_nInstruments - 1;
-	if( (_this->Headers[0] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL ) {
+	if( (_this->Headers[0] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL ) {
 		avoid_reentry = 0;
 		return FALSE;
 	}
@@ -1129,7 +1281,7 @@ BOOL CSoundFile_ReadPAT(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	SDL_memcpy(&_this->Ins[0], &_this->Ins[t], sizeof(MODINSTRUMENT));
 	// ==============================
 	// Load the pattern info now!
-	PAT_ReadPatterns(_this->Patterns, _this->PatternSize, h, numpat);
+	PAT_ReadPatterns(_this, _this->Patterns, _this->PatternSize, h, numpat);
 	// ============================================================
 	// set panning positions
 	for(t=0; t<(int)_this->m_nChannels; t++) {
@@ -17,6 +17,12 @@ const char *pat_gm_name(int gm);
 int pat_modnote(int midinote);
 int pat_smplooped(int smp);
 BOOL PAT_Load_Instruments(void *c);
+void PAT_ReleaseSamples(void *c);
+void pat_flush_cache(void);
+int pat_cache_init(void);
+void pat_cache_quit(void);
+void pat_lock(void);
+void pat_unlock(void);
 
 #ifdef __cplusplus
 }
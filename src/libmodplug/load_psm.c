@@ -258,7 +258,7 @@ BOOL CSoundFile_ReadPSM(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
 		if (len > pPsmPat->size) len = pPsmPat->size;
 		if ((nRows < 64) || (nRows > 256)) nRows = 64;
 		_this->PatternSize[nPat] = nRows;
-		if ((_this->Patterns[nPat] = CSoundFile_AllocatePattern(nRows, _this->m_nChannels)) == NULL) break;
+		if ((_this->Patterns[nPat] = CSoundFile_AllocatePattern(_this, nRows, _this->m_nChannels)) == NULL) break;
 		MODCOMMAND *m = _this->Patterns[nPat];
 		BYTE *p = pPsmPat->data;
 		UINT pos = 0;
@@ -138,7 +138,7 @@ BOOL CSoundFile_ReadPTM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		dwMemPos = ((UINT)pfh.patseg[ipat]) << 4;
 		if ((!dwMemPos) || (dwMemPos >= dwMemLength)) continue;
 		_this->PatternSize[ipat] = 64;
-		if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(64, _this->m_nChannels)) == NULL) break;
+		if ((_this->Patterns[ipat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels)) == NULL) break;
 		//
 		MODCOMMAND *m = _this->Patterns[ipat];
 		for (UINT row=0; ((row < 64) && (dwMemPos < dwMemLength)); )
@@ -251,7 +251,7 @@ BOOL CSoundFile_ReadS3M(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		nInd += 2;
 		_this->PatternSize[iPat] = 64;
 		if ((!len) || (nInd + len > dwMemLength - 6)
-		 || ((_this->Patterns[iPat] = CSoundFile_AllocatePattern(64, _this->m_nChannels)) == NULL)) continue;
+		 || ((_this->Patterns[iPat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels)) == NULL)) continue;
 		LPBYTE src = (LPBYTE)(lpStream+nInd);
 		// Unpacking pattern
 		MODCOMMAND *p = _this->Patterns[iPat];
@@ -105,7 +105,7 @@ BOOL CSoundFile_ReadSTM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 	{
 		if (dwMemPos + 64*4*4 > dwMemLength) return TRUE;
 		_this->PatternSize[nPat] = 64;
-		if ((_this->Patterns[nPat] = CSoundFile_AllocatePattern(64, _this->m_nChannels)) == NULL) return TRUE;
+		if ((_this->Patterns[nPat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels)) == NULL) return TRUE;
 		MODCOMMAND *m = _this->Patterns[nPat];
 		const STMNOTE *p = (const STMNOTE *)(lpStream + dwMemPos);
 		for (UINT n=0; n<64*4; n++, p++, m++)
@@ -119,7 +119,7 @@ BOOL CSoundFile_ReadUlt(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLeng
 		if (nAllocPat < MAX_PATTERNS)
 		{
 			_this->PatternSize[nAllocPat] = 64;
-			_this->Patterns[nAllocPat] = CSoundFile_AllocatePattern(64, _this->m_nChannels);
+			_this->Patterns[nAllocPat] = CSoundFile_AllocatePattern(_this, 64, _this->m_nChannels);
 		}
 	}
 	// Reading Patterns
@@ -172,7 +172,7 @@ BOOL CSoundFile_ReadXM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		if (ipatmap < MAX_PATTERNS)
 		{
 			_this->PatternSize[ipatmap] = rows;
-			if ((_this->Patterns[ipatmap] = CSoundFile_AllocatePattern(rows, _this->m_nChannels)) == NULL) return TRUE;
+			if ((_this->Patterns[ipatmap] = CSoundFile_AllocatePattern(_this, rows, _this->m_nChannels)) == NULL) return TRUE;
 			if (!packsize) continue;
 			p = _this->Patterns[ipatmap];
 		} else p = NULL;
@@ -280,7 +280,7 @@ BOOL CSoundFile_ReadXM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		if (dwMemPos + sizeof(XMINSTRUMENTHEADER) >= dwMemLength) return TRUE;
 		pih = (XMINSTRUMENTHEADER *)(lpStream+dwMemPos);
 		if (dwMemPos + bswapLE32(pih->size) > dwMemLength) return TRUE;
-		if ((_this->Headers[iIns] = (INSTRUMENTHEADER *) SDL_malloc(sizeof (INSTRUMENTHEADER))) == NULL) continue;
+		if ((_this->Headers[iIns] = (INSTRUMENTHEADER *) __Sound_Malloc(sizeof (INSTRUMENTHEADER))) == NULL) continue;
 		SDL_memset(_this->Headers[iIns], 0, sizeof(INSTRUMENTHEADER));
 		if ((nsamples = pih->samples) > 0)
 		{
@@ -525,7 +525,7 @@ BOOL CSoundFile_ReadXM(CSoundFile *_this, const BYTE *lpStream, DWORD dwMemLengt
 		dwMemPos += 8;
 		if ((dwMemPos + len <= dwMemLength) && (len <= MAX_PATTERNS*MAX_PATTERNNAME) && (len >= MAX_PATTERNNAME))
 		{
-			_this->m_lpszPatternNames = (char *) SDL_malloc(len);
+			_this->m_lpszPatternNames = (char *) __Sound_Malloc(len);
 			if (_this->m_lpszPatternNames)
 			{
 				_this->m_nPatternNames = len / MAX_PATTERNNAME;
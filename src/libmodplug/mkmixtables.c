@@ -0,0 +1,263 @@
+/*
+ * This source code is public domain.
+ *
+ * Authors: Olivier Lapicque <olivierl@jps.net>
+ *          Markus Fick <webmaster@mark-f.de> spline + fir-resampler
+*/
+
+// Writes mixtables.h, the spline and windowed-fir lookup tables the
+// interpolating mixers in fastmix.c use. They used to be computed by
+// init_modplug_filters() every time the library started up; now they're
+// const data. This isn't part of the build; if you change anything here,
+// regenerate the header with
+//
+//     cc -o mkmixtables mkmixtables.c -lm && ./mkmixtables > mixtables.h
+//
+// and keep the SPLINE_ and WFIR_ defines in fastmix.c in sync.
+
+#include <stdio.h>
+#include <math.h>
+
+/*
+ *-----------------------------------------------------------------------------
+ cubic spline interpolation doc,
+   (derived from "digital image warping", g. wolberg)
+
+   interpolation polynomial: f(x) = A3*(x-floor(x))**3 + A2*(x-floor(x))**2 +
+     A1*(x-floor(x)) + A0
+
+   with Y = equispaced data points (dist=1), YD = first derivates of data points and IP = floor(x)
+   the A[0..3] can be found by solving
+     A0  = Y[IP]
+     A1  = YD[IP]
+     A2  = 3*(Y[IP+1]-Y[IP])-2.0*YD[IP]-YD[IP+1]
+     A3  = -2.0 * (Y[IP+1]-Y[IP]) + YD[IP] - YD[IP+1]
+
+   with the first derivates as
+     YD[IP]    = 0.5 * (Y[IP+1] - Y[IP-1]);
+     YD[IP+1]  = 0.5 * (Y[IP+2] - Y[IP])
+
+   the coefs becomes
+     A0 = Y[IP]
+     A1 = YD[IP]
+        =  0.5*(Y[IP+1] - Y[IP-1]);
+     A2 =  3.0*(Y[IP+1]-Y[IP])-2.0*YD[IP]-YD[IP+1]
+        =  3.0*(Y[IP+1]-Y[IP]) - 0.5*2.0*(Y[IP+1]-Y[IP-1]) - 0.5*(Y[IP+2]-Y[IP])
+        =  3.0*Y[IP+1] - 3.0*Y[IP] - Y[IP+1] + Y[IP-1] - 0.5*Y[IP+2] + 0.5*Y[IP]
+        = -0.5*Y[IP+2] + 2.0 * Y[IP+1] - 2.5*Y[IP] + Y[IP-1]
+        = Y[IP-1] + 2 * Y[IP+1] - 0.5 * (5.0 * Y[IP] + Y[IP+2])
+     A3 = -2.0*(Y[IP+1]-Y[IP]) + YD[IP] + YD[IP+1]
+        = -2.0*Y[IP+1] + 2.0*Y[IP] + 0.5*(Y[IP+1]-Y[IP-1]) + 0.5*(Y[IP+2]-Y[IP])
+        = -2.0*Y[IP+1] + 2.0*Y[IP] + 0.5*Y[IP+1] - 0.5*Y[IP-1] + 0.5*Y[IP+2] - 0.5*Y[IP]
+        =  0.5 * Y[IP+2] - 1.5 * Y[IP+1] + 1.5 * Y[IP] - 0.5 * Y[IP-1]
+	=  0.5 * (3.0 * (Y[IP] - Y[IP+1]) - Y[IP-1] + YP[IP+2])
+
+   then interpolated data value is (horner rule)
+     out = (((A3*x)+A2)*x+A1)*x+A0
+
+   this gives parts of data points Y[IP-1] to Y[IP+2] of
+     part       x**3    x**2    x**1    x**0
+      Y[IP-1]    -0.5     1      -0.5    0
+      Y[IP]       1.5    -2.5     0      1
+      Y[IP+1]    -1.5     2       0.5    0
+      Y[IP+2]     0.5    -0.5     0      0
+ *---------------------------------------------------------------------------
+ */
+// number of bits used to scale spline coefs
+#define SPLINE_QUANTBITS	14
+#define SPLINE_QUANTSCALE	(1L<<SPLINE_QUANTBITS)
+#define SPLINE_8SHIFT		(SPLINE_QUANTBITS-8)
+#define SPLINE_16SHIFT		(SPLINE_QUANTBITS)
+// forces coefsset to unity gain
+#define SPLINE_CLAMPFORUNITY
+// log2(number) of precalculated splines (range is [4..14])
+#define SPLINE_FRACBITS 10
+#define SPLINE_LUTLEN (1L<<SPLINE_FRACBITS)
+
+static signed short CzCUBICSPLINE_lut[4*(1L<<SPLINE_FRACBITS)];
+
+static void initCzCUBICSPLINE()
+{
+	int _LIi;
+	int _LLen		= (1L<<SPLINE_FRACBITS);
+	float _LFlen	= 1.0f / (float)_LLen;
+	float _LScale	= (float)SPLINE_QUANTSCALE;
+	for(_LIi=0;_LIi<_LLen;_LIi++)
+	{	float _LCm1, _LC0, _LC1, _LC2;
+		float _LX = ((float)_LIi)*_LFlen;
+		int _LSum,_LIdx	= _LIi<<2;
+		_LCm1 = (float)floor( 0.5 + _LScale*(-0.5*_LX*_LX*_LX + 1.0*_LX*_LX - 0.5*_LX ) );
+		_LC0 = (float)floor( 0.5 + _LScale*( 1.5*_LX*_LX*_LX - 2.5*_LX*_LX + 1.0 ) );
+		_LC1 = (float)floor( 0.5 + _LScale*(-1.5*_LX*_LX*_LX + 2.0*_LX*_LX + 0.5*_LX ) );
+		_LC2 = (float)floor( 0.5 + _LScale*( 0.5*_LX*_LX*_LX - 0.5*_LX*_LX) );
+		CzCUBICSPLINE_lut[_LIdx+0] = (signed short)( (_LCm1 < -_LScale) ? -_LScale : ((_LCm1 > _LScale) ? _LScale : _LCm1) );
+		CzCUBICSPLINE_lut[_LIdx+1] = (signed short)( (_LC0  < -_LScale) ? -_LScale : ((_LC0  > _LScale) ? _LScale : _LC0 ) );
+		CzCUBICSPLINE_lut[_LIdx+2] = (signed short)( (_LC1  < -_LScale) ? -_LScale : ((_LC1  > _LScale) ? _LScale : _LC1 ) );
+		CzCUBICSPLINE_lut[_LIdx+3] = (signed short)( (_LC2  < -_LScale) ? -_LScale : ((_LC2  > _LScale) ? _LScale : _LC2 ) );
+#ifdef SPLINE_CLAMPFORUNITY
+		_LSum = CzCUBICSPLINE_lut[_LIdx+0]+CzCUBICSPLINE_lut[_LIdx+1]+CzCUBICSPLINE_lut[_LIdx+2]+CzCUBICSPLINE_lut[_LIdx+3];
+		if( _LSum != SPLINE_QUANTSCALE )
+		{	int _LMax = _LIdx;
+			if( CzCUBICSPLINE_lut[_LIdx+1]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+1;
+			if( CzCUBICSPLINE_lut[_LIdx+2]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+2;
+			if( CzCUBICSPLINE_lut[_LIdx+3]>CzCUBICSPLINE_lut[_LMax] ) _LMax = _LIdx+3;
+			CzCUBICSPLINE_lut[_LMax] += ((signed short)SPLINE_QUANTSCALE-_LSum);
+		}
+#endif
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+   fir interpolation doc,
+     (derived from "an engineer's guide to fir digital filters", n.j. loy)
+
+     calculate coefficients for ideal lowpass filter (with cutoff = fc in 
+	0..1 (mapped to 0..nyquist))
+     c[-N..N] = (i==0) ? fc : sin(fc*pi*i)/(pi*i)
+
+     then apply selected window to coefficients
+      c[-N..N] *= w(0..N)
+     with n in 2*N and w(n) being a window function (see loy)
+
+     then calculate gain and scale filter coefs to have unity gain.
+  ------------------------------------------------------------------------------
+*/
+// quantizer scale of window coefs
+#define WFIR_QUANTBITS		15
+#define WFIR_QUANTSCALE		(1L<<WFIR_QUANTBITS)
+#define WFIR_8SHIFT			(WFIR_QUANTBITS-8)
+#define WFIR_16BITSHIFT		(WFIR_QUANTBITS)
+// log2(number)-1 of precalculated taps range is [4..12]
+#define WFIR_FRACBITS		10
+#define WFIR_LUTLEN			((1L<<(WFIR_FRACBITS+1))+1)
+// number of samples in window
+#define WFIR_LOG2WIDTH		3
+#define WFIR_WIDTH			(1L<<WFIR_LOG2WIDTH)
+#define WFIR_SMPSPERWING	((WFIR_WIDTH-1)>>1)
+// cutoff (1.0 == pi/2)
+#define WFIR_CUTOFF		0.90f
+// wfir type
+#define WFIR_HANN		0
+#define WFIR_HAMMING		1
+#define WFIR_BLACKMANEXACT	2
+#define WFIR_BLACKMAN3T61	3
+#define WFIR_BLACKMAN3T67	4
+#define WFIR_BLACKMAN4T92	5
+#define WFIR_BLACKMAN4T74	6
+#define WFIR_KAISER4T		7
+#define WFIR_TYPE		WFIR_BLACKMANEXACT
+// wfir help
+#ifndef M_zPI
+#define M_zPI		3.1415926535897932384626433832795
+#endif
+#define M_zEPS		1e-8
+#define M_zBESSELEPS	1e-21
+
+    static float CzWINDOWEDFIR_coef( int _PCnr, float _POfs, float _PCut, int _PWidth, int _PType )
+//OLD args to coef: float _PPos, float _PFc, int _PLen )
+	{	
+		double	_LWidthM1       = _PWidth-1;
+		double	_LWidthM1Half   = 0.5*_LWidthM1;
+		double	_LPosU          = ((double)_PCnr - _POfs);
+		double	_LPos           = _LPosU-_LWidthM1Half;
+		double	_LPIdl          = 2.0*M_zPI/_LWidthM1;
+		double	_LWc,_LSi;
+		if( fabs(_LPos)<M_zEPS ) {
+			_LWc	= 1.0;
+			_LSi	= _PCut;
+		} else {	
+			switch( _PType )
+			{	
+			case WFIR_HANN:
+				_LWc = 0.50 - 0.50 * cos(_LPIdl*_LPosU);
+				break;
+			case WFIR_HAMMING:
+				_LWc = 0.54 - 0.46 * cos(_LPIdl*_LPosU);
+				break;
+			case WFIR_BLACKMANEXACT:
+				_LWc = 0.42 - 0.50 * cos(_LPIdl*_LPosU) + 
+					0.08 * cos(2.0*_LPIdl*_LPosU);
+				break;
+			case WFIR_BLACKMAN3T61:
+				_LWc = 0.44959 - 0.49364 * cos(_LPIdl*_LPosU) + 
+					0.05677 * cos(2.0*_LPIdl*_LPosU);
+				break;
+			case WFIR_BLACKMAN3T67:
+				_LWc = 0.42323 - 0.49755 * cos(_LPIdl*_LPosU) + 
+					0.07922 * cos(2.0*_LPIdl*_LPosU);
+				break;
+			case WFIR_BLACKMAN4T92:
+				_LWc = 0.35875 - 0.48829 * cos(_LPIdl*_LPosU) + 
+					0.14128 * cos(2.0*_LPIdl*_LPosU) - 
+					0.01168 * cos(3.0*_LPIdl*_LPosU);
+				break;
+			case WFIR_BLACKMAN4T74:
+				_LWc = 0.40217 - 0.49703 * cos(_LPIdl*_LPosU) + 
+					0.09392 * cos(2.0*_LPIdl*_LPosU) - 
+					0.00183 * cos(3.0*_LPIdl*_LPosU);
+				break;
+			case WFIR_KAISER4T:
+				_LWc = 0.40243 - 0.49804 * cos(_LPIdl*_LPosU) + 
+					0.09831 * cos(2.0*_LPIdl*_LPosU) - 
+					0.00122 * cos(3.0*_LPIdl*_LPosU);
+				break;
+			default:
+				_LWc = 1.0;
+				break;
+			}
+			_LPos	 *= M_zPI;
+			_LSi	 = sin(_PCut*_LPos)/_LPos;
+		}
+		return (float)(_LWc*_LSi);
+	}
+
+static signed short CzWINDOWEDFIR_lut[WFIR_LUTLEN*WFIR_WIDTH];
+
+static void initCzWINDOWEDFIR()
+{	
+	int _LPcl;
+	float _LPcllen	= (float)(1L<<WFIR_FRACBITS);	// number of precalculated lines for 0..1 (-1..0)
+	float _LNorm	= 1.0f / (float)(2.0f * _LPcllen);
+	float _LCut		= WFIR_CUTOFF;
+	float _LScale	= (float)WFIR_QUANTSCALE;
+	for( _LPcl=0;_LPcl<WFIR_LUTLEN;_LPcl++ )
+	{	
+		float _LGain,_LCoefs[WFIR_WIDTH];
+		float _LOfs		= ((float)_LPcl-_LPcllen)*_LNorm;
+		int _LCc,_LIdx	= _LPcl<<WFIR_LOG2WIDTH;
+		for( _LCc=0,_LGain=0.0f;_LCc<WFIR_WIDTH;_LCc++ )
+		{	_LGain	+= (_LCoefs[_LCc] = CzWINDOWEDFIR_coef( _LCc, _LOfs, _LCut, WFIR_WIDTH, WFIR_TYPE ));
+		}
+		_LGain = 1.0f/_LGain;
+		for( _LCc=0;_LCc<WFIR_WIDTH;_LCc++ )
+		{	float _LCoef = (float)floor( 0.5 + _LScale*_LCoefs[_LCc]*_LGain );
+		CzWINDOWEDFIR_lut[_LIdx+_LCc] = (signed short)( (_LCoef<-_LScale)?-_LScale:((_LCoef>_LScale)?_LScale:_LCoef) );
+		}
+	}
+}
+
+static void writetable(const char *name, const signed short *lut, int len)
+{
+	int i;
+	printf("static const signed short %s[%d] =\n{", name, len);
+	for (i=0; i<len; i++)
+	{
+		if (!(i & 7)) printf("\n\t");
+		printf("%d,", lut[i]);
+		if ((i & 7) != 7) printf(" ");
+	}
+	printf("\n};\n");
+}
+
+int main(void)
+{
+	initCzCUBICSPLINE();
+	initCzWINDOWEDFIR();
+	printf("/*\n * This source code is public domain.\n *\n");
+	printf(" * Generated by mkmixtables.c; don't edit.\n */\n\n");
+	writetable("CzCUBICSPLINE_lut", CzCUBICSPLINE_lut, 4*SPLINE_LUTLEN);
+	printf("\n");
+	writetable("CzWINDOWEDFIR_lut", CzWINDOWEDFIR_lut, WFIR_LUTLEN*WFIR_WIDTH);
+	return 0;
+}
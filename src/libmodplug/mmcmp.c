@@ -7,8 +7,6 @@
 
 #include "libmodplug.h"
 
-BOOL PP20_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength);
-
 typedef struct MMCMPFILEHEADER
 {
 	DWORD id_ziRC;	// "ziRC"
@@ -53,23 +51,39 @@ typedef struct MMCMPSUBBLOCK
 typedef struct MMCMPBITBUFFER
 {
 	UINT bitcount;
-	DWORD bitbuffer;
+	Uint64 bitbuffer;
 	LPCBYTE pSrc;
 	LPCBYTE pEnd;
 } MMCMPBITBUFFER;
 
 
-static DWORD MMCMPBITBUFFER_GetBits(MMCMPBITBUFFER *_this, UINT nBits)
-//---------------------------------------
+// Bits are read LSB first. The buffer is refilled a whole little-endian
+// word at a time while at least 4 bytes are left, so most calls are a
+// shift and a mask; past the end of the input it reads zeroes.
+static SDL_INLINE DWORD MMCMPBITBUFFER_GetBits(MMCMPBITBUFFER *_this, UINT nBits)
+//-----------------------------------------------------------------------------
 {
 	DWORD d;
 	if (!nBits) return 0;
-	while (_this->bitcount < 24)
+	if (_this->bitcount < 24)
 	{
-		_this->bitbuffer |= ((_this->pSrc < _this->pEnd) ? *_this->pSrc++ : 0) << _this->bitcount;
-		_this->bitcount += 8;
+		if (_this->pEnd - _this->pSrc >= 4)
+		{
+			Uint32 w;
+			SDL_memcpy(&w, _this->pSrc, 4);
+			_this->bitbuffer |= (Uint64)SDL_SwapLE32(w) << _this->bitcount;
+			_this->pSrc += 4;
+			_this->bitcount += 32;
+		} else
+		{
+			while (_this->bitcount < 24)
+			{
+				_this->bitbuffer |= (Uint64)((_this->pSrc < _this->pEnd) ? *_this->pSrc++ : 0) << _this->bitcount;
+				_this->bitcount += 8;
+			}
+		}
 	}
-	d = _this->bitbuffer & ((1 << nBits) - 1);
+	d = (DWORD)_this->bitbuffer & ((1 << nBits) - 1);
 	_this->bitbuffer >>= nBits;
 	_this->bitcount -= nBits;
 	return d;
@@ -98,26 +112,33 @@ const UINT MMCMP16BitFetch[16] =
 };
 
 
-BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
-//---------------------------------------------------------
+static DWORD MMCMP_GetUnpackedSize(LPCBYTE lpMemFile, DWORD dwMemLength)
+//----------------------------------------------------------------------
 {
-	DWORD dwMemLength = *pdwMemLength;
-	LPCBYTE lpMemFile = *ppMemFile;
-	LPBYTE pBuffer;
 	LPMMCMPFILEHEADER pmfh = (LPMMCMPFILEHEADER)(lpMemFile);
 	LPMMCMPHEADER pmmh = (LPMMCMPHEADER)(lpMemFile+10);
-	LPDWORD pblk_table;
-	DWORD dwFileSize;
 
-	if (PP20_Unpack(ppMemFile, pdwMemLength))
-	{
-		return TRUE;
-	}
 	if ((dwMemLength < 256) || (!pmfh) || (pmfh->id_ziRC != 0x4352697A) || (pmfh->id_ONia != 0x61694e4f) || (pmfh->hdrsize < 14)
 	 || (!pmmh->nblocks) || (pmmh->filesize < 16) || (pmmh->filesize > 0x8000000)
-	 || (pmmh->blktable >= dwMemLength) || (pmmh->blktable + 4*pmmh->nblocks > dwMemLength)) return FALSE;
-	dwFileSize = pmmh->filesize;
-	if ((pBuffer = (LPBYTE)GlobalAllocPtr(GHND, (dwFileSize + 31) & ~15)) == NULL) return FALSE;
+	 || (pmmh->blktable >= dwMemLength) || (pmmh->blktable + 4*pmmh->nblocks > dwMemLength)) return 0;
+	return pmmh->filesize;
+}
+
+
+// Returns FALSE if a subblock doesn't fit in the output buffer
+static SDL_INLINE BOOL MMCMP_CheckSubBlock(LPMMCMPSUBBLOCK psubblk, DWORD dwFileSize)
+{
+	return (psubblk->unpk_pos < dwFileSize) && (psubblk->unpk_size <= dwFileSize - psubblk->unpk_pos);
+}
+
+
+static BOOL MMCMP_DoUnpack(LPCBYTE lpMemFile, DWORD dwMemLength, LPBYTE pBuffer, DWORD dwFileSize)
+//-----------------------------------------------------------------------------------------------
+{
+	LPMMCMPHEADER pmmh = (LPMMCMPHEADER)(lpMemFile+10);
+	LPDWORD pblk_table;
+
+	SDL_memset(pBuffer, 0, dwFileSize);
 	pblk_table = (LPDWORD)(lpMemFile+pmmh->blktable);
 	for (UINT nBlock=0; nBlock<pmmh->nblocks; nBlock++)
 	{
@@ -127,14 +148,14 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 
 		if ((dwMemPos + 20 >= dwMemLength) || (dwMemPos + 20 + pblk->sub_blk*8 >= dwMemLength)) break;
 		dwMemPos += 20 + pblk->sub_blk*8;
+		if ((pblk->flags & MMCMP_COMP) && (!MMCMP_CheckSubBlock(psubblk, dwFileSize))) break;
 		// Data is not packed
 		if (!(pblk->flags & MMCMP_COMP))
 		{
 			for (UINT i=0; i<pblk->sub_blk; i++)
 			{
-				if ((psubblk->unpk_pos >= dwFileSize) ||
-					(psubblk->unpk_size >= dwFileSize) ||
-					(psubblk->unpk_size > dwFileSize - psubblk->unpk_pos)) break;
+				if ((!MMCMP_CheckSubBlock(psubblk, dwFileSize)) ||
+					(psubblk->unpk_size > dwMemLength - dwMemPos)) break;
 				SDL_memcpy(pBuffer+psubblk->unpk_pos, lpMemFile+dwMemPos, psubblk->unpk_size);
 				dwMemPos += psubblk->unpk_size;
 				psubblk++;
@@ -152,7 +173,7 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 			bb.bitcount = 0;
 			bb.bitbuffer = 0;
 			bb.pSrc = lpMemFile+dwMemPos+pblk->tt_entries;
-			bb.pEnd = lpMemFile+dwMemPos+pblk->pk_size;
+			bb.pEnd = lpMemFile+dwMemPos+((pblk->pk_size < dwMemLength - dwMemPos) ? pblk->pk_size : dwMemLength - dwMemPos);
 			while (subblk < pblk->sub_blk)
 			{
 				UINT newval = 0x10000;
@@ -192,11 +213,13 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 					{
 						newval ^= 0x8000;
 					}
-					pDest[dwPos++] = (WORD)newval;
+					if (dwPos < dwSize) pDest[dwPos] = (WORD)newval;
+					dwPos++;
 				}
 				if (dwPos >= dwSize)
 				{
-					subblk++;
+					if (++subblk >= pblk->sub_blk) break;
+					if (!MMCMP_CheckSubBlock(&psubblk[subblk], dwFileSize)) break;
 					dwPos = 0;
 					dwSize = psubblk[subblk].unpk_size >> 1;
 					pDest = (LPWORD)(pBuffer + psubblk[subblk].unpk_pos);
@@ -216,7 +239,7 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 			bb.bitcount = 0;
 			bb.bitbuffer = 0;
 			bb.pSrc = lpMemFile+dwMemPos+pblk->tt_entries;
-			bb.pEnd = lpMemFile+dwMemPos+pblk->pk_size;
+			bb.pEnd = lpMemFile+dwMemPos+((pblk->pk_size < dwMemLength - dwMemPos) ? pblk->pk_size : dwMemLength - dwMemPos);
 			while (subblk < pblk->sub_blk)
 			{
 				UINT newval = 0x100;
@@ -252,11 +275,13 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 						n += oldval;
 						oldval = n;
 					}
-					pDest[dwPos++] = (BYTE)n;
+					if (dwPos < dwSize) pDest[dwPos] = (BYTE)n;
+					dwPos++;
 				}
 				if (dwPos >= dwSize)
 				{
-					subblk++;
+					if (++subblk >= pblk->sub_blk) break;
+					if (!MMCMP_CheckSubBlock(&psubblk[subblk], dwFileSize)) break;
 					dwPos = 0;
 					dwSize = psubblk[subblk].unpk_size;
 					pDest = pBuffer + psubblk[subblk].unpk_pos;
@@ -267,8 +292,6 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 			return FALSE;
 		}
 	}
-	*ppMemFile = pBuffer;
-	*pdwMemLength = dwFileSize;
 	return TRUE;
 }
 
@@ -281,33 +304,70 @@ BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
 typedef struct _PPBITBUFFER
 {
 	UINT bitcount;
-	ULONG bitbuffer;
+	Uint64 bitbuffer;
 	LPCBYTE pStart;
 	LPCBYTE pSrc;
 } PPBITBUFFER;
 
 
-static ULONG PPBITBUFFER_GetBits(PPBITBUFFER *_this, UINT n)
+// The PP20 stream is read backwards from the end of the file, each byte LSB
+// first. Bits are kept MSB-aligned in a 64-bit buffer with every byte's bit
+// order reversed, so the stream becomes a plain MSB-first one and getting n
+// bits is a single shift. Refills take 4 bytes at a time; once the start of
+// the data is reached the first byte is repeated, like the old reader did.
+static SDL_INLINE Uint32 PPBITBUFFER_ReverseBytes(Uint32 w)
 {
-	ULONG result = 0;
+	w = ((w >> 1) & 0x55555555) | ((w & 0x55555555) << 1);
+	w = ((w >> 2) & 0x33333333) | ((w & 0x33333333) << 2);
+	w = ((w >> 4) & 0x0F0F0F0F) | ((w & 0x0F0F0F0F) << 4);
+	return w;
+}
 
-	for (UINT i=0; i<n; i++)
+
+static void PPBITBUFFER_Fill(PPBITBUFFER *_this)
+//----------------------------------------------
+{
+	while (_this->bitcount <= 56)
 	{
-		if (!_this->bitcount)
+		if ((_this->bitcount <= 32) && (_this->pSrc - _this->pStart >= 4))
+		{
+			Uint32 w;
+			_this->pSrc -= 4;
+			SDL_memcpy(&w, _this->pSrc, 4);
+			w = PPBITBUFFER_ReverseBytes(SDL_SwapLE32(w));
+			_this->bitbuffer |= (Uint64)w << (32 - _this->bitcount);
+			_this->bitcount += 32;
+		} else
 		{
-			_this->bitcount = 8;
 			if (_this->pSrc != _this->pStart) _this->pSrc--;
-			_this->bitbuffer = *_this->pSrc;
+			_this->bitbuffer |= (Uint64)PPBITBUFFER_ReverseBytes(*_this->pSrc) << (56 - _this->bitcount);
+			_this->bitcount += 8;
 		}
-		result = (result<<1) | (_this->bitbuffer&1);
-		_this->bitbuffer >>= 1;
-		_this->bitcount--;
-    }
-    return result;
+	}
+}
+
+
+static SDL_INLINE ULONG PPBITBUFFER_GetBits(PPBITBUFFER *_this, UINT n)
+//----------------------------------------------------------------
+{
+	ULONG result = 0;
+
+	// Only the low 32 bits of an oversized read survive, as before
+	while (n > 24)
+	{
+		result = (result << 24) | PPBITBUFFER_GetBits(_this, 24);
+		n -= 24;
+	}
+	if (!n) return result;
+	if (_this->bitcount < n) PPBITBUFFER_Fill(_this);
+	result = (result << n) | (ULONG)(_this->bitbuffer >> (64 - n));
+	_this->bitbuffer <<= n;
+	_this->bitcount -= n;
+	return result;
 }
 
 
-VOID PP20_DoUnpack(const BYTE *pSrc, UINT nSrcLen, BYTE *pDst, UINT nDstLen)
+static VOID PP20_DoUnpack(const BYTE *pSrc, UINT nSrcLen, BYTE *pDst, UINT nDstLen)
 {
 	PPBITBUFFER BitBuffer;
 	ULONG nBytesLeft;
@@ -329,7 +389,7 @@ VOID PP20_DoUnpack(const BYTE *pSrc, UINT nSrcLen, BYTE *pDst, UINT nDstLen)
 				n += code;
 				if (code != 3) break;
 			}
-			for (UINT i=0; i<n; i++)
+			for (UINT i=0; (i<n) && (nBytesLeft); i++)
 			{
 				pDst[--nBytesLeft] = (BYTE)PPBITBUFFER_GetBits(&BitBuffer, 8);
 			}
@@ -362,21 +422,64 @@ VOID PP20_DoUnpack(const BYTE *pSrc, UINT nSrcLen, BYTE *pDst, UINT nDstLen)
 }
 
 
-BOOL PP20_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
+static DWORD PP20_GetUnpackedSize(LPCBYTE lpMemFile, DWORD dwMemLength)
 {
-	DWORD dwMemLength = *pdwMemLength;
-	LPCBYTE lpMemFile = *ppMemFile;
 	DWORD dwDstLen;
-	LPBYTE pBuffer;
 
-	if ((!lpMemFile) || (dwMemLength < 256) || (*(DWORD *)lpMemFile != 0x30325050)) return FALSE;
+	if ((!lpMemFile) || (dwMemLength < 256) || (*(DWORD *)lpMemFile != 0x30325050)) return 0;
 	dwDstLen = (lpMemFile[dwMemLength-4]<<16) | (lpMemFile[dwMemLength-3]<<8) | (lpMemFile[dwMemLength-2]);
 	//Log("PP20 detected: Packed length=%d, Unpacked length=%d\n", dwMemLength, dwDstLen);
-	if ((dwDstLen < 512) || (dwDstLen > 0x400000) || (dwDstLen > 16*dwMemLength)) return FALSE;
-	if ((pBuffer = (LPBYTE)GlobalAllocPtr(GHND, (dwDstLen + 31) & ~15)) == NULL) return FALSE;
-	PP20_DoUnpack(lpMemFile+4, dwMemLength-4, pBuffer, dwDstLen);
+	if ((dwDstLen < 512) || (dwDstLen > 0x400000) || (dwDstLen > 16*dwMemLength)) return 0;
+	return dwDstLen;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Packed module entry points
+//
+
+// Returns the unpacked size of an MMCMP or PP20 file, 0 if it isn't packed
+DWORD MMCMP_GetSize(LPCBYTE lpMemFile, DWORD dwMemLength)
+//-------------------------------------------------------
+{
+	DWORD dwSize = PP20_GetUnpackedSize(lpMemFile, dwMemLength);
+	if (!dwSize) dwSize = MMCMP_GetUnpackedSize(lpMemFile, dwMemLength);
+	return dwSize;
+}
+
+
+// Unpacks straight into pDst, which must hold at least MMCMP_GetSize() bytes
+BOOL MMCMP_UnpackTo(LPCBYTE lpMemFile, DWORD dwMemLength, LPBYTE pDst, DWORD dwDstLen)
+//------------------------------------------------------------------------------------
+{
+	DWORD dwSize = PP20_GetUnpackedSize(lpMemFile, dwMemLength);
+	if (dwSize)
+	{
+		if (dwDstLen < dwSize) return FALSE;
+		PP20_DoUnpack(lpMemFile+4, dwMemLength-4, pDst, dwSize);
+		return TRUE;
+	}
+	dwSize = MMCMP_GetUnpackedSize(lpMemFile, dwMemLength);
+	if ((!dwSize) || (dwDstLen < dwSize)) return FALSE;
+	return MMCMP_DoUnpack(lpMemFile, dwMemLength, pDst, dwSize);
+}
+
+
+BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength)
+//---------------------------------------------------------
+{
+	DWORD dwSize = MMCMP_GetSize(*ppMemFile, *pdwMemLength);
+	LPBYTE pBuffer;
+
+	if (!dwSize) return FALSE;
+	if ((pBuffer = (LPBYTE)GlobalAllocPtr(GHND, (dwSize + 31) & ~15)) == NULL) return FALSE;
+	if (!MMCMP_UnpackTo(*ppMemFile, *pdwMemLength, pBuffer, dwSize))
+	{
+		GlobalFreePtr(pBuffer);
+		return FALSE;
+	}
 	*ppMemFile = pBuffer;
-	*pdwMemLength = dwDstLen;
+	*pdwMemLength = dwSize;
 	return TRUE;
 }
-
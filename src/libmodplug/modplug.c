@@ -6,14 +6,24 @@
 
 #include "modplug.h"
 #include "libmodplug.h"
-
-void ModPlug_Quit(void) { /* does nothing. */ }
+#include "load_pat.h"
 
 int ModPlug_Init(void)
 {
     extern void init_modplug_filters(void);
     init_modplug_filters();
+#ifndef MODPLUG_BASIC_SUPPORT
+    return pat_cache_init();
+#else
     return 1;
+#endif
+}
+
+void ModPlug_Quit(void)
+{
+#ifndef MODPLUG_BASIC_SUPPORT
+    pat_cache_quit();
+#endif
 }
 
 ModPlugFile* ModPlug_Load(const void* data, int size, const ModPlug_Settings *settings)
@@ -26,13 +36,53 @@ void ModPlug_Unload(ModPlugFile* file)
 	delete_CSoundFile((CSoundFile *) file);
 }
 
+int ModPlug_GetUnpackedSize(const void* data, int size)
+{
+	extern DWORD MMCMP_GetSize(LPCBYTE lpMemFile, DWORD dwMemLength);
+	if ((!data) || (size <= 0)) return 0;
+	return (int) MMCMP_GetSize((LPCBYTE) data, (DWORD) size);
+}
+
+int ModPlug_Unpack(const void* data, int size, void* buffer, int bufsize)
+{
+	extern BOOL MMCMP_UnpackTo(LPCBYTE lpMemFile, DWORD dwMemLength, LPBYTE pDst, DWORD dwDstLen);
+	if ((!data) || (size <= 0) || (!buffer) || (bufsize <= 0)) return 0;
+	return MMCMP_UnpackTo((LPCBYTE) data, (DWORD) size, (LPBYTE) buffer, (DWORD) bufsize);
+}
+
 int ModPlug_Read(ModPlugFile* file, void* buffer, int size)
 {
     CSoundFile *sndfile = (CSoundFile *) file;
 	return CSoundFile_Read(sndfile, buffer, size) * sndfile->gSampleSize;
 }
 
+int ModPlug_GetMemoryUsage(ModPlugFile* file)
+{
+	CSoundFile *sndfile = (CSoundFile *) file;
+	DWORD total = sizeof (CSoundFile) + ModArena_GetSize(&sndfile->m_Arena);
+	UINT i;
+	for (i=0; i<MAX_INSTRUMENTS; i++)
+	{
+		if (sndfile->Headers[i]) total += sizeof (INSTRUMENTHEADER);
+	}
+	if (sndfile->m_lpszPatternNames) total += sndfile->m_nPatternNames * MAX_PATTERNNAME;
+	if (sndfile->pSeekIndex) total += sndfile->nSeekPoints * sizeof (MODSEEKPOINT);
+	return (int) total;
+}
+
+void ModPlug_FlushPatchCache(void)
+{
+#ifndef MODPLUG_BASIC_SUPPORT
+	pat_flush_cache();
+#endif
+}
+
 int ModPlug_GetLength(ModPlugFile* file)
+{
+	return CSoundFile_GetSongTime((CSoundFile *) file);
+}
+
+int ModPlug_GetLengthNoIndex(ModPlugFile* file)
 {
 	return CSoundFile_GetLength((CSoundFile *) file, FALSE, TRUE) * 1000;
 }
@@ -40,9 +90,16 @@ int ModPlug_GetLength(ModPlugFile* file)
 void ModPlug_Seek(ModPlugFile* file, int millisecond)
 {
 	int maxpos;
-	int maxtime = CSoundFile_GetLength((CSoundFile *) file, FALSE, TRUE) * 1000;
+	int maxtime;
 	float postime;
 
+	if (millisecond < 0)
+		millisecond = 0;
+	if (CSoundFile_SeekTime((CSoundFile *) file, (DWORD) millisecond))
+		return;
+
+	// No memory for the seek index; guess from the average row length.
+	maxtime = CSoundFile_GetLength((CSoundFile *) file, FALSE, TRUE) * 1000;
 	if(millisecond > maxtime)
 		millisecond = maxtime;
 	maxpos = CSoundFile_GetMaxPosition((CSoundFile *) file);
@@ -132,7 +189,7 @@ BYTE mmreadUBYTE(MMFILE *mmfile)
 
 void mmfclose(MMFILE *mmfile)
 {
-	SDL_free(mmfile);
+	__Sound_Free(mmfile);
 }
 
 int mmfeof(MMFILE *mmfile)
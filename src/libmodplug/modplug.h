@@ -22,7 +22,8 @@ enum _ModPlug_Flags
 	MODPLUG_ENABLE_NOISE_REDUCTION  = 1 << 1,  /* Enable noise reduction */
 	MODPLUG_ENABLE_REVERB           = 1 << 2,  /* Enable reverb */
 	MODPLUG_ENABLE_MEGABASS         = 1 << 3,  /* Enable megabass */
-	MODPLUG_ENABLE_SURROUND         = 1 << 4   /* Enable surround sound. */
+	MODPLUG_ENABLE_SURROUND         = 1 << 4,  /* Enable surround sound. */
+	MODPLUG_ENABLE_FLOAT_OUTPUT     = 1 << 5   /* With mBits == 32, output floats, not ints. */
 };
 
 enum _ModPlug_ResamplingMode
@@ -40,7 +41,7 @@ typedef struct _ModPlug_Settings
 	/* Note that ModPlug always decodes sound at 44100kHz, 32 bit, stereo and then
 	 * down-mixes to the settings you choose. */
 	int mChannels;       /* Number of channels - 1 for mono or 2 for stereo */
-	int mBits;           /* Bits per sample - 8, 16, or 32 */
+	int mBits;           /* Bits per sample - 8 (unsigned), 16, or 32 */
 	int mFrequency;      /* Sampling rate - 11025, 22050, or 44100 */
 	int mResamplingMode; /* One of MODPLUG_RESAMPLE_*, above */
 
@@ -55,6 +56,8 @@ typedef struct _ModPlug_Settings
 	int mSurroundDelay;  /* Surround delay in ms, usually 5-40ms */
 	int mLoopCount;      /* Number of times to loop.  Zero prevents looping.
 	                        -1 loops forever. */
+	int mMixThreads;     /* Threads to mix channels with, up to 8. 0 or 1
+	                        mixes everything on the calling thread. */
 } ModPlug_Settings;
 
 int ModPlug_Init(void);
@@ -67,6 +70,14 @@ MODPLUG_EXPORT ModPlugFile* ModPlug_Load(const void* data, int size, const ModPl
 /* Unload a mod file. */
 MODPLUG_EXPORT void ModPlug_Unload(ModPlugFile* file);
 
+/* Packed modules (MMCMP, PowerPacker PP20) are unpacked into a temporary copy by
+ * ModPlug_Load.  ModPlug_GetUnpackedSize returns the unpacked size of [data], or 0
+ * if it isn't packed.  ModPlug_Unpack decompresses it into [buffer], which must be
+ * at least that many bytes; the caller can then free the packed copy and hand
+ * [buffer] to ModPlug_Load instead.  Returns nonzero on success. */
+MODPLUG_EXPORT int ModPlug_GetUnpackedSize(const void* data, int size);
+MODPLUG_EXPORT int ModPlug_Unpack(const void* data, int size, void* buffer, int bufsize);
+
 /* Read sample data into the buffer.  Returns the number of bytes read.  If the end
  * of the mod has been reached, zero is returned. */
 MODPLUG_EXPORT int  ModPlug_Read(ModPlugFile* file, void* buffer, int size);
@@ -75,14 +86,32 @@ MODPLUG_EXPORT int  ModPlug_Read(ModPlugFile* file, void* buffer, int size);
  * accurate, especially in the case of mods with loops. */
 MODPLUG_EXPORT int ModPlug_GetLength(ModPlugFile* file);
 
+/* Like ModPlug_GetLength(), but only walks the song, without keeping the seek
+ * index that builds, so it's cheaper for a file that's only being looked at.
+ * The result is rounded to a whole second. */
+MODPLUG_EXPORT int ModPlug_GetLengthNoIndex(ModPlugFile* file);
+
 /* Seek to a particular position in the song.  Note that seeking and MODs don't mix very
  * well.  Some mods will be missing instruments for a short time after a seek, as ModPlug
  * does not scan the sequence backwards to find out which instruments were supposed to be
- * playing at that time.  (Doing so would be difficult and not very reliable.)  Also,
- * note that seeking is not very exact in some mods -- especially those for which
- * ModPlug_GetLength() does not report the full length. */
+ * playing at that time.  (Doing so would be difficult and not very reliable.)  The
+ * first seek (or ModPlug_GetLength() call) walks the song once to note when every
+ * row starts, following tempo changes and jumps; later seeks just look that up.
+ * Seeking is still not very exact in mods for which ModPlug_GetLength() does not
+ * report the full length. */
 MODPLUG_EXPORT void ModPlug_Seek(ModPlugFile* file, int millisecond);
 
+/* Roughly how much memory the loaded song takes: patterns, samples, instruments
+ * and the seek index. GUS patches shared through the patch cache aren't counted. */
+MODPLUG_EXPORT int ModPlug_GetMemoryUsage(ModPlugFile* file);
+
+/* MIDI and ABC songs are played with GUS patches named in timidity.cfg.
+ * The config is only read once, and every patch is only decoded once, then
+ * shared by all the songs that use it. This throws away the patches no
+ * loaded song is using, and makes the next song read timidity.cfg again.
+ * Songs can be loading and unloading on other threads while this runs. */
+MODPLUG_EXPORT void ModPlug_FlushPatchCache(void);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
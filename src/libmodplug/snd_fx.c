@@ -8,9 +8,14 @@
 #include <stdlib.h>
 #include "tables.h"
 
-DWORD CSoundFile_GetLength(CSoundFile *_this, BOOL bAdjust, BOOL bTotal)
-//----------------------------------------------------
+// Walks the song without mixing it. With bIndex, also records the time,
+// speed and tempo at the start of every row played, so seeks and length
+// queries don't have to walk the song again.
+static DWORD GetLengthAndIndex(CSoundFile *_this, BOOL bAdjust, BOOL bTotal, BOOL bIndex)
+//----------------------------------------------------------------------------------------
 {
+	UINT nOrderPos[MAX_ORDERS];
+	UINT nPoints = 0, nMaxPoints = 0;
 	UINT dwElapsedTime=0, nRow=0, nCurrentPattern=0, nNextPattern=0, nPattern=0;
 	UINT nMusicSpeed=_this->m_nDefaultSpeed, nMusicTempo=_this->m_nDefaultTempo, nNextRow=0;
 	UINT nMaxRow = 0, nMaxPattern = 0;
@@ -34,6 +39,19 @@ DWORD CSoundFile_GetLength(CSoundFile *_this, BOOL bAdjust, BOOL bTotal)
 		chnvols[icv] = _this->ChnSettings[icv].nVolume;
 	nMaxRow = _this->m_nNextRow;
 	nMaxPattern = _this->m_nNextPattern;
+	if (bIndex)
+	{
+		// Same row numbering as CSoundFile_SetCurrentPos
+		UINT nPos = 0;
+		for (UINT iord=0; iord<MAX_ORDERS; iord++)
+		{
+			nOrderPos[iord] = nPos;
+			if (_this->Order[iord] < MAX_PATTERNS) nPos += _this->PatternSize[_this->Order[iord]];
+		}
+		nMaxPoints = CSoundFile_GetMaxPosition(_this) + 1;
+		_this->pSeekIndex = (MODSEEKPOINT *)__Sound_Malloc(nMaxPoints * sizeof(MODSEEKPOINT));
+		if (!_this->pSeekIndex) bIndex = FALSE;
+	}
 	for (;;)
 	{
 		UINT nSpeedCount = 0;
@@ -69,6 +87,31 @@ DWORD CSoundFile_GetLength(CSoundFile *_this, BOOL bAdjust, BOOL bTotal)
 		{
 			for (UINT ipck=0; ipck<_this->m_nChannels; ipck++) patloop[ipck] = dwElapsedTime;
 		}
+		if ((bIndex) && (nCurrentPattern < MAX_ORDERS))
+		{
+			if (nPoints >= nMaxPoints)
+			{
+				MODSEEKPOINT *pNewIndex = (MODSEEKPOINT *)__Sound_Realloc(_this->pSeekIndex, nMaxPoints * 2 * sizeof(MODSEEKPOINT));
+				if (!pNewIndex)
+				{
+					__Sound_Free(_this->pSeekIndex);
+					_this->pSeekIndex = NULL;
+					bIndex = FALSE;
+				} else
+				{
+					_this->pSeekIndex = pNewIndex;
+					nMaxPoints *= 2;
+				}
+			}
+			if (bIndex)
+			{
+				MODSEEKPOINT *pt = &_this->pSeekIndex[nPoints++];
+				pt->dwTime = dwElapsedTime;
+				pt->nPos = nOrderPos[nCurrentPattern] + nRow;
+				pt->nSpeed = (BYTE)nMusicSpeed;
+				pt->nTempo = (BYTE)nMusicTempo;
+			}
+		}
 		if (!bTotal)
 		{
 			if ((nCurrentPattern > nMaxPattern) || ((nCurrentPattern == nMaxPattern) && (nRow >= nMaxRow)))
@@ -260,10 +303,67 @@ EndMod:
 			}
 		}
 	}
+	if (bIndex)
+	{
+		_this->nSeekPoints = nPoints;
+		_this->dwSongLength = dwElapsedTime;
+	}
 	return (dwElapsedTime+500) / 1000;
 }
 
 
+DWORD CSoundFile_GetLength(CSoundFile *_this, BOOL bAdjust, BOOL bTotal)
+//----------------------------------------------------
+{
+	return GetLengthAndIndex(_this, bAdjust, bTotal, FALSE);
+}
+
+
+BOOL CSoundFile_BuildSeekIndex(CSoundFile *_this)
+//-----------------------------------------------
+{
+	if (_this->pSeekIndex) return TRUE;
+	GetLengthAndIndex(_this, FALSE, TRUE, TRUE);
+	if ((_this->pSeekIndex) && (!_this->nSeekPoints))
+	{
+		__Sound_Free(_this->pSeekIndex);
+		_this->pSeekIndex = NULL;
+	}
+	return (_this->pSeekIndex != NULL);
+}
+
+
+DWORD CSoundFile_GetSongTime(CSoundFile *_this)
+//---------------------------------------------
+{
+	if (CSoundFile_BuildSeekIndex(_this)) return _this->dwSongLength;
+	return CSoundFile_GetLength(_this, FALSE, TRUE) * 1000;
+}
+
+
+BOOL CSoundFile_SeekTime(CSoundFile *_this, DWORD dwTime)
+//-------------------------------------------------------
+{
+	const MODSEEKPOINT *pt;
+	UINT lo = 0, hi;
+
+	if (!CSoundFile_BuildSeekIndex(_this)) return FALSE;
+	// Last row starting at or before dwTime
+	hi = _this->nSeekPoints;
+	while (hi - lo > 1)
+	{
+		UINT mid = (lo + hi) / 2;
+		if (_this->pSeekIndex[mid].dwTime <= dwTime) lo = mid; else hi = mid;
+	}
+	pt = &_this->pSeekIndex[lo];
+	CSoundFile_SetCurrentPos(_this, pt->nPos);
+	_this->m_nMusicSpeed = pt->nSpeed;
+	_this->m_nMusicTempo = pt->nTempo;
+	_this->m_nTickCount = _this->m_nMusicSpeed;
+	return TRUE;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // Effects
 
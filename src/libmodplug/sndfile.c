@@ -8,6 +8,7 @@
 #include <math.h> //for GCCFIX
 #include "modplug.h"
 #include "libmodplug.h"
+#include "load_pat.h"
 
 extern BOOL MMCMP_Unpack(LPCBYTE *ppMemFile, LPDWORD pdwMemLength);
 
@@ -51,6 +52,7 @@ static void CSoundFile_UpdateSettings(CSoundFile *_this, const ModPlug_Settings
 		CSoundFile_SetSurroundParameters(_this, settings->mSurroundDepth, settings->mSurroundDelay);
 
 	CSoundFile_SetWaveConfig(_this, settings->mFrequency, settings->mBits, settings->mChannels);
+	_this->gbFloatOutput = (settings->mBits == 32) && (settings->mFlags & MODPLUG_ENABLE_FLOAT_OUTPUT);
 	CSoundFile_SetMixConfig(_this, settings->mStereoSeparation, settings->mMaxMixChannels);
 	_this->gSampleSize = settings->mBits / 8 * settings->mChannels;
 
@@ -62,12 +64,30 @@ static void CSoundFile_UpdateSettings(CSoundFile *_this, const ModPlug_Settings
 	                            settings->mFlags & MODPLUG_ENABLE_NOISE_REDUCTION,
 	                            FALSE);
 	CSoundFile_SetResamplingMode(_this, settings->mResamplingMode);
+	if (settings->mMixThreads > 1)
+		CSoundFile_SetMixThreads(_this, settings->mMixThreads);
 }
 
+#ifndef MODPLUG_BASIC_SUPPORT
+// These all share the patch tables in load_pat.c, and another song might be
+// loading or unloading on another thread.
+static BOOL ReadSequencer(CSoundFile *_this, LPCBYTE lpStream, DWORD dwMemLength)
+//-------------------------------------------------------------------------------
+{
+	BOOL bOk;
+	pat_lock();
+	bOk = CSoundFile_ReadABC(_this, lpStream, dwMemLength)
+	   || CSoundFile_ReadMID(_this, lpStream, dwMemLength)
+	   || CSoundFile_ReadPAT(_this, lpStream, dwMemLength);
+	pat_unlock();
+	return bOk;
+}
+#endif
+
 CSoundFile *new_CSoundFile(LPCBYTE lpStream, DWORD dwMemLength, const ModPlug_Settings *settings)
 //----------------------------------------------------------
 {
-    CSoundFile *_this = (CSoundFile *) SDL_calloc(1, sizeof (CSoundFile));
+    CSoundFile *_this = (CSoundFile *) __Sound_Calloc(1, sizeof (CSoundFile));
     if (!_this) return NULL;
 	int i;
 
@@ -110,9 +130,7 @@ CSoundFile *new_CSoundFile(LPCBYTE lpStream, DWORD dwMemLength, const ModPlug_Se
 		 && (!CSoundFile_ReadIT(_this, lpStream, dwMemLength))
 #ifndef MODPLUG_BASIC_SUPPORT
 /* Sequencer File Format Support */
-		 && (!CSoundFile_ReadABC(_this, lpStream, dwMemLength))
-		 && (!CSoundFile_ReadMID(_this, lpStream, dwMemLength))
-		 && (!CSoundFile_ReadPAT(_this, lpStream, dwMemLength))
+		 && (!ReadSequencer(_this, lpStream, dwMemLength))
 		 && (!CSoundFile_ReadSTM(_this, lpStream, dwMemLength))
 		 && (!CSoundFile_ReadMed(_this, lpStream, dwMemLength))
 		 && (!CSoundFile_ReadMTM(_this, lpStream, dwMemLength))
@@ -206,7 +224,7 @@ CSoundFile *new_CSoundFile(LPCBYTE lpStream, DWORD dwMemLength, const ModPlug_Se
         CSoundFile_UpdateSettings(_this, settings);
 		return _this;
 	}
-    SDL_free(_this);
+    __Sound_Free(_this);
 	return NULL;
 }
 
@@ -214,73 +232,169 @@ CSoundFile *new_CSoundFile(LPCBYTE lpStream, DWORD dwMemLength, const ModPlug_Se
 void delete_CSoundFile(CSoundFile *_this)
 {
 	int i;
-	for (i=0; i<MAX_PATTERNS; i++) if (_this->Patterns[i])
-	{
-		CSoundFile_FreePattern(_this->Patterns[i]);
-		_this->Patterns[i] = NULL;
-	}
+#ifndef MODPLUG_BASIC_SUPPORT
+	// MIDI and ABC songs share their samples with the patch cache
+	if (_this->m_nType & (MOD_TYPE_MID|MOD_TYPE_ABC)) PAT_ReleaseSamples(_this);
+#endif
 	_this->m_nPatternNames = 0;
 	if (_this->m_lpszPatternNames)
 	{
-		SDL_free(_this->m_lpszPatternNames);
+		__Sound_Free(_this->m_lpszPatternNames);
 		_this->m_lpszPatternNames = NULL;
 	}
-	for (i=1; i<MAX_SAMPLES; i++)
-	{
-		MODINSTRUMENT *pins = &_this->Ins[i];
-		if (pins->pSample)
-		{
-			CSoundFile_FreeSample(pins->pSample);
-			pins->pSample = NULL;
-		}
-	}
 	for (i=0; i<MAX_INSTRUMENTS; i++)
 	{
 		if (_this->Headers[i])
 		{
-			SDL_free(_this->Headers[i]);
+			__Sound_Free(_this->Headers[i]);
 			_this->Headers[i] = NULL;
 		}
 	}
 	_this->m_nType = MOD_TYPE_NONE;
 	_this->m_nChannels = _this->m_nSamples = _this->m_nInstruments = 0;
+	CSoundFile_SetMixThreads(_this, 0);
+	if (_this->pSeekIndex)
+	{
+		__Sound_Free(_this->pSeekIndex);
+		_this->pSeekIndex = NULL;
+	}
+	// Patterns and samples
+	ModArena_Free(&_this->m_Arena);
 
-    SDL_free(_this);
+    __Sound_Free(_this);
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 // Memory Allocation
 
-MODCOMMAND *CSoundFile_AllocatePattern(UINT rows, UINT nchns)
-//------------------------------------------------------------
+// The first block is small enough for a little MOD; after that each one
+// is twice the size of the last, so a big module still only takes a
+// handful. Anything bigger than the next block gets a block to itself.
+#define MODARENA_FIRSTBLOCK		(64*1024)
+#define MODARENA_MAXBLOCK		(4*1024*1024)
+
+struct _MODARENABLOCK
 {
-	return (MODCOMMAND *) SDL_calloc(sizeof (MODCOMMAND), rows * nchns);
+	MODARENABLOCK *pNext;
+	DWORD dwSize, dwUsed, dwLast;	// dwLast: offset of the latest allocation
+};
+
+// Keep the data after the header 16-byte aligned
+#define MODARENA_HEADER		((sizeof(MODARENABLOCK)+15) & ~15)
+#define MODARENA_DATA(b)	(((LPBYTE)(b)) + MODARENA_HEADER)
+
+LPVOID ModArena_Alloc(MODARENA *pArena, DWORD nBytes)
+//---------------------------------------------------
+{
+	MODARENABLOCK *pBlock = pArena->pBlocks;
+	nBytes = (nBytes + 15) & ~15;
+	if ((!pBlock) || (pBlock->dwSize - pBlock->dwUsed < nBytes))
+	{
+		DWORD dwSize = (pArena->dwNextSize) ? pArena->dwNextSize : MODARENA_FIRSTBLOCK;
+		BOOL bOwnBlock = (nBytes > dwSize);
+		if (bOwnBlock) dwSize = nBytes;
+		MODARENABLOCK *pNew = (MODARENABLOCK *)__Sound_Calloc(1, MODARENA_HEADER + dwSize);
+		if (!pNew) return NULL;
+		pNew->dwSize = dwSize;
+		if (!bOwnBlock) pArena->dwNextSize = (dwSize < MODARENA_MAXBLOCK) ? dwSize * 2 : dwSize;
+		// Only switch to the new block if it has more room left than the old one
+		if ((pBlock) && (dwSize - nBytes < pBlock->dwSize - pBlock->dwUsed))
+		{
+			pNew->pNext = pBlock->pNext;
+			pBlock->pNext = pNew;
+		} else
+		{
+			pNew->pNext = pBlock;
+			pArena->pBlocks = pNew;
+		}
+		pBlock = pNew;
+	}
+	pBlock->dwLast = pBlock->dwUsed;
+	pBlock->dwUsed += nBytes;
+	return MODARENA_DATA(pBlock) + pBlock->dwLast;
 }
 
 
-void CSoundFile_FreePattern(LPVOID pat)
-//--------------------------------------
+void ModArena_Release(MODARENA *pArena, LPVOID p)
+//-----------------------------------------------
+{
+	MODARENABLOCK **ppBlock;
+	for (ppBlock=&pArena->pBlocks; *ppBlock; ppBlock=&(*ppBlock)->pNext)
+	{
+		MODARENABLOCK *pBlock = *ppBlock;
+		if ((LPBYTE)p != MODARENA_DATA(pBlock) + pBlock->dwLast) continue;
+		if ((pBlock->dwLast == 0) && (pBlock != pArena->pBlocks))
+		{
+			// Nothing else lives in this block
+			*ppBlock = pBlock->pNext;
+			__Sound_Free(pBlock);
+		} else
+		{
+			// Memory from ModArena_Alloc is always zeroed
+			SDL_memset(p, 0, pBlock->dwUsed - pBlock->dwLast);
+			pBlock->dwUsed = pBlock->dwLast;
+		}
+		return;
+	}
+}
+
+
+void ModArena_Free(MODARENA *pArena)
+//----------------------------------
+{
+	MODARENABLOCK *pBlock = pArena->pBlocks;
+	while (pBlock)
+	{
+		MODARENABLOCK *pNext = pBlock->pNext;
+		__Sound_Free(pBlock);
+		pBlock = pNext;
+	}
+	pArena->pBlocks = NULL;
+	pArena->dwNextSize = 0;
+}
+
+
+DWORD ModArena_GetSize(const MODARENA *pArena)
+//--------------------------------------------
+{
+	const MODARENABLOCK *pBlock;
+	DWORD dwTotal = 0;
+	for (pBlock=pArena->pBlocks; pBlock; pBlock=pBlock->pNext)
+		dwTotal += MODARENA_HEADER + pBlock->dwSize;
+	return dwTotal;
+}
+
+
+MODCOMMAND *CSoundFile_AllocatePattern(CSoundFile *_this, UINT rows, UINT nchns)
+//------------------------------------------------------------------------------
+{
+	return (MODCOMMAND *) ModArena_Alloc(&_this->m_Arena, sizeof (MODCOMMAND) * rows * nchns);
+}
+
+
+void CSoundFile_FreePattern(CSoundFile *_this, LPVOID pat)
+//--------------------------------------------------------
 {
-	SDL_free(pat);
+	if (pat) ModArena_Release(&_this->m_Arena, pat);
 }
 
 
-signed char* CSoundFile_AllocateSample(UINT nbytes)
-//-------------------------------------------
+signed char* CSoundFile_AllocateSample(CSoundFile *_this, UINT nbytes)
+//--------------------------------------------------------------------
 {
-	signed char * p = (signed char *)GlobalAllocPtr(GHND, (nbytes+39) & ~7);
+	signed char * p = (signed char *)ModArena_Alloc(&_this->m_Arena, (nbytes+39) & ~7);
 	if (p) p += 16;
 	return p;
 }
 
 
-void CSoundFile_FreeSample(LPVOID p)
-//-----------------------------------
+void CSoundFile_FreeSample(CSoundFile *_this, LPVOID p)
+//-----------------------------------------------------
 {
 	if (p)
 	{
-		GlobalFreePtr(((LPSTR)p)-16);
+		ModArena_Release(&_this->m_Arena, ((LPSTR)p)-16);
 	}
 }
 
@@ -492,7 +606,7 @@ UINT CSoundFile_ReadSample(CSoundFile *_this, MODINSTRUMENT *pIns, UINT nFlags,
 		mem *= 2;
 		pIns->uFlags |= CHN_STEREO;
 	}
-	if ((pIns->pSample = CSoundFile_AllocateSample(mem)) == NULL)
+	if ((pIns->pSample = CSoundFile_AllocateSample(_this, mem)) == NULL)
 	{
 		pIns->nLength = 0;
 		return 0;
@@ -916,7 +1030,7 @@ UINT CSoundFile_ReadSample(CSoundFile *_this, MODINSTRUMENT *pIns, UINT nFlags,
 		if (pIns->pSample)
 		{
 			pIns->nLength = 0;
-			CSoundFile_FreeSample(pIns->pSample);
+			CSoundFile_FreeSample(_this, pIns->pSample);
 			pIns->pSample = NULL;
 		}
 		return 0;
@@ -1076,13 +1190,13 @@ BOOL CSoundFile_SetPatternName(CSoundFile *_this, UINT nPat, LPCSTR lpszName)
 	{
 		if (!lpszName[0]) return TRUE;
 		UINT len = (nPat+1)*MAX_PATTERNNAME;
-		char *p = (char *) SDL_malloc(len);
+		char *p = (char *) __Sound_Malloc(len);
 		if (!p) return FALSE;
 		SDL_memset(p, 0, len);
 		if (_this->m_lpszPatternNames)
 		{
 			SDL_memcpy(p, _this->m_lpszPatternNames, _this->m_nPatternNames * MAX_PATTERNNAME);
-			SDL_free(_this->m_lpszPatternNames);
+			__Sound_Free(_this->m_lpszPatternNames);
 			_this->m_lpszPatternNames = NULL;
 		}
 		_this->m_lpszPatternNames = p;
@@ -1163,7 +1277,7 @@ BOOL CSoundFile_DestroySample(CSoundFile *_this, UINT nSample)
 			_this->Chn[i].pSample = _this->Chn[i].pCurrentSample = NULL;
 		}
 	}
-	CSoundFile_FreeSample(pSample);
+	CSoundFile_FreeSample(_this, pSample);
 	return TRUE;
 }
 
@@ -796,6 +796,11 @@ struct stb_vorbis
 
    ProbedPage p_first, p_last;
 
+   // pages seen by earlier seeks, sorted by page_start, so seeking to the
+   // same places again (loop points, cue markers) mostly skips the search
+   ProbedPage *page_index;
+   int page_index_count, page_index_alloc;
+
   // memory management
    stb_vorbis_alloc alloc;
    int setup_offset;
@@ -4234,6 +4239,7 @@ static void vorbis_deinit(stb_vorbis *p)
       setup_free(p, p->window[i]);
       setup_free(p, p->bit_reverse[i]);
    }
+   free(p->page_index);  // always on the heap, even with alloc_buffer
    #ifdef __SDL_SOUND_INTERNAL__
    if (p->close_on_free) SDL_RWclose(p->rwops);
    #endif
@@ -4641,6 +4647,55 @@ static int get_seek_page_info(stb_vorbis *f, ProbedPage *z)
    return 1;
 }
 
+#define PAGE_INDEX_MAX  4096
+
+// remember a page seen during a seek; pages with no known sample position
+// aren't useful and get skipped
+static void page_index_add(stb_vorbis *f, const ProbedPage *z)
+{
+   int lo = 0, hi = f->page_index_count;
+   if (z->last_decoded_sample == ~0U) return;
+   while (lo < hi) {
+      int m = (lo + hi) >> 1;
+      if (f->page_index[m].page_start < z->page_start) lo = m+1; else hi = m;
+   }
+   if (lo < f->page_index_count && f->page_index[lo].page_start == z->page_start)
+      return; // already known
+   if (f->page_index_count == f->page_index_alloc) {
+      int n = f->page_index_alloc ? f->page_index_alloc * 2 : 64;
+      ProbedPage *p;
+      if (n > PAGE_INDEX_MAX) return;
+      p = (ProbedPage *) realloc(f->page_index, n * sizeof(*p));
+      if (p == NULL) return; // it's just a cache
+      f->page_index = p;
+      f->page_index_alloc = n;
+   }
+   memmove(f->page_index+lo+1, f->page_index+lo, (f->page_index_count-lo) * sizeof(*z));
+   f->page_index[lo] = *z;
+   ++f->page_index_count;
+}
+
+// tighten [left,right] around sample_number with pages we already know about
+static void page_index_bound(stb_vorbis *f, uint32 sample_number, ProbedPage *left, ProbedPage *right)
+{
+   int lo = 0, hi = f->page_index_count;
+   // first known page that ends past sample_number
+   while (lo < hi) {
+      int m = (lo + hi) >> 1;
+      if (f->page_index[m].last_decoded_sample <= sample_number) lo = m+1; else hi = m;
+   }
+   if (lo > 0) {
+      const ProbedPage *l = &f->page_index[lo-1];
+      if (l->page_start > left->page_start && l->page_end <= right->page_start)
+         *left = *l;
+   }
+   if (lo < f->page_index_count) {
+      const ProbedPage *r = &f->page_index[lo];
+      if (r->page_start < right->page_start && r->page_start >= left->page_end)
+         *right = *r;
+   }
+}
+
 // rarely used function to seek back to the preceeding page while finding the
 // start of a packet
 static int go_to_page_before(stb_vorbis *f, unsigned int limit_offset)
@@ -4696,6 +4751,7 @@ static int seek_to_sample_coarse(stb_vorbis *f, uint32 sample_number)
       set_file_offset(f, left.page_end);
       if (!get_seek_page_info(f, &left)) goto error;
    }
+   bytes_per_sample = 0;
 
    right = f->p_last;
    assert(right.last_decoded_sample != ~0U);
@@ -4707,6 +4763,12 @@ static int seek_to_sample_coarse(stb_vorbis *f, uint32 sample_number)
       return 0;
    }
 
+   // estimate the bitrate over the whole stream, then start the search from
+   // the closest pages an earlier seek found; if we've been here before,
+   // they're adjacent and there's nothing left to search
+   bytes_per_sample = (double) (right.page_end - left.page_start) / right.last_decoded_sample;
+   page_index_bound(f, sample_number, &left, &right);
+
    while (left.page_end != right.page_start) {
       assert(left.page_end < right.page_start);
       // search range in bytes
@@ -4718,8 +4780,6 @@ static int seek_to_sample_coarse(stb_vorbis *f, uint32 sample_number)
          if (probe < 2) {
             if (probe == 0) {
                // first probe (interpolate)
-               double data_bytes = right.page_end - left.page_start;
-               bytes_per_sample = data_bytes / right.last_decoded_sample;
                offset = left.page_start + bytes_per_sample * (sample_number - left.last_decoded_sample);
             } else {
                // second probe (try to bound the other side)
@@ -4747,6 +4807,7 @@ static int seek_to_sample_coarse(stb_vorbis *f, uint32 sample_number)
 
       for (;;) {
          if (!get_seek_page_info(f, &mid)) goto error;
+         page_index_add(f, &mid);
          if (mid.last_decoded_sample != ~0U) break;
          // (untested) no frames end on this page
          set_file_offset(f, mid.page_end);
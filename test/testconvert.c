@@ -0,0 +1,206 @@
+/**
+ * SDL_sound; An abstract sound format decoding API.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+/**
+ * Checks the single-pass converters in SDL_sound_convert.c against
+ *  SDL_ConvertAudio(). Every conversion __Sound_ChooseFastConvert() will do
+ *  is run on the same data both ways, at a few lengths so the SIMD loops
+ *  and their scalar tails both get a turn, and the output has to match
+ *  byte for byte. Exits with zero if it all does.
+ *
+ * This builds SDL_sound_convert.c into itself, since the converters aren't
+ *  exported from the library.
+ */
+
+#include <stdio.h>
+
+#define __SDL_SOUND_INTERNAL__
+#include "SDL_sound_internal.h"
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define AUDIO_S16SWAPPED AUDIO_S16MSB
+#else
+#define AUDIO_S16SWAPPED AUDIO_S16LSB
+#endif
+
+#define MAX_POINTS 1031  /* odd, so every tail length comes up. */
+
+typedef struct
+{
+    const char *name;
+    Uint16 format;
+    Uint8 channels;
+    Uint8 dst_channels;
+} ConvertTest;
+
+static const ConvertTest tests[] =
+{
+    { "F32 to S16", AUDIO_F32SYS, 2, 2 },
+    { "F32 mono to S16 stereo", AUDIO_F32SYS, 1, 2 },
+    { "S32 to S16", AUDIO_S32SYS, 2, 2 },
+    { "S32 mono to S16 stereo", AUDIO_S32SYS, 1, 2 },
+    { "swapped S16 to S16", AUDIO_S16SWAPPED, 2, 2 },
+    { "swapped S16 mono to S16 stereo", AUDIO_S16SWAPPED, 1, 2 },
+    { "S16 mono to S16 stereo", AUDIO_S16SYS, 1, 2 }
+};
+
+static Uint32 rng_state = 0x12345678;
+
+static Uint32 rng(void)
+{
+    rng_state = (rng_state * 1103515245) + 12345;
+    return rng_state;
+} /* rng */
+
+
+/*
+ * Fill (buf) with (points) sample points in (format): mostly noise, plus
+ *  the values at and past full scale that the clamping has to get right.
+ *  SDL's own SIMD and scalar converters disagree about -1.0f (and anything
+ *  that turns into it on the way through float), so that is left out.
+ */
+static void fill(Uint8 *buf, Uint16 format, Uint32 points)
+{
+    Uint32 i;
+
+    for (i = 0; i < points; i++)
+    {
+        const Uint32 r = rng();
+        if (format == AUDIO_F32SYS)
+        {
+            float val = (((float) (r >> 8)) / 16777216.0f) * 2.5f - 1.25f;
+            if (val <= -1.0f)
+                val = -0.999f;
+            else if ((i % 7) == 0)
+                val = 1.0f;
+            ((float *) buf)[i] = val;
+        } /* if */
+
+        else if (format == AUDIO_S32SYS)
+        {
+            Sint32 val = (Sint32) r;
+            if ((val >> 8) == -8388608)
+                val = -8388607 * 256;
+            else if ((i % 7) == 0)
+                val = 0x7FFFFFFF;
+            ((Sint32 *) buf)[i] = val;
+        } /* else if */
+
+        else
+        {
+            Sint16 val = (Sint16) (r >> 16);
+            if (val == -32768)
+                val = -32767;
+            else if ((i % 7) == 0)
+                val = 32767;
+            ((Sint16 *) buf)[i] = (format == AUDIO_S16SYS) ? val :
+                                    (Sint16) SDL_Swap16((Uint16) val);
+        } /* else */
+    } /* for */
+} /* fill */
+
+
+static int run_test(const ConvertTest *test, Uint32 frames)
+{
+    const Uint32 points = frames * test->channels;
+    const Uint32 len = points * (SDL_AUDIO_BITSIZE(test->format) / 8);
+    Sound_AudioInfo src, dst;
+    Sound_FastConvertFunc fastcvt;
+    SDL_AudioCVT cvt;
+    Uint8 *fast, *slow;
+    Uint32 fastlen;
+    int retval = 0;
+
+    src.format = test->format;
+    src.channels = test->channels;
+    src.rate = 44100;
+    dst.format = AUDIO_S16SYS;
+    dst.channels = test->dst_channels;
+    dst.rate = 44100;
+
+    fastcvt = __Sound_ChooseFastConvert(&src, &dst);
+    if (fastcvt == NULL)
+    {
+        fprintf(stderr, "%s: no fast path.\n", test->name);
+        return 0;
+    } /* if */
+
+    if (SDL_BuildAudioCVT(&cvt, src.format, src.channels, (int) src.rate,
+                          dst.format, dst.channels, (int) dst.rate) < 0)
+    {
+        fprintf(stderr, "%s: SDL_BuildAudioCVT failed: %s\n", test->name, SDL_GetError());
+        return 0;
+    } /* if */
+
+    fast = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    slow = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    if ((fast == NULL) || (slow == NULL))
+    {
+        fprintf(stderr, "%s: out of memory.\n", test->name);
+        SDL_free(fast);
+        SDL_free(slow);
+        return 0;
+    } /* if */
+
+    fill(slow, test->format, points);
+    SDL_memcpy(fast, slow, len);
+
+    cvt.buf = slow;
+    cvt.len = (int) len;
+    fastlen = fastcvt(fast, len);
+
+    if (SDL_ConvertAudio(&cvt) < 0)
+        fprintf(stderr, "%s: SDL_ConvertAudio failed: %s\n", test->name, SDL_GetError());
+    else if (fastlen != (Uint32) cvt.len_cvt)
+        fprintf(stderr, "%s, %u frames: %u bytes out, SDL made %d.\n", test->name, (unsigned int) frames, (unsigned int) fastlen, cvt.len_cvt);
+    else if (SDL_memcmp(fast, slow, fastlen) != 0)
+    {
+        const Sint16 *a = (const Sint16 *) fast;
+        const Sint16 *b = (const Sint16 *) slow;
+        Uint32 i;
+        for (i = 0; a[i] == b[i]; i++) { /* spin */ }
+        fprintf(stderr, "%s, %u frames: point %u is %d, SDL made %d.\n", test->name, (unsigned int) frames, (unsigned int) i, (int) a[i], (int) b[i]);
+    } /* else if */
+    else
+        retval = 1;
+
+    SDL_free(fast);
+    SDL_free(slow);
+    return retval;
+} /* run_test */
+
+
+int main(int argc, char **argv)
+{
+    static const Uint32 lengths[] = { 0, 1, 3, 7, 8, 9, 15, 16, 17, 63, MAX_POINTS / 2 };
+    const size_t numtests = sizeof (tests) / sizeof (tests[0]);
+    const size_t numlengths = sizeof (lengths) / sizeof (lengths[0]);
+    int failed = 0;
+    size_t i, j;
+
+    (void) argc;
+    (void) argv;
+
+    for (i = 0; i < numtests; i++)
+    {
+        for (j = 0; j < numlengths; j++)
+        {
+            if (!run_test(&tests[i], lengths[j]))
+                failed++;
+        } /* for */
+    } /* for */
+
+    if (failed)
+        fprintf(stderr, "%d of %d conversions didn't match.\n", failed, (int) (numtests * numlengths));
+    else
+        printf("All %d conversions match SDL_ConvertAudio().\n", (int) (numtests * numlengths));
+
+    return failed ? 1 : 0;
+} /* main */
+
+/* end of testconvert.c ... */